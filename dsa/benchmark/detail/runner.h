@@ -17,6 +17,7 @@
 #include <thread>
 #include <vector>
 
+#include "../../memory/detail/residency.h"
 #include "core.h"
 #include "statistics.h"
 #include "timer.h"
@@ -36,6 +37,8 @@ struct Config {
     std::size_t repetitions_{1000};
     std::size_t threads_{1};
     bool verbose_{false};
+    // 预缺页运行：mlockall + 栈预触及，并统计计时区间内的缺页
+    bool prefault_{false};
 
     Config& max_time(NanoSeconds v) {
         max_time_ = v;
@@ -72,6 +75,11 @@ struct Config {
         return *this;
     }
 
+    Config& prefault(bool v) {
+        prefault_ = v;
+        return *this;
+    }
+
     static Config quick() noexcept {
         return Config{}.max_time(1e7).warmup(3).max_iterations(1e6).verbose(false);
     }
@@ -83,6 +91,8 @@ struct Config {
     }
 
     static Config concurrent(std::size_t n) noexcept { return Config{}.threads(n).repetitions(3); }
+
+    static Config resident() noexcept { return Config{}.prefault(true); }
 };
 
 // =============================================================================
@@ -144,6 +154,10 @@ public:
         const auto& cfg = bm.config_;
         TscTimer timer;
 
+        if (cfg.prefault_) {
+            make_resident();
+        }
+
         for (std::size_t i = 0; i < cfg.warmup_; ++i) {
             if (bm.init) {
                 bm.init();
@@ -151,7 +165,7 @@ public:
 
             IterationCount cnt = 1;
             if (cfg.threads_ > 1) {
-                run_parallel(bm.func, cnt, cfg.threads_, timer);
+                run_parallel(bm.func, cnt, cfg.threads_, timer, cfg.prefault_);
             } else {
                 bm.func(cnt);
             }
@@ -166,19 +180,30 @@ public:
 
         timer.reset();
         auto iters = determine_iterations(bm, cfg);
+        memory::FaultCounts faults;
 
         for (std::size_t rep = 0; rep < cfg.repetitions_; ++rep) {
             if (bm.init) {
                 bm.init();
             }
 
+            memory::FaultCounts faults_delta;
             if (cfg.threads_ > 1) {
-                run_parallel(bm.func, iters, cfg.threads_, timer);
+                // 基线在工作线程创建并预触及栈之后、开始信号之前采样
+                run_parallel(bm.func, iters, cfg.threads_, timer, cfg.prefault_,
+                             cfg.prefault_ ? &faults_delta : nullptr);
             } else {
+                const auto faults_before =
+                    cfg.prefault_ ? memory::Residency::fault_counts() : memory::FaultCounts{};
                 timer.start();
                 bm.func(iters);
                 timer.stop();
+                if (cfg.prefault_) {
+                    faults_delta = memory::Residency::fault_counts() - faults_before;
+                }
             }
+            faults.minor_ += faults_delta.minor_;
+            faults.major_ += faults_delta.major_;
 
             if (bm.reset) {
                 bm.reset();
@@ -191,7 +216,13 @@ public:
             }
         }
 
-        return analyzer.compute(bm.name_, cfg.threads_);
+        auto stats = analyzer.compute(bm.name_, cfg.threads_);
+        if (cfg.prefault_) {
+            stats.prefaulted_ = true;
+            stats.minor_faults_ = faults.minor_;
+            stats.major_faults_ = faults.major_;
+        }
+        return stats;
     }
 
     std::vector<Statistics> run_all(bool verbose = true) {
@@ -257,8 +288,23 @@ private:
         return std::min(rounded, cfg.max_iterations_);
     }
 
+    /// 锁定全部内存并预触及主线程栈（进程内只执行一次）
+    static void make_resident() {
+        static const bool locked = [] {
+            // RLIMIT_MEMLOCK 受限时只锁定现有映射，避免之后的 mmap 因超限失败
+            const bool ok = memory::Residency::lock_all(memory::Residency::memlock_unlimited());
+            if (!ok) {
+                std::println("[ WARN   ] mlockall failed, falling back to warmup prefault only");
+            }
+            return ok;
+        }();
+        (void)locked;
+        (void)memory::Residency::prefault_stack();
+    }
+
+    /// faults 非空时记录计时窗口内的缺页数：线程创建、栈预触及都在基线之前完成
     void run_parallel(const BenchmarkFunctionT& func, IterationCount& total, std::size_t threads,
-                      TscTimer& timer) {
+                      TscTimer& timer, bool prefault = false, memory::FaultCounts* faults = nullptr) {
         std::vector<std::thread> workers;
         workers.reserve(threads);
 
@@ -268,6 +314,9 @@ private:
 
         for (std::size_t i = 0; i < threads; ++i) {
             workers.emplace_back([&] {
+                if (prefault) {
+                    (void)memory::Residency::prefault_stack();
+                }
                 ready_latch.count_down();  // 1. 表示已准备好
                 start_latch.wait();        // 2. 等待开始信号
 
@@ -278,12 +327,17 @@ private:
         }
 
         ready_latch.wait();  // 等待所有工作线程准备好
+        const auto faults_before = faults ? memory::Residency::fault_counts() : memory::FaultCounts{};
 
         timer.start();             // 先启动计时
         start_latch.count_down();  // 再通知所有工作线程开始
         done_latch.wait();         // 等待所有工作线程完成
         timer.stop();
 
+        if (faults) {  // 在 join（线程退出）之前采样
+            *faults = memory::Residency::fault_counts() - faults_before;
+        }
+
         for (auto& t : workers) t.join();
     }
 
@@ -298,6 +352,9 @@ private:
         if (s.threads_ > 1) {
             std::println("  Threads: {}", s.threads_);
         }
+        if (s.prefaulted_) {
+            std::println("  Page faults (timed): {} minor / {} major", s.minor_faults_, s.major_faults_);
+        }
     }
 
     void print_summary(const std::vector<Statistics>& results) {
@@ -26,6 +26,10 @@ struct Statistics {
     double p25_{0}, p50_{0}, p75_{0}, p90_{0}, p95_{0}, p99_{0}, p999_{0};
     double mean_per_iter_{0}, stddev_per_iter_{0};
 
+    // 计时区间内的缺页数（仅 Config::prefault 开启时统计）
+    bool prefaulted_{false};
+    long minor_faults_{0}, major_faults_{0};
+
     double rsd() const noexcept { return mean_ > 0 ? stddev_ / mean_ * 100.0 : 0.0; }
     double ops_per_second() const noexcept { return mean_per_iter_ > 0 ? 1e9 / mean_per_iter_ : 0.0; }
     double mops() const noexcept { return ops_per_second() / 1e6; }
@@ -0,0 +1,322 @@
+/**
+ * @file fast_copy_benchmark.cpp
+ * @brief fast_copy SIMD memory primitives performance benchmark
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../fast_copy.h"
+
+namespace {
+
+/// 大块缓冲区（多 MB 快照），源/目的各一份
+struct Benchmark_SnapshotBuffer {
+    std::vector<char> src_;
+    std::vector<char> dst_;
+
+    void init(std::size_t bytes = 16 * 1024 * 1024) {
+        src_.assign(bytes, 'x');
+        dst_.assign(bytes, 0);
+    }
+    void reset() {}
+};
+
+}  // namespace
+
+// =============================================================================
+// 大块复制：memcpy vs fast_copy_stream
+// =============================================================================
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(memcpy_16mb, Benchmark_SnapshotBuffer, benchmark::Config::quick(),
+                                 16 * 1024 * 1024) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::memcpy(dst_.data(), src_.data(), src_.size());
+    }
+    DONT_OPTIMIZE(dst_.data());
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(copy_stream_16mb, Benchmark_SnapshotBuffer, benchmark::Config::quick(),
+                                 16 * 1024 * 1024) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+#if defined(__AVX512F__)
+        common::copy_stream_avx512(dst_.data(), src_.data(), src_.size());
+#else
+        common::copy_stream_avx2(dst_.data(), src_.data(), src_.size());
+#endif
+    }
+    DONT_OPTIMIZE(dst_.data());
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(fast_copy_stream_64mb, Benchmark_SnapshotBuffer, benchmark::Config::quick(),
+                                 64 * 1024 * 1024) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        common::fast_copy_stream(dst_.data(), src_.data(), src_.size());
+    }
+    DONT_OPTIMIZE(dst_.data());
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(memset_16mb, Benchmark_SnapshotBuffer, benchmark::Config::quick(),
+                                 16 * 1024 * 1024) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::memset(dst_.data(), 0x5A, dst_.size());
+    }
+    DONT_OPTIMIZE(dst_.data());
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(fill_stream_16mb, Benchmark_SnapshotBuffer, benchmark::Config::quick(),
+                                 16 * 1024 * 1024) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        common::fill_stream(dst_.data(), char{0x5A}, dst_.size());
+    }
+    DONT_OPTIMIZE(dst_.data());
+}
+
+// =============================================================================
+// 热数据保留：大块复制后访问 L2 大小的工作集
+// =============================================================================
+
+namespace {
+
+struct Benchmark_HotWorkingSet : Benchmark_SnapshotBuffer {
+    std::vector<uint64_t> hot_;
+
+    void init(std::size_t bytes = 16 * 1024 * 1024) {
+        Benchmark_SnapshotBuffer::init(bytes);
+        hot_.assign(common::memory_constants::kL2CacheSize / sizeof(uint64_t), 1);
+    }
+
+    uint64_t touch_hot() const {
+        uint64_t sum = 0;
+        for (std::size_t i = 0; i < hot_.size(); i += 8) {
+            sum += hot_[i];
+        }
+        return sum;
+    }
+};
+
+}  // namespace
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(hot_set_after_memcpy, Benchmark_HotWorkingSet, benchmark::Config::quick(),
+                                 16 * 1024 * 1024) {
+    uint64_t sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += touch_hot();
+        std::memcpy(dst_.data(), src_.data(), src_.size());
+        sum += touch_hot();
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(hot_set_after_stream, Benchmark_HotWorkingSet, benchmark::Config::quick(),
+                                 16 * 1024 * 1024) {
+    uint64_t sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += touch_hot();
+        common::copy_stream_avx2(dst_.data(), src_.data(), src_.size());
+        sum += touch_hot();
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+// =============================================================================
+// 比较 / 查找 / 填充 / 判零：与 libc 对比的尺寸扫描
+// =============================================================================
+
+namespace {
+
+/// 两份相同内容的缓冲区，最后一个字节为查找目标
+struct Benchmark_PrimitiveBuffer {
+    std::vector<char> a_;
+    std::vector<char> b_;
+
+    void init(std::size_t bytes) {
+        a_.assign(bytes, 0);
+        b_.assign(bytes, 0);
+        a_.back() = 1;
+        b_.back() = 1;
+    }
+    void reset() {}
+};
+
+}  // namespace
+
+/// 为一个尺寸生成 memcmp/memchr/memset 及对应 SIMD 原语的基准测试
+#define FAST_PRIMITIVE_SWEEP(Suffix, Bytes)                                                                  \
+    BENCHMARK_F_WITH_CONFIG_AND_ARGS(memcmp_##Suffix, Benchmark_PrimitiveBuffer, benchmark::Config::quick(), \
+                                     Bytes) {                                                                \
+        int r = 0;                                                                                           \
+        for (std::size_t i = 0; i < iterations; ++i) {                                                       \
+            r += std::memcmp(a_.data(), b_.data(), a_.size());                                               \
+        }                                                                                                    \
+        DONT_OPTIMIZE(r);                                                                                    \
+    }                                                                                                        \
+    BENCHMARK_F_WITH_CONFIG_AND_ARGS(fast_equal_##Suffix, Benchmark_PrimitiveBuffer,                         \
+                                     benchmark::Config::quick(), Bytes) {                                    \
+        int r = 0;                                                                                           \
+        for (std::size_t i = 0; i < iterations; ++i) {                                                       \
+            r += common::fast_equal(a_.data(), b_.data(), a_.size());                                        \
+        }                                                                                                    \
+        DONT_OPTIMIZE(r);                                                                                    \
+    }                                                                                                        \
+    BENCHMARK_F_WITH_CONFIG_AND_ARGS(memchr_##Suffix, Benchmark_PrimitiveBuffer, benchmark::Config::quick(), \
+                                     Bytes) {                                                                \
+        const void* r = nullptr;                                                                             \
+        for (std::size_t i = 0; i < iterations; ++i) {                                                       \
+            r = std::memchr(a_.data(), 1, a_.size());                                                        \
+            DONT_OPTIMIZE(r);                                                                                \
+        }                                                                                                    \
+    }                                                                                                        \
+    BENCHMARK_F_WITH_CONFIG_AND_ARGS(fast_find_##Suffix, Benchmark_PrimitiveBuffer,                          \
+                                     benchmark::Config::quick(), Bytes) {                                    \
+        std::size_t r = 0;                                                                                   \
+        for (std::size_t i = 0; i < iterations; ++i) {                                                       \
+            r = common::fast_find(a_.data(), a_.size(), char{1});                                            \
+            DONT_OPTIMIZE(r);                                                                                \
+        }                                                                                                    \
+    }                                                                                                        \
+    BENCHMARK_F_WITH_CONFIG_AND_ARGS(memset_##Suffix, Benchmark_PrimitiveBuffer, benchmark::Config::quick(), \
+                                     Bytes) {                                                                \
+        for (std::size_t i = 0; i < iterations; ++i) {                                                       \
+            std::memset(b_.data(), 0, b_.size());                                                            \
+            DONT_OPTIMIZE(b_.data());                                                                        \
+        }                                                                                                    \
+    }                                                                                                        \
+    BENCHMARK_F_WITH_CONFIG_AND_ARGS(fast_fill_##Suffix, Benchmark_PrimitiveBuffer,                          \
+                                     benchmark::Config::quick(), Bytes) {                                    \
+        auto* words = reinterpret_cast<uint64_t*>(b_.data());                                                \
+        for (std::size_t i = 0; i < iterations; ++i) {                                                       \
+            common::fast_fill(words, uint64_t{0}, b_.size() / sizeof(uint64_t));                             \
+            DONT_OPTIMIZE(b_.data());                                                                        \
+        }                                                                                                    \
+    }                                                                                                        \
+    BENCHMARK_F_WITH_CONFIG_AND_ARGS(fast_is_zero_##Suffix, Benchmark_PrimitiveBuffer,                       \
+                                     benchmark::Config::quick(), Bytes) {                                    \
+        int r = 0;                                                                                           \
+        for (std::size_t i = 0; i < iterations; ++i) {                                                       \
+            r += common::fast_is_zero(b_.data(), b_.size());                                                 \
+        }                                                                                                    \
+        DONT_OPTIMIZE(r);                                                                                    \
+    }
+
+FAST_PRIMITIVE_SWEEP(64b, 64)
+FAST_PRIMITIVE_SWEEP(1kb, 1024)
+FAST_PRIMITIVE_SWEEP(64kb, 64 * 1024)
+FAST_PRIMITIVE_SWEEP(1mb, 1024 * 1024)
+
+// =============================================================================
+// 分散/聚集：大量小变长记录
+// =============================================================================
+
+namespace {
+
+/// 模拟一个行情包：4096 条 16~200 字节的记录，分散到各自的目的缓冲区
+struct Benchmark_FeedRecords {
+    std::vector<char> packet_;
+    std::vector<std::vector<char>> books_;
+    std::vector<common::CopyDescriptor> descs_;
+    std::vector<common::MutableSlice> slices_;
+
+    void init(std::size_t records = 4096) {
+        books_.assign(records, std::vector<char>(256, 0));
+        descs_.clear();
+        slices_.clear();
+
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < records; ++i) {
+            total += 16 + (i * 7919) % 185;
+        }
+        packet_.assign(total, 'p');
+
+        std::size_t off = 0;
+        for (std::size_t i = 0; i < records; ++i) {
+            const std::size_t len = 16 + (i * 7919) % 185;
+            // 以交错顺序访问目的缓冲区，模拟按品种分发
+            auto& book = books_[(i * 2654435761u) % records];
+            descs_.push_back({book.data(), packet_.data() + off, len});
+            slices_.push_back({book.data(), len});
+            off += len;
+        }
+    }
+    void reset() {}
+};
+
+}  // namespace
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(memcpy_loop_4096_records, Benchmark_FeedRecords, benchmark::Config::quick(),
+                                 4096) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const auto& d : descs_) {
+            std::memcpy(d.dst_, d.src_, d.len_);
+        }
+    }
+    DONT_OPTIMIZE(books_.data());
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(fast_copy_batch_4096_records, Benchmark_FeedRecords,
+                                 benchmark::Config::quick(), 4096) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        common::fast_copy_batch(descs_.data(), descs_.size());
+    }
+    DONT_OPTIMIZE(books_.data());
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(fast_copy_scatter_4096_records, Benchmark_FeedRecords,
+                                 benchmark::Config::quick(), 4096) {
+    std::size_t bytes = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        bytes += common::fast_copy_scatter(packet_.data(), slices_.data(), slices_.size());
+    }
+    DONT_OPTIMIZE(bytes);
+}
+
+// =============================================================================
+// 复制 + CRC32C：融合 vs 复制后单独校验
+// =============================================================================
+
+/// 为一个尺寸生成 fast_copy + crc32c 两遍与 fast_copy_crc32c 一遍的对比
+#define FAST_COPY_CRC_SWEEP(Suffix, Bytes)                                                                   \
+    BENCHMARK_F_WITH_CONFIG_AND_ARGS(copy_then_crc32c_##Suffix, Benchmark_SnapshotBuffer,                    \
+                                     benchmark::Config::quick(), Bytes) {                                    \
+        uint32_t crc = 0;                                                                                    \
+        for (std::size_t i = 0; i < iterations; ++i) {                                                       \
+            common::fast_copy(dst_.data(), src_.data(), src_.size());                                        \
+            crc = common::crc32c(dst_.data(), dst_.size(), crc);                                             \
+        }                                                                                                    \
+        DONT_OPTIMIZE(crc);                                                                                  \
+    }                                                                                                        \
+    BENCHMARK_F_WITH_CONFIG_AND_ARGS(fast_copy_crc32c_##Suffix, Benchmark_SnapshotBuffer,                    \
+                                     benchmark::Config::quick(), Bytes) {                                    \
+        uint32_t crc = 0;                                                                                    \
+        for (std::size_t i = 0; i < iterations; ++i) {                                                       \
+            crc = common::fast_copy_crc32c(dst_.data(), src_.data(), src_.size(), crc);                      \
+        }                                                                                                    \
+        DONT_OPTIMIZE(crc);                                                                                  \
+    }
+
+FAST_COPY_CRC_SWEEP(256b, 256)
+FAST_COPY_CRC_SWEEP(4kb, 4 * 1024)
+FAST_COPY_CRC_SWEEP(64kb, 64 * 1024)
+FAST_COPY_CRC_SWEEP(4mb, 4 * 1024 * 1024)
+
+// =============================================================================
+// 主函数
+// =============================================================================
+
+int main() {
+    std::cout << "FastCopy Benchmark v" << benchmark::version() << "\n\n";
+    std::cout << "Non-temporal threshold: " << common::non_temporal_threshold() / 1024 << " KB\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("fast_copy_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("fast_copy_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
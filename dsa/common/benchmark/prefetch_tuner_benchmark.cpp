@@ -0,0 +1,182 @@
+/**
+ * @file prefetch_tuner_benchmark.cpp
+ * @brief Prefetch distance: fixed vs calibrated, bulk and indirect traversal
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../prefetch_tuner.h"
+
+namespace {
+
+struct Order {
+    uint64_t id_{0};
+    double price_{1.0};
+    double qty_{2.0};
+    uint64_t flags_{0};
+};
+
+inline double process(const Order& o) noexcept {
+    return o.price_ * o.qty_ + static_cast<double>(o.flags_ & 7);
+}
+
+const common::PrefetchProfile& tuned_profile() {
+    static const common::PrefetchProfile profile = common::PrefetchTuner::calibrate<Order>(process);
+    return profile;
+}
+
+/// 远大于 LLC 的订单数组 + 随机访问索引（间接遍历，硬件预取无效）
+struct Benchmark_OrderBook {
+    std::vector<Order> orders_;
+    std::vector<uint32_t> index_;
+
+    void init(std::size_t count = 4 * 1024 * 1024) {
+        if (orders_.size() == count) {
+            return;  // 每轮重复复用同一份数据，避免重复洗牌
+        }
+        orders_.assign(count, Order{});
+        index_.resize(count);
+        std::iota(index_.begin(), index_.end(), 0u);
+        std::shuffle(index_.begin(), index_.end(), std::mt19937(42));
+    }
+    void reset() {}
+};
+
+const auto kTraversalConfig = benchmark::Config::quick().repetitions(20);
+
+}  // namespace
+
+// =============================================================================
+// 随机间接遍历：无预取 / 固定距离 / 校准距离
+// =============================================================================
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(indirect_no_prefetch, Benchmark_OrderBook, kTraversalConfig,
+                                 4 * 1024 * 1024) {
+    const std::size_t n = index_.size();
+    double sum = 0.0;
+    for (std::size_t it = 0; it < iterations; ++it) {
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += process(orders_[index_[i]]);
+        }
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(indirect_fixed_distance_8, Benchmark_OrderBook, kTraversalConfig,
+                                 4 * 1024 * 1024) {
+    const std::size_t n = index_.size();
+    double sum = 0.0;
+    for (std::size_t it = 0; it < iterations; ++it) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (i + 8 < n) {
+                common::prefetch_read(&orders_[index_[i + 8]]);
+            }
+            sum += process(orders_[index_[i]]);
+        }
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(indirect_tuned_distance, Benchmark_OrderBook, kTraversalConfig,
+                                 4 * 1024 * 1024) {
+    const std::size_t n = index_.size();
+    const std::size_t d = tuned_profile().distance_elements_;
+    double sum = 0.0;
+    for (std::size_t it = 0; it < iterations; ++it) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (i + d < n) {
+                common::prefetch_read(&orders_[index_[i + d]]);
+            }
+            sum += process(orders_[index_[i]]);
+        }
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+// =============================================================================
+// 顺序批量遍历：固定距离 vs 校准距离
+// =============================================================================
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(bulk_no_prefetch, Benchmark_OrderBook, kTraversalConfig,
+                                 4 * 1024 * 1024) {
+    double sum = 0.0;
+    for (std::size_t it = 0; it < iterations; ++it) {
+        for (const auto& o : orders_) {
+            sum += process(o);
+        }
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(bulk_tuned_distance, Benchmark_OrderBook, kTraversalConfig,
+                                 4 * 1024 * 1024) {
+    const auto& profile = tuned_profile();
+    const std::size_t n = orders_.size();
+    double sum = 0.0;
+    for (std::size_t it = 0; it < iterations; ++it) {
+        for (std::size_t i = 0; i < n; ++i) {
+            profile.prefetch(orders_.data(), i, n);
+            sum += process(orders_[i]);
+        }
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+// =============================================================================
+// 环形缓冲区：AdaptivePrefetcher 内置阈值 vs 校准距离
+// =============================================================================
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(ring_adaptive_builtin, Benchmark_OrderBook, kTraversalConfig,
+                                 4 * 1024 * 1024) {
+    common::AdaptivePrefetcher<Order> prefetcher;
+    const std::size_t n = orders_.size();
+    double sum = 0.0;
+    for (std::size_t it = 0; it < iterations; ++it) {
+        for (std::size_t i = 0; i < n; ++i) {
+            prefetcher.prefetch_read_adaptive(orders_.data(), i, n, n - i - 1);
+            sum += process(orders_[i]);
+        }
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(ring_adaptive_tuned, Benchmark_OrderBook, kTraversalConfig,
+                                 4 * 1024 * 1024) {
+    common::AdaptivePrefetcher<Order> prefetcher(tuned_profile().distance_elements_);
+    const std::size_t n = orders_.size();
+    double sum = 0.0;
+    for (std::size_t it = 0; it < iterations; ++it) {
+        for (std::size_t i = 0; i < n; ++i) {
+            prefetcher.prefetch_read_adaptive(orders_.data(), i, n, n - i - 1);
+            sum += process(orders_[i]);
+        }
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+// =============================================================================
+// 主函数
+// =============================================================================
+
+int main() {
+    std::cout << "PrefetchTuner Benchmark v" << benchmark::version() << "\n\n";
+    std::cout << tuned_profile() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("prefetch_tuner_results.json",
+                                          benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("prefetch_tuner_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file seqlock_benchmark.cpp
+ * @brief SeqLock 多读者读取吞吐随写入频率的变化
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "../../benchmark/benchmark.h"
+#include "../seqlock.h"
+
+namespace {
+
+/// 盘口顶档（40 字节）
+struct TopOfBook {
+    double bid_{0}, ask_{0};
+    uint32_t bid_qty_{0}, ask_qty_{0};
+    uint64_t seq_{0};
+    uint64_t ts_{0};
+};
+
+constexpr std::size_t kReaderThreads = 4;
+
+/// 后台写者：每隔 interval_ns 写入一次（0 表示连续写入，kNoWriter 表示不写）
+struct Benchmark_SeqLockWriter {
+    static constexpr uint64_t kNoWriter = ~uint64_t{0};
+
+    common::SeqLock<TopOfBook> book_;
+    std::atomic<bool> stop_{false};
+    std::thread writer_;
+
+    void init(uint64_t interval_ns) {
+        if (interval_ns == kNoWriter) {
+            return;
+        }
+        stop_.store(false, std::memory_order_relaxed);
+        writer_ = std::thread([this, interval_ns] {
+            TopOfBook t{100.0, 100.25, 10, 12, 0, 0};
+            auto next = std::chrono::steady_clock::now();
+            while (!stop_.load(std::memory_order_relaxed)) {
+                ++t.seq_;
+                t.bid_qty_ = static_cast<uint32_t>(t.seq_);
+                book_.store(t);
+                next += std::chrono::nanoseconds(interval_ns);
+                while (interval_ns != 0 && std::chrono::steady_clock::now() < next) {
+                    common::pause();
+                }
+            }
+        });
+    }
+
+    void reset() {
+        stop_.store(true, std::memory_order_relaxed);
+        if (writer_.joinable()) {
+            writer_.join();
+        }
+    }
+
+    void read(benchmark::IterationCount iterations) const {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            const TopOfBook t = book_.load();
+            DONT_OPTIMIZE(t);
+        }
+    }
+};
+
+const auto kReadConfig =
+    benchmark::Config::concurrent(kReaderThreads).max_iterations(1'000'000).repetitions(10);
+const auto kSingleConfig = benchmark::Config::quick().repetitions(20);
+constexpr uint64_t kNoWriter = Benchmark_SeqLockWriter::kNoWriter;
+
+}  // namespace
+
+// =============================================================================
+// 单读者：无写者时的读取开销
+// =============================================================================
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(seqlock_read_1_reader_no_writer, Benchmark_SeqLockWriter, kSingleConfig,
+                                 kNoWriter) {
+    read(iterations);
+}
+
+// =============================================================================
+// 多读者：写入间隔 ∞ / 100us / 10us / 1us / 不间断
+// =============================================================================
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(seqlock_read_4_readers_no_writer, Benchmark_SeqLockWriter, kReadConfig,
+                                 kNoWriter) {
+    read(iterations);
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(seqlock_read_4_readers_write_100us, Benchmark_SeqLockWriter, kReadConfig,
+                                 100'000) {
+    read(iterations);
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(seqlock_read_4_readers_write_10us, Benchmark_SeqLockWriter, kReadConfig,
+                                 10'000) {
+    read(iterations);
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(seqlock_read_4_readers_write_1us, Benchmark_SeqLockWriter, kReadConfig,
+                                 1'000) {
+    read(iterations);
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(seqlock_read_4_readers_write_always, Benchmark_SeqLockWriter, kReadConfig,
+                                 0) {
+    read(iterations);
+}
+
+// =============================================================================
+// 写者开销
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(seqlock_store, benchmark::Config::quick()) {
+    static common::SeqLock<TopOfBook> book;
+    TopOfBook t{100.0, 100.25, 10, 12, 0, 0};
+    for (std::size_t i = 0; i < iterations; ++i) {
+        t.seq_ = i;
+        book.store(t);
+    }
+    DONT_OPTIMIZE(book);
+}
+
+int main() {
+    std::cout << "SeqLock Benchmark v" << benchmark::version() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("seqlock_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("seqlock_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
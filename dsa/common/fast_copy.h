@@ -6,10 +6,16 @@
 #include <xmmintrin.h>
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cstdint>
 #include <cstring>
 #include <type_traits>
 
+#include "../utility/detail/coreDetector.h"
+#include "constants.h"
+#include "intrinsics.h"
+
 namespace common {
 
 template <typename T>
@@ -29,6 +35,14 @@ struct is_simd_friendly
 template <typename T>
 static constexpr bool is_simd_friendly_v = is_simd_friendly<T>::value;
 
+/// 检查类型是否可按字节比较（无填充字节，值相等等价于表示相等；排除浮点 -0.0/NaN）
+template <typename T>
+struct is_bitwise_comparable
+    : std::conjunction<is_simd_friendly<T>, std::has_unique_object_representations<T>> {};
+
+template <typename T>
+static constexpr bool is_bitwise_comparable_v = is_bitwise_comparable<T>::value;
+
 /// batch copy with SIMD avx2
 [[gnu::optimize("Ofast"), gnu::always_inline, gnu::hot, gnu::target("avx2")]]
 static inline void copy_avx2(void* dst, const void* src, std::size_t bytes) noexcept {
@@ -39,15 +53,13 @@ static inline void copy_avx2(void* dst, const void* src, std::size_t bytes) noex
     constexpr std::size_t vec_size = 32;
     const std::size_t vec_count = bytes / vec_size;
 
-    // 安全边界：确保不会读取超出范围
-    // const std::size_t safe_count = (vec_count >= 4) ? vec_count - 4 : 0;
-
     const __m256i* s = static_cast<const __m256i*>(src);
     __m256i* d = static_cast<__m256i*>(dst);
 
     std::size_t i = 0;
     // 使用展开循环，但确保不会越界
-    for (; i + 4 <= vec_count; i += 4) {
+    const std::size_t unrolled = vec_count & ~std::size_t{3};
+    for (; i < unrolled; i += 4) {
         __m256i v0 = _mm256_loadu_si256(s + i);
         __m256i v1 = _mm256_loadu_si256(s + i + 1);
         __m256i v2 = _mm256_loadu_si256(s + i + 2);
@@ -58,8 +70,8 @@ static inline void copy_avx2(void* dst, const void* src, std::size_t bytes) noex
         _mm256_storeu_si256(d + i + 3, v3);
     }
 
-    // 处理剩余完整向量
-    for (; i < vec_count; ++i) {
+    // 处理剩余完整向量（至多 3 个）：按剩余个数计数，BatchSize 为常量时不会生成越界的循环分析
+    for (std::size_t rest = vec_count & 3; rest > 0; --rest, ++i) {
         _mm256_storeu_si256(d + i, _mm256_loadu_si256(s + i));
     }
 
@@ -89,7 +101,8 @@ static inline void copy_sse2(void* dst, const void* src, std::size_t bytes) noex
     __m128i* d = static_cast<__m128i*>(dst);
 
     std::size_t i = 0;
-    for (; i + 4 <= vec_count; i += 4) {
+    const std::size_t unrolled = vec_count & ~std::size_t{3};
+    for (; i < unrolled; i += 4) {
         __m128i v0 = _mm_loadu_si128(s + i);
         __m128i v1 = _mm_loadu_si128(s + i + 1);
         __m128i v2 = _mm_loadu_si128(s + i + 2);
@@ -100,7 +113,7 @@ static inline void copy_sse2(void* dst, const void* src, std::size_t bytes) noex
         _mm_storeu_si128(d + i + 3, v3);
     }
 
-    for (; i < vec_count; ++i) {
+    for (std::size_t rest = vec_count & 3; rest > 0; --rest, ++i) {
         _mm_storeu_si128(d + i, _mm_loadu_si128(s + i));
     }
 
@@ -170,4 +183,880 @@ static inline void fast_copy_batch(T* dst, const T* src) noexcept {
         std::memcpy(dst, src, bytes);
     }
 }
+
+// =============================================================================
+// 分散/聚集批量复制（大量小消息）
+// =============================================================================
+
+/// 复制描述符：(dst, src, len)
+struct CopyDescriptor {
+    void* dst_;
+    const void* src_;
+    std::size_t len_;
+};
+
+/// 只读内存片段（聚集源）
+struct ConstSlice {
+    const void* data_;
+    std::size_t len_;
+};
+
+/// 可写内存片段（分散目的）
+struct MutableSlice {
+    void* data_;
+    std::size_t len_;
+};
+
+/// 单条描述符的源数据预取上限（字节），避免大消息挤占 L1
+static inline constexpr std::size_t kDescriptorPrefetchBytes = 4 * memory_constants::kCacheLineSize;
+
+/// 按尺寸分级的变长复制：<=16 / <=32 / <=64 字节用首尾重叠的寄存器复制，无循环无分支预测失败
+[[gnu::optimize("Ofast"), gnu::always_inline, gnu::hot, gnu::target("avx2")]]
+static inline void copy_sized_avx2(void* dst, const void* src, std::size_t len) noexcept {
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+
+    if (len <= 16) {
+        if (len >= 8) {
+            uint64_t head, tail;
+            std::memcpy(&head, s, 8);
+            std::memcpy(&tail, s + len - 8, 8);
+            std::memcpy(d, &head, 8);
+            std::memcpy(d + len - 8, &tail, 8);
+        } else if (len >= 4) {
+            uint32_t head, tail;
+            std::memcpy(&head, s, 4);
+            std::memcpy(&tail, s + len - 4, 4);
+            std::memcpy(d, &head, 4);
+            std::memcpy(d + len - 4, &tail, 4);
+        } else if (len > 0) {
+            const char first = s[0];
+            const char mid = s[len / 2];
+            const char last = s[len - 1];
+            d[0] = first;
+            d[len / 2] = mid;
+            d[len - 1] = last;
+        }
+        return;
+    }
+
+    if (len <= 32) {
+        __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+        __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + len - 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(d), head);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(d + len - 16), tail);
+        return;
+    }
+
+    if (len <= 64) {
+        __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+        __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + len - 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d), head);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + len - 32), tail);
+        return;
+    }
+
+    if (len <= 4096) {
+        // 整向量部分走 copy_avx2，尾部用一次重叠的向量写入补齐
+        copy_avx2(d, s, len - (len % 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + len - 32),
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + len - 32)));
+        return;
+    }
+
+    std::memcpy(d, s, len);
+}
+
+/// 变长复制分派（编译期选择指令集）
+[[gnu::optimize("Ofast"), gnu::always_inline, gnu::hot, gnu::target("avx2")]]
+static inline void copy_sized(void* dst, const void* src, std::size_t len) noexcept {
+#if defined(__AVX2__)
+    copy_sized_avx2(dst, src, len);
+#else
+    std::memcpy(dst, src, len);
+#endif
+}
+
+/// 按描述符批量复制：处理第 i 条时预取第 i + PrefetchDistance 条的源/目的及其后的描述符
+template <std::size_t PrefetchDistance = 4>
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx2")]]
+static inline void fast_copy_batch(const CopyDescriptor* descs, std::size_t count) noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (i + PrefetchDistance < count) {
+            const CopyDescriptor& ahead = descs[i + PrefetchDistance];
+            aggressive_prefetch(descs, i + PrefetchDistance);
+            prefetch_range(ahead.src_, std::min(ahead.len_, kDescriptorPrefetchBytes));
+            prefetch_write(ahead.dst_);
+        }
+        copy_sized(descs[i].dst_, descs[i].src_, descs[i].len_);
+    }
+}
+
+/// 聚集复制：将 count 个源片段依次写入连续的 dst，返回写入字节数
+template <std::size_t PrefetchDistance = 4>
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx2")]]
+static inline std::size_t fast_copy_gather(void* dst, const ConstSlice* srcs, std::size_t count) noexcept {
+    char* d = static_cast<char*>(dst);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (i + PrefetchDistance < count) {
+            const ConstSlice& ahead = srcs[i + PrefetchDistance];
+            aggressive_prefetch(srcs, i + PrefetchDistance);
+            prefetch_range(ahead.data_, std::min(ahead.len_, kDescriptorPrefetchBytes));
+        }
+        copy_sized(d, srcs[i].data_, srcs[i].len_);
+        d += srcs[i].len_;
+    }
+    return static_cast<std::size_t>(d - static_cast<char*>(dst));
+}
+
+/// 分散复制：将连续的 src 依次切分写入 count 个目的片段，返回读取字节数
+template <std::size_t PrefetchDistance = 4>
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx2")]]
+static inline std::size_t fast_copy_scatter(const void* src, const MutableSlice* dsts, std::size_t count) noexcept {
+    const char* s = static_cast<const char*>(src);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (i + PrefetchDistance < count) {
+            aggressive_prefetch(dsts, i + PrefetchDistance);
+            prefetch_write(dsts[i + PrefetchDistance].data_);
+        }
+        copy_sized(dsts[i].data_, s, dsts[i].len_);
+        s += dsts[i].len_;
+    }
+    return static_cast<std::size_t>(s - static_cast<const char*>(src));
+}
+
+// =============================================================================
+// Non-temporal 流式复制/填充（大块数据，绕过缓存）
+// =============================================================================
+
+/// 流式写入时源数据的预取提前量（字节）
+static inline constexpr std::size_t kStreamPrefetchBytes =
+    memory_constants::kPrefetchDistance * memory_constants::kCacheLineSize;
+
+/// 根据检测到的 L2/L3 大小计算 non-temporal 切换阈值（字节），只在首次调用 non_temporal_threshold() 时执行
+/// 源 + 目的共占用 2 * bytes 缓存，超过单核 L3 份额的一半即会驱逐热数据
+[[gnu::cold, gnu::noinline]]
+inline std::size_t detect_non_temporal_threshold() noexcept {
+    const auto& detector = utils::CoreDetector::instance();
+    std::size_t l2 = 0;
+    std::size_t l3 = 0;
+    for (const auto& cache : detector.get_cache_info()) {
+        if (cache.level_ == 2) {
+            l2 = cache.size_;
+        } else if (cache.level_ == 3) {
+            l3 = cache.size_;
+        }
+    }
+
+    if (l2 == 0) {
+        l2 = memory_constants::kL2CacheSize;
+    }
+    if (l3 == 0) {
+        l3 = memory_constants::kL3CacheSize;
+    }
+
+    const std::size_t nodes = std::max<std::size_t>(1, detector.get_num_of_numa_nodes());
+    const std::size_t cores = std::max<std::size_t>(1, detector.get_num_of_threads() / nodes);
+    return std::max(l2, l3 / cores / 2);
+}
+
+/// non-temporal 切换阈值（字节），首次调用时检测并缓存；每次流式复制/填充都会读取
+[[gnu::always_inline]]
+inline std::size_t non_temporal_threshold() noexcept {
+    static const std::size_t threshold = detect_non_temporal_threshold();
+    return threshold;
+}
+
+/// 流式复制 AVX2：目的地址 32 字节对齐后使用 _mm256_stream_si256，结尾 sfence
+/// 要求 bytes >= 64
+[[gnu::optimize("Ofast"), gnu::always_inline, gnu::hot, gnu::target("avx2")]]
+static inline void copy_stream_avx2(void* dst, const void* src, std::size_t bytes) noexcept {
+    constexpr std::size_t vec_size = 32;
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+
+    // 头部：非对齐写入首个向量，随后从对齐位置开始流式写入
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(d),
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s)));
+    std::size_t i = vec_size - (reinterpret_cast<std::uintptr_t>(d) & (vec_size - 1));
+
+    for (; i + 4 * vec_size <= bytes; i += 4 * vec_size) {
+        prefetch_read(s + i + kStreamPrefetchBytes);
+        prefetch_read(s + i + kStreamPrefetchBytes + 2 * vec_size);
+        __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + vec_size));
+        __m256i v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + 2 * vec_size));
+        __m256i v3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + 3 * vec_size));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + i), v0);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + i + vec_size), v1);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + i + 2 * vec_size), v2);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + i + 3 * vec_size), v3);
+    }
+
+    for (; i + vec_size <= bytes; i += vec_size) {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + i),
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i)));
+    }
+
+    // 尾部：与已写区域重叠的非对齐写入（写入内容相同，顺序无关）
+    if (i < bytes) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + bytes - vec_size),
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + bytes - vec_size)));
+    }
+    sfence();
+}
+
+#if defined(__AVX512F__)
+/// 流式复制 AVX-512：目的地址 64 字节对齐（整缓存行）后使用 _mm512_stream_si512
+/// 要求 bytes >= 128
+[[gnu::optimize("Ofast"), gnu::always_inline, gnu::hot, gnu::target("avx512f")]]
+static inline void copy_stream_avx512(void* dst, const void* src, std::size_t bytes) noexcept {
+    constexpr std::size_t vec_size = 64;
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+
+    _mm512_storeu_si512(d, _mm512_loadu_si512(s));
+    std::size_t i = vec_size - (reinterpret_cast<std::uintptr_t>(d) & (vec_size - 1));
+
+    for (; i + 4 * vec_size <= bytes; i += 4 * vec_size) {
+        prefetch_read(s + i + kStreamPrefetchBytes);
+        prefetch_read(s + i + kStreamPrefetchBytes + vec_size);
+        prefetch_read(s + i + kStreamPrefetchBytes + 2 * vec_size);
+        prefetch_read(s + i + kStreamPrefetchBytes + 3 * vec_size);
+        __m512i v0 = _mm512_loadu_si512(s + i);
+        __m512i v1 = _mm512_loadu_si512(s + i + vec_size);
+        __m512i v2 = _mm512_loadu_si512(s + i + 2 * vec_size);
+        __m512i v3 = _mm512_loadu_si512(s + i + 3 * vec_size);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d + i), v0);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d + i + vec_size), v1);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d + i + 2 * vec_size), v2);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d + i + 3 * vec_size), v3);
+    }
+
+    for (; i + vec_size <= bytes; i += vec_size) {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d + i), _mm512_loadu_si512(s + i));
+    }
+
+    if (i < bytes) {
+        _mm512_storeu_si512(d + bytes - vec_size, _mm512_loadu_si512(s + bytes - vec_size));
+    }
+    sfence();
+}
+#endif
+
+/// 流式填充 AVX2：pattern 为与对齐后目的地址相位一致的 32 字节模式
+/// 调用方负责写入 [dst, align_up(dst, 32)) 头部和不足一个向量的尾部，返回已流式写入的末尾偏移
+[[gnu::optimize("Ofast"), gnu::always_inline, gnu::hot, gnu::target("avx2")]]
+static inline std::size_t fill_stream_avx2(void* dst, __m256i pattern, std::size_t bytes) noexcept {
+    constexpr std::size_t vec_size = 32;
+    char* d = static_cast<char*>(dst);
+
+    std::size_t i = (vec_size - (reinterpret_cast<std::uintptr_t>(d) & (vec_size - 1))) & (vec_size - 1);
+    for (; i + 4 * vec_size <= bytes; i += 4 * vec_size) {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + i), pattern);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + i + vec_size), pattern);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + i + 2 * vec_size), pattern);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + i + 3 * vec_size), pattern);
+    }
+
+    for (; i + vec_size <= bytes; i += vec_size) {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + i), pattern);
+    }
+    sfence();
+    return i;
+}
+
+/// 大块复制，超过 non_temporal_threshold() 时使用 non-temporal 写入，避免驱逐热数据
+template <typename T>
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx2")]]
+static inline void fast_copy_stream(T* dst, const T* src, std::size_t count) noexcept {
+    const std::size_t bytes = count * sizeof(T);
+    if constexpr (!can_memcpy_v<T>) {
+        fast_copy(dst, src, count);
+    } else {
+        if (bytes < non_temporal_threshold()) {
+            fast_copy(dst, src, count);
+            return;
+        }
+
+#if defined(__AVX512F__)
+        copy_stream_avx512(dst, src, bytes);
+#elif defined(__AVX2__)
+        copy_stream_avx2(dst, src, bytes);
+#else
+        std::memcpy(dst, src, bytes);
+#endif
+    }
+}
+
+/// 流式填充任意 SIMD 友好类型，要求 count * sizeof(T) >= 64
+template <typename T>
+[[gnu::optimize("Ofast"), gnu::always_inline, gnu::hot, gnu::target("avx2")]]
+static inline void fill_stream(T* dst, const T& value, std::size_t count) noexcept {
+    static_assert(is_simd_friendly_v<T>, "T must be SIMD friendly for stream fill");
+    constexpr std::size_t vec_size = 32;
+    const std::size_t bytes = count * sizeof(T);
+
+    // 按对齐后目的地址的相位构造 32 字节模式（sizeof(T) 整除 32）
+    const std::size_t head =
+        (vec_size - (reinterpret_cast<std::uintptr_t>(dst) & (vec_size - 1))) & (vec_size - 1);
+    const char* value_bytes = reinterpret_cast<const char*>(&value);
+    alignas(vec_size) char pattern_bytes[vec_size];
+    for (std::size_t b = 0; b < vec_size; ++b) {
+        pattern_bytes[b] = value_bytes[(head + b) % sizeof(T)];
+    }
+    const __m256i pattern = _mm256_load_si256(reinterpret_cast<const __m256i*>(pattern_bytes));
+
+    // 头部元素（可能跨越对齐边界，与流式区域重叠写入相同内容）
+    std::fill_n(dst, (head + sizeof(T) - 1) / sizeof(T), value);
+
+    const std::size_t streamed = fill_stream_avx2(dst, pattern, bytes);
+    const std::size_t tail_first = streamed / sizeof(T);
+    std::fill_n(dst + tail_first, count - tail_first, value);
+}
+
+/// 大块填充，超过 non_temporal_threshold() 时使用 non-temporal 写入
+template <typename T>
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx2")]]
+static inline void fast_fill_stream(T* dst, const T& value, std::size_t count) noexcept {
+    if constexpr (!is_simd_friendly_v<T>) {
+        std::fill_n(dst, count, value);
+    } else {
+        if (count * sizeof(T) < non_temporal_threshold()) {
+            std::fill_n(dst, count, value);
+            return;
+        }
+        fill_stream(dst, value, count);
+    }
+}
+
+// =============================================================================
+// SIMD 内存原语：比较、查找、填充、判零（运行时分派）
+// =============================================================================
+
+/// 运行时检测到的 SIMD 等级（AVX-512 需同时支持 F + BW 以处理字节/字元素）
+enum class SimdLevel : uint8_t { SSE2 = 0, AVX2, AVX512 };
+
+[[gnu::cold]]
+inline SimdLevel detect_simd_level() noexcept {
+    const auto& detector = utils::CoreDetector::instance();
+    if (detector.has(utils::Feature::AVX512F) && detector.has(utils::Feature::AVX512BW)) {
+        return SimdLevel::AVX512;
+    }
+    if (detector.has(utils::Feature::AVX2)) {
+        return SimdLevel::AVX2;
+    }
+    return SimdLevel::SSE2;
+}
+
+/// 缓存的 SIMD 等级，首次调用时检测
+[[gnu::hot, gnu::always_inline]]
+inline SimdLevel simd_level() noexcept {
+    static const SimdLevel level = detect_simd_level();
+    return level;
+}
+
+/// 字节比较 AVX2，要求 bytes >= 32
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx2")]]
+static inline bool equal_avx2(const void* a, const void* b, std::size_t bytes) noexcept {
+    constexpr std::size_t vec_size = 32;
+    const char* pa = static_cast<const char*>(a);
+    const char* pb = static_cast<const char*>(b);
+
+    auto diff = [&](std::size_t off) {
+        return _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pa + off)),
+                                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pb + off)));
+    };
+
+    std::size_t i = 0;
+    for (; i + 4 * vec_size <= bytes; i += 4 * vec_size) {
+        __m256i acc = _mm256_or_si256(_mm256_or_si256(diff(i), diff(i + vec_size)),
+                                      _mm256_or_si256(diff(i + 2 * vec_size), diff(i + 3 * vec_size)));
+        if (!_mm256_testz_si256(acc, acc)) {
+            return false;
+        }
+    }
+    for (; i + vec_size <= bytes; i += vec_size) {
+        __m256i d = diff(i);
+        if (!_mm256_testz_si256(d, d)) {
+            return false;
+        }
+    }
+    if (i < bytes) {
+        __m256i d = diff(bytes - vec_size);
+        return _mm256_testz_si256(d, d);
+    }
+    return true;
+}
+
+/// 字节比较 AVX-512，要求 bytes >= 64
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx512f,avx512bw")]]
+static inline bool equal_avx512(const void* a, const void* b, std::size_t bytes) noexcept {
+    constexpr std::size_t vec_size = 64;
+    const char* pa = static_cast<const char*>(a);
+    const char* pb = static_cast<const char*>(b);
+
+    auto diff = [&](std::size_t off) {
+        return _mm512_xor_si512(_mm512_loadu_si512(pa + off), _mm512_loadu_si512(pb + off));
+    };
+
+    std::size_t i = 0;
+    for (; i + 4 * vec_size <= bytes; i += 4 * vec_size) {
+        __m512i acc = _mm512_or_si512(_mm512_or_si512(diff(i), diff(i + vec_size)),
+                                      _mm512_or_si512(diff(i + 2 * vec_size), diff(i + 3 * vec_size)));
+        if (_mm512_test_epi64_mask(acc, acc) != 0) {
+            return false;
+        }
+    }
+    for (; i + vec_size <= bytes; i += vec_size) {
+        __m512i d = diff(i);
+        if (_mm512_test_epi64_mask(d, d) != 0) {
+            return false;
+        }
+    }
+    if (i < bytes) {
+        __m512i d = diff(bytes - vec_size);
+        return _mm512_test_epi64_mask(d, d) == 0;
+    }
+    return true;
+}
+
+/// 判零 AVX2，要求 bytes >= 32
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx2")]]
+static inline bool is_zero_avx2(const void* data, std::size_t bytes) noexcept {
+    constexpr std::size_t vec_size = 32;
+    const char* p = static_cast<const char*>(data);
+    auto load = [&](std::size_t off) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + off)); };
+
+    std::size_t i = 0;
+    for (; i + 4 * vec_size <= bytes; i += 4 * vec_size) {
+        __m256i acc = _mm256_or_si256(_mm256_or_si256(load(i), load(i + vec_size)),
+                                      _mm256_or_si256(load(i + 2 * vec_size), load(i + 3 * vec_size)));
+        if (!_mm256_testz_si256(acc, acc)) {
+            return false;
+        }
+    }
+    __m256i acc = _mm256_setzero_si256();
+    for (; i + vec_size <= bytes; i += vec_size) {
+        acc = _mm256_or_si256(acc, load(i));
+    }
+    if (i < bytes) {
+        acc = _mm256_or_si256(acc, load(bytes - vec_size));
+    }
+    return _mm256_testz_si256(acc, acc);
+}
+
+/// 判零 AVX-512，要求 bytes >= 64
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx512f")]]
+static inline bool is_zero_avx512(const void* data, std::size_t bytes) noexcept {
+    constexpr std::size_t vec_size = 64;
+    const char* p = static_cast<const char*>(data);
+    auto load = [&](std::size_t off) { return _mm512_loadu_si512(p + off); };
+
+    std::size_t i = 0;
+    for (; i + 4 * vec_size <= bytes; i += 4 * vec_size) {
+        __m512i acc = _mm512_or_si512(_mm512_or_si512(load(i), load(i + vec_size)),
+                                      _mm512_or_si512(load(i + 2 * vec_size), load(i + 3 * vec_size)));
+        if (_mm512_test_epi64_mask(acc, acc) != 0) {
+            return false;
+        }
+    }
+    __m512i acc = _mm512_setzero_si512();
+    for (; i + vec_size <= bytes; i += vec_size) {
+        acc = _mm512_or_si512(acc, load(i));
+    }
+    if (i < bytes) {
+        acc = _mm512_or_si512(acc, load(bytes - vec_size));
+    }
+    return _mm512_test_epi64_mask(acc, acc) == 0;
+}
+
+/// 元素查找 AVX2（元素宽度 1/2/4/8），返回首个匹配下标，未找到返回 count
+template <std::size_t Width>
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx2")]]
+static inline std::size_t find_avx2(const void* data, std::size_t count, uint64_t value) noexcept {
+    static_assert(Width == 1 || Width == 2 || Width == 4 || Width == 8, "unsupported element width");
+    constexpr std::size_t vec_size = 32;
+    constexpr std::size_t lanes = vec_size / Width;
+    const char* p = static_cast<const char*>(data);
+
+    __m256i needle;
+    if constexpr (Width == 1) {
+        needle = _mm256_set1_epi8(static_cast<char>(value));
+    } else if constexpr (Width == 2) {
+        needle = _mm256_set1_epi16(static_cast<short>(value));
+    } else if constexpr (Width == 4) {
+        needle = _mm256_set1_epi32(static_cast<int>(value));
+    } else {
+        needle = _mm256_set1_epi64x(static_cast<long long>(value));
+    }
+
+    auto match = [&](std::size_t idx) -> uint32_t {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + idx * Width));
+        __m256i eq;
+        if constexpr (Width == 1) {
+            eq = _mm256_cmpeq_epi8(v, needle);
+        } else if constexpr (Width == 2) {
+            eq = _mm256_cmpeq_epi16(v, needle);
+        } else if constexpr (Width == 4) {
+            eq = _mm256_cmpeq_epi32(v, needle);
+        } else {
+            eq = _mm256_cmpeq_epi64(v, needle);
+        }
+        return static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+    };
+
+    std::size_t i = 0;
+    for (; i + 2 * lanes <= count; i += 2 * lanes) {
+        const uint32_t m0 = match(i);
+        const uint32_t m1 = match(i + lanes);
+        if ((m0 | m1) != 0) [[unlikely]] {
+            return m0 ? i + std::countr_zero(m0) / Width : i + lanes + std::countr_zero(m1) / Width;
+        }
+    }
+    for (; i + lanes <= count; i += lanes) {
+        if (const uint32_t m = match(i); m != 0) {
+            return i + std::countr_zero(m) / Width;
+        }
+    }
+    if (i < count && count >= lanes) {
+        // 尾部：与已扫描区域重叠的最后一个向量
+        const std::size_t last = count - lanes;
+        if (const uint32_t m = match(last); m != 0) {
+            return last + std::countr_zero(m) / Width;
+        }
+        return count;
+    }
+    for (; i < count; ++i) {
+        if (std::memcmp(p + i * Width, &value, Width) == 0) {
+            return i;
+        }
+    }
+    return count;
+}
+
+/// 元素查找 AVX-512（元素宽度 1/2/4/8），返回首个匹配下标，未找到返回 count
+template <std::size_t Width>
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx512f,avx512bw")]]
+static inline std::size_t find_avx512(const void* data, std::size_t count, uint64_t value) noexcept {
+    static_assert(Width == 1 || Width == 2 || Width == 4 || Width == 8, "unsupported element width");
+    constexpr std::size_t vec_size = 64;
+    constexpr std::size_t lanes = vec_size / Width;
+    const char* p = static_cast<const char*>(data);
+
+    __m512i needle;
+    if constexpr (Width == 1) {
+        needle = _mm512_set1_epi8(static_cast<char>(value));
+    } else if constexpr (Width == 2) {
+        needle = _mm512_set1_epi16(static_cast<short>(value));
+    } else if constexpr (Width == 4) {
+        needle = _mm512_set1_epi32(static_cast<int>(value));
+    } else {
+        needle = _mm512_set1_epi64(static_cast<long long>(value));
+    }
+
+    // 掩码每位对应一个元素
+    auto match = [&](std::size_t idx) -> uint64_t {
+        __m512i v = _mm512_loadu_si512(p + idx * Width);
+        if constexpr (Width == 1) {
+            return _mm512_cmpeq_epi8_mask(v, needle);
+        } else if constexpr (Width == 2) {
+            return _mm512_cmpeq_epi16_mask(v, needle);
+        } else if constexpr (Width == 4) {
+            return _mm512_cmpeq_epi32_mask(v, needle);
+        } else {
+            return _mm512_cmpeq_epi64_mask(v, needle);
+        }
+    };
+
+    std::size_t i = 0;
+    for (; i + lanes <= count; i += lanes) {
+        if (const uint64_t m = match(i); m != 0) {
+            return i + std::countr_zero(m);
+        }
+    }
+    if (i < count && count >= lanes) {
+        const std::size_t last = count - lanes;
+        if (const uint64_t m = match(last); m != 0) {
+            return last + std::countr_zero(m);
+        }
+        return count;
+    }
+    for (; i < count; ++i) {
+        if (std::memcmp(p + i * Width, &value, Width) == 0) {
+            return i;
+        }
+    }
+    return count;
+}
+
+/// 模式填充 AVX2：pattern 为从 dst 起始相位的 32 字节模式，要求 bytes >= 32
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx2")]]
+static inline void fill_avx2(void* dst, const void* pattern, std::size_t bytes) noexcept {
+    constexpr std::size_t vec_size = 32;
+    char* d = static_cast<char*>(dst);
+    const __m256i v = _mm256_loadu_si256(static_cast<const __m256i*>(pattern));
+
+    std::size_t i = 0;
+    for (; i + 4 * vec_size <= bytes; i += 4 * vec_size) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), v);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i + vec_size), v);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i + 2 * vec_size), v);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i + 3 * vec_size), v);
+    }
+    for (; i + vec_size <= bytes; i += vec_size) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), v);
+    }
+    // 尾部不足一个向量，逐字节写入以保持模式相位
+    for (; i < bytes; ++i) {
+        d[i] = static_cast<const char*>(pattern)[i % vec_size];
+    }
+}
+
+/// 模式填充 AVX-512：pattern 为从 dst 起始相位的 64 字节模式，要求 bytes >= 64
+[[gnu::optimize("Ofast"), gnu::hot, gnu::target("avx512f")]]
+static inline void fill_avx512(void* dst, const void* pattern, std::size_t bytes) noexcept {
+    constexpr std::size_t vec_size = 64;
+    char* d = static_cast<char*>(dst);
+    const __m512i v = _mm512_loadu_si512(pattern);
+
+    std::size_t i = 0;
+    for (; i + 4 * vec_size <= bytes; i += 4 * vec_size) {
+        _mm512_storeu_si512(d + i, v);
+        _mm512_storeu_si512(d + i + vec_size, v);
+        _mm512_storeu_si512(d + i + 2 * vec_size, v);
+        _mm512_storeu_si512(d + i + 3 * vec_size, v);
+    }
+    for (; i + vec_size <= bytes; i += vec_size) {
+        _mm512_storeu_si512(d + i, v);
+    }
+    for (; i < bytes; ++i) {
+        d[i] = static_cast<const char*>(pattern)[i % vec_size];
+    }
+}
+
+/// 比较两段数据是否相等（可按字节比较的类型走 SIMD，否则逐元素 operator==）
+template <typename T>
+[[nodiscard, gnu::optimize("Ofast"), gnu::hot]]
+static inline bool fast_equal(const T* a, const T* b, std::size_t count) noexcept {
+    if constexpr (!is_bitwise_comparable_v<T>) {
+        return std::equal(a, a + count, b);
+    } else {
+        const std::size_t bytes = count * sizeof(T);
+        switch (simd_level()) {
+        case SimdLevel::AVX512:
+            if (bytes >= 64) {
+                return equal_avx512(a, b, bytes);
+            }
+            [[fallthrough]];
+        case SimdLevel::AVX2:
+            if (bytes >= 32) {
+                return equal_avx2(a, b, bytes);
+            }
+            [[fallthrough]];
+        default: return bytes == 0 || std::memcmp(a, b, bytes) == 0;
+        }
+    }
+}
+
+/// 查找首个等于 value 的元素下标，未找到返回 count
+/// 元素宽度 1/2/4/8 且可按字节比较时走 SIMD
+template <typename T>
+[[nodiscard, gnu::optimize("Ofast"), gnu::hot]]
+static inline std::size_t fast_find(const T* data, std::size_t count, const T& value) noexcept {
+    if constexpr (!is_bitwise_comparable_v<T> || sizeof(T) > 8) {
+        return static_cast<std::size_t>(std::find(data, data + count, value) - data);
+    } else {
+        uint64_t raw = 0;
+        std::memcpy(&raw, &value, sizeof(T));
+        switch (simd_level()) {
+        case SimdLevel::AVX512: return find_avx512<sizeof(T)>(data, count, raw);
+        case SimdLevel::AVX2: return find_avx2<sizeof(T)>(data, count, raw);
+        default:
+            if constexpr (sizeof(T) == 1) {
+                const void* hit = std::memchr(data, static_cast<int>(raw), count);
+                return hit ? static_cast<std::size_t>(static_cast<const T*>(hit) - data) : count;
+            } else {
+                return static_cast<std::size_t>(std::find(data, data + count, value) - data);
+            }
+        }
+    }
+}
+
+/// 用 value 填充 count 个元素
+template <typename T>
+[[gnu::optimize("Ofast"), gnu::hot]]
+static inline void fast_fill(T* dst, const T& value, std::size_t count) noexcept {
+    if constexpr (!is_simd_friendly_v<T>) {
+        std::fill_n(dst, count, value);
+    } else {
+        const std::size_t bytes = count * sizeof(T);
+        if constexpr (sizeof(T) == 1) {
+            std::memset(dst, static_cast<unsigned char>(reinterpret_cast<const char&>(value)), bytes);
+            return;
+        }
+
+        const SimdLevel level = simd_level();
+        if (level == SimdLevel::SSE2 || bytes < 64) {
+            std::fill_n(dst, count, value);
+            return;
+        }
+
+        // sizeof(T) 整除 64，模式与 dst 起始相位一致
+        alignas(64) char pattern[64];
+        for (std::size_t b = 0; b < sizeof(pattern); b += sizeof(T)) {
+            std::memcpy(pattern + b, &value, sizeof(T));
+        }
+        if (level == SimdLevel::AVX512) {
+            fill_avx512(dst, pattern, bytes);
+        } else {
+            fill_avx2(dst, pattern, bytes);
+        }
+    }
+}
+
+/// 判断数据是否全零（按字节）
+template <typename T>
+[[nodiscard, gnu::optimize("Ofast"), gnu::hot]]
+static inline bool fast_is_zero(const T* data, std::size_t count) noexcept {
+    if constexpr (!is_bitwise_comparable_v<T>) {
+        return std::all_of(data, data + count, [](const T& v) { return v == T{}; });
+    } else {
+        const std::size_t bytes = count * sizeof(T);
+        switch (simd_level()) {
+        case SimdLevel::AVX512:
+            if (bytes >= 64) {
+                return is_zero_avx512(data, bytes);
+            }
+            [[fallthrough]];
+        case SimdLevel::AVX2:
+            if (bytes >= 32) {
+                return is_zero_avx2(data, bytes);
+            }
+            [[fallthrough]];
+        default: {
+            const char* p = reinterpret_cast<const char*>(data);
+            return std::all_of(p, p + bytes, [](char c) { return c == 0; });
+        }
+        }
+    }
+}
+
+// =============================================================================
+// 复制 + CRC32C 融合（一次遍历完成复制与校验）
+// =============================================================================
+
+/// CRC32C (Castagnoli) 反射多项式
+static inline constexpr uint32_t kCrc32cPoly = 0x82F63B78u;
+
+/// CRC32C 查表（软件回退）
+static inline constexpr auto kCrc32cTable = [] {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int k = 0; k < 8; ++k) {
+            crc = (crc >> 1) ^ ((crc & 1u) ? kCrc32cPoly : 0u);
+        }
+        table[i] = crc;
+    }
+    return table;
+}();
+
+/// 软件 CRC32C，crc 为上一次返回值（首次传 0）
+[[nodiscard, gnu::hot]]
+static inline uint32_t crc32c_sw(const void* data, std::size_t bytes, uint32_t crc = 0) noexcept {
+    const auto* p = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+    for (std::size_t i = 0; i < bytes; ++i) {
+        crc = kCrc32cTable[(crc ^ p[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+/// SSE4.2 硬件 CRC32C
+[[nodiscard, gnu::optimize("Ofast"), gnu::hot, gnu::target("sse4.2")]]
+static inline uint32_t crc32c_sse42(const void* data, std::size_t bytes, uint32_t crc = 0) noexcept {
+    const char* p = static_cast<const char*>(data);
+    uint64_t c = ~crc;
+    std::size_t i = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        uint64_t v;
+        std::memcpy(&v, p + i, sizeof(v));
+        c = _mm_crc32_u64(c, v);
+    }
+    uint32_t c32 = static_cast<uint32_t>(c);
+    for (; i < bytes; ++i) {
+        c32 = _mm_crc32_u8(c32, static_cast<uint8_t>(p[i]));
+    }
+    return ~c32;
+}
+
+/// 复制 + CRC32C 融合 AVX2：每个 32 字节向量写出后，立即对刚载入 L1 的同一段数据计算 CRC
+[[nodiscard, gnu::optimize("Ofast"), gnu::hot, gnu::target("avx2,sse4.2")]]
+static inline uint32_t copy_crc32c_avx2(void* dst, const void* src, std::size_t bytes, uint32_t crc = 0) noexcept {
+    constexpr std::size_t vec_size = 32;
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+    uint64_t c = ~crc;
+
+    std::size_t i = 0;
+    for (; i + 2 * vec_size <= bytes; i += 2 * vec_size) {
+        __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + vec_size));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), v0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i + vec_size), v1);
+
+        uint64_t w[8];
+        std::memcpy(w, s + i, sizeof(w));
+        c = _mm_crc32_u64(c, w[0]);
+        c = _mm_crc32_u64(c, w[1]);
+        c = _mm_crc32_u64(c, w[2]);
+        c = _mm_crc32_u64(c, w[3]);
+        c = _mm_crc32_u64(c, w[4]);
+        c = _mm_crc32_u64(c, w[5]);
+        c = _mm_crc32_u64(c, w[6]);
+        c = _mm_crc32_u64(c, w[7]);
+    }
+
+    for (; i + 8 <= bytes; i += 8) {
+        uint64_t w;
+        std::memcpy(&w, s + i, sizeof(w));
+        std::memcpy(d + i, &w, sizeof(w));
+        c = _mm_crc32_u64(c, w);
+    }
+
+    uint32_t c32 = static_cast<uint32_t>(c);
+    for (; i < bytes; ++i) {
+        d[i] = s[i];
+        c32 = _mm_crc32_u8(c32, static_cast<uint8_t>(s[i]));
+    }
+    return ~c32;
+}
+
+/// 计算 CRC32C（SSE4.2 可用时走硬件指令），crc 为上一次返回值（首次传 0）
+[[nodiscard, gnu::hot]]
+static inline uint32_t crc32c(const void* data, std::size_t bytes, uint32_t crc = 0) noexcept {
+    static const bool has_sse42 = utils::CoreDetector::instance().has(utils::Feature::SSE4_2);
+    return has_sse42 ? crc32c_sse42(data, bytes, crc) : crc32c_sw(data, bytes, crc);
+}
+
+/// 复制 count 个元素并返回目的数据的 CRC32C，crc 为上一次返回值（首次传 0）
+/// 用于日志/持久化路径，避免复制后再遍历一遍计算校验
+template <typename T>
+[[nodiscard, gnu::optimize("Ofast"), gnu::hot]]
+static inline uint32_t fast_copy_crc32c(T* dst, const T* src, std::size_t count, uint32_t crc = 0) noexcept {
+    static_assert(can_memcpy_v<T>, "T must be trivially copyable for checksummed copy");
+    static const bool fused =
+        simd_level() != SimdLevel::SSE2 && utils::CoreDetector::instance().has(utils::Feature::SSE4_2);
+
+    const std::size_t bytes = count * sizeof(T);
+    if (fused) {
+        return copy_crc32c_avx2(dst, src, bytes, crc);
+    }
+    if (bytes > 0) {
+        std::memcpy(dst, src, bytes);
+    }
+    return crc32c_sw(dst, bytes, crc);
+}
+
 }  // namespace common
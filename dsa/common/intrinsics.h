@@ -317,11 +317,29 @@ static inline void aggressive_prefetch(const T* base_addr, std::size_t current_i
 template <typename T>
 class AdaptivePrefetcher {
 public:
+    AdaptivePrefetcher() = default;
+
+    /// 使用校准得到的预取距离（元素数，见 PrefetchTuner），0 表示使用内置阈值
+    explicit AdaptivePrefetcher(std::size_t tuned_distance) noexcept : tuned_distance_(tuned_distance) {}
+
+    inline void set_tuned_distance(std::size_t distance) noexcept { tuned_distance_ = distance; }
+    [[nodiscard]] inline std::size_t tuned_distance() const noexcept { return tuned_distance_; }
+
     // 根据数据大小和访问模式动态调整预取距离
     [[gnu::hot, gnu::always_inline, gnu::nonnull(1)]]
     inline void prefetch_read_adaptive(const T* base, std::size_t current_idx, std::size_t capacity,
                                        std::size_t available) {
         assert(capacity > 0 && std::has_single_bit(capacity));
+        // 已校准：流水线式只预取 distance 处的一个元素，更近的元素已由之前的调用预取
+        if (tuned_distance_ > 0) {
+            if (available > 0) {
+                std::size_t distance = available < tuned_distance_ ? available : tuned_distance_;
+                prefetch_read<PrefetchLocality::HighTemporalLocality>(
+                    &base[(current_idx + distance) & (capacity - 1)]);
+            }
+            return;
+        }
+
         // 计算最优预取距离
         std::size_t distance = calculate_prefetch_distance(available);
 
@@ -360,6 +378,8 @@ private:
         }
         return 8;
     }
+
+    std::size_t tuned_distance_{0};
 };
 
 }  // namespace common
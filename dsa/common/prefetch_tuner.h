@@ -0,0 +1,188 @@
+/**
+ * @file prefetch_tuner.h
+ * @brief 软件预取距离自动校准
+ * @version 1.0.0
+ *
+ * 通过短时校准测量本机内存访问延迟与单元素处理开销，推导最优预取距离：
+ *   distance = ceil(内存延迟 / 单元素处理开销)
+ * 即预取请求发出后，恰好在处理完 distance 个元素时数据到达。
+ *
+ * 用法：
+ *   auto profile = PrefetchTuner::calibrate<Order>([](const Order& o) { return o.price_ * o.qty_; });
+ *   AdaptivePrefetcher<Order> ring_prefetcher(profile.distance_elements_);   // 环形缓冲区
+ *   for (i...) { profile.prefetch(orders, i, n); process(orders[i]); }        // 批量遍历
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <ostream>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "../utility/detail/coreDetector.h"
+#include "constants.h"
+#include "intrinsics.h"
+#include "macros.h"
+
+namespace common {
+
+// =============================================================================
+// 校准结果
+// =============================================================================
+
+/// 预取校准结果（周期数均为 TSC 周期）
+struct PrefetchProfile {
+    double memory_latency_cycles_{0.0};  // 单次未命中缓存的访问延迟
+    double element_cost_cycles_{0.0};    // 单元素处理开销（数据在 L1 时）
+    std::size_t element_size_{0};        // 元素大小（字节）
+    std::size_t distance_elements_{1};   // 预取距离（元素数）
+    std::size_t distance_bytes_{0};      // 预取距离（字节，按缓存行向上取整）
+
+    /// 批量遍历中预取第 idx + distance 个元素
+    template <typename T>
+    [[gnu::hot, gnu::always_inline, gnu::nonnull(2)]]
+    inline void prefetch(const T* base, std::size_t idx, std::size_t count) const noexcept {
+        if (idx + distance_elements_ < count) {
+            prefetch_read<PrefetchLocality::HighTemporalLocality>(&base[idx + distance_elements_]);
+        }
+    }
+
+    friend inline std::ostream& operator<<(std::ostream& os, const PrefetchProfile& p) {
+        return os << "PrefetchProfile:\n"
+                  << "  memory_latency: " << p.memory_latency_cycles_ << " cycles\n"
+                  << "  element_cost: " << p.element_cost_cycles_ << " cycles\n"
+                  << "  element_size: " << p.element_size_ << " bytes\n"
+                  << "  distance: " << p.distance_elements_ << " elements / " << p.distance_bytes_
+                  << " bytes";
+    }
+};
+
+// =============================================================================
+// 预取距离校准器
+// =============================================================================
+
+class PrefetchTuner {
+public:
+    /// 预取距离上限：一页，跨页预取收益低且可能触发 TLB 未命中
+    static constexpr std::size_t kMaxDistanceBytes = memory_constants::kPageSize;
+
+    /// 延迟测量缓冲区上限
+    static constexpr std::size_t kMaxLatencyBufferBytes = 128 * 1024 * 1024;
+
+    /// 由延迟与开销推导预取距离（纯函数）
+    [[nodiscard]] static constexpr PrefetchProfile derive(double latency_cycles, double element_cost_cycles,
+                                                          std::size_t element_size) noexcept {
+        PrefetchProfile p;
+        p.memory_latency_cycles_ = latency_cycles;
+        p.element_cost_cycles_ = element_cost_cycles;
+        p.element_size_ = element_size;
+
+        const double cost = element_cost_cycles < 1.0 ? 1.0 : element_cost_cycles;
+        const double ratio = latency_cycles / cost;
+        std::size_t elements = ratio < 1.0 ? 1 : static_cast<std::size_t>(ratio);
+        if (static_cast<double>(elements) < ratio) {
+            ++elements;
+        }
+
+        const std::size_t max_elements =
+            std::max<std::size_t>(1, kMaxDistanceBytes / std::max<std::size_t>(1, element_size));
+        p.distance_elements_ = std::min(elements, max_elements);
+
+        const std::size_t line = memory_constants::kCacheLineSize;
+        const std::size_t bytes = p.distance_elements_ * element_size;
+        p.distance_bytes_ = std::clamp((bytes + line - 1) / line * line, line, kMaxDistanceBytes);
+        return p;
+    }
+
+    /// 默认延迟测量缓冲区：两倍末级缓存，确保指针追逐落在内存上
+    [[nodiscard]] static std::size_t default_latency_buffer_bytes() noexcept {
+        std::size_t llc = memory_constants::kL3CacheSize;
+        for (const auto& cache : utils::CoreDetector::instance().get_cache_info()) {
+            llc = std::max<std::size_t>(llc, cache.size_);
+        }
+        return std::min(2 * llc, kMaxLatencyBufferBytes);
+    }
+
+    /// 测量内存访问延迟（周期）：在随机单环链表上做依赖指针追逐，硬件预取无效
+    [[nodiscard]] static double measure_memory_latency(
+        std::size_t buffer_bytes = default_latency_buffer_bytes(), std::size_t steps = 1 << 16) {
+        struct alignas(memory_constants::kCacheLineSize) Node {
+            Node* next_;
+        };
+
+        const std::size_t n = std::max<std::size_t>(2, buffer_bytes / sizeof(Node));
+        std::vector<Node> nodes(n);
+
+        // Sattolo 算法：生成单个长度为 n 的环
+        std::vector<std::size_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::mt19937_64 rng(0x9E3779B97F4A7C15ULL);
+        for (std::size_t i = n - 1; i > 0; --i) {
+            std::uniform_int_distribution<std::size_t> dist(0, i - 1);
+            std::swap(order[i], order[dist(rng)]);
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            nodes[i].next_ = &nodes[order[i]];
+        }
+
+        // 预热：走一小段，填充 TLB
+        Node* p = &nodes[0];
+        for (std::size_t i = 0; i < std::min<std::size_t>(steps / 8, n); ++i) {
+            p = p->next_;
+        }
+
+        cpuid_serialize();
+        const uint64_t start = rdtsc();
+        for (std::size_t i = 0; i < steps; ++i) {
+            p = p->next_;
+        }
+        const uint64_t end = rdtscp();
+        DONT_OPTIMIZE(p);
+
+        return static_cast<double>(end - start) / static_cast<double>(steps);
+    }
+
+    /// 本机内存延迟（首次调用时测量并缓存）
+    [[nodiscard]] static double memory_latency() {
+        static const double latency = measure_memory_latency();
+        return latency;
+    }
+
+    /// 测量单元素处理开销（周期）：数据驻留 L1，多轮取最小值
+    template <typename T, typename Fn>
+    [[nodiscard]] static double measure_element_cost(Fn&& fn, std::size_t count = 1024,
+                                                     std::size_t rounds = 16) {
+        static_assert(std::is_default_constructible_v<T>, "T must be default constructible for calibration");
+        std::vector<T> data(std::max<std::size_t>(1, count));
+
+        uint64_t best = ~uint64_t{0};
+        for (std::size_t r = 0; r < rounds; ++r) {
+            const uint64_t start = rdtsc();
+            for (const auto& v : data) {
+                if constexpr (std::is_void_v<std::invoke_result_t<Fn&, const T&>>) {
+                    fn(v);
+                } else {
+                    auto result = fn(v);
+                    DONT_OPTIMIZE(result);
+                }
+            }
+            const uint64_t end = rdtscp();
+            best = std::min(best, end - start);
+        }
+        return static_cast<double>(best) / static_cast<double>(data.size());
+    }
+
+    /// 完整校准：本机内存延迟 + 当前负载的单元素开销
+    template <typename T, typename Fn>
+    [[nodiscard]] static PrefetchProfile calibrate(Fn&& fn) {
+        return derive(memory_latency(), measure_element_cost<T>(std::forward<Fn>(fn)), sizeof(T));
+    }
+};
+
+}  // namespace common
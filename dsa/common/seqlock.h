@@ -0,0 +1,130 @@
+/**
+ * @file seqlock.h
+ * @brief 顺序锁：单写多读的小型 POD 状态无撕裂发布
+ * @version 1.0.0
+ *
+ * 适用于一个线程写、多个线程读的小型值（盘口顶档、TscClock 换算系数、统计计数器）：
+ * - 写者: 序号 +1（奇数，写入中）→ 复制负载 → 序号 +1（偶数，稳定）
+ * - 读者: 读序号 → 复制负载 → 复查序号，前后一致且为偶数则副本无撕裂
+ *
+ * x86 TSO 下 StoreStore/LoadLoad 由硬件保证，写端只需 release_fence、读端只需 acquire_fence
+ * 阻止编译器重排，读写两端均无原子读-改-写和硬件屏障。
+ *
+ * 序号与负载位于同一缓存行（读者一次取得），对象按缓存行对齐避免与相邻数据伪共享。
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "constants.h"
+#include "fast_copy.h"
+#include "intrinsics.h"
+
+namespace common {
+
+template <typename T>
+class alignas(memory_constants::kCacheLineSize) SeqLock {
+    static_assert(can_memcpy_v<T>, "SeqLock payload must be trivially copyable");
+
+public:
+    /// load() 默认的最大重试次数（0 表示不限）
+    static constexpr std::size_t kUnboundedRetries = 0;
+
+    constexpr SeqLock() noexcept = default;
+    explicit SeqLock(const T& value) noexcept : value_(value) {}
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    // -------------------------------------------------------------------------
+    // 写者（单线程）
+    // -------------------------------------------------------------------------
+
+    [[gnu::hot]]
+    inline void store(const T& value) noexcept {
+        const uint64_t seq = begin_write();
+        fast_copy(&value_, &value, 1);
+        end_write(seq);
+    }
+
+    /// 原地修改：fn(T&) 在写入区间内执行
+    template <typename Fn>
+    [[gnu::hot]]
+    inline void update(Fn&& fn) noexcept(noexcept(fn(std::declval<T&>()))) {
+        const uint64_t seq = begin_write();
+        fn(value_);
+        end_write(seq);
+    }
+
+    // -------------------------------------------------------------------------
+    // 读者
+    // -------------------------------------------------------------------------
+
+    /// 单次乐观读取：成功返回 true；写入进行中或读取期间发生写入返回 false
+    [[nodiscard, gnu::hot, gnu::always_inline]]
+    inline bool try_load(T& out) const noexcept {
+        const uint64_t before = seq_.load(std::memory_order_relaxed);
+        if (before & 1) [[unlikely]] {
+            return false;
+        }
+        acquire_fence();
+        fast_copy(&out, &value_, 1);
+        acquire_fence();
+        return seq_.load(std::memory_order_relaxed) == before;
+    }
+
+    /// 有界重试读取：最多尝试 max_retries 次（0 表示直到成功），失败返回 false
+    [[nodiscard, gnu::hot]]
+    inline bool load(T& out, std::size_t max_retries) const noexcept {
+        for (std::size_t attempt = 0; max_retries == kUnboundedRetries || attempt < max_retries; ++attempt) {
+            if (try_load(out)) [[likely]] {
+                return true;
+            }
+            pause();
+        }
+        return false;
+    }
+
+    /// 读取直到得到一致副本
+    [[nodiscard, gnu::hot]]
+    inline T load() const noexcept {
+        T out;
+        (void)load(out, kUnboundedRetries);
+        return out;
+    }
+
+    // -------------------------------------------------------------------------
+    // 查询
+    // -------------------------------------------------------------------------
+
+    /// 当前序号（偶数表示稳定，每次写入 +2）
+    [[nodiscard]] inline uint64_t sequence() const noexcept { return seq_.load(std::memory_order_relaxed); }
+
+    /// 完成的写入次数
+    [[nodiscard]] inline uint64_t version() const noexcept { return sequence() >> 1; }
+
+private:
+    [[nodiscard, gnu::always_inline]]
+    inline uint64_t begin_write() noexcept {
+        const uint64_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        // 奇数序号先于负载写入可见
+        release_fence();
+        return seq;
+    }
+
+    [[gnu::always_inline]]
+    inline void end_write(uint64_t seq) noexcept {
+        // 负载写入先于偶数序号可见
+        release_fence();
+        seq_.store(seq + 2, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> seq_{0};
+    T value_{};
+};
+
+}  // namespace common
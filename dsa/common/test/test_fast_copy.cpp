@@ -0,0 +1,345 @@
+/**
+ * @file test_fast_copy.cpp
+ * @brief fast_copy SIMD 内存原语单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../fast_copy.h"
+
+using namespace common;
+
+namespace {
+
+std::vector<uint8_t> make_pattern(std::size_t n) {
+    std::vector<uint8_t> v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        v[i] = static_cast<uint8_t>(i * 131 + 7);
+    }
+    return v;
+}
+
+struct Pod16 {
+    uint32_t a, b, c, d;
+    bool operator==(const Pod16&) const = default;
+};
+
+}  // namespace
+
+// =============================================================================
+// fast_copy 测试
+// =============================================================================
+
+TEST(FastCopy, SizeSweep) {
+    for (std::size_t n : {0, 1, 15, 63, 64, 127, 128, 1000, 4096, 4097, 100000}) {
+        auto src = make_pattern(n);
+        std::vector<uint8_t> dst(n, 0);
+        fast_copy(dst.data(), src.data(), n);
+        EXPECT_TRUE(dst == src);
+    }
+    return true;
+}
+
+TEST(FastCopy, Batch) {
+    std::vector<uint64_t> src(64);
+    std::iota(src.begin(), src.end(), 1);
+    std::vector<uint64_t> dst(64, 0);
+    fast_copy_batch<uint64_t, 64>(dst.data(), src.data());
+    EXPECT_TRUE(dst == src);
+    return true;
+}
+
+// =============================================================================
+// 分散/聚集批量复制测试
+// =============================================================================
+
+TEST(CopySized, AllSizeClasses) {
+    auto src = make_pattern(10000);
+    for (std::size_t n = 0; n <= 300; ++n) {
+        std::vector<uint8_t> dst(n + 1, 0xEE);
+        copy_sized(dst.data(), src.data() + 1, n);
+        EXPECT_TRUE(std::equal(dst.begin(), dst.begin() + n, src.begin() + 1));
+        EXPECT_EQ(dst[n], 0xEE);
+    }
+    for (std::size_t n : {4095, 4096, 4097, 9999}) {
+        std::vector<uint8_t> dst(n, 0);
+        copy_sized(dst.data(), src.data(), n);
+        EXPECT_TRUE(std::equal(dst.begin(), dst.end(), src.begin()));
+    }
+    return true;
+}
+
+TEST(FastCopyBatch, Descriptors) {
+    auto src = make_pattern(64 * 1024);
+    std::vector<uint8_t> dst(64 * 1024, 0);
+    std::vector<CopyDescriptor> descs;
+    std::size_t off = 0;
+    for (std::size_t i = 0; off < src.size(); ++i) {
+        const std::size_t len = std::min<std::size_t>(1 + (i * 37) % 300, src.size() - off);
+        descs.push_back({dst.data() + off, src.data() + off, len});
+        off += len;
+    }
+    fast_copy_batch(descs.data(), descs.size());
+    EXPECT_TRUE(dst == src);
+    return true;
+}
+
+TEST(FastCopyGatherScatter, RoundTrip) {
+    std::vector<std::vector<uint8_t>> records;
+    std::vector<ConstSlice> srcs;
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < 200; ++i) {
+        records.push_back(make_pattern(1 + (i * 13) % 97));
+        srcs.push_back({records.back().data(), records.back().size()});
+        total += records.back().size();
+    }
+
+    std::vector<uint8_t> packed(total, 0);
+    EXPECT_EQ(fast_copy_gather(packed.data(), srcs.data(), srcs.size()), total);
+
+    std::vector<std::vector<uint8_t>> out;
+    std::vector<MutableSlice> dsts;
+    for (const auto& r : records) {
+        out.emplace_back(r.size(), 0);
+    }
+    for (auto& o : out) {
+        dsts.push_back({o.data(), o.size()});
+    }
+    EXPECT_EQ(fast_copy_scatter(packed.data(), dsts.data(), dsts.size()), total);
+    EXPECT_TRUE(out == records);
+    return true;
+}
+
+// =============================================================================
+// 流式复制/填充测试
+// =============================================================================
+
+TEST(FastCopyStream, ThresholdFromCache) {
+    EXPECT_GE(non_temporal_threshold(), memory_constants::kL2CacheSize / 2);
+    EXPECT_EQ(non_temporal_threshold(), non_temporal_threshold());
+    return true;
+}
+
+TEST(FastCopyStream, MisalignedAvx2) {
+    auto src = make_pattern(8192 + 64);
+    for (std::size_t offset : {0, 1, 7, 31, 33}) {
+        for (std::size_t n : {64, 65, 100, 255, 256, 1000, 8192}) {
+            std::vector<uint8_t> dst(n + 64, 0);
+            copy_stream_avx2(dst.data() + offset, src.data() + 3, n);
+            EXPECT_TRUE(std::equal(dst.begin() + offset, dst.begin() + offset + n, src.begin() + 3));
+            EXPECT_EQ(dst[offset + n], 0);
+        }
+    }
+    return true;
+}
+
+#if defined(__AVX512F__)
+TEST(FastCopyStream, MisalignedAvx512) {
+    auto src = make_pattern(8192 + 128);
+    for (std::size_t offset : {0, 1, 17, 63}) {
+        for (std::size_t n : {128, 129, 300, 512, 8191}) {
+            std::vector<uint8_t> dst(n + 128, 0);
+            copy_stream_avx512(dst.data() + offset, src.data() + 5, n);
+            EXPECT_TRUE(std::equal(dst.begin() + offset, dst.begin() + offset + n, src.begin() + 5));
+            EXPECT_EQ(dst[offset + n], 0);
+        }
+    }
+    return true;
+}
+#endif
+
+TEST(FastCopyStream, AboveThreshold) {
+    const std::size_t count = non_temporal_threshold() / sizeof(uint32_t) + 37;
+    std::vector<uint32_t> src(count);
+    std::iota(src.begin(), src.end(), 0u);
+    std::vector<uint32_t> dst(count, 0);
+    fast_copy_stream(dst.data(), src.data(), count);
+    EXPECT_TRUE(dst == src);
+    return true;
+}
+
+TEST(FastFillStream, PatternPhase) {
+    const Pod16 value{1, 2, 3, 4};
+    std::vector<uint8_t> raw(4096 + 64, 0);
+    for (std::size_t offset : {0, 4, 8, 12, 20}) {
+        for (std::size_t count : {4, 5, 17, 100, 255}) {
+            std::fill(raw.begin(), raw.end(), 0);
+            auto* dst = reinterpret_cast<Pod16*>(raw.data() + offset);
+            fill_stream(dst, value, count);
+            bool ok = true;
+            for (std::size_t i = 0; i < count; ++i) {
+                ok = ok && (dst[i] == value);
+            }
+            EXPECT_TRUE(ok);
+            EXPECT_EQ(raw[offset + count * sizeof(Pod16)], 0);
+        }
+    }
+    return true;
+}
+
+TEST(FastFillStream, Bytes) {
+    std::vector<uint8_t> dst(1000 + 3, 0);
+    fill_stream(dst.data() + 3, uint8_t{0xAB}, 1000);
+    EXPECT_EQ(std::count(dst.begin() + 3, dst.end(), 0xAB), 1000);
+    EXPECT_EQ(dst[2], 0);
+
+    std::vector<uint16_t> big(non_temporal_threshold() / sizeof(uint16_t) + 3, 0);
+    fast_fill_stream(big.data(), uint16_t{0x1234}, big.size());
+    EXPECT_EQ(static_cast<std::size_t>(std::count(big.begin(), big.end(), 0x1234)), big.size());
+    return true;
+}
+
+// =============================================================================
+// 比较 / 查找 / 填充 / 判零测试
+// =============================================================================
+
+TEST(FastEqual, SizeSweepWithMismatch) {
+    for (std::size_t n : {0, 1, 31, 32, 33, 64, 65, 200, 4096, 10007}) {
+        auto a = make_pattern(n);
+        auto b = a;
+        EXPECT_TRUE(fast_equal(a.data(), b.data(), n));
+        for (std::size_t pos : {std::size_t{0}, n / 2, n - 1}) {
+            if (n == 0) {
+                continue;
+            }
+            b[pos] ^= 0x10;
+            EXPECT_FALSE(fast_equal(a.data(), b.data(), n));
+            b[pos] ^= 0x10;
+        }
+    }
+    return true;
+}
+
+TEST(FastEqual, Kernels) {
+    auto a = make_pattern(1000);
+    auto b = a;
+    b[999] = ~b[999];
+    EXPECT_TRUE(equal_avx2(a.data(), b.data(), 999));
+    EXPECT_FALSE(equal_avx2(a.data(), b.data(), 1000));
+    if (simd_level() == SimdLevel::AVX512) {
+        EXPECT_TRUE(equal_avx512(a.data(), b.data(), 999));
+        EXPECT_FALSE(equal_avx512(a.data(), b.data(), 1000));
+    }
+    return true;
+}
+
+TEST(FastEqual, NonBitwiseTypes) {
+    std::vector<double> a{0.0, 1.0};
+    std::vector<double> b{-0.0, 1.0};
+    EXPECT_TRUE(fast_equal(a.data(), b.data(), a.size()));
+    return true;
+}
+
+TEST(FastFind, BytesAndWords) {
+    for (std::size_t n : {1, 7, 31, 32, 63, 64, 65, 129, 1000, 4099}) {
+        std::vector<uint8_t> bytes(n, 0);
+        std::vector<uint64_t> words(n, 0);
+        EXPECT_EQ(fast_find(bytes.data(), n, uint8_t{1}), n);
+        EXPECT_EQ(fast_find(words.data(), n, uint64_t{1}), n);
+        for (std::size_t pos : {std::size_t{0}, n / 3, n - 1}) {
+            bytes[pos] = 1;
+            words[pos] = 0xDEADBEEFCAFEULL;
+            EXPECT_EQ(fast_find(bytes.data(), n, uint8_t{1}), pos);
+            EXPECT_EQ(fast_find(words.data(), n, uint64_t{0xDEADBEEFCAFEULL}), pos);
+            bytes[pos] = 0;
+            words[pos] = 0;
+        }
+    }
+    return true;
+}
+
+TEST(FastFind, FirstOfMany) {
+    std::vector<uint32_t> v(500);
+    std::iota(v.begin(), v.end(), 0u);
+    v[300] = 42;
+    EXPECT_EQ(fast_find(v.data(), v.size(), 42u), static_cast<std::size_t>(42));
+    EXPECT_EQ(find_avx2<4>(v.data() + 43, v.size() - 43, 42), static_cast<std::size_t>(300 - 43));
+    std::vector<uint16_t> w(100, 7);
+    EXPECT_EQ(fast_find(w.data(), w.size(), uint16_t{7}), static_cast<std::size_t>(0));
+    return true;
+}
+
+TEST(FastFill, ElementTypes) {
+    for (std::size_t n : {0, 1, 3, 8, 17, 100, 1001}) {
+        std::vector<uint8_t> bytes(n + 1, 0);
+        fast_fill(bytes.data(), uint8_t{9}, n);
+        EXPECT_EQ(static_cast<std::size_t>(std::count(bytes.begin(), bytes.end(), 9)), n);
+
+        std::vector<Pod16> pods(n + 1, Pod16{});
+        fast_fill(pods.data(), Pod16{5, 6, 7, 8}, n);
+        EXPECT_EQ(static_cast<std::size_t>(std::count(pods.begin(), pods.end(), Pod16{5, 6, 7, 8})), n);
+        EXPECT_TRUE(pods[n] == Pod16{});
+    }
+    return true;
+}
+
+TEST(FastIsZero, SizeSweep) {
+    for (std::size_t n : {0, 1, 31, 32, 33, 64, 127, 256, 4097}) {
+        std::vector<uint8_t> v(n, 0);
+        EXPECT_TRUE(fast_is_zero(v.data(), n));
+        if (n > 0) {
+            v[n - 1] = 1;
+            EXPECT_FALSE(fast_is_zero(v.data(), n));
+            v[n - 1] = 0;
+            v[0] = 0x80;
+            EXPECT_FALSE(fast_is_zero(v.data(), n));
+        }
+    }
+    return true;
+}
+
+// =============================================================================
+// 复制 + CRC32C 测试
+// =============================================================================
+
+TEST(Crc32c, KnownVector) {
+    const char msg[] = "123456789";
+    EXPECT_EQ(crc32c_sw(msg, 9), 0xE3069283u);
+    EXPECT_EQ(crc32c(msg, 9), 0xE3069283u);
+    EXPECT_EQ(crc32c(msg, 0), 0u);
+    return true;
+}
+
+TEST(Crc32c, Chaining) {
+    auto data = make_pattern(1000);
+    const uint32_t whole = crc32c(data.data(), data.size());
+    const uint32_t part = crc32c(data.data() + 333, 667, crc32c(data.data(), 333));
+    EXPECT_EQ(whole, part);
+    EXPECT_EQ(crc32c_sw(data.data(), data.size()), whole);
+    return true;
+}
+
+TEST(FastCopyCrc32c, MatchesSeparatePass) {
+    for (std::size_t n : {0, 1, 7, 8, 63, 64, 65, 1000, 4096, 65537}) {
+        auto src = make_pattern(n);
+        std::vector<uint8_t> dst(n + 1, 0);
+        const uint32_t fused = fast_copy_crc32c(dst.data(), src.data(), n);
+        EXPECT_TRUE(std::equal(src.begin(), src.end(), dst.begin()));
+        EXPECT_EQ(dst[n], 0);
+        EXPECT_EQ(fused, crc32c_sw(src.data(), n));
+    }
+    return true;
+}
+
+// =============================================================================
+// 编译时检查
+// =============================================================================
+
+TEST(FastCopy, CompileTimeChecks) {
+    CHECK_COMPILE_TIME(can_memcpy_v<Pod16>);
+    CHECK_COMPILE_TIME(is_simd_friendly_v<Pod16>);
+    CHECK_COMPILE_TIME(!is_simd_friendly_v<std::vector<int>>);
+    CHECK_COMPILE_TIME(is_bitwise_comparable_v<uint64_t>);
+    CHECK_COMPILE_TIME(!is_bitwise_comparable_v<double>);
+    return true;
+}
+
+// =============================================================================
+// 主函数
+// =============================================================================
+
+int main() { return testing::run_all_tests(); }
@@ -0,0 +1,118 @@
+/**
+ * @file test_prefetch_tuner.cpp
+ * @brief PrefetchTuner 预取距离校准单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../prefetch_tuner.h"
+
+using namespace common;
+
+namespace {
+
+struct Order {
+    uint64_t id_{0};
+    double price_{1.0};
+    double qty_{2.0};
+    uint64_t flags_{0};
+};
+
+}  // namespace
+
+TEST(PrefetchTuner, DeriveDistance) {
+    // 延迟 300 周期、每元素 10 周期 → 30 个元素
+    auto p = PrefetchTuner::derive(300.0, 10.0, 32);
+    EXPECT_EQ(p.distance_elements_, 30u);
+    EXPECT_EQ(p.distance_bytes_, 960u);
+    EXPECT_EQ(p.element_size_, 32u);
+
+    // 非整数比值向上取整
+    p = PrefetchTuner::derive(301.0, 10.0, 8);
+    EXPECT_EQ(p.distance_elements_, 31u);
+    EXPECT_EQ(p.distance_bytes_, 256u);
+    return true;
+}
+
+TEST(PrefetchTuner, DeriveClamp) {
+    // 处理开销大于延迟：至少预取下一个元素，至少一条缓存行
+    auto p = PrefetchTuner::derive(100.0, 500.0, 4);
+    EXPECT_EQ(p.distance_elements_, 1u);
+    EXPECT_EQ(p.distance_bytes_, memory_constants::kCacheLineSize);
+
+    // 开销极小：距离不超过一页
+    p = PrefetchTuner::derive(1e6, 0.0, 64);
+    EXPECT_EQ(p.distance_elements_, PrefetchTuner::kMaxDistanceBytes / 64);
+    EXPECT_EQ(p.distance_bytes_, PrefetchTuner::kMaxDistanceBytes);
+
+    // 元素大于一页
+    p = PrefetchTuner::derive(1000.0, 1.0, 8192);
+    EXPECT_EQ(p.distance_elements_, 1u);
+    EXPECT_EQ(p.distance_bytes_, PrefetchTuner::kMaxDistanceBytes);
+    return true;
+}
+
+TEST(PrefetchTuner, DeriveCompileTime) {
+    constexpr auto p = PrefetchTuner::derive(200.0, 4.0, 16);
+    CHECK_COMPILE_TIME(p.distance_elements_ == 50);
+    CHECK_COMPILE_TIME(p.distance_bytes_ == 832);
+    return true;
+}
+
+TEST(PrefetchTuner, MeasureLatency) {
+    // 小缓冲区（L1 内）延迟应明显低于大缓冲区
+    double l1 = PrefetchTuner::measure_memory_latency(16 * 1024, 1 << 14);
+    double mem = PrefetchTuner::measure_memory_latency(64 * 1024 * 1024, 1 << 14);
+    EXPECT_TRUE(l1 > 0.0);
+    EXPECT_TRUE(mem > l1);
+    return true;
+}
+
+TEST(PrefetchTuner, Calibrate) {
+    auto p = PrefetchTuner::calibrate<Order>([](const Order& o) { return o.price_ * o.qty_; });
+    EXPECT_TRUE(p.memory_latency_cycles_ > 0.0);
+    EXPECT_TRUE(p.element_cost_cycles_ > 0.0);
+    EXPECT_EQ(p.element_size_, sizeof(Order));
+    EXPECT_TRUE(p.distance_elements_ >= 1);
+    EXPECT_TRUE(p.distance_bytes_ >= memory_constants::kCacheLineSize);
+    EXPECT_TRUE(p.distance_bytes_ <= PrefetchTuner::kMaxDistanceBytes);
+
+    // 延迟只测量一次
+    EXPECT_EQ(PrefetchTuner::memory_latency(), p.memory_latency_cycles_);
+    return true;
+}
+
+TEST(PrefetchTuner, ProfilePrefetchBounds) {
+    std::vector<Order> orders(64);
+    auto p = PrefetchTuner::derive(160.0, 10.0, sizeof(Order));
+    double sum = 0.0;
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+        p.prefetch(orders.data(), i, orders.size());
+        sum += orders[i].price_;
+    }
+    EXPECT_EQ(sum, 64.0);
+    return true;
+}
+
+TEST(AdaptivePrefetcher, TunedDistance) {
+    AdaptivePrefetcher<Order> legacy;
+    EXPECT_EQ(legacy.tuned_distance(), 0u);
+
+    auto p = PrefetchTuner::derive(160.0, 10.0, sizeof(Order));
+    AdaptivePrefetcher<Order> tuned(p.distance_elements_);
+    EXPECT_EQ(tuned.tuned_distance(), 16u);
+
+    std::vector<Order> ring(64);
+    for (std::size_t i = 0; i < 256; ++i) {
+        tuned.prefetch_read_adaptive(ring.data(), i & 63, ring.size(), 256 - i);
+        legacy.prefetch_read_adaptive(ring.data(), i & 63, ring.size(), 256 - i);
+    }
+    tuned.set_tuned_distance(0);
+    EXPECT_EQ(tuned.tuned_distance(), 0u);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
@@ -0,0 +1,146 @@
+/**
+ * @file benchmark_parallel.cpp
+ * @brief parallel_reduce / parallel_transform 在 1..N 个工作线程上的扩展性（对比 std::execution::par）
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <functional>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/parallel.h"
+#include "../detail/thread_pool.h"
+
+using namespace concurrent;
+
+namespace {
+
+constexpr std::size_t kElements = 1 << 22;
+const auto kConfig = benchmark::Config::quick().max_iterations(1'000);
+
+std::vector<double> g_in(kElements, 1.0);
+std::vector<double> g_out(kElements);
+
+/// 宽度为 workers 的线程池（惰性创建；受候选 CPU 数限制）
+ThreadPool& pool_of(std::size_t workers) {
+    static std::map<std::size_t, std::unique_ptr<ThreadPool>> pools;
+    auto& pool = pools[workers];
+    if (!pool) {
+        pool = std::make_unique<ThreadPool>(
+            ThreadPoolOptions{.placement_ = {.policy_ = PlacementPolicy::AllCpus, .max_workers_ = workers}});
+    }
+    return *pool;
+}
+
+[[gnu::always_inline]] inline double price(double x) { return std::exp(-0.05 * x) * 100.0; }
+
+void reduce_on(std::size_t workers, benchmark::IterationCount iterations) {
+    auto& pool = pool_of(workers);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        double sum = parallel_reduce(pool, std::span<const double>(g_in), 0.0, std::plus<>{});
+        DONT_OPTIMIZE(sum);
+    }
+}
+
+void transform_on(std::size_t workers, benchmark::IterationCount iterations) {
+    auto& pool = pool_of(workers);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        (void)parallel_transform(pool, std::span<const double>(g_in), std::span<double>(g_out), price);
+        DONT_OPTIMIZE(g_out.data());
+    }
+}
+
+}  // namespace
+
+// =============================================================================
+// 归约（4M double）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(reduce_serial_executor, kConfig) {
+    SerialExecutor serial;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        double sum = parallel_reduce(serial, std::span<const double>(g_in), 0.0, std::plus<>{});
+        DONT_OPTIMIZE(sum);
+    }
+}
+
+BENCHMARK_WITH_CONFIG(reduce_pool_1, kConfig) { reduce_on(1, iterations); }
+BENCHMARK_WITH_CONFIG(reduce_pool_2, kConfig) { reduce_on(2, iterations); }
+BENCHMARK_WITH_CONFIG(reduce_pool_4, kConfig) { reduce_on(4, iterations); }
+BENCHMARK_WITH_CONFIG(reduce_pool_8, kConfig) { reduce_on(8, iterations); }
+
+BENCHMARK_WITH_CONFIG(reduce_std_seq, kConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        double sum = std::reduce(std::execution::seq, g_in.begin(), g_in.end(), 0.0);
+        DONT_OPTIMIZE(sum);
+    }
+}
+
+BENCHMARK_WITH_CONFIG(reduce_std_par, kConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        double sum = std::reduce(std::execution::par, g_in.begin(), g_in.end(), 0.0);
+        DONT_OPTIMIZE(sum);
+    }
+}
+
+// =============================================================================
+// 变换（4M double → exp）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(transform_pool_1, kConfig) { transform_on(1, iterations); }
+BENCHMARK_WITH_CONFIG(transform_pool_2, kConfig) { transform_on(2, iterations); }
+BENCHMARK_WITH_CONFIG(transform_pool_4, kConfig) { transform_on(4, iterations); }
+BENCHMARK_WITH_CONFIG(transform_pool_8, kConfig) { transform_on(8, iterations); }
+
+BENCHMARK_WITH_CONFIG(transform_std_par, kConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::transform(std::execution::par, g_in.begin(), g_in.end(), g_out.begin(), price);
+        DONT_OPTIMIZE(g_out.data());
+    }
+}
+
+// =============================================================================
+// 小规模（低于一块）：串行回退开销
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(small_reduce_plain_loop, benchmark::Config::quick()) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < 256; ++k) {
+            sum += g_in[k];
+        }
+        DONT_OPTIMIZE(sum);
+    }
+}
+
+BENCHMARK_WITH_CONFIG(small_reduce_pool, benchmark::Config::quick()) {
+    auto& pool = pool_of(4);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        double sum = parallel_reduce(pool, std::span<const double>(g_in.data(), 256), 0.0, std::plus<>{});
+        DONT_OPTIMIZE(sum);
+    }
+}
+
+int main() {
+    std::cout << "Parallel Benchmark v" << benchmark::version() << "\n\n";
+    std::cout << "Workers (1/2/4/8): " << pool_of(1).size() << "/" << pool_of(2).size() << "/"
+              << pool_of(4).size() << "/" << pool_of(8).size() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("parallel_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("parallel_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
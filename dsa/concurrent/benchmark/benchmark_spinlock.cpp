@@ -0,0 +1,173 @@
+/**
+ * @file benchmark_spinlock.cpp
+ * @brief 自旋锁争用开销：std::mutex / TicketLock / McsLock / RwSpinLock，1~8 线程，绑核与不绑核
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/placement.h"
+#include "../detail/spinlock.h"
+
+using namespace concurrent;
+
+namespace {
+
+/// 临界区：更新两个计数器（约 10ns）
+struct alignas(memory_constants::kCacheLineSize) Shared {
+    uint64_t a_{0};
+    uint64_t b_{0};
+};
+
+Shared g_shared;
+
+std::mutex g_mutex;
+TicketLock<> g_ticket;
+McsLock<> g_mcs;
+RwSpinLock<> g_rw;
+std::shared_mutex g_shared_mutex;
+TicketLock<true> g_ticket_stats;
+McsLock<true> g_mcs_stats;
+
+/// 绑核：每个线程按 AllCpus 放置顺序依次绑定（线程数超过 CPU 数时回绕）
+void pin_current_thread() {
+    static const auto plan = Placement::plan({.policy_ = PlacementPolicy::AllCpus});
+    static std::atomic<std::size_t> next{0};
+    const auto& slot = plan[next.fetch_add(1, std::memory_order_relaxed) % plan.size()];
+    if (slot.cpu_ >= 0) {
+        (void)utils::CpuAffinity::pin_to_cpu(static_cast<std::size_t>(slot.cpu_));
+    }
+}
+
+inline void critical_section() {
+    ++g_shared.a_;
+    ++g_shared.b_;
+    DONT_OPTIMIZE(g_shared);
+}
+
+template <typename Lock>
+void run_lockable(Lock& lock, benchmark::IterationCount iterations, bool pin) {
+    if (pin) {
+        pin_current_thread();
+    }
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::lock_guard<Lock> guard(lock);
+        critical_section();
+    }
+}
+
+template <typename Lock>
+void run_mcs(Lock& lock, benchmark::IterationCount iterations, bool pin) {
+    if (pin) {
+        pin_current_thread();
+    }
+    for (std::size_t i = 0; i < iterations; ++i) {
+        typename Lock::Guard guard(lock);
+        critical_section();
+    }
+}
+
+/// 读多写少：每 16 次一次写
+template <typename Lock>
+void run_read_mostly(Lock& lock, benchmark::IterationCount iterations) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if ((i & 15) == 0) {
+            std::lock_guard<Lock> guard(lock);
+            critical_section();
+        } else {
+            std::shared_lock<Lock> guard(lock);
+            DONT_OPTIMIZE(g_shared.a_);
+        }
+    }
+}
+
+const auto kConfig1 = benchmark::Config::quick();
+const auto kConfig2 = benchmark::Config::concurrent(2).max_iterations(200'000);
+const auto kConfig4 = benchmark::Config::concurrent(4).max_iterations(200'000);
+const auto kConfig8 = benchmark::Config::concurrent(8).max_iterations(200'000);
+
+}  // namespace
+
+// =============================================================================
+// 无争用
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(mutex_1_thread, kConfig1) { run_lockable(g_mutex, iterations, false); }
+BENCHMARK_WITH_CONFIG(ticket_1_thread, kConfig1) { run_lockable(g_ticket, iterations, false); }
+BENCHMARK_WITH_CONFIG(mcs_1_thread, kConfig1) { run_mcs(g_mcs, iterations, false); }
+BENCHMARK_WITH_CONFIG(rw_write_1_thread, kConfig1) { run_lockable(g_rw, iterations, false); }
+
+// =============================================================================
+// 争用：不绑核
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(mutex_2_threads, kConfig2) { run_lockable(g_mutex, iterations, false); }
+BENCHMARK_WITH_CONFIG(ticket_2_threads, kConfig2) { run_lockable(g_ticket, iterations, false); }
+BENCHMARK_WITH_CONFIG(mcs_2_threads, kConfig2) { run_mcs(g_mcs, iterations, false); }
+
+BENCHMARK_WITH_CONFIG(mutex_4_threads, kConfig4) { run_lockable(g_mutex, iterations, false); }
+BENCHMARK_WITH_CONFIG(ticket_4_threads, kConfig4) { run_lockable(g_ticket, iterations, false); }
+BENCHMARK_WITH_CONFIG(mcs_4_threads, kConfig4) { run_mcs(g_mcs, iterations, false); }
+
+BENCHMARK_WITH_CONFIG(mutex_8_threads, kConfig8) { run_lockable(g_mutex, iterations, false); }
+BENCHMARK_WITH_CONFIG(ticket_8_threads, kConfig8) { run_lockable(g_ticket, iterations, false); }
+BENCHMARK_WITH_CONFIG(mcs_8_threads, kConfig8) { run_mcs(g_mcs, iterations, false); }
+
+// =============================================================================
+// 争用：每线程绑定一个 CPU
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(mutex_4_threads_pinned, kConfig4) { run_lockable(g_mutex, iterations, true); }
+BENCHMARK_WITH_CONFIG(ticket_4_threads_pinned, kConfig4) { run_lockable(g_ticket, iterations, true); }
+BENCHMARK_WITH_CONFIG(mcs_4_threads_pinned, kConfig4) { run_mcs(g_mcs, iterations, true); }
+
+// =============================================================================
+// 读多写少
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(shared_mutex_read_mostly_4_threads, kConfig4) {
+    run_read_mostly(g_shared_mutex, iterations);
+}
+BENCHMARK_WITH_CONFIG(rw_spin_read_mostly_4_threads, kConfig4) { run_read_mostly(g_rw, iterations); }
+
+// =============================================================================
+// 统计开销
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(ticket_stats_4_threads, kConfig4) { run_lockable(g_ticket_stats, iterations, false); }
+BENCHMARK_WITH_CONFIG(mcs_stats_4_threads, kConfig4) { run_mcs(g_mcs_stats, iterations, false); }
+
+namespace {
+
+void print_stats(const char* name, const LockStats& s) {
+    const double contended = s.acquisitions_ == 0 ? 0.0 : 100.0 * s.contended_ / s.acquisitions_;
+    const double avg_wait = s.contended_ == 0 ? 0.0 : static_cast<double>(s.spin_cycles_) / s.contended_;
+    std::cout << "  " << name << ": acquisitions=" << s.acquisitions_ << " contended=" << contended
+              << "% avg_wait=" << avg_wait << " cycles max_wait=" << s.max_wait_cycles_ << " cycles\n";
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "SpinLock Benchmark v" << benchmark::version() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    std::cout << "\nContention stats (4 threads):\n";
+    print_stats("ticket", g_ticket_stats.stats());
+    print_stats("mcs", g_mcs_stats.stats());
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("spinlock_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("spinlock_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file benchmark_thread_pool.cpp
+ * @brief ThreadPool 任务提交、批量提交与 parallel_for 开销（对比 std::async 与串行循环）
+ */
+
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <future>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/thread_pool.h"
+
+using concurrent::ThreadPool;
+
+namespace {
+
+constexpr std::size_t kBatch = 1024;
+constexpr std::size_t kElements = 1 << 16;
+
+ThreadPool& pool() {
+    static ThreadPool instance;
+    return instance;
+}
+
+/// 每个元素的计算量（模拟日终重算）
+[[gnu::noinline]] double work(std::size_t i) {
+    double x = static_cast<double>(i);
+    for (int k = 0; k < 16; ++k) {
+        x = std::sqrt(x + 1.0) * 1.0001;
+    }
+    return x;
+}
+
+std::vector<double> g_out(kElements);
+
+}  // namespace
+
+// =============================================================================
+// 单任务提交：提交 kBatch 个空任务后等待完成
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(pool_submit_batch, benchmark::Config::quick().max_iterations(10'000)) {
+    std::atomic<std::size_t> counter{0};
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            pool().submit([&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+        }
+        pool().wait_idle();
+    }
+    DONT_OPTIMIZE(counter);
+}
+
+BENCHMARK_WITH_CONFIG(pool_submit_bulk, benchmark::Config::quick().max_iterations(10'000)) {
+    std::atomic<std::size_t> counter{0};
+    std::vector<std::function<void()>> tasks(kBatch, [&counter] {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    });
+    for (std::size_t i = 0; i < iterations; ++i) {
+        pool().submit_bulk(tasks.begin(), tasks.end());
+        pool().wait_idle();
+    }
+    DONT_OPTIMIZE(counter);
+}
+
+BENCHMARK_WITH_CONFIG(std_async_batch, benchmark::Config::quick().max_iterations(100)) {
+    std::atomic<std::size_t> counter{0};
+    std::vector<std::future<void>> futures;
+    futures.reserve(kBatch);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            futures.push_back(std::async(std::launch::async, [&counter] {
+                counter.fetch_add(1, std::memory_order_relaxed);
+            }));
+        }
+        for (auto& f : futures) {
+            f.get();
+        }
+        futures.clear();
+    }
+    DONT_OPTIMIZE(counter);
+}
+
+// =============================================================================
+// parallel_for vs 串行循环
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(serial_for, benchmark::Config::quick().max_iterations(1'000)) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t k = 0; k < kElements; ++k) {
+            g_out[k] = work(k);
+        }
+        DONT_OPTIMIZE(g_out.data());
+    }
+}
+
+BENCHMARK_WITH_CONFIG(pool_parallel_for, benchmark::Config::quick().max_iterations(1'000)) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        pool().parallel_for(0, kElements, [](std::size_t k) { g_out[k] = work(k); });
+        DONT_OPTIMIZE(g_out.data());
+    }
+}
+
+int main() {
+    std::cout << "ThreadPool Benchmark v" << benchmark::version() << "\n\n";
+    std::cout << "Workers: " << pool().size() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("thread_pool_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("thread_pool_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
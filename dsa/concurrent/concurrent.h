@@ -0,0 +1,17 @@
+/**
+ * @file concurrent.h
+ * @brief 并发执行库主头文件
+ * @version 1.0.0
+ *
+ * 提供工作窃取线程池及其构件（Chase-Lev 双端队列、futex 事件计数器、工作线程放置策略），
+ * 基于可插拔执行器的数据并行算法，以及短临界区使用的自旋锁
+ */
+
+#pragma once
+
+#include "detail/chase_lev_deque.h"
+#include "detail/futex.h"
+#include "detail/parallel.h"
+#include "detail/placement.h"
+#include "detail/spinlock.h"
+#include "detail/thread_pool.h"
@@ -0,0 +1,162 @@
+/**
+ * @file chase_lev_deque.h
+ * @brief Chase-Lev 工作窃取双端队列
+ * @version 1.0.0
+ *
+ * 所有者线程在底部 push/pop（LIFO，缓存局部性好），其他线程从顶部 steal（FIFO，偷走较大的早期任务）。
+ * 内存序参照 Lê 等人的 C11 形式化版本（"Correct and Efficient Work-Stealing for Weak Memory Models"）。
+ *
+ * - 元素为指针（nullptr 表示空）
+ * - 容量不足时所有者线程扩容为两倍；旧数组可能仍被窃取者读取，保留到队列析构时释放
+ * - top/bottom 分处不同缓存行：bottom 由所有者频繁写，top 由窃取者 CAS
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "../../common/constants.h"
+
+namespace concurrent {
+
+using namespace common;
+
+template <typename T>
+class ChaseLevDeque {
+    static_assert(std::is_pointer_v<T>, "ChaseLevDeque stores pointers (nullptr means empty)");
+
+public:
+    static constexpr std::size_t kDefaultCapacity = 1024;
+
+    explicit ChaseLevDeque(std::size_t capacity = kDefaultCapacity) {
+        std::size_t cap = 2;
+        while (cap < capacity) {
+            cap <<= 1;
+        }
+        auto array = std::make_unique<Array>(cap);
+        array_.store(array.get(), std::memory_order_relaxed);
+        arrays_.push_back(std::move(array));
+    }
+
+    ChaseLevDeque(const ChaseLevDeque&) = delete;
+    ChaseLevDeque& operator=(const ChaseLevDeque&) = delete;
+
+    // -------------------------------------------------------------------------
+    // 所有者线程
+    // -------------------------------------------------------------------------
+
+    [[gnu::hot]]
+    inline void push(T item) {
+        const int64_t b = bottom_.load(std::memory_order_relaxed);
+        const int64_t t = top_.load(std::memory_order_acquire);
+        Array* a = array_.load(std::memory_order_relaxed);
+        if (b - t > static_cast<int64_t>(a->mask_)) [[unlikely]] {
+            a = grow(a, t, b);
+        }
+        a->put(b, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+
+    /// 从底部弹出，空时返回 nullptr
+    [[nodiscard, gnu::hot]]
+    inline T pop() noexcept {
+        const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Array* a = array_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T item = a->get(b);
+        if (t == b) {
+            // 最后一个元素：与窃取者竞争
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                              std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // -------------------------------------------------------------------------
+    // 任意线程
+    // -------------------------------------------------------------------------
+
+    /// 从顶部窃取，空或竞争失败时返回 nullptr
+    [[nodiscard, gnu::hot]]
+    inline T steal() noexcept {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) {
+            return nullptr;
+        }
+
+        Array* a = array_.load(std::memory_order_acquire);
+        T item = a->get(t);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    /// 近似元素数
+    [[nodiscard]] inline std::size_t size() const noexcept {
+        const int64_t b = bottom_.load(std::memory_order_relaxed);
+        const int64_t t = top_.load(std::memory_order_relaxed);
+        return b > t ? static_cast<std::size_t>(b - t) : 0;
+    }
+
+    [[nodiscard]] inline bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] inline std::size_t capacity() const noexcept {
+        return array_.load(std::memory_order_relaxed)->mask_ + 1;
+    }
+
+private:
+    struct Array {
+        explicit Array(std::size_t capacity) : mask_(capacity - 1), slots_(new std::atomic<T>[capacity]) {}
+
+        inline T get(int64_t i) const noexcept {
+            return slots_[static_cast<std::size_t>(i) & mask_].load(std::memory_order_relaxed);
+        }
+
+        inline void put(int64_t i, T item) noexcept {
+            slots_[static_cast<std::size_t>(i) & mask_].store(item, std::memory_order_relaxed);
+        }
+
+        const std::size_t mask_;
+        std::unique_ptr<std::atomic<T>[]> slots_;
+    };
+
+    [[gnu::noinline]] Array* grow(Array* old, int64_t t, int64_t b) {
+        auto bigger = std::make_unique<Array>((old->mask_ + 1) * 2);
+        for (int64_t i = t; i < b; ++i) {
+            bigger->put(i, old->get(i));
+        }
+        Array* a = bigger.get();
+        arrays_.push_back(std::move(bigger));
+        array_.store(a, std::memory_order_release);
+        return a;
+    }
+
+    alignas(memory_constants::kCacheLineSize) std::atomic<int64_t> top_{0};
+    alignas(memory_constants::kCacheLineSize) std::atomic<int64_t> bottom_{0};
+    alignas(memory_constants::kCacheLineSize) std::atomic<Array*> array_{nullptr};
+
+    // 所有者线程独占：全部数组（含已被替换的）
+    std::vector<std::unique_ptr<Array>> arrays_;
+};
+
+}  // namespace concurrent
@@ -0,0 +1,92 @@
+/**
+ * @file futex.h
+ * @brief futex 封装与事件计数器（空闲线程休眠/唤醒）
+ * @version 1.0.0
+ *
+ * EventCount 解决"检查条件 → 休眠"之间的丢失唤醒问题：
+ *   auto key = ec.prepare_wait();   // 登记为等待者
+ *   if (has_work()) { ec.cancel_wait(); ... } else { ec.wait(key); }
+ * 通知方在发布工作后调用 notify_one()/notify_all()，没有等待者时不进入内核。
+ */
+
+#pragma once
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+
+#include "../../common/constants.h"
+
+namespace concurrent {
+
+using namespace common;
+
+// =============================================================================
+// futex 系统调用
+// =============================================================================
+
+struct Futex {
+    /// *word == expected 时休眠，直到被唤醒（可能虚假唤醒）
+    static void wait(std::atomic<uint32_t>& word, uint32_t expected) noexcept {
+        auto* addr = reinterpret_cast<uint32_t*>(&word);
+        (void)::syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+    }
+
+    /// 唤醒最多 count 个等待者，返回被唤醒数
+    static int wake(std::atomic<uint32_t>& word, int count) noexcept {
+        auto* addr = reinterpret_cast<uint32_t*>(&word);
+        return static_cast<int>(::syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0));
+    }
+};
+
+// =============================================================================
+// 事件计数器
+// =============================================================================
+
+class EventCount {
+public:
+    /// 登记为等待者并返回当前纪元；之后须调用 wait(key) 或 cancel_wait()
+    [[nodiscard]] inline uint32_t prepare_wait() noexcept {
+        // seq_cst RMW：登记先于调用方复查条件（与 notify 中的纪元递增配对）
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        return epoch_.load(std::memory_order_acquire);
+    }
+
+    inline void cancel_wait() noexcept { waiters_.fetch_sub(1, std::memory_order_relaxed); }
+
+    /// 纪元仍为 key 时休眠
+    inline void wait(uint32_t key) noexcept {
+        while (epoch_.load(std::memory_order_acquire) == key) {
+            Futex::wait(epoch_, key);
+        }
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    inline void notify_one() noexcept { notify(1); }
+    inline void notify_all() noexcept { notify(INT_MAX); }
+
+    [[nodiscard]] inline uint32_t waiters() const noexcept {
+        return waiters_.load(std::memory_order_relaxed);
+    }
+
+private:
+    inline void notify(int count) noexcept {
+        // StoreLoad：发布的工作先于读取等待者数可见（与 prepare_wait 的 seq_cst RMW 配对）；
+        // 没有等待者时不写共享纪元、不进入内核
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+        epoch_.fetch_add(1, std::memory_order_release);
+        (void)Futex::wake(epoch_, count);
+    }
+
+    alignas(memory_constants::kCacheLineSize) std::atomic<uint32_t> epoch_{0};
+    alignas(memory_constants::kCacheLineSize) std::atomic<uint32_t> waiters_{0};
+};
+
+}  // namespace concurrent
@@ -0,0 +1,215 @@
+/**
+ * @file parallel.h
+ * @brief 数据并行算法：parallel_for / parallel_reduce / parallel_transform
+ * @version 1.0.0
+ *
+ * - 执行器可插拔：满足 Executor 概念（size() + parallel_for(begin, end, fn, grain)）即可，
+ *   ThreadPool 与 SerialExecutor 均满足
+ * - 分块大小由 L2 容量（utils::cache_optimal_capacity）推导，块内数据常驻 L2
+ * - 元素数不超过一块或执行器只有一个线程时直接串行执行，不分配任务
+ * - parallel_reduce 的分块只取决于元素数与块大小，块内从左到右累加、块间按固定二叉树合并，
+ *   浮点结果与线程数和调度顺序无关（串行回退得到相同结果）
+ *
+ * 用法：
+ *   ThreadPool pool;
+ *   parallel_transform(pool, std::span<const double>(px), std::span<double>(ret), [](double p) { ... });
+ *   double sum = parallel_reduce(pool, std::span<const double>(ret), 0.0, std::plus<>{});
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "../../utility/detail/core.h"
+
+namespace concurrent {
+
+// =============================================================================
+// 执行器
+// =============================================================================
+
+template <typename E>
+concept Executor = requires(E& e, void (*fn)(std::size_t), std::size_t i) {
+    { e.size() } -> std::convertible_to<std::size_t>;
+    e.parallel_for(i, i, fn, i);
+};
+
+/// 在调用线程上顺序执行
+struct SerialExecutor {
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return 1; }
+
+    template <typename F>
+    static void parallel_for(std::size_t begin, std::size_t end, F&& fn, std::size_t = 0) {
+        for (std::size_t i = begin; i < end; ++i) {
+            fn(i);
+        }
+    }
+};
+
+// =============================================================================
+// 分块
+// =============================================================================
+
+/// 每块元素数：块内每个元素占用 BytesPerElement 字节时，一块占用半个 L2（另一半留给输出与其他数据）
+template <std::size_t BytesPerElement>
+[[nodiscard]] constexpr std::size_t chunk_elements() noexcept {
+    struct alignas(1) Element {
+        unsigned char bytes_[BytesPerElement];
+    };
+    return std::max<std::size_t>(1, utils::cache_optimal_capacity<Element>(utils::CacheLevel::L2) / 2);
+}
+
+/// 下标区间的默认块大小（按每个下标访问一个 double 估计）
+inline constexpr std::size_t kDefaultIndexGrain = chunk_elements<sizeof(double)>();
+
+namespace detail {
+
+[[nodiscard]] constexpr std::size_t num_chunks(std::size_t n, std::size_t grain) noexcept {
+    return (n + grain - 1) / grain;
+}
+
+/// 按块执行 chunk(begin, end)；单块或单线程时在调用线程上执行
+template <Executor E, typename ChunkFn>
+void for_each_chunk(E& exec, std::size_t begin, std::size_t end, std::size_t grain, ChunkFn&& chunk) {
+    const std::size_t n = end - begin;
+    const std::size_t chunks = num_chunks(n, grain);
+    if (chunks <= 1 || exec.size() <= 1) {
+        for (std::size_t c = 0; c < chunks; ++c) {
+            const std::size_t lo = begin + c * grain;
+            chunk(lo, std::min(end, lo + grain));
+        }
+        return;
+    }
+
+    exec.parallel_for(
+        0, chunks,
+        [&](std::size_t c) {
+            const std::size_t lo = begin + c * grain;
+            chunk(lo, std::min(end, lo + grain));
+        },
+        1);
+}
+
+/// 固定形状的二叉树合并：第 k 轮合并下标相差 2^k 的部分和，结果与执行顺序无关
+template <typename V, typename Combine>
+[[nodiscard]] V tree_combine(std::span<V> partials, Combine& combine) {
+    const std::size_t k = partials.size();
+    for (std::size_t step = 1; step < k; step <<= 1) {
+        for (std::size_t i = 0; i + step < k; i += step << 1) {
+            partials[i] = combine(std::move(partials[i]), std::move(partials[i + step]));
+        }
+    }
+    return std::move(partials[0]);
+}
+
+}  // namespace detail
+
+// =============================================================================
+// parallel_for
+// =============================================================================
+
+/// 对 [begin, end) 的每个下标调用 fn(i)。元素数不超过 grain 时串行执行；
+/// 否则在块数少于线程数时缩小块，使每个线程都有工作
+template <Executor E, typename F>
+void parallel_for(E& exec, std::size_t begin, std::size_t end, F&& fn,
+                  std::size_t grain = kDefaultIndexGrain) {
+    if (begin >= end) {
+        return;
+    }
+    const std::size_t n = end - begin;
+    const std::size_t workers = exec.size();
+    if (n <= grain || workers <= 1) [[likely]] {
+        for (std::size_t i = begin; i < end; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    grain = std::clamp<std::size_t>((n + workers - 1) / workers, 1, grain);
+    detail::for_each_chunk(exec, begin, end, grain, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i) {
+            fn(i);
+        }
+    });
+}
+
+/// 对 data 的每个元素调用 fn(T&)；块大小由 L2 容量与 sizeof(T) 决定
+template <Executor E, typename T, std::size_t Extent, typename F>
+void parallel_for(E& exec, std::span<T, Extent> data, F&& fn) {
+    parallel_for(exec, 0, data.size(), [&](std::size_t i) { fn(data[i]); }, chunk_elements<sizeof(T)>());
+}
+
+// =============================================================================
+// parallel_transform
+// =============================================================================
+
+/// out[i] = fn(in[i])；out 短于 in 时返回 false 且不写入
+template <Executor E, typename In, std::size_t InExtent, typename Out, std::size_t OutExtent, typename F>
+bool parallel_transform(E& exec, std::span<In, InExtent> in, std::span<Out, OutExtent> out, F&& fn) {
+    if (out.size() < in.size()) {
+        return false;
+    }
+    parallel_for(
+        exec, 0, in.size(), [&](std::size_t i) { out[i] = fn(in[i]); },
+        chunk_elements<sizeof(In) + sizeof(Out)>());
+    return true;
+}
+
+// =============================================================================
+// parallel_reduce
+// =============================================================================
+
+/// 归约 map(i)，i ∈ [begin, end)，结果为 combine(init, 各块结果的树形合并)。
+/// 每块以 map(lo) 为初值从左到右累加（无需单位元）；grain 固定时结果确定，与执行器线程数无关。
+/// V 须可默认构造（存放各块结果）
+template <Executor E, typename V, typename Map, typename Combine>
+[[nodiscard]] V parallel_reduce(E& exec, std::size_t begin, std::size_t end, V init, Map&& map,
+                                Combine&& combine, std::size_t grain = kDefaultIndexGrain) {
+    if (begin >= end) {
+        return init;
+    }
+    grain = std::max<std::size_t>(1, grain);
+    auto reduce_chunk = [&](std::size_t lo, std::size_t hi) {
+        V acc = map(lo);
+        for (std::size_t i = lo + 1; i < hi; ++i) {
+            acc = combine(std::move(acc), map(i));
+        }
+        return acc;
+    };
+
+    const std::size_t chunks = detail::num_chunks(end - begin, grain);
+    if (chunks == 1) [[likely]] {
+        return combine(std::move(init), reduce_chunk(begin, end));
+    }
+
+    // 每块一个独立对象：std::vector<bool> 按位打包，多线程写相邻元素会竞争同一个字
+    const auto partials = std::make_unique<V[]>(chunks);
+    detail::for_each_chunk(exec, begin, end, grain, [&](std::size_t lo, std::size_t hi) {
+        partials[(lo - begin) / grain] = reduce_chunk(lo, hi);
+    });
+    return combine(std::move(init), detail::tree_combine(std::span<V>(partials.get(), chunks), combine));
+}
+
+/// 归约 data 的全部元素；块大小由 L2 容量与 sizeof(T) 决定
+template <Executor E, typename T, std::size_t Extent, typename V, typename Combine>
+[[nodiscard]] V parallel_reduce(E& exec, std::span<T, Extent> data, V init, Combine&& combine) {
+    return parallel_reduce(
+        exec, 0, data.size(), std::move(init), [&](std::size_t i) -> V { return data[i]; }, combine,
+        chunk_elements<sizeof(T)>());
+}
+
+/// 先变换再归约：combine(init, transform(data[0]), ...)
+template <Executor E, typename T, std::size_t Extent, typename V, typename Combine, typename Transform>
+[[nodiscard]] V parallel_transform_reduce(E& exec, std::span<T, Extent> data, V init, Combine&& combine,
+                                          Transform&& transform) {
+    auto map = [&](std::size_t i) -> V { return transform(data[i]); };
+    return parallel_reduce(exec, 0, data.size(), std::move(init), map, combine, chunk_elements<sizeof(T)>());
+}
+
+}  // namespace concurrent
@@ -0,0 +1,156 @@
+/**
+ * @file placement.h
+ * @brief 工作线程放置策略：按物理核心 / NUMA 节点分配 CPU
+ * @version 1.0.0
+ *
+ * 候选 CPU = 进程亲和性 ∩ 在线 CPU − 隔离 CPU（可选）− 调用方保留的 CPU（延迟敏感线程所在核心）
+ * - PhysicalCores: 每个物理核心只放一个工作线程（不与超线程兄弟争抢执行单元）；
+ *   保留或隔离 CPU 所在物理核心的其他超线程兄弟也不使用
+ * - AllCpus: 每个候选逻辑 CPU 一个工作线程
+ * - Unpinned: 不绑核，线程数取候选 CPU 数
+ *
+ * 结果按 NUMA 节点分组、组内按 CPU 编号排序；限制线程数时在节点间轮流选取，保持各节点均衡。
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <vector>
+
+#include "../../utility/detail/coreAffinity.h"
+#include "../../utility/detail/coreDetector.h"
+
+namespace concurrent {
+
+enum class PlacementPolicy : uint8_t {
+    Unpinned,       // 不绑核
+    PhysicalCores,  // 每物理核心一个
+    AllCpus,        // 每逻辑 CPU 一个
+};
+
+/// 单个工作线程的放置
+struct WorkerPlacement {
+    int32_t cpu_{-1};  // -1 表示不绑核
+    int32_t node_{0};  // 所属 NUMA 节点
+};
+
+struct PlacementOptions {
+    PlacementPolicy policy_{PlacementPolicy::PhysicalCores};
+    std::size_t max_workers_{0};  // 0 表示不限
+    bool avoid_isolated_{true};   // 排除 isolcpus 指定的 CPU
+    utils::CpuSet reserved_{};    // 额外排除的 CPU（如行情/交易线程所在核心）
+};
+
+/// 放置所需的 CPU 拓扑；detect() 读取本机，测试可直接构造
+struct PlacementTopology {
+    std::set<int32_t> online_;
+    std::set<int32_t> isolated_;
+    std::vector<std::set<int32_t>> nodes_;           // 每个 NUMA 节点的逻辑 CPU
+    std::vector<std::set<int32_t>> physical_cores_;  // 每项为同一物理核心的超线程兄弟
+    std::optional<utils::CpuSet> affinity_;          // 进程亲和性，无值表示不限制
+
+    [[nodiscard]] static PlacementTopology detect() {
+        const auto& detector = utils::CoreDetector::instance();
+        return {detector.get_online_cpus(), detector.get_isolated_cpus(), detector.get_cpulists(),
+                detector.get_physical_cores(), utils::CpuAffinity::get_process_affinity()};
+    }
+
+    /// 逻辑 CPU 所属 NUMA 节点（无 NUMA 信息时为 0）
+    [[nodiscard]] std::size_t node_of(int32_t cpu) const noexcept {
+        return utils::CoreDetector::node_of_cpu(nodes_, cpu);
+    }
+};
+
+struct Placement {
+    /// 计算工作线程放置；候选为空时返回一个不绑核的工作线程
+    [[nodiscard]] static std::vector<WorkerPlacement> plan(const PlacementOptions& opts) {
+        return plan(opts, PlacementTopology::detect());
+    }
+
+    [[nodiscard]] static std::vector<WorkerPlacement> plan(const PlacementOptions& opts,
+                                                           const PlacementTopology& topo) {
+        const std::set<int32_t> candidates = candidate_cpus(opts, topo);
+
+        // 1. 每个节点的候选 CPU
+        const std::size_t num_nodes = std::max<std::size_t>(1, topo.nodes_.size());
+        std::vector<std::vector<int32_t>> per_node(num_nodes);
+        if (opts.policy_ == PlacementPolicy::PhysicalCores) {
+            for (const auto& core : topo.physical_cores_) {
+                // 任一超线程兄弟被保留或隔离时整个物理核心不可用，否则取第一个候选逻辑 CPU
+                if (std::ranges::any_of(core, [&](int32_t cpu) { return excluded(opts, topo, cpu); })) {
+                    continue;
+                }
+                for (int32_t cpu : core) {
+                    if (candidates.contains(cpu)) {
+                        per_node[topo.node_of(cpu)].push_back(cpu);
+                        break;
+                    }
+                }
+            }
+        } else {
+            for (int32_t cpu : candidates) {
+                per_node[topo.node_of(cpu)].push_back(cpu);
+            }
+        }
+
+        // 2. 节点间轮流选取，直到达到上限
+        std::size_t total = 0;
+        for (auto& cpus : per_node) {
+            std::sort(cpus.begin(), cpus.end());
+            total += cpus.size();
+        }
+        const std::size_t limit = opts.max_workers_ == 0 ? total : std::min(total, opts.max_workers_);
+
+        std::vector<std::size_t> taken(num_nodes, 0);
+        for (std::size_t picked = 0, round = 0; picked < limit; ++round) {
+            for (std::size_t n = 0; n < num_nodes && picked < limit; ++n) {
+                if (round < per_node[n].size()) {
+                    ++taken[n];
+                    ++picked;
+                }
+            }
+        }
+
+        std::vector<WorkerPlacement> out;
+        out.reserve(limit);
+        for (std::size_t n = 0; n < num_nodes; ++n) {
+            for (std::size_t i = 0; i < taken[n]; ++i) {
+                const int32_t cpu = opts.policy_ == PlacementPolicy::Unpinned ? -1 : per_node[n][i];
+                out.push_back({cpu, static_cast<int32_t>(n)});
+            }
+        }
+
+        if (out.empty()) {
+            out.push_back({-1, 0});
+        }
+        return out;
+    }
+
+private:
+    /// 调用方保留或（按选项）被隔离的 CPU：其超线程兄弟也不能放工作线程
+    [[nodiscard]] static bool excluded(const PlacementOptions& opts, const PlacementTopology& topo,
+                                       int32_t cpu) noexcept {
+        return opts.reserved_.contains(static_cast<std::size_t>(cpu)) ||
+               (opts.avoid_isolated_ && topo.isolated_.contains(cpu));
+    }
+
+    static std::set<int32_t> candidate_cpus(const PlacementOptions& opts, const PlacementTopology& topo) {
+        std::set<int32_t> out;
+        for (int32_t cpu : topo.online_) {
+            if (topo.affinity_ && !topo.affinity_->contains(static_cast<std::size_t>(cpu))) {
+                continue;
+            }
+            if (excluded(opts, topo, cpu)) {
+                continue;
+            }
+            out.insert(cpu);
+        }
+        return out;
+    }
+};
+
+}  // namespace concurrent
@@ -0,0 +1,434 @@
+/**
+ * @file spinlock.h
+ * @brief 自旋锁：票据锁、MCS 队列锁、写者优先读写自旋锁
+ * @version 1.0.0
+ *
+ * 面向绑核线程上的短临界区（几十到几百纳秒），避免 std::mutex 的 futex 路径：
+ * - TicketLock: FIFO 公平；按前方排队人数比例退避
+ * - McsLock: 每个等待者在自己的节点（独占缓存行）上自旋，释放时只写后继节点，
+ *   锁字只在入队/出队时被写一次，无全局缓存行颠簸
+ * - RwSpinLock: 写者优先，写者登记后新读者不再进入，避免写者饥饿
+ *
+ * 等待使用 SpinWait 分阶段退避（cpu_constants::kSpinPhase*）：pause → 批量 pause → yield → 短休眠。
+ * 模板参数 CollectStats 为 true 时记录获取次数、争用次数、等待周期（rdtsc）与最大等待，
+ * 为 false 时计数器为空类型，无任何开销。
+ *
+ * TicketLock/RwSpinLock 满足 Lockable（可用于 std::lock_guard / std::unique_lock / std::shared_lock）。
+ */
+
+#pragma once
+
+#include <sched.h>
+#include <time.h>
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include "../../common/constants.h"
+#include "../../common/intrinsics.h"
+
+namespace concurrent {
+
+using namespace common;
+
+// =============================================================================
+// 分阶段退避
+// =============================================================================
+
+class SpinWait {
+public:
+    /// 批量 pause 阶段每次执行的 pause 数
+    static constexpr int kBatchPauses = 4;
+
+    /// 等待一次，并推进到下一阶段
+    inline void spin() noexcept {
+        if (count_ < cpu_constants::kSpinPhase1) {
+            common::pause();
+        } else if (count_ < cpu_constants::kSpinPhase2) {
+            for (int i = 0; i < kBatchPauses; ++i) {
+                common::pause();
+            }
+        } else if (count_ < cpu_constants::kSpinPhase3) {
+            ::sched_yield();
+        } else {
+            // 最后阶段：短休眠 kSpinPhase4 纳秒，让出 CPU 给持锁者
+            const struct timespec ts{0, cpu_constants::kSpinPhase4};
+            ::nanosleep(&ts, nullptr);
+        }
+        if (count_ < cpu_constants::kSpinPhase3) {
+            ++count_;
+        }
+    }
+
+    /// 是否仍处于纯自旋阶段（未让出 CPU）
+    [[nodiscard]] inline bool spinning() const noexcept { return count_ < cpu_constants::kSpinPhase2; }
+
+    inline void reset() noexcept { count_ = 0; }
+
+private:
+    int count_{0};
+};
+
+// =============================================================================
+// 争用统计
+// =============================================================================
+
+struct LockStats {
+    uint64_t acquisitions_{0};     // 获取次数（含读锁）
+    uint64_t contended_{0};        // 首次尝试失败、需要等待的次数
+    uint64_t spin_cycles_{0};      // 等待总周期（rdtsc）
+    uint64_t max_wait_cycles_{0};  // 单次最大等待周期
+};
+
+namespace detail {
+
+template <bool Enabled>
+class LockCounters;
+
+/// 关闭统计：全部为空操作
+template <>
+class LockCounters<false> {
+public:
+    [[gnu::always_inline]] static inline uint64_t begin_wait() noexcept { return 0; }
+    [[gnu::always_inline]] static inline void acquired() noexcept {}
+    [[gnu::always_inline]] static inline void acquired_after(uint64_t) noexcept {}
+    [[nodiscard]] static inline LockStats snapshot() noexcept { return {}; }
+    static inline void reset() noexcept {}
+};
+
+/// 开启统计：读锁可并发获取，计数器使用 relaxed 原子操作
+template <>
+class LockCounters<true> {
+public:
+    [[gnu::always_inline]] static inline uint64_t begin_wait() noexcept { return rdtsc(); }
+
+    [[gnu::always_inline]] inline void acquired() noexcept {
+        acquisitions_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    inline void acquired_after(uint64_t start) noexcept {
+        const uint64_t waited = rdtsc() - start;
+        acquisitions_.fetch_add(1, std::memory_order_relaxed);
+        contended_.fetch_add(1, std::memory_order_relaxed);
+        spin_cycles_.fetch_add(waited, std::memory_order_relaxed);
+
+        uint64_t max = max_wait_cycles_.load(std::memory_order_relaxed);
+        while (waited > max &&
+               !max_wait_cycles_.compare_exchange_weak(max, waited, std::memory_order_relaxed)) {
+        }
+    }
+
+    [[nodiscard]] inline LockStats snapshot() const noexcept {
+        return {acquisitions_.load(std::memory_order_relaxed), contended_.load(std::memory_order_relaxed),
+                spin_cycles_.load(std::memory_order_relaxed),
+                max_wait_cycles_.load(std::memory_order_relaxed)};
+    }
+
+    inline void reset() noexcept {
+        acquisitions_.store(0, std::memory_order_relaxed);
+        contended_.store(0, std::memory_order_relaxed);
+        spin_cycles_.store(0, std::memory_order_relaxed);
+        max_wait_cycles_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> acquisitions_{0};
+    std::atomic<uint64_t> contended_{0};
+    std::atomic<uint64_t> spin_cycles_{0};
+    std::atomic<uint64_t> max_wait_cycles_{0};
+};
+
+}  // namespace detail
+
+// =============================================================================
+// 票据锁
+// =============================================================================
+
+template <bool CollectStats = false>
+class alignas(memory_constants::kCacheLineSize) TicketLock {
+public:
+    TicketLock() noexcept = default;
+    TicketLock(const TicketLock&) = delete;
+    TicketLock& operator=(const TicketLock&) = delete;
+
+    [[gnu::hot]]
+    inline void lock() noexcept {
+        const uint32_t ticket = next_.fetch_add(1, std::memory_order_relaxed);
+        uint32_t serving = serving_.load(std::memory_order_acquire);
+        if (serving == ticket) [[likely]] {
+            counters_.acquired();
+            return;
+        }
+
+        const uint64_t start = counters_.begin_wait();
+        SpinWait wait;
+        while (serving != ticket) {
+            // 比例退避：自旋阶段前方每多一人多一个 pause；之后按分阶段退避让出 CPU
+            const uint32_t ahead = ticket - serving;
+            for (uint32_t i = 1; i < ahead && wait.spinning(); ++i) {
+                common::pause();
+            }
+            wait.spin();
+            serving = serving_.load(std::memory_order_acquire);
+        }
+        counters_.acquired_after(start);
+    }
+
+    [[nodiscard, gnu::hot]]
+    inline bool try_lock() noexcept {
+        uint32_t serving = serving_.load(std::memory_order_relaxed);
+        uint32_t expected = serving;
+        if (next_.compare_exchange_strong(expected, serving + 1, std::memory_order_acquire,
+                                          std::memory_order_relaxed)) {
+            counters_.acquired();
+            return true;
+        }
+        return false;
+    }
+
+    [[gnu::hot]]
+    inline void unlock() noexcept {
+        // 仅持锁者写 serving_
+        serving_.store(serving_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    [[nodiscard]] inline bool is_locked() const noexcept {
+        return next_.load(std::memory_order_relaxed) != serving_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] inline LockStats stats() const noexcept { return counters_.snapshot(); }
+    inline void reset_stats() noexcept { counters_.reset(); }
+
+private:
+    std::atomic<uint32_t> next_{0};
+    std::atomic<uint32_t> serving_{0};
+    [[no_unique_address]] detail::LockCounters<CollectStats> counters_;
+};
+
+// =============================================================================
+// MCS 队列锁
+// =============================================================================
+
+template <bool CollectStats = false>
+class McsLock {
+public:
+    /// 排队节点：由调用方提供（通常在栈上），持锁期间不可移动
+    struct alignas(memory_constants::kCacheLineSize) Node {
+        std::atomic<Node*> next_{nullptr};
+        std::atomic<bool> locked_{false};
+    };
+
+    /// 作用域守卫：节点位于守卫内部
+    class Guard {
+    public:
+        explicit Guard(McsLock& lock) noexcept : lock_(lock) { lock_.lock(node_); }
+        ~Guard() { lock_.unlock(node_); }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        McsLock& lock_;
+        Node node_;
+    };
+
+    McsLock() noexcept = default;
+    McsLock(const McsLock&) = delete;
+    McsLock& operator=(const McsLock&) = delete;
+
+    [[gnu::hot]]
+    inline void lock(Node& node) noexcept {
+        node.next_.store(nullptr, std::memory_order_relaxed);
+        node.locked_.store(true, std::memory_order_relaxed);
+
+        Node* prev = tail_.exchange(&node, std::memory_order_acq_rel);
+        if (prev == nullptr) [[likely]] {
+            counters_.acquired();
+            return;
+        }
+
+        const uint64_t start = counters_.begin_wait();
+        prev->next_.store(&node, std::memory_order_release);
+        SpinWait wait;
+        while (node.locked_.load(std::memory_order_acquire)) {
+            wait.spin();
+        }
+        counters_.acquired_after(start);
+    }
+
+    [[nodiscard, gnu::hot]]
+    inline bool try_lock(Node& node) noexcept {
+        node.next_.store(nullptr, std::memory_order_relaxed);
+        node.locked_.store(false, std::memory_order_relaxed);
+        Node* expected = nullptr;
+        if (tail_.compare_exchange_strong(expected, &node, std::memory_order_acq_rel,
+                                          std::memory_order_relaxed)) {
+            counters_.acquired();
+            return true;
+        }
+        return false;
+    }
+
+    [[gnu::hot]]
+    inline void unlock(Node& node) noexcept {
+        Node* next = node.next_.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            Node* expected = &node;
+            if (tail_.compare_exchange_strong(expected, nullptr, std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+                return;
+            }
+            // 后继已入队但尚未链接
+            while ((next = node.next_.load(std::memory_order_acquire)) == nullptr) {
+                common::pause();
+            }
+        }
+        next->locked_.store(false, std::memory_order_release);
+    }
+
+    [[nodiscard]] inline bool is_locked() const noexcept {
+        return tail_.load(std::memory_order_relaxed) != nullptr;
+    }
+
+    [[nodiscard]] inline LockStats stats() const noexcept { return counters_.snapshot(); }
+    inline void reset_stats() noexcept { counters_.reset(); }
+
+private:
+    alignas(memory_constants::kCacheLineSize) std::atomic<Node*> tail_{nullptr};
+    [[no_unique_address]] detail::LockCounters<CollectStats> counters_;
+};
+
+// =============================================================================
+// 写者优先读写自旋锁
+// =============================================================================
+
+/// 状态字：bit0 写者持有，bit1 写者等待，其余位为读者数
+template <bool CollectStats = false>
+class alignas(memory_constants::kCacheLineSize) RwSpinLock {
+public:
+    static constexpr uint32_t kWriter = 1;
+    static constexpr uint32_t kWriterPending = 2;
+    static constexpr uint32_t kReader = 4;
+
+    RwSpinLock() noexcept = default;
+    RwSpinLock(const RwSpinLock&) = delete;
+    RwSpinLock& operator=(const RwSpinLock&) = delete;
+
+    // -------------------------------------------------------------------------
+    // 写者
+    // -------------------------------------------------------------------------
+
+    [[gnu::hot]]
+    inline void lock() noexcept {
+        if (try_lock_writer()) [[likely]] {
+            counters_.acquired();
+            return;
+        }
+
+        const uint64_t start = counters_.begin_wait();
+        SpinWait wait;
+        while (true) {
+            uint32_t state = state_.load(std::memory_order_relaxed);
+            if ((state & ~kWriterPending) == 0) {
+                // 无读者、无写者：占有并清除等待位（其他等待的写者会重新置位）
+                if (state_.compare_exchange_weak(state, kWriter, std::memory_order_acquire,
+                                                 std::memory_order_relaxed)) {
+                    break;
+                }
+                continue;
+            }
+            if ((state & kWriterPending) == 0) {
+                // 登记等待，阻止新读者进入
+                state_.fetch_or(kWriterPending, std::memory_order_relaxed);
+            }
+            wait.spin();
+        }
+        counters_.acquired_after(start);
+    }
+
+    [[nodiscard, gnu::hot]]
+    inline bool try_lock() noexcept {
+        if (try_lock_writer()) {
+            counters_.acquired();
+            return true;
+        }
+        return false;
+    }
+
+    [[gnu::hot]]
+    inline void unlock() noexcept { state_.fetch_and(~kWriter, std::memory_order_release); }
+
+    // -------------------------------------------------------------------------
+    // 读者
+    // -------------------------------------------------------------------------
+
+    [[gnu::hot]]
+    inline void lock_shared() noexcept {
+        if (try_lock_reader()) [[likely]] {
+            counters_.acquired();
+            return;
+        }
+
+        const uint64_t start = counters_.begin_wait();
+        SpinWait wait;
+        do {
+            wait.spin();
+        } while (!try_lock_reader());
+        counters_.acquired_after(start);
+    }
+
+    [[nodiscard, gnu::hot]]
+    inline bool try_lock_shared() noexcept {
+        if (try_lock_reader()) {
+            counters_.acquired();
+            return true;
+        }
+        return false;
+    }
+
+    [[gnu::hot]]
+    inline void unlock_shared() noexcept { state_.fetch_sub(kReader, std::memory_order_release); }
+
+    // -------------------------------------------------------------------------
+    // 查询
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline uint32_t readers() const noexcept {
+        return state_.load(std::memory_order_relaxed) / kReader;
+    }
+
+    [[nodiscard]] inline bool writer_active() const noexcept {
+        return (state_.load(std::memory_order_relaxed) & kWriter) != 0;
+    }
+
+    [[nodiscard]] inline LockStats stats() const noexcept { return counters_.snapshot(); }
+    inline void reset_stats() noexcept { counters_.reset(); }
+
+private:
+    [[nodiscard, gnu::always_inline]]
+    inline bool try_lock_writer() noexcept {
+        uint32_t expected = 0;
+        return state_.compare_exchange_strong(expected, kWriter, std::memory_order_acquire,
+                                              std::memory_order_relaxed);
+    }
+
+    /// 有写者持有或等待时不进入；加计数后发现写者抢先则撤销
+    [[nodiscard, gnu::always_inline]]
+    inline bool try_lock_reader() noexcept {
+        if (state_.load(std::memory_order_relaxed) & (kWriter | kWriterPending)) {
+            return false;
+        }
+        const uint32_t prev = state_.fetch_add(kReader, std::memory_order_acquire);
+        if (prev & kWriter) [[unlikely]] {
+            state_.fetch_sub(kReader, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    std::atomic<uint32_t> state_{0};
+    [[no_unique_address]] detail::LockCounters<CollectStats> counters_;
+};
+
+}  // namespace concurrent
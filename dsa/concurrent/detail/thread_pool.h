@@ -0,0 +1,414 @@
+/**
+ * @file thread_pool.h
+ * @brief 拓扑感知的工作窃取线程池
+ * @version 1.0.0
+ *
+ * - 每个工作线程一个 Chase-Lev 双端队列；工作线程内提交的任务压入自身队列底部
+ * - 外部线程提交的任务进入注入队列（互斥锁保护，批量提交只加锁一次）
+ * - 取任务顺序: 自身队列 → 注入队列 → 同 NUMA 节点窃取 → 跨节点窃取
+ * - 空闲线程先自旋若干轮，再通过 EventCount（futex）休眠；提交方在无等待者时不进入内核
+ * - 工作线程按 PlacementOptions 绑核（默认每物理核心一个，排除隔离 CPU 与保留 CPU）
+ *
+ * 任务不得抛出异常（在 noexcept 上下文中执行）。
+ *
+ * 用法：
+ *   ThreadPool pool({.policy_ = PlacementPolicy::PhysicalCores, .reserved_ = hot_cpus});
+ *   pool.submit([] { recompute(); });
+ *   pool.parallel_for(0, n, [&](std::size_t i) { out[i] = f(in[i]); });
+ *   pool.wait_idle();
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../common/constants.h"
+#include "../../common/intrinsics.h"
+#include "chase_lev_deque.h"
+#include "futex.h"
+#include "placement.h"
+
+namespace concurrent {
+
+namespace detail {
+
+/// 类型擦除的任务节点
+struct Task {
+    void (*run_)(Task*) noexcept;
+};
+
+template <typename F>
+struct FnTask final : Task {
+    explicit FnTask(F&& fn) : Task{&invoke}, fn_(std::move(fn)) {}
+
+    static void invoke(Task* task) noexcept {
+        auto* self = static_cast<FnTask*>(task);
+        self->fn_();
+        delete self;
+    }
+
+    F fn_;
+};
+
+template <typename F>
+[[nodiscard]] inline Task* make_task(F&& fn) {
+    return new FnTask<std::decay_t<F>>(std::decay_t<F>(std::forward<F>(fn)));
+}
+
+}  // namespace detail
+
+struct ThreadPoolOptions {
+    PlacementOptions placement_{};
+    std::size_t spin_rounds_{64};  // 休眠前自旋取任务的轮数
+};
+
+class ThreadPool {
+public:
+    /// 运行统计（近似值）
+    struct Stats {
+        uint64_t executed_{0};
+        uint64_t local_steals_{0};
+        uint64_t remote_steals_{0};
+        uint64_t parks_{0};
+    };
+
+    explicit ThreadPool(ThreadPoolOptions opts = {}) : options_(std::move(opts)) {
+        const auto placement = Placement::plan(options_.placement_);
+        workers_.reserve(placement.size());
+        for (std::size_t i = 0; i < placement.size(); ++i) {
+            workers_.push_back(std::make_unique<Worker>(i, placement[i]));
+        }
+        build_steal_orders();
+
+        for (auto& w : workers_) {
+            w->thread_ = std::thread([this, worker = w.get()] { run_worker(worker); });
+        }
+    }
+
+    /// 等待已提交任务全部完成后停止
+    ~ThreadPool() {
+        wait_idle();
+        stop_.store(true, std::memory_order_release);
+        idle_.notify_all();
+        for (auto& w : workers_) {
+            if (w->thread_.joinable()) {
+                w->thread_.join();
+            }
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // -------------------------------------------------------------------------
+    // 提交
+    // -------------------------------------------------------------------------
+
+    /// 提交单个任务（fn 须可无参调用）
+    template <typename F>
+    void submit(F&& fn) {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        push(detail::make_task(std::forward<F>(fn)));
+        idle_.notify_one();
+    }
+
+    /// 批量提交 [first, last) 中的可调用对象（按 *first 复制；需移动时传入 std::move_iterator）
+    /// 注入队列只加锁一次，唤醒全部空闲线程
+    template <typename Iterator>
+    void submit_bulk(Iterator first, Iterator last) {
+        std::vector<detail::Task*> tasks;
+        for (; first != last; ++first) {
+            tasks.push_back(detail::make_task(*first));
+        }
+        if (tasks.empty()) {
+            return;
+        }
+
+        pending_.fetch_add(tasks.size(), std::memory_order_relaxed);
+        if (Worker* w = current_worker()) {
+            for (auto* t : tasks) {
+                w->deque_.push(t);
+            }
+        } else {
+            std::lock_guard<std::mutex> lock(injection_mutex_);
+            injection_.insert(injection_.end(), tasks.begin(), tasks.end());
+            injection_size_.store(injection_.size(), std::memory_order_release);
+        }
+        idle_.notify_all();
+    }
+
+    /// 对 [begin, end) 的每个下标调用 fn(i)；区间递归二分，空闲线程窃取另一半。
+    /// 调用线程参与执行并在全部完成后返回（可在任务内嵌套调用）
+    template <typename F>
+    void parallel_for(std::size_t begin, std::size_t end, F&& fn, std::size_t grain = 0) {
+        if (begin >= end) {
+            return;
+        }
+        const std::size_t n = end - begin;
+        if (grain == 0) {
+            // 每个工作线程约 8 块，兼顾负载均衡与任务开销
+            grain = std::max<std::size_t>(1, n / (workers_.size() * 8));
+        }
+
+        std::atomic<std::size_t> remaining{n};
+        split_range(begin, end, grain, fn, remaining);
+        help_until([&] { return remaining.load(std::memory_order_acquire) == 0; });
+    }
+
+    /// 等待所有已提交任务完成；调用线程协助执行
+    void wait_idle() {
+        help_until([&] { return pending_.load(std::memory_order_acquire) == 0; });
+    }
+
+    // -------------------------------------------------------------------------
+    // 查询
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return workers_.size(); }
+
+    [[nodiscard]] std::vector<WorkerPlacement> placement() const {
+        std::vector<WorkerPlacement> out;
+        out.reserve(workers_.size());
+        for (const auto& w : workers_) {
+            out.push_back(w->placement_);
+        }
+        return out;
+    }
+
+    /// 当前线程在本池中的工作线程编号，非工作线程返回 -1
+    [[nodiscard]] inline int32_t current_index() const noexcept {
+        const Worker* w = current_worker();
+        return w == nullptr ? -1 : static_cast<int32_t>(w->index_);
+    }
+
+    [[nodiscard]] Stats stats() const noexcept {
+        Stats s;
+        for (const auto& w : workers_) {
+            s.executed_ += w->executed_.load(std::memory_order_relaxed);
+            s.local_steals_ += w->local_steals_.load(std::memory_order_relaxed);
+            s.remote_steals_ += w->remote_steals_.load(std::memory_order_relaxed);
+            s.parks_ += w->parks_.load(std::memory_order_relaxed);
+        }
+        return s;
+    }
+
+private:
+    struct alignas(memory_constants::kCacheLineSize) Worker {
+        Worker(std::size_t index, WorkerPlacement placement) : index_(index), placement_(placement) {}
+
+        ChaseLevDeque<detail::Task*> deque_;
+        const std::size_t index_;
+        const WorkerPlacement placement_;
+        std::vector<std::size_t> local_victims_;   // 同节点其他工作线程
+        std::vector<std::size_t> remote_victims_;  // 其他节点工作线程
+        uint64_t rng_{0x9E3779B97F4A7C15ULL};
+        std::thread thread_;
+
+        // 统计（所有者写，stats() 读）
+        alignas(memory_constants::kCacheLineSize) std::atomic<uint64_t> executed_{0};
+        std::atomic<uint64_t> local_steals_{0};
+        std::atomic<uint64_t> remote_steals_{0};
+        std::atomic<uint64_t> parks_{0};
+    };
+
+    /// 当前线程所属工作线程（平凡类型，thread_local 访问无初始化检查）
+    struct CurrentWorker {
+        const ThreadPool* pool_;
+        Worker* worker_;
+    };
+
+    static inline thread_local CurrentWorker tls_current_{nullptr, nullptr};
+
+    [[nodiscard, gnu::always_inline]]
+    inline Worker* current_worker() const noexcept {
+        return tls_current_.pool_ == this ? tls_current_.worker_ : nullptr;
+    }
+
+    void build_steal_orders() {
+        for (auto& w : workers_) {
+            w->rng_ ^= (w->index_ + 1) * 0xBF58476D1CE4E5B9ULL;
+            for (auto& v : workers_) {
+                if (v.get() == w.get()) {
+                    continue;
+                }
+                const bool same_node = v->placement_.node_ == w->placement_.node_;
+                (same_node ? w->local_victims_ : w->remote_victims_).push_back(v->index_);
+            }
+        }
+    }
+
+    void push(detail::Task* task) {
+        if (Worker* w = current_worker()) {
+            w->deque_.push(task);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(injection_mutex_);
+        injection_.push_back(task);
+        injection_size_.store(injection_.size(), std::memory_order_release);
+    }
+
+    [[nodiscard]] detail::Task* pop_injection() {
+        if (injection_size_.load(std::memory_order_acquire) == 0) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(injection_mutex_);
+        if (injection_.empty()) {
+            return nullptr;
+        }
+        detail::Task* task = injection_.front();
+        injection_.pop_front();
+        injection_size_.store(injection_.size(), std::memory_order_release);
+        return task;
+    }
+
+    [[nodiscard]] static inline uint64_t next_random(uint64_t& state) noexcept {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    /// 从 victims 中随机起点轮询窃取
+    [[nodiscard]] detail::Task* steal_from(const std::vector<std::size_t>& victims, uint64_t& rng) noexcept {
+        if (victims.empty()) {
+            return nullptr;
+        }
+        const std::size_t start = next_random(rng) % victims.size();
+        for (std::size_t k = 0; k < victims.size(); ++k) {
+            if (detail::Task* t = workers_[victims[(start + k) % victims.size()]]->deque_.steal()) {
+                return t;
+            }
+        }
+        return nullptr;
+    }
+
+    /// 工作线程取任务：自身队列 → 注入队列 → 同节点窃取 → 跨节点窃取
+    [[nodiscard]] detail::Task* find_task(Worker* w) {
+        if (detail::Task* t = w->deque_.pop()) {
+            return t;
+        }
+        if (detail::Task* t = pop_injection()) {
+            return t;
+        }
+        if (detail::Task* t = steal_from(w->local_victims_, w->rng_)) {
+            w->local_steals_.fetch_add(1, std::memory_order_relaxed);
+            return t;
+        }
+        if (detail::Task* t = steal_from(w->remote_victims_, w->rng_)) {
+            w->remote_steals_.fetch_add(1, std::memory_order_relaxed);
+            return t;
+        }
+        return nullptr;
+    }
+
+    /// 非工作线程协助：注入队列 → 任意工作线程窃取
+    [[nodiscard]] detail::Task* find_task_external() {
+        if (detail::Task* t = pop_injection()) {
+            return t;
+        }
+        for (auto& w : workers_) {
+            if (detail::Task* t = w->deque_.steal()) {
+                return t;
+            }
+        }
+        return nullptr;
+    }
+
+    inline void execute(detail::Task* task, Worker* w) noexcept {
+        task->run_(task);
+        if (w != nullptr) {
+            w->executed_.fetch_add(1, std::memory_order_relaxed);
+        }
+        pending_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    /// 协助执行任务直到 done() 为真
+    template <typename Pred>
+    void help_until(Pred&& done) {
+        Worker* w = current_worker();
+        while (!done()) {
+            detail::Task* t = w != nullptr ? find_task(w) : find_task_external();
+            if (t != nullptr) {
+                execute(t, w);
+            } else {
+                common::pause();
+            }
+        }
+    }
+
+    template <typename F>
+    void split_range(std::size_t begin, std::size_t end, std::size_t grain, F& fn,
+                     std::atomic<std::size_t>& remaining) {
+        while (end - begin > grain) {
+            const std::size_t mid = begin + (end - begin) / 2;
+            submit([this, mid, end, grain, &fn, &remaining] { split_range(mid, end, grain, fn, remaining); });
+            end = mid;
+        }
+        for (std::size_t i = begin; i < end; ++i) {
+            fn(i);
+        }
+        remaining.fetch_sub(end - begin, std::memory_order_acq_rel);
+    }
+
+    void run_worker(Worker* w) {
+        if (w->placement_.cpu_ >= 0) {
+            (void)utils::CpuAffinity::pin_to_cpu(static_cast<std::size_t>(w->placement_.cpu_));
+        }
+        tls_current_ = {this, w};
+
+        while (true) {
+            detail::Task* t = nullptr;
+            for (std::size_t spin = 0; spin <= options_.spin_rounds_ && t == nullptr; ++spin) {
+                t = find_task(w);
+                if (t == nullptr) {
+                    common::pause();
+                }
+            }
+            if (t != nullptr) {
+                execute(t, w);
+                continue;
+            }
+
+            // 登记后复查，避免与提交方之间丢失唤醒
+            const uint32_t key = idle_.prepare_wait();
+            if ((t = find_task(w)) != nullptr) {
+                idle_.cancel_wait();
+                execute(t, w);
+                continue;
+            }
+            if (stop_.load(std::memory_order_acquire)) {
+                idle_.cancel_wait();
+                break;
+            }
+            w->parks_.fetch_add(1, std::memory_order_relaxed);
+            idle_.wait(key);
+        }
+
+        tls_current_ = {nullptr, nullptr};
+    }
+
+    const ThreadPoolOptions options_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    alignas(memory_constants::kCacheLineSize) std::atomic<std::size_t> pending_{0};
+    alignas(memory_constants::kCacheLineSize) std::atomic<bool> stop_{false};
+
+    alignas(memory_constants::kCacheLineSize) std::atomic<std::size_t> injection_size_{0};
+    std::mutex injection_mutex_;
+    std::deque<detail::Task*> injection_;
+
+    EventCount idle_;
+};
+
+}  // namespace concurrent
@@ -0,0 +1,97 @@
+/**
+ * @file test_chase_lev_deque.cpp
+ * @brief ChaseLevDeque 单元测试
+ * @version 1.0.0
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/chase_lev_deque.h"
+
+using namespace concurrent;
+
+TEST(ChaseLevDeque, OwnerLifoThiefFifo) {
+    int items[4] = {0, 1, 2, 3};
+    ChaseLevDeque<int*> deque(4);
+    for (auto& item : items) {
+        deque.push(&item);
+    }
+    EXPECT_EQ(deque.size(), 4u);
+
+    EXPECT_EQ(deque.pop(), &items[3]);
+    EXPECT_EQ(deque.steal(), &items[0]);
+    EXPECT_EQ(deque.pop(), &items[2]);
+    EXPECT_EQ(deque.steal(), &items[1]);
+    EXPECT_TRUE(deque.pop() == nullptr);
+    EXPECT_TRUE(deque.steal() == nullptr);
+    EXPECT_TRUE(deque.empty());
+    return true;
+}
+
+TEST(ChaseLevDeque, Grow) {
+    std::vector<int> items(1000);
+    ChaseLevDeque<int*> deque(2);
+    for (auto& item : items) {
+        deque.push(&item);
+    }
+    EXPECT_TRUE(deque.capacity() >= items.size());
+    EXPECT_EQ(deque.size(), items.size());
+
+    for (std::size_t i = items.size(); i > 0; --i) {
+        EXPECT_EQ(deque.pop(), &items[i - 1]);
+    }
+    EXPECT_TRUE(deque.empty());
+    return true;
+}
+
+TEST(ChaseLevDeque, ConcurrentStealExactlyOnce) {
+    constexpr std::size_t kItems = 100000;
+    constexpr std::size_t kThieves = 3;
+
+    std::vector<int> items(kItems);
+    std::vector<std::atomic<int>> seen(kItems);
+    ChaseLevDeque<int*> deque(16);
+    std::atomic<bool> done{false};
+
+    auto consume = [&](int* p) { seen[static_cast<std::size_t>(p - items.data())].fetch_add(1); };
+
+    std::vector<std::thread> thieves;
+    for (std::size_t t = 0; t < kThieves; ++t) {
+        thieves.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire) || !deque.empty()) {
+                if (int* p = deque.steal()) {
+                    consume(p);
+                }
+            }
+        });
+    }
+
+    // 所有者交替压入与弹出，并触发扩容
+    for (std::size_t i = 0; i < kItems; ++i) {
+        deque.push(&items[i]);
+        if (i % 3 == 0) {
+            if (int* p = deque.pop()) {
+                consume(p);
+            }
+        }
+    }
+    while (int* p = deque.pop()) {
+        consume(p);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& t : thieves) {
+        t.join();
+    }
+
+    std::size_t wrong = 0;
+    for (auto& s : seen) {
+        wrong += s.load() == 1 ? 0 : 1;
+    }
+    EXPECT_EQ(wrong, 0u);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
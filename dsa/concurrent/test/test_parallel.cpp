@@ -0,0 +1,176 @@
+/**
+ * @file test_parallel.cpp
+ * @brief parallel_for / parallel_reduce / parallel_transform 单元测试
+ * @version 1.0.0
+ */
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/parallel.h"
+#include "../detail/thread_pool.h"
+
+using namespace concurrent;
+
+namespace {
+
+ThreadPoolOptions pool_options(std::size_t workers) {
+    return {.placement_ = {.policy_ = PlacementPolicy::Unpinned, .max_workers_ = workers}};
+}
+
+/// 数量级差异大的浮点序列：求和顺序不同时结果不同
+std::vector<double> ill_conditioned(std::size_t n) {
+    std::vector<double> v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        v[i] = (i % 3 == 0 ? 1e16 : 1.0) * (i % 2 == 0 ? 1.0 : -1.0) + 1.0 / static_cast<double>(i + 1);
+    }
+    return v;
+}
+
+}  // namespace
+
+TEST(Parallel, ExecutorConcept) {
+    CHECK_COMPILE_TIME(Executor<SerialExecutor>);
+    CHECK_COMPILE_TIME(Executor<ThreadPool>);
+    CHECK_COMPILE_TIME(chunk_elements<8>() == utils::cache_optimal_capacity<double>() / 2);
+    CHECK_COMPILE_TIME(chunk_elements<1 << 30>() == 1);
+    return true;
+}
+
+TEST(Parallel, ForCoversEachIndexOnce) {
+    ThreadPool pool(pool_options(4));
+    for (std::size_t n : {0ul, 1ul, 100ul, kDefaultIndexGrain + 1, 5 * kDefaultIndexGrain + 7}) {
+        std::vector<std::atomic<int>> hits(n + 10);
+        parallel_for(pool, 10, n + 10, [&](std::size_t i) {
+            hits[i].fetch_add(1, std::memory_order_relaxed);
+        });
+
+        std::size_t wrong = 0;
+        for (std::size_t i = 0; i < hits.size(); ++i) {
+            wrong += hits[i].load() == (i >= 10 ? 1 : 0) ? 0 : 1;
+        }
+        EXPECT_EQ(wrong, 0u);
+    }
+    return true;
+}
+
+TEST(Parallel, ForSpan) {
+    ThreadPool pool(pool_options(4));
+    std::vector<int> data(200000, 1);
+    parallel_for(pool, std::span<int>(data), [](int& x) { x *= 3; });
+
+    std::size_t wrong = 0;
+    for (int x : data) {
+        wrong += x == 3 ? 0 : 1;
+    }
+    EXPECT_EQ(wrong, 0u);
+    return true;
+}
+
+TEST(Parallel, Transform) {
+    ThreadPool pool(pool_options(4));
+    std::vector<double> in(100000);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        in[i] = static_cast<double>(i);
+    }
+    std::vector<double> out(in.size());
+
+    EXPECT_TRUE(parallel_transform(pool, std::span<const double>(in), std::span<double>(out),
+                                   [](double x) { return x * 2.0; }));
+    std::size_t wrong = 0;
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        wrong += out[i] == 2.0 * static_cast<double>(i) ? 0 : 1;
+    }
+    EXPECT_EQ(wrong, 0u);
+
+    // 输出过短
+    std::vector<double> small(10);
+    EXPECT_TRUE(!parallel_transform(pool, std::span<const double>(in), std::span<double>(small),
+                                    [](double x) { return x; }));
+    return true;
+}
+
+TEST(Parallel, ReduceInteger) {
+    ThreadPool pool(pool_options(4));
+    constexpr std::size_t kN = 1'000'000;
+    const uint64_t sum = parallel_reduce(
+        pool, 0, kN, uint64_t{7}, [](std::size_t i) { return static_cast<uint64_t>(i); }, std::plus<>{});
+    EXPECT_EQ(sum, 7 + kN * (kN - 1) / 2);
+
+    EXPECT_EQ(parallel_reduce(pool, 5, 5, 42, [](std::size_t) { return 1; }, std::plus<>{}), 42);
+
+    std::vector<int> data(12345, 2);
+    EXPECT_EQ(parallel_reduce(pool, std::span<const int>(data), 0, std::plus<>{}), 24690);
+    EXPECT_EQ(parallel_transform_reduce(pool, std::span<const int>(data), 0L, std::plus<>{},
+                                        [](int x) { return long{x} * x; }),
+              49380L);
+    return true;
+}
+
+TEST(Parallel, ReduceBool) {
+    ThreadPool pool(pool_options(4));
+    constexpr std::size_t kN = 100'000;
+    std::vector<int> data(kN, 1);
+    data[kN - 3] = -1;
+    auto negative = [&](std::size_t i) { return data[i] < 0; };
+    auto positive = [&](std::size_t i) { return data[i] > 0; };
+    auto any = [](bool a, bool b) { return a || b; };
+    auto all = [](bool a, bool b) { return a && b; };
+
+    // 小粒度：相邻块的结果由不同线程同时写入
+    for (std::size_t grain : {1ul, 7ul, 64ul, 1000ul}) {
+        for (int run = 0; run < 5; ++run) {
+            EXPECT_TRUE(parallel_reduce(pool, 0, kN, false, negative, any, grain));
+            EXPECT_FALSE(parallel_reduce(pool, 0, kN, true, positive, all, grain));
+            EXPECT_FALSE(parallel_reduce(pool, 0, kN - 3, false, negative, any, grain));
+            EXPECT_TRUE(parallel_reduce(pool, 0, kN - 3, true, positive, all, grain));
+        }
+    }
+    return true;
+}
+
+TEST(Parallel, ReduceDeterministic) {
+    const auto data = ill_conditioned(1'000'003);
+    const std::span<const double> span(data);
+
+    SerialExecutor serial;
+    const double expected = parallel_reduce(serial, span, 0.0, std::plus<>{});
+
+    // 不同线程数、多次运行结果逐位相同
+    for (std::size_t workers : {1ul, 2ul, 3ul, 8ul}) {
+        ThreadPool pool(pool_options(workers));
+        for (int run = 0; run < 5; ++run) {
+            const double got = parallel_reduce(pool, span, 0.0, std::plus<>{});
+            EXPECT_EQ(std::memcmp(&got, &expected, sizeof(double)), 0);
+        }
+    }
+
+    // 块形状固定时与粒度相关、与执行器无关
+    ThreadPool pool(pool_options(4));
+    auto map = [&](std::size_t i) { return data[i]; };
+    const double a = parallel_reduce(pool, 0, data.size(), 0.0, map, std::plus<>{}, 1000);
+    const double b = parallel_reduce(serial, 0, data.size(), 0.0, map, std::plus<>{}, 1000);
+    EXPECT_EQ(std::memcmp(&a, &b, sizeof(double)), 0);
+    return true;
+}
+
+TEST(Parallel, NestedInsidePoolTask) {
+    ThreadPool pool(pool_options(3));
+    std::atomic<uint64_t> total{0};
+    parallel_for(
+        pool, 0, 8,
+        [&](std::size_t) {
+            total.fetch_add(parallel_reduce(
+                pool, 0, 10000, uint64_t{0}, [](std::size_t i) { return uint64_t{i}; }, std::plus<>{}, 100));
+        },
+        1);
+    EXPECT_EQ(total.load(), 8u * (10000u * 9999u / 2));
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
@@ -0,0 +1,194 @@
+/**
+ * @file test_spinlock.cpp
+ * @brief TicketLock / McsLock / RwSpinLock 单元测试
+ * @version 1.0.0
+ */
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/spinlock.h"
+
+using namespace concurrent;
+
+namespace {
+
+constexpr std::size_t kThreads = 4;
+constexpr std::size_t kIterations = 20000;
+
+/// 非原子读-改-写：锁不互斥时会丢失更新
+template <typename LockFn>
+uint64_t hammer(LockFn&& with_lock) {
+    uint64_t counter = 0;
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&] {
+            for (std::size_t i = 0; i < kIterations; ++i) {
+                with_lock([&] {
+                    const uint64_t v = counter;
+                    DONT_OPTIMIZE(v);
+                    counter = v + 1;
+                });
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    return counter;
+}
+
+}  // namespace
+
+TEST(SpinLock, Layout) {
+    // 关闭统计时计数器不占空间
+    CHECK_COMPILE_TIME(sizeof(TicketLock<>) == memory_constants::kCacheLineSize);
+    CHECK_COMPILE_TIME(sizeof(RwSpinLock<>) == memory_constants::kCacheLineSize);
+    CHECK_COMPILE_TIME(sizeof(McsLock<>) == memory_constants::kCacheLineSize);
+    CHECK_COMPILE_TIME(sizeof(McsLock<>::Node) == memory_constants::kCacheLineSize);
+    return true;
+}
+
+TEST(TicketLock, MutualExclusion) {
+    TicketLock<true> lock;
+    const uint64_t total = hammer([&](auto&& fn) {
+        std::lock_guard<TicketLock<true>> guard(lock);
+        fn();
+    });
+    EXPECT_EQ(total, kThreads * kIterations);
+
+    const auto stats = lock.stats();
+    EXPECT_EQ(stats.acquisitions_, kThreads * kIterations);
+    EXPECT_TRUE(stats.contended_ <= stats.acquisitions_);
+    EXPECT_TRUE(stats.max_wait_cycles_ <= stats.spin_cycles_);
+    EXPECT_TRUE(!lock.is_locked());
+    return true;
+}
+
+TEST(TicketLock, TryLock) {
+    TicketLock<> lock;
+    EXPECT_TRUE(lock.try_lock());
+    EXPECT_TRUE(lock.is_locked());
+    EXPECT_TRUE(!lock.try_lock());
+    lock.unlock();
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+    EXPECT_EQ(lock.stats().acquisitions_, 0u);
+    return true;
+}
+
+TEST(McsLock, MutualExclusion) {
+    McsLock<true> lock;
+    const uint64_t total = hammer([&](auto&& fn) {
+        McsLock<true>::Guard guard(lock);
+        fn();
+    });
+    EXPECT_EQ(total, kThreads * kIterations);
+    EXPECT_EQ(lock.stats().acquisitions_, kThreads * kIterations);
+    EXPECT_TRUE(!lock.is_locked());
+    return true;
+}
+
+TEST(McsLock, TryLock) {
+    McsLock<> lock;
+    McsLock<>::Node a, b;
+    EXPECT_TRUE(lock.try_lock(a));
+    EXPECT_TRUE(!lock.try_lock(b));
+    lock.unlock(a);
+    EXPECT_TRUE(!lock.is_locked());
+    lock.lock(b);
+    lock.unlock(b);
+    return true;
+}
+
+TEST(RwSpinLock, WritersExclusive) {
+    RwSpinLock<true> lock;
+    const uint64_t total = hammer([&](auto&& fn) {
+        std::lock_guard<RwSpinLock<true>> guard(lock);
+        fn();
+    });
+    EXPECT_EQ(total, kThreads * kIterations);
+    EXPECT_EQ(lock.stats().acquisitions_, kThreads * kIterations);
+    return true;
+}
+
+TEST(RwSpinLock, ReadersShareWritersExclude) {
+    RwSpinLock<> lock;
+    EXPECT_TRUE(lock.try_lock_shared());
+    EXPECT_TRUE(lock.try_lock_shared());
+    EXPECT_EQ(lock.readers(), 2u);
+    EXPECT_TRUE(!lock.try_lock());
+    lock.unlock_shared();
+    lock.unlock_shared();
+
+    EXPECT_TRUE(lock.try_lock());
+    EXPECT_TRUE(lock.writer_active());
+    EXPECT_TRUE(!lock.try_lock_shared());
+    lock.unlock();
+    EXPECT_TRUE(!lock.writer_active());
+    return true;
+}
+
+TEST(RwSpinLock, WriterPreferred) {
+    RwSpinLock<> lock;
+    lock.lock_shared();
+
+    // 写者等待读者释放期间，新读者不得进入
+    std::atomic<bool> writer_done{false};
+    std::thread writer([&] {
+        std::lock_guard<RwSpinLock<>> guard(lock);
+        writer_done.store(true);
+    });
+    // 等待写者登记
+    bool blocked = false;
+    for (int i = 0; i < 1000000 && !blocked; ++i) {
+        blocked = !lock.try_lock_shared();
+        if (!blocked) {
+            lock.unlock_shared();
+            std::this_thread::yield();
+        }
+    }
+    EXPECT_TRUE(blocked);
+    EXPECT_TRUE(!writer_done.load());
+
+    lock.unlock_shared();
+    writer.join();
+    EXPECT_TRUE(writer_done.load());
+    EXPECT_EQ(lock.readers(), 0u);
+    return true;
+}
+
+TEST(RwSpinLock, MixedReadersWriters) {
+    RwSpinLock<> lock;
+    uint64_t a = 0;
+    uint64_t b = 0;
+    std::atomic<uint64_t> torn{0};
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            for (std::size_t i = 0; i < kIterations; ++i) {
+                if (t == 0 || i % 16 == 0) {
+                    std::lock_guard<RwSpinLock<>> guard(lock);
+                    ++a;
+                    ++b;
+                } else {
+                    std::shared_lock<RwSpinLock<>> guard(lock);
+                    torn.fetch_add(a != b ? 1 : 0, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(torn.load(), 0u);
+    EXPECT_EQ(a, b);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
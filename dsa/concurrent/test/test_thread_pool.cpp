@@ -0,0 +1,187 @@
+/**
+ * @file test_thread_pool.cpp
+ * @brief Placement 与 ThreadPool 单元测试
+ * @version 1.0.0
+ */
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/thread_pool.h"
+
+using namespace concurrent;
+
+TEST(Placement, PhysicalCoresAreUnique) {
+    const auto plan = Placement::plan({});
+    EXPECT_GT(plan.size(), 0u);
+
+    // 每个物理核心至多一个工作线程
+    const auto& cores = utils::CoreDetector::instance().get_physical_cores();
+    for (const auto& core : cores) {
+        std::size_t hits = 0;
+        for (const auto& w : plan) {
+            hits += core.contains(w.cpu_) ? 1 : 0;
+        }
+        EXPECT_TRUE(hits <= 1);
+    }
+    return true;
+}
+
+TEST(Placement, ReservedAndLimit) {
+    const auto all = Placement::plan({.policy_ = PlacementPolicy::AllCpus});
+
+    utils::CpuSet reserved;
+    if (all.front().cpu_ >= 0) {
+        reserved.add_cpu(static_cast<std::size_t>(all.front().cpu_));
+    }
+    const auto plan = Placement::plan({.policy_ = PlacementPolicy::AllCpus, .reserved_ = reserved});
+    for (const auto& w : plan) {
+        if (w.cpu_ >= 0) {
+            EXPECT_TRUE(!reserved.contains(static_cast<std::size_t>(w.cpu_)));
+        }
+    }
+    // 全部候选被保留时退化为一个不绑核的工作线程
+    EXPECT_GT(plan.size(), 0u);
+
+    const auto limited = Placement::plan({.policy_ = PlacementPolicy::Unpinned, .max_workers_ = 1});
+    EXPECT_EQ(limited.size(), 1u);
+    EXPECT_EQ(limited.front().cpu_, -1);
+    return true;
+}
+
+namespace {
+
+/// 4 个物理核心、每核 2 个超线程（cpu i 与 i + 4 为兄弟），单 NUMA 节点
+PlacementTopology smt_topology() {
+    PlacementTopology topo;
+    topo.online_ = {0, 1, 2, 3, 4, 5, 6, 7};
+    topo.nodes_ = {topo.online_};
+    topo.physical_cores_ = {{0, 4}, {1, 5}, {2, 6}, {3, 7}};
+    return topo;
+}
+
+}  // namespace
+
+TEST(Placement, ReservedCoreSiblingsExcluded) {
+    const PlacementTopology topo = smt_topology();
+    utils::CpuSet reserved;
+    reserved.add_cpu(0);  // 兄弟 4 仍在候选集中，但不能放工作线程
+
+    const auto plan = Placement::plan({.reserved_ = reserved}, topo);
+    EXPECT_EQ(plan.size(), 3u);
+    for (const auto& w : plan) {
+        EXPECT_TRUE(w.cpu_ != 0 && w.cpu_ != 4);
+    }
+
+    // 隔离的 CPU 同样排除整个物理核心；不避开隔离 CPU 时该核心可用
+    PlacementTopology isolated = smt_topology();
+    isolated.isolated_ = {6};
+    const auto avoided = Placement::plan({}, isolated);
+    EXPECT_EQ(avoided.size(), 3u);
+    for (const auto& w : avoided) {
+        EXPECT_TRUE(w.cpu_ != 2 && w.cpu_ != 6);
+    }
+    EXPECT_EQ(Placement::plan({.avoid_isolated_ = false}, isolated).size(), 4u);
+    return true;
+}
+
+TEST(ThreadPool, Submit) {
+    ThreadPool pool({.placement_ = {.policy_ = PlacementPolicy::Unpinned, .max_workers_ = 4}});
+    EXPECT_GT(pool.size(), 0u);
+
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 10000; ++i) {
+        pool.submit([&] { counter.fetch_add(1, std::memory_order_relaxed); });
+    }
+    pool.wait_idle();
+    EXPECT_EQ(counter.load(), 10000);
+    // 调用线程在 wait_idle 中协助执行的任务不计入工作线程统计
+    EXPECT_TRUE(pool.stats().executed_ <= 10000u);
+    return true;
+}
+
+TEST(ThreadPool, SubmitBulk) {
+    ThreadPool pool({.placement_ = {.policy_ = PlacementPolicy::Unpinned, .max_workers_ = 4}});
+    std::atomic<int> counter{0};
+
+    std::vector<std::function<void()>> tasks;
+    for (int i = 0; i < 1000; ++i) {
+        tasks.emplace_back([&counter, i] { counter.fetch_add(i, std::memory_order_relaxed); });
+    }
+    pool.submit_bulk(tasks.begin(), tasks.end());
+    pool.wait_idle();
+    EXPECT_EQ(counter.load(), 999 * 1000 / 2);
+    return true;
+}
+
+TEST(ThreadPool, ParallelForCoversEachIndexOnce) {
+    ThreadPool pool({.placement_ = {.policy_ = PlacementPolicy::Unpinned, .max_workers_ = 4}});
+    constexpr std::size_t kN = 100000;
+    std::vector<std::atomic<int>> hits(kN);
+
+    pool.parallel_for(0, kN, [&](std::size_t i) { hits[i].fetch_add(1, std::memory_order_relaxed); });
+
+    std::size_t wrong = 0;
+    for (auto& h : hits) {
+        wrong += h.load() == 1 ? 0 : 1;
+    }
+    EXPECT_EQ(wrong, 0u);
+
+    // 空区间与单元素粒度
+    pool.parallel_for(5, 5, [&](std::size_t) { wrong = 1; });
+    EXPECT_EQ(wrong, 0u);
+    std::atomic<int> count{0};
+    pool.parallel_for(0, 100, [&](std::size_t) { count.fetch_add(1); }, 1);
+    EXPECT_EQ(count.load(), 100);
+    return true;
+}
+
+TEST(ThreadPool, NestedParallelFor) {
+    ThreadPool pool({.placement_ = {.policy_ = PlacementPolicy::Unpinned, .max_workers_ = 4}});
+    std::atomic<std::size_t> sum{0};
+
+    pool.parallel_for(0, 64, [&](std::size_t i) {
+        EXPECT_TRUE(pool.current_index() >= -1);
+        pool.parallel_for(0, 100, [&](std::size_t j) {
+            sum.fetch_add(i * 100 + j, std::memory_order_relaxed);
+        });
+    });
+    constexpr std::size_t kTotal = 6400;
+    EXPECT_EQ(sum.load(), kTotal * (kTotal - 1) / 2);
+    return true;
+}
+
+TEST(ThreadPool, WorkersParkWhenIdle) {
+    ThreadPool pool({.placement_ = {.policy_ = PlacementPolicy::Unpinned, .max_workers_ = 2},
+                     .spin_rounds_ = 1});
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_GT(pool.stats().parks_, 0u);
+
+    // 休眠后仍能被唤醒执行任务
+    std::atomic<int> counter{0};
+    pool.submit([&] { counter.fetch_add(1); });
+    pool.wait_idle();
+    EXPECT_EQ(counter.load(), 1);
+    EXPECT_EQ(pool.current_index(), -1);
+    return true;
+}
+
+TEST(ThreadPool, DestructorDrains) {
+    std::atomic<int> counter{0};
+    {
+        ThreadPool pool({.placement_ = {.policy_ = PlacementPolicy::Unpinned, .max_workers_ = 3}});
+        for (int i = 0; i < 1000; ++i) {
+            // 任务内提交子任务，析构须等待子任务完成
+            pool.submit([&] { pool.submit([&] { counter.fetch_add(1, std::memory_order_relaxed); }); });
+        }
+    }
+    EXPECT_EQ(counter.load(), 1000);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
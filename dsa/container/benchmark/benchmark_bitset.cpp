@@ -0,0 +1,303 @@
+/**
+ * @file benchmark_bitset.cpp
+ * @brief FixedBitset / DynamicBitset vs std::bitset / std::vector<bool>：集合运算、popcount、置位枚举、秩/选择
+ *
+ * 位图长度 1M 位（128 KB，L2 内），模拟合约全集上的活跃集合与订阅掩码：
+ * - 批量运算：&=、count、count_and（交集计数），每次迭代处理整个位图
+ * - 置位枚举：稀疏（1%）与稠密（50%）位图上访问全部置位并求和
+ * - rank / select：随机位置，RankSelect 索引对比逐字扫描
+ */
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/bitset.h"
+#include "../detail/rank_select.h"
+
+using namespace container;
+
+namespace {
+
+const auto kBulkConfig =
+    benchmark::Config::quick().min_iterations(2'000).max_iterations(2'000).repetitions(5);
+const auto kQueryConfig =
+    benchmark::Config::quick().min_iterations(1'000'000).max_iterations(1'000'000).repetitions(5);
+
+constexpr std::size_t kBits = std::size_t{1} << 20;
+constexpr std::size_t kQueries = std::size_t{1} << 16;
+
+/// 同一份随机内容的四种表示
+struct Bitmaps {
+    explicit Bitmaps(unsigned density, uint64_t seed) : dynamic(kBits), vector(kBits) {
+        std::mt19937_64 rng(seed);
+        for (std::size_t i = 0; i < kBits; ++i) {
+            const bool value = rng() % 100 < density;
+            fixed.set(i, value);
+            dynamic.set(i, value);
+            standard[i] = value;
+            vector[i] = value;
+        }
+    }
+
+    FixedBitset<kBits> fixed;
+    DynamicBitset dynamic;
+    std::bitset<kBits> standard;
+    std::vector<bool> vector;
+};
+
+/// 活跃集合（50%）与订阅掩码（50%）
+Bitmaps& active() {
+    static const auto bitmaps = std::make_unique<Bitmaps>(50, 1);
+    return *bitmaps;
+}
+
+Bitmaps& subscribed() {
+    static const auto bitmaps = std::make_unique<Bitmaps>(50, 2);
+    return *bitmaps;
+}
+
+Bitmaps& sparse() {
+    static const auto bitmaps = std::make_unique<Bitmaps>(1, 3);
+    return *bitmaps;
+}
+
+/// 运算目标：每次迭代在同一份位图上就地 &=（结果不变，代价相同）
+Bitmaps& target() {
+    static const auto bitmaps = std::make_unique<Bitmaps>(50, 1);
+    return *bitmaps;
+}
+
+const std::vector<uint32_t>& positions() {
+    static const std::vector<uint32_t> values = [] {
+        std::mt19937_64 rng(4);
+        std::vector<uint32_t> v(kQueries);
+        for (auto& p : v) {
+            p = static_cast<uint32_t>(rng() % kBits);
+        }
+        return v;
+    }();
+    return values;
+}
+
+const RankSelect& index() {
+    static const RankSelect rank_select(active().fixed);
+    return rank_select;
+}
+
+/// 给定位图上全部置位下标之和
+template <typename Visit>
+[[gnu::always_inline]] inline uint64_t sum_set_bits(Visit&& visit) {
+    uint64_t sum = 0;
+    visit([&](std::size_t i) { sum += i; });
+    return sum;
+}
+
+}  // namespace
+
+// =============================================================================
+// 批量运算：&=
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(fixed_bitset_and, kBulkConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        target().fixed &= subscribed().fixed;
+        DONT_OPTIMIZE(&target().fixed);
+    }
+}
+
+BENCHMARK_WITH_CONFIG(dynamic_bitset_and, kBulkConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        target().dynamic &= subscribed().dynamic;
+        DONT_OPTIMIZE(&target().dynamic);
+    }
+}
+
+BENCHMARK_WITH_CONFIG(std_bitset_and, kBulkConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        target().standard &= subscribed().standard;
+        DONT_OPTIMIZE(&target().standard);
+    }
+}
+
+/// vector<bool> 没有按字的集合运算，只能逐位
+BENCHMARK_WITH_CONFIG(vector_bool_and, kBulkConfig) {
+    auto& dst = target().vector;
+    const auto& src = subscribed().vector;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t k = 0; k < kBits; ++k) {
+            dst[k] = dst[k] && src[k];
+        }
+        DONT_OPTIMIZE(&dst);
+    }
+}
+
+// =============================================================================
+// popcount
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(fixed_bitset_count, kBulkConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        DONT_OPTIMIZE(active().fixed.count());
+    }
+}
+
+BENCHMARK_WITH_CONFIG(std_bitset_count, kBulkConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        DONT_OPTIMIZE(active().standard.count());
+    }
+}
+
+BENCHMARK_WITH_CONFIG(vector_bool_count, kBulkConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        DONT_OPTIMIZE((std::count(active().vector.begin(), active().vector.end(), true)));
+    }
+}
+
+/// 交集计数：count_and 不物化交集；std::bitset 需要临时对象
+BENCHMARK_WITH_CONFIG(fixed_bitset_count_and, kBulkConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        DONT_OPTIMIZE(active().fixed.count_and(subscribed().fixed));
+    }
+}
+
+BENCHMARK_WITH_CONFIG(std_bitset_count_and, kBulkConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        DONT_OPTIMIZE((active().standard & subscribed().standard).count());
+    }
+}
+
+// =============================================================================
+// 置位枚举：稀疏 1%
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(fixed_bitset_for_each_sparse, kBulkConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        DONT_OPTIMIZE(sum_set_bits([](auto&& fn) { sparse().fixed.for_each(fn); }));
+    }
+}
+
+BENCHMARK_WITH_CONFIG(std_bitset_find_next_sparse, kBulkConfig) {
+    const auto& bits = sparse().standard;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        uint64_t sum = 0;
+        for (std::size_t k = bits._Find_first(); k < kBits; k = bits._Find_next(k)) {
+            sum += k;
+        }
+        DONT_OPTIMIZE(sum);
+    }
+}
+
+BENCHMARK_WITH_CONFIG(std_bitset_test_sparse, kBulkConfig) {
+    const auto& bits = sparse().standard;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        uint64_t sum = 0;
+        for (std::size_t k = 0; k < kBits; ++k) {
+            sum += bits.test(k) ? k : 0;
+        }
+        DONT_OPTIMIZE(sum);
+    }
+}
+
+BENCHMARK_WITH_CONFIG(vector_bool_test_sparse, kBulkConfig) {
+    const auto& bits = sparse().vector;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        uint64_t sum = 0;
+        for (std::size_t k = 0; k < kBits; ++k) {
+            sum += bits[k] ? k : 0;
+        }
+        DONT_OPTIMIZE(sum);
+    }
+}
+
+// =============================================================================
+// 置位枚举：稠密 50%
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(fixed_bitset_for_each_dense, kBulkConfig) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        DONT_OPTIMIZE(sum_set_bits([](auto&& fn) { active().fixed.for_each(fn); }));
+    }
+}
+
+BENCHMARK_WITH_CONFIG(std_bitset_find_next_dense, kBulkConfig) {
+    const auto& bits = active().standard;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        uint64_t sum = 0;
+        for (std::size_t k = bits._Find_first(); k < kBits; k = bits._Find_next(k)) {
+            sum += k;
+        }
+        DONT_OPTIMIZE(sum);
+    }
+}
+
+BENCHMARK_WITH_CONFIG(vector_bool_test_dense, kBulkConfig) {
+    const auto& bits = active().vector;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        uint64_t sum = 0;
+        for (std::size_t k = 0; k < kBits; ++k) {
+            sum += bits[k] ? k : 0;
+        }
+        DONT_OPTIMIZE(sum);
+    }
+}
+
+// =============================================================================
+// rank / select：随机位置
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(rank_select_rank1, kQueryConfig) {
+    const auto& queries = positions();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        DONT_OPTIMIZE(index().rank1(queries[i & (kQueries - 1)]));
+    }
+}
+
+BENCHMARK_WITH_CONFIG(rank_select_select1, kQueryConfig) {
+    const auto& queries = positions();
+    const std::size_t ones = index().ones();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        DONT_OPTIMIZE(index().select1(queries[i & (kQueries - 1)] % ones));
+    }
+}
+
+/// 无索引：逐字 popcount 扫描
+BENCHMARK_WITH_CONFIG(fixed_bitset_rank_scan, kBulkConfig) {
+    const auto& queries = positions();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        DONT_OPTIMIZE(active().fixed.rank(queries[i & (kQueries - 1)]));
+    }
+}
+
+BENCHMARK_WITH_CONFIG(fixed_bitset_select_scan, kBulkConfig) {
+    const auto& queries = positions();
+    const std::size_t ones = index().ones();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        DONT_OPTIMIZE(active().fixed.select(queries[i & (kQueries - 1)] % ones));
+    }
+}
+
+int main() {
+    std::cout << "Bitset Benchmark v" << benchmark::version() << "\n";
+    std::cout << "Bitmap: " << kBits << " bits (" << kBits / 8 / 1024 << " KB)\n\n";
+
+    // 先构造全部位图与索引，不计入首个基准
+    DONT_OPTIMIZE(active().fixed.count() + subscribed().fixed.count() + sparse().fixed.count() +
+                  target().fixed.count() + index().ones());
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("bitset_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("bitset_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
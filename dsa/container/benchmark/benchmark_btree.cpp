@@ -0,0 +1,247 @@
+/**
+ * @file benchmark_btree.cpp
+ * @brief BPlusTree vs std::map vs FlatMap：点查、范围扫描、插入吞吐（随机 / 递增时间戳）
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/btree.h"
+#include "../detail/flat_map.h"
+
+using namespace container;
+
+namespace {
+
+const auto kConfig = benchmark::Config::quick().max_iterations(1'000'000).repetitions(5);
+/// 插入：每次重复从空容器插入固定个数（FlatMap 随机插入为 O(n) 移动，只跑小规模）
+const auto kInsertConfig =
+    benchmark::Config::quick().min_iterations(50'000).max_iterations(50'000).repetitions(5);
+const auto kLargeInsertConfig =
+    benchmark::Config::quick().min_iterations(1'000'000).max_iterations(1'000'000).repetitions(3);
+
+using Key = uint64_t;
+using Tree = BPlusTree<Key, uint64_t>;
+
+constexpr std::size_t k1M = 1'000'000;
+constexpr std::size_t k8M = 8'000'000;
+constexpr std::size_t kQueries = std::size_t{1} << 20;
+/// 每次范围扫描的元素数
+constexpr std::size_t kScanLength = 100;
+
+struct Fixture {
+    explicit Fixture(std::size_t n) {
+        std::mt19937_64 rng(n);
+        std::vector<std::pair<Key, uint64_t>> entries(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            entries[i] = {rng(), i};
+            std_.emplace(entries[i]);
+        }
+        flat_ = FlatMap<Key, uint64_t>(entries);
+        std::sort(entries.begin(), entries.end());
+        tree_.bulk_load(entries.begin(), entries.end());
+
+        keys_.reserve(n);
+        for (const auto& [key, value] : entries) {
+            keys_.push_back(key);
+        }
+        queries_.resize(kQueries);
+        for (auto& q : queries_) {
+            q = rng() % (n - kScanLength);
+        }
+    }
+
+    Tree tree_;
+    std::map<Key, uint64_t> std_;
+    FlatMap<Key, uint64_t> flat_;
+    std::vector<Key> keys_;             // 升序
+    std::vector<std::size_t> queries_;  // keys_ 下标
+};
+
+Fixture& fixture(std::size_t n) {
+    static std::map<std::size_t, std::unique_ptr<Fixture>> fixtures;
+    auto& f = fixtures[n];
+    if (!f) {
+        f = std::make_unique<Fixture>(n);
+    }
+    return *f;
+}
+
+/// 插入用键：随机与递增（时间戳）两种顺序
+const std::vector<Key>& random_keys() {
+    static const std::vector<Key> keys = [] {
+        std::mt19937_64 rng(42);
+        std::vector<Key> v(k1M);
+        for (auto& k : v) {
+            k = rng();
+        }
+        return v;
+    }();
+    return keys;
+}
+
+// -----------------------------------------------------------------------------
+// 点查
+// -----------------------------------------------------------------------------
+
+template <typename Lookup>
+void lookup(std::size_t n, Lookup&& find, benchmark::IterationCount iterations) {
+    auto& f = fixture(n);
+    uint64_t sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += find(f, f.keys_[f.queries_[i & (kQueries - 1)]]);
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+uint64_t tree_find(Fixture& f, Key key) { return *f.tree_.find(key); }
+uint64_t std_find(Fixture& f, Key key) { return f.std_.find(key)->second; }
+uint64_t flat_find(Fixture& f, Key key) { return *f.flat_.find(key); }
+
+// -----------------------------------------------------------------------------
+// 范围扫描：[keys_[q], keys_[q + kScanLength])
+// -----------------------------------------------------------------------------
+
+template <typename Scan>
+void range(std::size_t n, Scan&& scan, benchmark::IterationCount iterations) {
+    auto& f = fixture(n);
+    uint64_t sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const std::size_t q = f.queries_[i & (kQueries - 1)];
+        sum += scan(f, f.keys_[q], f.keys_[q + kScanLength]);
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+uint64_t tree_scan(Fixture& f, Key from, Key to) {
+    uint64_t sum = 0;
+    f.tree_.scan(from, to, [&](Key, uint64_t value) { sum += value; });
+    return sum;
+}
+
+template <typename Map>
+uint64_t iterate(Map& map, Key from, Key to) {
+    uint64_t sum = 0;
+    for (auto it = map.lower_bound(from); it != map.end() && it->first < to; ++it) {
+        sum += it->second;
+    }
+    return sum;
+}
+
+uint64_t std_scan(Fixture& f, Key from, Key to) { return iterate(f.std_, from, to); }
+
+uint64_t flat_scan(Fixture& f, Key from, Key to) {
+    uint64_t sum = 0;
+    for (auto it = f.flat_.lower_bound(from); it != f.flat_.end() && it.key() < to; ++it) {
+        sum += it.value();
+    }
+    return sum;
+}
+
+// -----------------------------------------------------------------------------
+// 插入：每次重复新建容器
+// -----------------------------------------------------------------------------
+
+template <typename Map>
+void insert(bool sequential, benchmark::IterationCount iterations) {
+    const auto& keys = random_keys();
+    Map map;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const Key key = sequential ? i : keys[i];
+        map.try_emplace(key, i);
+    }
+    DONT_OPTIMIZE(map);
+}
+
+/// BPlusTree 不可移动，在堆上新建
+void tree_insert(bool sequential, benchmark::IterationCount iterations) {
+    const auto& keys = random_keys();
+    auto tree = std::make_unique<Tree>();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const Key key = sequential ? i : keys[i];
+        tree->try_emplace(key, i);
+    }
+    DONT_OPTIMIZE(tree->size());
+}
+
+}  // namespace
+
+// =============================================================================
+// 点查（随机命中）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(btree_find_1M, kConfig) { lookup(k1M, tree_find, iterations); }
+BENCHMARK_WITH_CONFIG(std_map_find_1M, kConfig) { lookup(k1M, std_find, iterations); }
+BENCHMARK_WITH_CONFIG(flat_map_find_1M, kConfig) { lookup(k1M, flat_find, iterations); }
+BENCHMARK_WITH_CONFIG(btree_find_8M, kConfig) { lookup(k8M, tree_find, iterations); }
+BENCHMARK_WITH_CONFIG(std_map_find_8M, kConfig) { lookup(k8M, std_find, iterations); }
+BENCHMARK_WITH_CONFIG(flat_map_find_8M, kConfig) { lookup(k8M, flat_find, iterations); }
+
+// =============================================================================
+// 范围扫描（每次 100 个元素）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(btree_scan_1M, kConfig) { range(k1M, tree_scan, iterations); }
+BENCHMARK_WITH_CONFIG(std_map_scan_1M, kConfig) { range(k1M, std_scan, iterations); }
+BENCHMARK_WITH_CONFIG(flat_map_scan_1M, kConfig) { range(k1M, flat_scan, iterations); }
+BENCHMARK_WITH_CONFIG(btree_scan_8M, kConfig) { range(k8M, tree_scan, iterations); }
+BENCHMARK_WITH_CONFIG(std_map_scan_8M, kConfig) { range(k8M, std_scan, iterations); }
+BENCHMARK_WITH_CONFIG(flat_map_scan_8M, kConfig) { range(k8M, flat_scan, iterations); }
+
+// =============================================================================
+// 插入 50K（随机 / 递增）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(btree_insert_random_50K, kInsertConfig) { tree_insert(false, iterations); }
+BENCHMARK_WITH_CONFIG(std_map_insert_random_50K, kInsertConfig) {
+    insert<std::map<Key, uint64_t>>(false, iterations);
+}
+BENCHMARK_WITH_CONFIG(flat_map_insert_random_50K, kInsertConfig) {
+    insert<FlatMap<Key, uint64_t>>(false, iterations);
+}
+BENCHMARK_WITH_CONFIG(btree_insert_sequential_50K, kInsertConfig) { tree_insert(true, iterations); }
+BENCHMARK_WITH_CONFIG(std_map_insert_sequential_50K, kInsertConfig) {
+    insert<std::map<Key, uint64_t>>(true, iterations);
+}
+BENCHMARK_WITH_CONFIG(flat_map_insert_sequential_50K, kInsertConfig) {
+    insert<FlatMap<Key, uint64_t>>(true, iterations);
+}
+
+// =============================================================================
+// 插入 1M（FlatMap 随机插入不参与）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(btree_insert_random_1M, kLargeInsertConfig) { tree_insert(false, iterations); }
+BENCHMARK_WITH_CONFIG(std_map_insert_random_1M, kLargeInsertConfig) {
+    insert<std::map<Key, uint64_t>>(false, iterations);
+}
+BENCHMARK_WITH_CONFIG(btree_insert_sequential_1M, kLargeInsertConfig) { tree_insert(true, iterations); }
+BENCHMARK_WITH_CONFIG(std_map_insert_sequential_1M, kLargeInsertConfig) {
+    insert<std::map<Key, uint64_t>>(true, iterations);
+}
+BENCHMARK_WITH_CONFIG(flat_map_insert_sequential_1M, kLargeInsertConfig) {
+    insert<FlatMap<Key, uint64_t>>(true, iterations);
+}
+
+int main() {
+    std::cout << "BPlusTree Benchmark v" << benchmark::version() << "\n";
+    std::cout << "Node: " << Tree::kNodeBytes << " bytes, leaf slots " << Tree::kLeafSlots << ", fanout "
+              << Tree::kInnerSlots + 1 << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("btree_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("btree_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
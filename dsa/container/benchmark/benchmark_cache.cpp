@@ -0,0 +1,243 @@
+/**
+ * @file benchmark_cache.cpp
+ * @brief LruCache / ClockCache vs std::list + std::unordered_map LRU：Zipf 分布读穿、分片并发
+ *
+ * 读穿：命中读取值，未命中即插入。键空间 1M，缓存容量为键空间的 10%，值为 32 字节；
+ * 访问序列按 Zipf(θ) 预先生成（θ = 0.99 为典型热点，0.7 较平坦），排名经 mix() 打散为键，
+ * 热点不聚集在相邻槽位。运行结束后另打印各实现的命中率。
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/cache.h"
+
+using namespace container;
+
+namespace {
+
+const auto kConfig =
+    benchmark::Config::quick().min_iterations(1'000'000).max_iterations(1'000'000).repetitions(5);
+const auto kConfig4 = benchmark::Config::concurrent(4).max_iterations(200'000);
+
+constexpr std::size_t kUniverse = std::size_t{1} << 20;
+constexpr std::size_t kCapacity = kUniverse / 10;
+constexpr std::size_t kStream = std::size_t{1} << 22;
+
+using Key = uint64_t;
+using Value = std::array<uint64_t, 4>;
+
+/// 按 Zipf(theta) 采样排名（逆 CDF 二分查找），排名经 mix() 映射为键
+std::vector<Key> zipf_stream(double theta, uint64_t seed) {
+    std::vector<double> cdf(kUniverse);
+    double sum = 0.0;
+    for (std::size_t i = 0; i < kUniverse; ++i) {
+        sum += 1.0 / std::pow(static_cast<double>(i + 1), theta);
+        cdf[i] = sum;
+    }
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> uniform(0.0, sum);
+    std::vector<Key> keys(kStream);
+    for (auto& key : keys) {
+        const auto rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+        key = mix(static_cast<uint64_t>(rank) + 1);
+    }
+    return keys;
+}
+
+const std::vector<Key>& hot_keys() {
+    static const std::vector<Key> keys = zipf_stream(0.99, 1);
+    return keys;
+}
+
+const std::vector<Key>& flat_keys() {
+    static const std::vector<Key> keys = zipf_stream(0.7, 2);
+    return keys;
+}
+
+inline Value make_value(Key key) noexcept { return {key, key + 1, key + 2, key + 3}; }
+
+/// 常见写法：std::list 维护顺序，std::unordered_map 存链表迭代器；每次插入两次堆分配
+class StdLru {
+public:
+    explicit StdLru(std::size_t capacity) : capacity_(capacity) { index_.reserve(capacity); }
+
+    Value* find(Key key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return nullptr;
+        }
+        order_.splice(order_.begin(), order_, it->second);
+        return &it->second->second;
+    }
+
+    void insert_or_assign(Key key, const Value& value) {
+        if (auto it = index_.find(key); it != index_.end()) {
+            it->second->second = value;
+            order_.splice(order_.begin(), order_, it->second);
+            return;
+        }
+        if (order_.size() == capacity_) {
+            index_.erase(order_.back().first);
+            order_.pop_back();
+        }
+        order_.emplace_front(key, value);
+        index_.emplace(key, order_.begin());
+    }
+
+private:
+    std::size_t capacity_;
+    std::list<std::pair<Key, Value>> order_;
+    std::unordered_map<Key, std::list<std::pair<Key, Value>>::iterator> index_;
+};
+
+/// 读穿：命中读取值，未命中插入
+template <typename Cache>
+[[gnu::always_inline]] inline void read_through(Cache& cache, Key key) {
+    if (const Value* value = cache.find(key)) {
+        DONT_OPTIMIZE((*value)[0]);
+    } else {
+        cache.insert_or_assign(key, make_value(key));
+    }
+}
+
+/// 每个 (实现, 分布) 一个缓存，跨重复运行保持预热状态
+template <typename Cache, const std::vector<Key>& (*Keys)()>
+void zipf(benchmark::IterationCount iterations) {
+    static Cache cache(kCapacity);
+    static std::size_t cursor = 0;
+    const auto& keys = Keys();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        read_through(cache, keys[cursor++ & (kStream - 1)]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// 并发：ShardedCache vs 单把锁保护的 LruCache
+// -----------------------------------------------------------------------------
+
+using ShardedClock = ShardedCache<ClockCache<Key, Value, std::hash<Key>, std::equal_to<>, true>>;
+using ShardedLru = ShardedCache<LruCache<Key, Value>>;
+
+/// 全局一把 std::mutex：未分片的基线
+class LockedLru {
+public:
+    explicit LockedLru(std::size_t capacity) : cache_(capacity) {}
+
+    bool visit(Key key) {
+        std::lock_guard lock(mutex_);
+        if (const Value* value = cache_.find(key)) {
+            DONT_OPTIMIZE((*value)[0]);
+            return true;
+        }
+        return false;
+    }
+
+    void insert_or_assign(Key key, const Value& value) {
+        std::lock_guard lock(mutex_);
+        cache_.insert_or_assign(key, value);
+    }
+
+private:
+    std::mutex mutex_;
+    LruCache<Key, Value> cache_;
+};
+
+/// 每个线程从访问序列的不同位置开始
+template <typename Cache>
+void concurrent_zipf(benchmark::IterationCount iterations) {
+    static Cache cache(kCapacity);
+    static std::atomic<std::size_t> next_thread{0};
+    const auto& keys = hot_keys();
+    std::size_t cursor = next_thread.fetch_add(1, std::memory_order_relaxed) * (kStream / 7);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const Key key = keys[cursor++ & (kStream - 1)];
+        bool hit;
+        if constexpr (std::is_same_v<Cache, LockedLru>) {
+            hit = cache.visit(key);
+        } else {
+            hit = cache.visit(key, [](const Value& value) { DONT_OPTIMIZE(value[0]); });
+        }
+        if (!hit) {
+            cache.insert_or_assign(key, make_value(key));
+        }
+    }
+}
+
+/// 预热后在新缓存上重放 1M 次访问，返回统计
+template <typename Cache>
+CacheStats measure(const std::vector<Key>& keys) {
+    Cache cache(kCapacity);
+    for (std::size_t i = 0; i < kStream / 2; ++i) {
+        read_through(cache, keys[i]);
+    }
+    cache.reset_stats();
+    for (std::size_t i = kStream / 2; i < kStream / 2 + 1'000'000; ++i) {
+        read_through(cache, keys[i]);
+    }
+    return cache.stats();
+}
+
+void print_stats(const char* name, const CacheStats& s) {
+    std::cout << "  " << name << ": hit_ratio=" << s.hit_ratio() * 100.0 << "% evictions=" << s.evictions_
+              << "\n";
+}
+
+}  // namespace
+
+// =============================================================================
+// Zipf θ = 0.99
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(std_lru_zipf_099, kConfig) { zipf<StdLru, hot_keys>(iterations); }
+BENCHMARK_WITH_CONFIG(lru_cache_zipf_099, kConfig) { zipf<LruCache<Key, Value>, hot_keys>(iterations); }
+BENCHMARK_WITH_CONFIG(clock_cache_zipf_099, kConfig) { zipf<ClockCache<Key, Value>, hot_keys>(iterations); }
+
+// =============================================================================
+// Zipf θ = 0.7
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(std_lru_zipf_07, kConfig) { zipf<StdLru, flat_keys>(iterations); }
+BENCHMARK_WITH_CONFIG(lru_cache_zipf_07, kConfig) { zipf<LruCache<Key, Value>, flat_keys>(iterations); }
+BENCHMARK_WITH_CONFIG(clock_cache_zipf_07, kConfig) { zipf<ClockCache<Key, Value>, flat_keys>(iterations); }
+
+// =============================================================================
+// 并发：4 线程，Zipf θ = 0.99
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(locked_lru_4_threads, kConfig4) { concurrent_zipf<LockedLru>(iterations); }
+BENCHMARK_WITH_CONFIG(sharded_lru_4_threads, kConfig4) { concurrent_zipf<ShardedLru>(iterations); }
+BENCHMARK_WITH_CONFIG(sharded_clock_4_threads, kConfig4) { concurrent_zipf<ShardedClock>(iterations); }
+
+int main() {
+    std::cout << "Cache Benchmark v" << benchmark::version() << "\n";
+    std::cout << "Universe: " << kUniverse << " keys, capacity " << kCapacity << ", value " << sizeof(Value)
+              << " bytes\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    std::cout << "\nHit ratio (1M accesses after warm-up):\n";
+    print_stats("lru   zipf 0.99", measure<LruCache<Key, Value>>(hot_keys()));
+    print_stats("clock zipf 0.99", measure<ClockCache<Key, Value>>(hot_keys()));
+    print_stats("lru   zipf 0.7 ", measure<LruCache<Key, Value>>(flat_keys()));
+    print_stats("clock zipf 0.7 ", measure<ClockCache<Key, Value>>(flat_keys()));
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("cache_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("cache_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
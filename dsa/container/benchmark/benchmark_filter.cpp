@@ -0,0 +1,221 @@
+/**
+ * @file benchmark_filter.cpp
+ * @brief BlockedBloomFilter / CuckooFilter vs FlatHashMap：1000 万键参考集上的未命中查询吞吐与实测误判率
+ *
+ * 参考集 1000 万个随机 64 位键（最低位为 0），未命中查询的最低位为 1，查询序列 1M 个随机键：
+ * - 单次查询：每次迭代一个键
+ * - 批量查询：contains_batch 一次处理一段查询，先预取整组块/桶；每次迭代仍计一个键
+ * - 过滤器 + 哈希表：过滤器判定可能命中时才探测哈希表，即实际使用方式
+ * - 10 万键（过滤器在 L2 内）：不受访存延迟限制时的单次查询计算开销
+ * 各过滤器的内存与实测误判率在运行前打印
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/bloom_filter.h"
+#include "../detail/cuckoo_filter.h"
+#include "../detail/flat_hash_map.h"
+
+using namespace container;
+
+namespace {
+
+const auto kConfig =
+    benchmark::Config::quick().min_iterations(4'000'000).max_iterations(4'000'000).repetitions(5);
+
+constexpr std::size_t kKeys = 10'000'000;
+constexpr std::size_t kSmallKeys = 100'000;
+constexpr std::size_t kQueries = std::size_t{1} << 20;
+/// 批量查询每次调用的键数
+constexpr std::size_t kChunk = 256;
+constexpr double kTargetFpr = 0.01;
+
+[[nodiscard]] uint64_t splitmix64(uint64_t& state) noexcept {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+struct Fixture {
+    Fixture()
+        : map_(kKeys),
+          bloom_(kKeys, kTargetFpr),
+          cuckoo_(kKeys),
+          cuckoo8_(kKeys),
+          small_bloom_(kSmallKeys, kTargetFpr),
+          small_cuckoo_(kSmallKeys) {
+        uint64_t state = 1;
+        for (std::size_t i = 0; i < kKeys; ++i) {
+            const uint64_t key = splitmix64(state) & ~uint64_t{1};
+            map_.insert_or_assign(key, static_cast<uint32_t>(i));
+            bloom_.insert(key);
+            (void)cuckoo_.insert(key);
+            (void)cuckoo8_.insert(key);
+            if (i < kSmallKeys) {
+                small_bloom_.insert(key);
+                (void)small_cuckoo_.insert(key);
+            }
+            if (i < kQueries) {
+                hits_.push_back(key);
+            }
+        }
+        for (std::size_t i = 0; i < kQueries; ++i) {
+            misses_.push_back(splitmix64(state) | 1);
+        }
+    }
+
+    FlatHashMap<uint64_t, uint32_t> map_;
+    BlockedBloomFilter<uint64_t> bloom_;
+    CuckooFilterFor<uint64_t, kTargetFpr> cuckoo_;
+    CuckooFilterFor<uint64_t, 0.05> cuckoo8_;
+    BlockedBloomFilter<uint64_t> small_bloom_;
+    CuckooFilterFor<uint64_t, kTargetFpr> small_cuckoo_;
+    std::vector<uint64_t> hits_;
+    std::vector<uint64_t> misses_;
+};
+
+Fixture& fixture() {
+    static const auto instance = std::make_unique<Fixture>();
+    return *instance;
+}
+
+/// 每次迭代查询一个键
+template <typename Query>
+[[gnu::always_inline]] inline void run_single(std::size_t iterations, const std::vector<uint64_t>& keys,
+                                              Query&& query) {
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        found += query(keys[i & (kQueries - 1)]);
+    }
+    DONT_OPTIMIZE(found);
+}
+
+/// 每 kChunk 个键调用一次 contains_batch，总键数等于迭代次数
+template <typename Filter>
+[[gnu::always_inline]] inline void run_batch(std::size_t iterations, const Filter& filter,
+                                             const std::vector<uint64_t>& keys) {
+    bool hits[kChunk];
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < iterations; i += kChunk) {
+        const std::size_t n = std::min(kChunk, iterations - i);
+        found += filter.contains_batch(std::span<const uint64_t>(&keys[i & (kQueries - 1)], n), hits);
+    }
+    DONT_OPTIMIZE(found);
+}
+
+template <typename Filter>
+double measured_fpr(const Filter& filter) {
+    std::size_t positives = 0;
+    for (uint64_t key : fixture().misses_) {
+        positives += filter.contains(key);
+    }
+    return static_cast<double>(positives) / kQueries;
+}
+
+}  // namespace
+
+// =============================================================================
+// 未命中：单次查询
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(bloom_contains_miss, kConfig) {
+    const auto& f = fixture();
+    run_single(iterations, f.misses_, [&](uint64_t key) { return f.bloom_.contains(key); });
+}
+
+BENCHMARK_WITH_CONFIG(cuckoo_contains_miss, kConfig) {
+    const auto& f = fixture();
+    run_single(iterations, f.misses_, [&](uint64_t key) { return f.cuckoo_.contains(key); });
+}
+
+BENCHMARK_WITH_CONFIG(flat_hash_map_find_miss, kConfig) {
+    const auto& f = fixture();
+    run_single(iterations, f.misses_, [&](uint64_t key) { return f.map_.contains(key); });
+}
+
+/// 先过过滤器，可能命中（约 1%）时才探测哈希表
+BENCHMARK_WITH_CONFIG(bloom_then_map_miss, kConfig) {
+    const auto& f = fixture();
+    run_single(iterations, f.misses_,
+               [&](uint64_t key) { return f.bloom_.contains(key) && f.map_.contains(key); });
+}
+
+// =============================================================================
+// 未命中：批量查询（预取）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(bloom_contains_batch_miss, kConfig) {
+    run_batch(iterations, fixture().bloom_, fixture().misses_);
+}
+
+BENCHMARK_WITH_CONFIG(cuckoo_contains_batch_miss, kConfig) {
+    run_batch(iterations, fixture().cuckoo_, fixture().misses_);
+}
+
+// =============================================================================
+// 未命中：10 万键，过滤器常驻 L2
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(bloom_contains_miss_small, kConfig) {
+    const auto& f = fixture();
+    run_single(iterations, f.misses_, [&](uint64_t key) { return f.small_bloom_.contains(key); });
+}
+
+BENCHMARK_WITH_CONFIG(cuckoo_contains_miss_small, kConfig) {
+    const auto& f = fixture();
+    run_single(iterations, f.misses_, [&](uint64_t key) { return f.small_cuckoo_.contains(key); });
+}
+
+// =============================================================================
+// 命中
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(bloom_contains_hit, kConfig) {
+    const auto& f = fixture();
+    run_single(iterations, f.hits_, [&](uint64_t key) { return f.bloom_.contains(key); });
+}
+
+BENCHMARK_WITH_CONFIG(flat_hash_map_find_hit, kConfig) {
+    const auto& f = fixture();
+    run_single(iterations, f.hits_, [&](uint64_t key) { return f.map_.contains(key); });
+}
+
+BENCHMARK_WITH_CONFIG(bloom_then_map_hit, kConfig) {
+    const auto& f = fixture();
+    run_single(iterations, f.hits_,
+               [&](uint64_t key) { return f.bloom_.contains(key) && f.map_.contains(key); });
+}
+
+int main() {
+    std::cout << "Filter Benchmark v" << benchmark::version() << "\n";
+    std::cout << "Reference set: " << kKeys << " keys, " << kQueries << " queries\n\n";
+
+    // 先构造参考集与过滤器，不计入首个基准；打印内存与实测误判率
+    const auto& f = fixture();
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << "BlockedBloomFilter  " << f.bloom_.bytes() / 1024 / 1024 << " MB, fpr "
+              << measured_fpr(f.bloom_) * 100 << "% (estimated " << f.bloom_.fpr() * 100 << "%)\n";
+    std::cout << "CuckooFilter<16>    " << f.cuckoo_.bytes() / 1024 / 1024 << " MB, fpr "
+              << measured_fpr(f.cuckoo_) * 100 << "% (load " << f.cuckoo_.load_factor() << ")\n";
+    std::cout << "CuckooFilter<8>     " << f.cuckoo8_.bytes() / 1024 / 1024 << " MB, fpr "
+              << measured_fpr(f.cuckoo8_) * 100 << "% (load " << f.cuckoo8_.load_factor() << ")\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("filter_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("filter_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
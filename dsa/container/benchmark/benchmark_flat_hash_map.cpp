@@ -0,0 +1,232 @@
+/**
+ * @file benchmark_flat_hash_map.cpp
+ * @brief FlatHashMap 与 std::unordered_map 查找开销：命中 / 未命中 / 混合，1K~10M 个键
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/flat_hash_map.h"
+
+using namespace container;
+
+namespace {
+
+const auto kConfig = benchmark::Config::quick().max_iterations(1'000'000).repetitions(5);
+
+/// 查询序列长度上限（超过键数时取键数）
+constexpr std::size_t kMaxQueries = 1 << 20;
+
+[[nodiscard]] uint64_t splitmix64(uint64_t& state) noexcept {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/// 每个规模一份数据：键为随机 64 位整数（最低位为 0），未命中键最低位为 1
+struct Fixture {
+    explicit Fixture(std::size_t n) {
+        uint64_t state = n;
+        flat_.reserve(n);
+        std_.reserve(n);
+        std::vector<uint64_t> keys(n);
+        for (auto& key : keys) {
+            key = splitmix64(state) & ~uint64_t{1};
+            flat_.try_emplace(key, key);
+            std_.try_emplace(key, key);
+        }
+
+        std::mt19937_64 rng(n);
+        const std::size_t q = std::min(n, kMaxQueries);
+        std::shuffle(keys.begin(), keys.end(), rng);
+        hit_.assign(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(q));
+        miss_.resize(q);
+        mixed_.resize(q);
+        for (std::size_t i = 0; i < q; ++i) {
+            miss_[i] = splitmix64(state) | 1;
+            mixed_[i] = (rng() & 1) ? hit_[i] : miss_[i];
+        }
+    }
+
+    FlatHashMap<uint64_t, uint64_t> flat_;
+    std::unordered_map<uint64_t, uint64_t> std_;
+    std::vector<uint64_t> hit_;
+    std::vector<uint64_t> miss_;
+    std::vector<uint64_t> mixed_;
+};
+
+Fixture& fixture(std::size_t n) {
+    static std::map<std::size_t, std::unique_ptr<Fixture>> fixtures;
+    auto& f = fixtures[n];
+    if (!f) {
+        f = std::make_unique<Fixture>(n);
+    }
+    return *f;
+}
+
+enum class Workload { Hit, Miss, Mixed };
+
+[[nodiscard]] const std::vector<uint64_t>& queries(Fixture& f, Workload w) noexcept {
+    switch (w) {
+        case Workload::Hit:
+            return f.hit_;
+        case Workload::Miss:
+            return f.miss_;
+        default:
+            return f.mixed_;
+    }
+}
+
+void flat_lookup(std::size_t n, Workload w, benchmark::IterationCount iterations) {
+    auto& f = fixture(n);
+    const auto& q = queries(f, w);
+    uint64_t sum = 0;
+    for (std::size_t i = 0, j = 0; i < iterations; ++i) {
+        if (const uint64_t* v = f.flat_.get(q[j]); v != nullptr) {
+            sum += *v;
+        }
+        j = j + 1 == q.size() ? 0 : j + 1;
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+void std_lookup(std::size_t n, Workload w, benchmark::IterationCount iterations) {
+    auto& f = fixture(n);
+    const auto& q = queries(f, w);
+    uint64_t sum = 0;
+    for (std::size_t i = 0, j = 0; i < iterations; ++i) {
+        if (auto it = f.std_.find(q[j]); it != f.std_.end()) {
+            sum += it->second;
+        }
+        j = j + 1 == q.size() ? 0 : j + 1;
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+constexpr std::size_t k1K = 1'000;
+constexpr std::size_t k64K = 64'000;
+constexpr std::size_t k1M = 1'000'000;
+constexpr std::size_t k10M = 10'000'000;
+
+}  // namespace
+
+// =============================================================================
+// 命中
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(flat_hit_1K, kConfig) { flat_lookup(k1K, Workload::Hit, iterations); }
+BENCHMARK_WITH_CONFIG(std_hit_1K, kConfig) { std_lookup(k1K, Workload::Hit, iterations); }
+BENCHMARK_WITH_CONFIG(flat_hit_64K, kConfig) { flat_lookup(k64K, Workload::Hit, iterations); }
+BENCHMARK_WITH_CONFIG(std_hit_64K, kConfig) { std_lookup(k64K, Workload::Hit, iterations); }
+BENCHMARK_WITH_CONFIG(flat_hit_1M, kConfig) { flat_lookup(k1M, Workload::Hit, iterations); }
+BENCHMARK_WITH_CONFIG(std_hit_1M, kConfig) { std_lookup(k1M, Workload::Hit, iterations); }
+BENCHMARK_WITH_CONFIG(flat_hit_10M, kConfig) { flat_lookup(k10M, Workload::Hit, iterations); }
+BENCHMARK_WITH_CONFIG(std_hit_10M, kConfig) { std_lookup(k10M, Workload::Hit, iterations); }
+
+// =============================================================================
+// 未命中
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(flat_miss_1K, kConfig) { flat_lookup(k1K, Workload::Miss, iterations); }
+BENCHMARK_WITH_CONFIG(std_miss_1K, kConfig) { std_lookup(k1K, Workload::Miss, iterations); }
+BENCHMARK_WITH_CONFIG(flat_miss_64K, kConfig) { flat_lookup(k64K, Workload::Miss, iterations); }
+BENCHMARK_WITH_CONFIG(std_miss_64K, kConfig) { std_lookup(k64K, Workload::Miss, iterations); }
+BENCHMARK_WITH_CONFIG(flat_miss_1M, kConfig) { flat_lookup(k1M, Workload::Miss, iterations); }
+BENCHMARK_WITH_CONFIG(std_miss_1M, kConfig) { std_lookup(k1M, Workload::Miss, iterations); }
+BENCHMARK_WITH_CONFIG(flat_miss_10M, kConfig) { flat_lookup(k10M, Workload::Miss, iterations); }
+BENCHMARK_WITH_CONFIG(std_miss_10M, kConfig) { std_lookup(k10M, Workload::Miss, iterations); }
+
+// =============================================================================
+// 混合（50% 命中）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(flat_mixed_1K, kConfig) { flat_lookup(k1K, Workload::Mixed, iterations); }
+BENCHMARK_WITH_CONFIG(std_mixed_1K, kConfig) { std_lookup(k1K, Workload::Mixed, iterations); }
+BENCHMARK_WITH_CONFIG(flat_mixed_64K, kConfig) { flat_lookup(k64K, Workload::Mixed, iterations); }
+BENCHMARK_WITH_CONFIG(std_mixed_64K, kConfig) { std_lookup(k64K, Workload::Mixed, iterations); }
+BENCHMARK_WITH_CONFIG(flat_mixed_1M, kConfig) { flat_lookup(k1M, Workload::Mixed, iterations); }
+BENCHMARK_WITH_CONFIG(std_mixed_1M, kConfig) { std_lookup(k1M, Workload::Mixed, iterations); }
+BENCHMARK_WITH_CONFIG(flat_mixed_10M, kConfig) { flat_lookup(k10M, Workload::Mixed, iterations); }
+BENCHMARK_WITH_CONFIG(std_mixed_10M, kConfig) { std_lookup(k10M, Workload::Mixed, iterations); }
+
+// =============================================================================
+// 字符串键（代码表查找：string_view 透明查找 vs 构造 std::string）
+// =============================================================================
+
+namespace {
+
+struct SymbolFixture {
+    static constexpr std::size_t kSymbols = 4096;
+
+    SymbolFixture() {
+        uint64_t state = 7;
+        for (std::size_t i = 0; i < kSymbols; ++i) {
+            std::string symbol = "SYM" + std::to_string(splitmix64(state) % 1'000'000);
+            flat_.try_emplace(symbol, i);
+            std_.try_emplace(symbol, i);
+            queries_.push_back(std::move(symbol));
+        }
+        std::shuffle(queries_.begin(), queries_.end(), std::mt19937_64(7));
+    }
+
+    FlatHashMap<std::string, std::size_t> flat_;
+    std::unordered_map<std::string, std::size_t> std_;
+    std::vector<std::string> queries_;
+};
+
+SymbolFixture& symbols() {
+    static SymbolFixture f;
+    return f;
+}
+
+}  // namespace
+
+BENCHMARK_WITH_CONFIG(flat_symbol_string_view, kConfig) {
+    auto& f = symbols();
+    std::size_t sum = 0;
+    for (std::size_t i = 0, j = 0; i < iterations; ++i) {
+        if (const std::size_t* v = f.flat_.get(std::string_view(f.queries_[j])); v != nullptr) {
+            sum += *v;
+        }
+        j = j + 1 == f.queries_.size() ? 0 : j + 1;
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+BENCHMARK_WITH_CONFIG(std_symbol_string, kConfig) {
+    auto& f = symbols();
+    std::size_t sum = 0;
+    for (std::size_t i = 0, j = 0; i < iterations; ++i) {
+        if (auto it = f.std_.find(f.queries_[j]); it != f.std_.end()) {
+            sum += it->second;
+        }
+        j = j + 1 == f.queries_.size() ? 0 : j + 1;
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+int main() {
+    std::cout << "FlatHashMap Benchmark v" << benchmark::version() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("flat_hash_map_results.json",
+                                          benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("flat_hash_map_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file benchmark_flat_map.cpp
+ * @brief 有序映射查找：FlatMap（Sorted / Eytzinger）vs std::lower_bound vs std::map，
+ *        键数组大小分别落在检测到的 L1 / L2 / L3 内及超出 L3
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../../utility/detail/coreDetector.h"
+#include "../detail/flat_map.h"
+
+using namespace container;
+
+namespace {
+
+const auto kConfig = benchmark::Config::quick().max_iterations(1'000'000).repetitions(5);
+
+using Key = uint64_t;
+
+/// 超出 L3 时的键数上限（std::map 对照组的内存占用约为键数组的 6 倍）
+constexpr std::size_t kMaxKeys = std::size_t{1} << 24;
+constexpr std::size_t kQueries = std::size_t{1} << 20;
+
+enum class Level { L1, L2, L3, Memory };
+
+/// 检测到的数据缓存容量（字节），检测失败时取 memory_constants 默认值
+std::size_t cache_bytes(uint32_t level) {
+    std::size_t bytes = 0;
+    for (const auto& cache : utils::CoreDetector::instance().get_cache_info()) {
+        if (cache.level_ == level && cache.type_ != utils::CacheType::INSTRUCTION) {
+            bytes = cache.size_;
+        }
+    }
+    if (bytes == 0) {
+        bytes = level == 1 ? memory_constants::kL1CacheSize
+                           : (level == 2 ? memory_constants::kL2CacheSize : memory_constants::kL3CacheSize);
+    }
+    return bytes;
+}
+
+/// 键数组占该级缓存一半（超出 L3 时为两倍 L3）
+std::size_t keys_for(Level level) {
+    switch (level) {
+        case Level::L1:
+            return cache_bytes(1) / 2 / sizeof(Key);
+        case Level::L2:
+            return cache_bytes(2) / 2 / sizeof(Key);
+        case Level::L3:
+            return cache_bytes(3) / 2 / sizeof(Key);
+        default:
+            return std::min(kMaxKeys, cache_bytes(3) * 2 / sizeof(Key));
+    }
+}
+
+struct Fixture {
+    explicit Fixture(std::size_t n) {
+        std::mt19937_64 rng(n);
+        std::vector<std::pair<Key, uint64_t>> entries(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            entries[i] = {rng(), i};
+        }
+        sorted_ = FlatMap<Key, uint64_t>(entries);
+        eytzinger_ = FlatMap<Key, uint64_t, FlatMapLayout::Eytzinger>(entries);
+        for (const auto& [key, value] : entries) {
+            keys_.push_back(key);
+            std_.emplace(key, value);
+        }
+        std::sort(keys_.begin(), keys_.end());
+
+        queries_.resize(kQueries);
+        for (auto& q : queries_) {
+            q = entries[rng() % n].first;
+        }
+        std::cout << "  [fixture] " << n << " keys, " << n * sizeof(Key) / 1024 << " KiB of keys\n";
+    }
+
+    FlatMap<Key, uint64_t> sorted_;
+    FlatMap<Key, uint64_t, FlatMapLayout::Eytzinger> eytzinger_;
+    std::vector<Key> keys_;
+    std::map<Key, uint64_t> std_;
+    std::vector<Key> queries_;
+};
+
+Fixture& fixture(Level level) {
+    static std::map<Level, std::unique_ptr<Fixture>> fixtures;
+    auto& f = fixtures[level];
+    if (!f) {
+        f = std::make_unique<Fixture>(keys_for(level));
+    }
+    return *f;
+}
+
+template <typename Lookup>
+void run(Level level, Lookup&& lookup, benchmark::IterationCount iterations) {
+    auto& f = fixture(level);
+    uint64_t sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += lookup(f, f.queries_[i & (kQueries - 1)]);
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+uint64_t sorted_lookup(Fixture& f, Key key) { return *f.sorted_.find(key); }
+uint64_t eytzinger_lookup(Fixture& f, Key key) { return *f.eytzinger_.find(key); }
+uint64_t std_lower_bound(Fixture& f, Key key) {
+    return static_cast<uint64_t>(std::lower_bound(f.keys_.begin(), f.keys_.end(), key) - f.keys_.begin());
+}
+uint64_t std_map_lookup(Fixture& f, Key key) { return f.std_.find(key)->second; }
+
+}  // namespace
+
+// =============================================================================
+// L1
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(flat_sorted_L1, kConfig) { run(Level::L1, sorted_lookup, iterations); }
+BENCHMARK_WITH_CONFIG(flat_eytzinger_L1, kConfig) { run(Level::L1, eytzinger_lookup, iterations); }
+BENCHMARK_WITH_CONFIG(std_lower_bound_L1, kConfig) { run(Level::L1, std_lower_bound, iterations); }
+BENCHMARK_WITH_CONFIG(std_map_L1, kConfig) { run(Level::L1, std_map_lookup, iterations); }
+
+// =============================================================================
+// L2
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(flat_sorted_L2, kConfig) { run(Level::L2, sorted_lookup, iterations); }
+BENCHMARK_WITH_CONFIG(flat_eytzinger_L2, kConfig) { run(Level::L2, eytzinger_lookup, iterations); }
+BENCHMARK_WITH_CONFIG(std_lower_bound_L2, kConfig) { run(Level::L2, std_lower_bound, iterations); }
+BENCHMARK_WITH_CONFIG(std_map_L2, kConfig) { run(Level::L2, std_map_lookup, iterations); }
+
+// =============================================================================
+// L3
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(flat_sorted_L3, kConfig) { run(Level::L3, sorted_lookup, iterations); }
+BENCHMARK_WITH_CONFIG(flat_eytzinger_L3, kConfig) { run(Level::L3, eytzinger_lookup, iterations); }
+BENCHMARK_WITH_CONFIG(std_lower_bound_L3, kConfig) { run(Level::L3, std_lower_bound, iterations); }
+BENCHMARK_WITH_CONFIG(std_map_L3, kConfig) { run(Level::L3, std_map_lookup, iterations); }
+
+// =============================================================================
+// 超出 L3
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(flat_sorted_memory, kConfig) { run(Level::Memory, sorted_lookup, iterations); }
+BENCHMARK_WITH_CONFIG(flat_eytzinger_memory, kConfig) { run(Level::Memory, eytzinger_lookup, iterations); }
+BENCHMARK_WITH_CONFIG(std_lower_bound_memory, kConfig) { run(Level::Memory, std_lower_bound, iterations); }
+BENCHMARK_WITH_CONFIG(std_map_memory, kConfig) { run(Level::Memory, std_map_lookup, iterations); }
+
+int main() {
+    std::cout << "FlatMap Benchmark v" << benchmark::version() << "\n";
+    std::cout << "Data caches: L1=" << cache_bytes(1) / 1024 << " KiB, L2=" << cache_bytes(2) / 1024
+              << " KiB, L3=" << cache_bytes(3) / 1024 << " KiB\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("flat_map_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("flat_map_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
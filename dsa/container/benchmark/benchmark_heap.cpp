@@ -0,0 +1,270 @@
+/**
+ * @file benchmark_heap.cpp
+ * @brief DaryHeap / RadixHeap vs std::priority_queue：稳态 pop + push（hold 模型），decrease-key
+ *
+ * hold 模型：堆预填充 n 个随机截止时间，每次迭代弹出最早的一个并以"当前时间 + 随机延迟"重新插入，
+ * 堆大小保持 n，键单调推进（与定时器一致，RadixHeap 可参与）。所有实现都用 pop + push，不用 replace_top。
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/dary_heap.h"
+#include "../detail/radix_heap.h"
+
+using namespace container;
+
+namespace {
+
+const auto kConfig =
+    benchmark::Config::quick().min_iterations(1'000'000).max_iterations(1'000'000).repetitions(5);
+
+constexpr std::size_t k1K = 1'000;
+constexpr std::size_t k64K = 65'536;
+constexpr std::size_t k1M = 1'000'000;
+constexpr std::size_t k16M = 16'000'000;
+constexpr std::size_t k100M = 100'000'000;
+
+constexpr std::size_t kRandoms = std::size_t{1} << 20;
+
+using Key = uint64_t;
+using PriorityQueue = std::priority_queue<Key, std::vector<Key>, std::greater<Key>>;
+using BinaryHeap = DaryHeap<Key, 2>;
+using QuaternaryHeap = DaryHeap<Key, 4>;
+using OctonaryHeap = DaryHeap<Key, 8>;  // 8 × 8 字节 = 一条缓存行
+using Radix = RadixHeap<>;
+
+/// 随机延迟，[0, 2^32)
+const std::vector<uint32_t>& delays() {
+    static const std::vector<uint32_t> values = [] {
+        std::mt19937 rng(42);
+        std::vector<uint32_t> v(kRandoms);
+        for (auto& x : v) {
+            x = rng();
+        }
+        return v;
+    }();
+    return values;
+}
+
+std::vector<Key> initial_keys(std::size_t n) {
+    std::mt19937_64 rng(n);
+    std::vector<Key> keys(n);
+    for (auto& key : keys) {
+        key = rng() >> 32;
+    }
+    return keys;
+}
+
+template <typename Heap>
+std::shared_ptr<Heap> build(std::size_t n) {
+    auto keys = initial_keys(n);
+    if constexpr (std::is_same_v<Heap, PriorityQueue>) {
+        return std::make_shared<Heap>(std::greater<Key>(), std::move(keys));
+    } else if constexpr (std::is_same_v<Heap, Radix>) {
+        auto heap = std::make_shared<Heap>();
+        for (Key key : keys) {
+            heap->push(key);
+        }
+        return heap;
+    } else {
+        return std::make_shared<Heap>(keys.begin(), keys.end());
+    }
+}
+
+/// 当前预填充的堆：同一时刻只保留一个（100M 个键时单个堆约 0.8~1.6 GB）
+struct Prefilled {
+    std::shared_ptr<void> heap_;
+    const void* tag_{nullptr};
+    std::size_t n_{0};
+};
+
+Prefilled& current() {
+    static Prefilled prefilled;
+    return prefilled;
+}
+
+/// 换类型或大小时先释放上一个堆再构建
+template <typename Heap>
+Heap& prefilled(std::size_t n) {
+    static const char tag = 0;
+    auto& p = current();
+    if (p.tag_ != &tag || p.n_ != n) {
+        p.heap_.reset();
+        p.heap_ = build<Heap>(n);
+        p.tag_ = &tag;
+        p.n_ = n;
+    }
+    return *static_cast<Heap*>(p.heap_.get());
+}
+
+[[gnu::always_inline]] inline Key pop_min(PriorityQueue& heap) {
+    const Key key = heap.top();
+    heap.pop();
+    return key;
+}
+
+template <std::size_t Arity>
+[[gnu::always_inline]] inline Key pop_min(DaryHeap<Key, Arity>& heap) {
+    const Key key = heap.top();
+    heap.pop();
+    return key;
+}
+
+[[gnu::always_inline]] inline Key pop_min(Radix& heap) { return heap.pop().key_; }
+
+template <typename Heap>
+void hold(std::size_t n, benchmark::IterationCount iterations) {
+    const auto& d = delays();
+    Heap& heap = prefilled<Heap>(n);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const Key now = pop_min(heap);
+        heap.push(now + d[i & (kRandoms - 1)]);
+    }
+    DONT_OPTIMIZE(heap.size());
+}
+
+// -----------------------------------------------------------------------------
+// decrease-key：重新调度最早者 + 提前一个随机元素（Dijkstra / 定时器改期）
+// -----------------------------------------------------------------------------
+
+constexpr std::size_t kIdBits = 20;
+constexpr std::size_t kDecreaseCount = std::size_t{1} << kIdBits;
+
+template <std::size_t Arity>
+void indexed_decrease(benchmark::IterationCount iterations) {
+    const auto& d = delays();
+    const auto keys = initial_keys(kDecreaseCount);
+    IndexedDaryHeap<Key, Arity> heap;
+    heap.reserve(kDecreaseCount);
+    for (Key key : keys) {
+        heap.push(key);
+    }
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const uint32_t r = d[i & (kRandoms - 1)];
+        const Key now = heap.top();
+        heap.update(heap.top_handle(), now + r);
+        const auto other = static_cast<uint32_t>(d[(i + 1) & (kRandoms - 1)] & (kDecreaseCount - 1));
+        const Key key = heap.value(other);
+        const Key earlier = std::max(now, key - std::min<Key>(key, r >> 8));
+        if (earlier < key) {
+            heap.update(other, earlier);
+        }
+    }
+    DONT_OPTIMIZE(heap.top());
+}
+
+/// std::priority_queue 无 decrease-key：插入新副本，弹出时跳过过期副本（惰性删除）
+void lazy_decrease(benchmark::IterationCount iterations) {
+    const auto& d = delays();
+    std::vector<Key> current = initial_keys(kDecreaseCount);
+    std::vector<Key> entries(kDecreaseCount);
+    for (std::size_t id = 0; id < kDecreaseCount; ++id) {
+        entries[id] = current[id] << kIdBits | id;
+    }
+    PriorityQueue heap(std::greater<Key>(), std::move(entries));
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const uint32_t r = d[i & (kRandoms - 1)];
+        Key now;
+        std::size_t id;
+        do {
+            const Key entry = pop_min(heap);
+            now = entry >> kIdBits;
+            id = entry & (kDecreaseCount - 1);
+        } while (current[id] != now);
+        current[id] = now + r;
+        heap.push(current[id] << kIdBits | id);
+        const std::size_t other = d[(i + 1) & (kRandoms - 1)] & (kDecreaseCount - 1);
+        const Key key = current[other];
+        const Key earlier = std::max(now, key - std::min<Key>(key, r >> 8));
+        if (earlier < key) {
+            current[other] = earlier;
+            heap.push(earlier << kIdBits | other);
+        }
+    }
+    DONT_OPTIMIZE(heap.size());
+}
+
+}  // namespace
+
+// =============================================================================
+// hold：1K
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(std_pq_hold_1K, kConfig) { hold<PriorityQueue>(k1K, iterations); }
+BENCHMARK_WITH_CONFIG(binary_heap_hold_1K, kConfig) { hold<BinaryHeap>(k1K, iterations); }
+BENCHMARK_WITH_CONFIG(dary4_heap_hold_1K, kConfig) { hold<QuaternaryHeap>(k1K, iterations); }
+BENCHMARK_WITH_CONFIG(dary8_heap_hold_1K, kConfig) { hold<OctonaryHeap>(k1K, iterations); }
+BENCHMARK_WITH_CONFIG(radix_heap_hold_1K, kConfig) { hold<Radix>(k1K, iterations); }
+
+// =============================================================================
+// hold：64K
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(std_pq_hold_64K, kConfig) { hold<PriorityQueue>(k64K, iterations); }
+BENCHMARK_WITH_CONFIG(binary_heap_hold_64K, kConfig) { hold<BinaryHeap>(k64K, iterations); }
+BENCHMARK_WITH_CONFIG(dary4_heap_hold_64K, kConfig) { hold<QuaternaryHeap>(k64K, iterations); }
+BENCHMARK_WITH_CONFIG(dary8_heap_hold_64K, kConfig) { hold<OctonaryHeap>(k64K, iterations); }
+BENCHMARK_WITH_CONFIG(radix_heap_hold_64K, kConfig) { hold<Radix>(k64K, iterations); }
+
+// =============================================================================
+// hold：1M
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(std_pq_hold_1M, kConfig) { hold<PriorityQueue>(k1M, iterations); }
+BENCHMARK_WITH_CONFIG(binary_heap_hold_1M, kConfig) { hold<BinaryHeap>(k1M, iterations); }
+BENCHMARK_WITH_CONFIG(dary4_heap_hold_1M, kConfig) { hold<QuaternaryHeap>(k1M, iterations); }
+BENCHMARK_WITH_CONFIG(dary8_heap_hold_1M, kConfig) { hold<OctonaryHeap>(k1M, iterations); }
+BENCHMARK_WITH_CONFIG(radix_heap_hold_1M, kConfig) { hold<Radix>(k1M, iterations); }
+
+// =============================================================================
+// hold：16M
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(std_pq_hold_16M, kConfig) { hold<PriorityQueue>(k16M, iterations); }
+BENCHMARK_WITH_CONFIG(binary_heap_hold_16M, kConfig) { hold<BinaryHeap>(k16M, iterations); }
+BENCHMARK_WITH_CONFIG(dary4_heap_hold_16M, kConfig) { hold<QuaternaryHeap>(k16M, iterations); }
+BENCHMARK_WITH_CONFIG(dary8_heap_hold_16M, kConfig) { hold<OctonaryHeap>(k16M, iterations); }
+BENCHMARK_WITH_CONFIG(radix_heap_hold_16M, kConfig) { hold<Radix>(k16M, iterations); }
+
+// =============================================================================
+// hold：100M
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(std_pq_hold_100M, kConfig) { hold<PriorityQueue>(k100M, iterations); }
+BENCHMARK_WITH_CONFIG(binary_heap_hold_100M, kConfig) { hold<BinaryHeap>(k100M, iterations); }
+BENCHMARK_WITH_CONFIG(dary4_heap_hold_100M, kConfig) { hold<QuaternaryHeap>(k100M, iterations); }
+BENCHMARK_WITH_CONFIG(dary8_heap_hold_100M, kConfig) { hold<OctonaryHeap>(k100M, iterations); }
+BENCHMARK_WITH_CONFIG(radix_heap_hold_100M, kConfig) { hold<Radix>(k100M, iterations); }
+
+// =============================================================================
+// decrease-key（1M 个元素）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(std_pq_lazy_decrease_1M, kConfig) { lazy_decrease(iterations); }
+BENCHMARK_WITH_CONFIG(indexed_binary_decrease_1M, kConfig) { indexed_decrease<2>(iterations); }
+BENCHMARK_WITH_CONFIG(indexed_dary4_decrease_1M, kConfig) { indexed_decrease<4>(iterations); }
+
+int main() {
+    std::cout << "Heap Benchmark v" << benchmark::version() << "\n";
+    std::cout << "Key: " << sizeof(Key) << " bytes, arity 2 / 4 / 8, radix buckets " << Radix::kBuckets
+              << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("heap_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("heap_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
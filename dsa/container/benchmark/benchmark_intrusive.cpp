@@ -0,0 +1,290 @@
+/**
+ * @file benchmark_intrusive.cpp
+ * @brief 侵入式链表 / 红黑树 vs std::list / std::multiset（默认分配器、pmr 池、单调 arena）
+ *
+ * 场景均为稳态换手：容器内保持固定数量的活跃对象，每次迭代摘除一个并再放入一个。
+ * 侵入式容器复用对象本身，不分配；标准容器每次摘除释放节点、放入分配节点。
+ */
+
+#include <cstdint>
+#include <list>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../../memory/detail/arena.h"
+#include "../detail/intrusive_list.h"
+#include "../detail/intrusive_rbtree.h"
+
+using namespace container;
+
+namespace {
+
+/// 固定迭代次数：初始填充的开销在各实现间相同
+const auto kConfig =
+    benchmark::Config::quick().min_iterations(1'000'000).max_iterations(1'000'000).repetitions(5);
+
+/// 活跃对象个数
+constexpr std::size_t kLive = 16384;
+/// 随机下标序列长度
+constexpr std::size_t kRandoms = std::size_t{1} << 20;
+/// 单调 arena 预留的地址空间（只增不减，换手会持续触碰新页）
+constexpr std::size_t kArenaBytes = std::size_t{1} << 30;
+
+struct Order {
+    ListHook<> hook_;
+    uint64_t id_{0};
+    uint64_t quantity_{0};
+};
+
+struct Timer {
+    RbHook<> hook_;
+    uint64_t deadline_{0};
+};
+
+struct ByDeadline {
+    bool operator()(const Timer& a, const Timer& b) const noexcept { return a.deadline_ < b.deadline_; }
+};
+
+const std::vector<uint32_t>& randoms() {
+    static const std::vector<uint32_t> values = [] {
+        std::mt19937 rng(42);
+        std::vector<uint32_t> v(kRandoms);
+        for (auto& x : v) {
+            x = rng();
+        }
+        return v;
+    }();
+    return values;
+}
+
+/// 标准容器的三种分配方式
+enum class Alloc { Default, Pool, Arena };
+
+/// 按 Alloc 构造 pmr 资源（Default 使用 new_delete_resource）
+struct Resource {
+    explicit Resource(Alloc alloc)
+        : arena_(alloc == Alloc::Arena ? kArenaBytes : 0), arena_resource_(arena_) {
+        switch (alloc) {
+            case Alloc::Default: resource_ = std::pmr::new_delete_resource(); break;
+            case Alloc::Pool: resource_ = &pool_; break;
+            case Alloc::Arena: resource_ = &arena_resource_; break;
+        }
+    }
+
+    std::pmr::unsynchronized_pool_resource pool_;
+    memory::MonotonicArena arena_;
+    memory::ArenaResource arena_resource_;
+    std::pmr::memory_resource* resource_{nullptr};
+};
+
+// -----------------------------------------------------------------------------
+// 订单队列：FIFO 换手（成交队首、新单排队尾）
+// -----------------------------------------------------------------------------
+
+void intrusive_fifo(benchmark::IterationCount iterations) {
+    std::vector<Order> orders(kLive);
+    IntrusiveList<&Order::hook_> queue;
+    for (std::size_t i = 0; i < kLive; ++i) {
+        orders[i].id_ = i;
+        queue.push_back(orders[i]);
+    }
+    uint64_t sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Order* order = queue.pop_front();
+        sum += order->id_;
+        order->id_ = kLive + i;
+        queue.push_back(*order);
+    }
+    DONT_OPTIMIZE(sum);
+    queue.clear();
+}
+
+void std_fifo(Alloc alloc, benchmark::IterationCount iterations) {
+    Resource resource(alloc);
+    std::pmr::list<Order> queue(resource.resource_);
+    for (std::size_t i = 0; i < kLive; ++i) {
+        queue.emplace_back().id_ = i;
+    }
+    uint64_t sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += queue.front().id_;
+        queue.pop_front();
+        queue.emplace_back().id_ = kLive + i;
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+// -----------------------------------------------------------------------------
+// 撤单：随机摘除中间元素并重新排到队尾（std::list 需保存迭代器）
+// -----------------------------------------------------------------------------
+
+void intrusive_cancel(benchmark::IterationCount iterations) {
+    const auto& r = randoms();
+    std::vector<Order> orders(kLive);
+    IntrusiveList<&Order::hook_> queue;
+    for (std::size_t i = 0; i < kLive; ++i) {
+        orders[i].id_ = i;
+        queue.push_back(orders[i]);
+    }
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Order& order = orders[r[i & (kRandoms - 1)] % kLive];
+        queue.erase(order);
+        order.quantity_ = i;
+        queue.push_back(order);
+    }
+    DONT_OPTIMIZE(queue.front()->quantity_);
+    queue.clear();
+}
+
+void std_cancel(Alloc alloc, benchmark::IterationCount iterations) {
+    const auto& r = randoms();
+    Resource resource(alloc);
+    std::pmr::list<Order> queue(resource.resource_);
+    std::vector<std::pmr::list<Order>::iterator> handles(kLive);
+    for (std::size_t i = 0; i < kLive; ++i) {
+        handles[i] = queue.emplace(queue.end());
+        handles[i]->id_ = i;
+    }
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto& handle = handles[r[i & (kRandoms - 1)] % kLive];
+        const uint64_t id = handle->id_;
+        queue.erase(handle);
+        handle = queue.emplace(queue.end());
+        handle->id_ = id;
+        handle->quantity_ = i;
+    }
+    DONT_OPTIMIZE(queue.front().quantity_);
+}
+
+// -----------------------------------------------------------------------------
+// 定时器：取最早到期并以随机延迟重新调度
+// -----------------------------------------------------------------------------
+
+void intrusive_timers(benchmark::IterationCount iterations) {
+    const auto& r = randoms();
+    std::vector<Timer> timers(kLive);
+    IntrusiveRbTree<&Timer::hook_, ByDeadline> tree;
+    for (std::size_t i = 0; i < kLive; ++i) {
+        timers[i].deadline_ = r[i] % (kLive * 16);
+        tree.insert(timers[i]);
+    }
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Timer* timer = tree.pop_front();
+        timer->deadline_ += 1 + r[i & (kRandoms - 1)] % (kLive * 16);
+        tree.insert(*timer);
+    }
+    DONT_OPTIMIZE(tree.front()->deadline_);
+    tree.clear();
+}
+
+void std_timers(Alloc alloc, benchmark::IterationCount iterations) {
+    const auto& r = randoms();
+    Resource resource(alloc);
+    std::pmr::multiset<uint64_t> tree(resource.resource_);
+    for (std::size_t i = 0; i < kLive; ++i) {
+        tree.insert(r[i] % (kLive * 16));
+    }
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const uint64_t deadline = *tree.begin();
+        tree.erase(tree.begin());
+        tree.insert(deadline + 1 + r[i & (kRandoms - 1)] % (kLive * 16));
+    }
+    DONT_OPTIMIZE(*tree.begin());
+}
+
+/// 随机撤销定时器并重新调度（std::multiset 需保存迭代器）
+void intrusive_timer_cancel(benchmark::IterationCount iterations) {
+    const auto& r = randoms();
+    std::vector<Timer> timers(kLive);
+    IntrusiveRbTree<&Timer::hook_, ByDeadline> tree;
+    for (std::size_t i = 0; i < kLive; ++i) {
+        timers[i].deadline_ = r[i] % (kLive * 16);
+        tree.insert(timers[i]);
+    }
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const uint32_t x = r[i & (kRandoms - 1)];
+        Timer& timer = timers[x % kLive];
+        tree.erase(timer);
+        timer.deadline_ += 1 + (x >> 8) % (kLive * 16);
+        tree.insert(timer);
+    }
+    DONT_OPTIMIZE(tree.front()->deadline_);
+    tree.clear();
+}
+
+void std_timer_cancel(Alloc alloc, benchmark::IterationCount iterations) {
+    const auto& r = randoms();
+    Resource resource(alloc);
+    std::pmr::multiset<uint64_t> tree(resource.resource_);
+    std::vector<std::pmr::multiset<uint64_t>::iterator> handles(kLive);
+    for (std::size_t i = 0; i < kLive; ++i) {
+        handles[i] = tree.insert(r[i] % (kLive * 16));
+    }
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const uint32_t x = r[i & (kRandoms - 1)];
+        auto& handle = handles[x % kLive];
+        const uint64_t deadline = *handle + 1 + (x >> 8) % (kLive * 16);
+        tree.erase(handle);
+        handle = tree.insert(deadline);
+    }
+    DONT_OPTIMIZE(*tree.begin());
+}
+
+}  // namespace
+
+// =============================================================================
+// 订单队列 FIFO 换手
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(intrusive_list_fifo, kConfig) { intrusive_fifo(iterations); }
+BENCHMARK_WITH_CONFIG(std_list_fifo, kConfig) { std_fifo(Alloc::Default, iterations); }
+BENCHMARK_WITH_CONFIG(pmr_pool_list_fifo, kConfig) { std_fifo(Alloc::Pool, iterations); }
+BENCHMARK_WITH_CONFIG(arena_list_fifo, kConfig) { std_fifo(Alloc::Arena, iterations); }
+
+// =============================================================================
+// 随机撤单并重新排队
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(intrusive_list_cancel, kConfig) { intrusive_cancel(iterations); }
+BENCHMARK_WITH_CONFIG(std_list_cancel, kConfig) { std_cancel(Alloc::Default, iterations); }
+BENCHMARK_WITH_CONFIG(pmr_pool_list_cancel, kConfig) { std_cancel(Alloc::Pool, iterations); }
+BENCHMARK_WITH_CONFIG(arena_list_cancel, kConfig) { std_cancel(Alloc::Arena, iterations); }
+
+// =============================================================================
+// 定时器：取最早到期并重新调度
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(intrusive_rbtree_timers, kConfig) { intrusive_timers(iterations); }
+BENCHMARK_WITH_CONFIG(std_multiset_timers, kConfig) { std_timers(Alloc::Default, iterations); }
+BENCHMARK_WITH_CONFIG(pmr_pool_multiset_timers, kConfig) { std_timers(Alloc::Pool, iterations); }
+BENCHMARK_WITH_CONFIG(arena_multiset_timers, kConfig) { std_timers(Alloc::Arena, iterations); }
+
+// =============================================================================
+// 定时器：随机撤销并重新调度
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(intrusive_rbtree_cancel, kConfig) { intrusive_timer_cancel(iterations); }
+BENCHMARK_WITH_CONFIG(std_multiset_cancel, kConfig) { std_timer_cancel(Alloc::Default, iterations); }
+BENCHMARK_WITH_CONFIG(pmr_pool_multiset_cancel, kConfig) { std_timer_cancel(Alloc::Pool, iterations); }
+BENCHMARK_WITH_CONFIG(arena_multiset_cancel, kConfig) { std_timer_cancel(Alloc::Arena, iterations); }
+
+int main() {
+    std::cout << "Intrusive Containers Benchmark v" << benchmark::version() << "\n";
+    std::cout << "Live objects: " << kLive << ", list hook " << sizeof(ListHook<>) << " bytes, rbtree hook "
+              << sizeof(RbHook<>) << " bytes\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("intrusive_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("intrusive_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
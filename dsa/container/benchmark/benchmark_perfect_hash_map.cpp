@@ -0,0 +1,209 @@
+/**
+ * @file benchmark_perfect_hash_map.cpp
+ * @brief 编译期完美哈希 vs 按长度 switch + memcmp 链 vs FlatHashMap / std::unordered_map：消息类型名路由
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/flat_hash_map.h"
+#include "../detail/perfect_hash_map.h"
+
+using namespace container;
+using utils::operator""_cs;
+
+namespace {
+
+const auto kConfig = benchmark::Config::quick().max_iterations(1'000'000).repetitions(5);
+
+/// 24 个消息类型名：长度 5~25，其中 18 字符的有 5 个（switch 分支内 memcmp 链最长处）
+constexpr auto kMessageTypes = make_perfect_hash_map(
+    std::pair{"Logon"_cs, 1}, std::pair{"Logout"_cs, 2}, std::pair{"Reject"_cs, 3},
+    std::pair{"Heartbeat"_cs, 4}, std::pair{"MassQuote"_cs, 5}, std::pair{"TestRequest"_cs, 6},
+    std::pair{"QuoteCancel"_cs, 7}, std::pair{"QuoteRequest"_cs, 8}, std::pair{"ResendRequest"_cs, 9},
+    std::pair{"SequenceReset"_cs, 10}, std::pair{"NewOrderSingle"_cs, 11}, std::pair{"SecurityStatus"_cs, 12},
+    std::pair{"ExecutionReport"_cs, 13}, std::pair{"OrderCancelRequest"_cs, 14},
+    std::pair{"OrderStatusRequest"_cs, 15}, std::pair{"SecurityDefinition"_cs, 16},
+    std::pair{"TradeCaptureReport"_cs, 17}, std::pair{"MarketDataSnapshot"_cs, 18},
+    std::pair{"TradingSessionStatus"_cs, 19}, std::pair{"AllocationInstruction"_cs, 20},
+    std::pair{"BusinessMessageReject"_cs, 21}, std::pair{"MarketDataIncremental"_cs, 22},
+    std::pair{"OrderMassCancelRequest"_cs, 23}, std::pair{"OrderCancelReplaceRequest"_cs, 24});
+
+#define MATCH(lit, id)                                        \
+    if (std::memcmp(s.data(), lit, sizeof(lit) - 1) == 0) { \
+        return id;                                            \
+    }
+
+/// 手写路由：按长度分支，同长度内逐个 memcmp
+[[gnu::noinline]] int switch_lookup(std::string_view s) noexcept {
+    switch (s.size()) {
+        case 5:
+            MATCH("Logon", 1)
+            break;
+        case 6:
+            MATCH("Logout", 2)
+            MATCH("Reject", 3)
+            break;
+        case 9:
+            MATCH("Heartbeat", 4)
+            MATCH("MassQuote", 5)
+            break;
+        case 11:
+            MATCH("TestRequest", 6)
+            MATCH("QuoteCancel", 7)
+            break;
+        case 12:
+            MATCH("QuoteRequest", 8)
+            break;
+        case 13:
+            MATCH("ResendRequest", 9)
+            MATCH("SequenceReset", 10)
+            break;
+        case 14:
+            MATCH("NewOrderSingle", 11)
+            MATCH("SecurityStatus", 12)
+            break;
+        case 15:
+            MATCH("ExecutionReport", 13)
+            break;
+        case 18:
+            MATCH("OrderCancelRequest", 14)
+            MATCH("OrderStatusRequest", 15)
+            MATCH("SecurityDefinition", 16)
+            MATCH("TradeCaptureReport", 17)
+            MATCH("MarketDataSnapshot", 18)
+            break;
+        case 20:
+            MATCH("TradingSessionStatus", 19)
+            break;
+        case 21:
+            MATCH("AllocationInstruction", 20)
+            MATCH("BusinessMessageReject", 21)
+            MATCH("MarketDataIncremental", 22)
+            break;
+        case 22:
+            MATCH("OrderMassCancelRequest", 23)
+            break;
+        case 25:
+            MATCH("OrderCancelReplaceRequest", 24)
+            break;
+        default:
+            break;
+    }
+    return 0;
+}
+
+#undef MATCH
+
+[[gnu::noinline]] int perfect_lookup(std::string_view s) noexcept { return kMessageTypes.value_or(s, 0); }
+
+/// 查询序列：随机顺序的消息类型名（存放在运行期字符串中），miss_percent% 替换为同长度的未知名
+struct Fixture {
+    explicit Fixture(unsigned miss_percent) {
+        std::mt19937_64 rng(miss_percent + 1);
+        std::vector<std::string> names;
+        for (const auto& slot : kMessageTypes.slots()) {
+            if (slot.length_ != decltype(kMessageTypes)::kEmptySlot) {
+                names.emplace_back(slot.key_.data(), slot.length_);
+                flat_.try_emplace(names.back(), slot.value_);
+                std_.try_emplace(names.back(), slot.value_);
+            }
+        }
+        storage_.resize(kQueries);
+        for (auto& query : storage_) {
+            query = names[rng() % names.size()];
+            if (rng() % 100 < miss_percent) {
+                query.back() = '#';
+            }
+        }
+        queries_.assign(storage_.begin(), storage_.end());
+    }
+
+    static constexpr std::size_t kQueries = 4096;
+
+    std::vector<std::string> storage_;
+    std::vector<std::string_view> queries_;
+    FlatHashMap<std::string, int> flat_;
+    std::unordered_map<std::string_view, int> std_;
+};
+
+Fixture& hits() {
+    static Fixture f(0);
+    return f;
+}
+
+Fixture& mixed() {
+    static Fixture f(50);
+    return f;
+}
+
+template <typename Lookup>
+void run(Fixture& f, Lookup&& lookup, benchmark::IterationCount iterations) {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += lookup(f.queries_[i & (Fixture::kQueries - 1)]);
+    }
+    DONT_OPTIMIZE(sum);
+}
+
+int flat_value(Fixture& f, std::string_view s) noexcept {
+    const int* v = f.flat_.get(s);
+    return v != nullptr ? *v : 0;
+}
+
+int std_value(Fixture& f, std::string_view s) noexcept {
+    auto it = f.std_.find(s);
+    return it != f.std_.end() ? it->second : 0;
+}
+
+}  // namespace
+
+// =============================================================================
+// 全部命中
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(perfect_hit, kConfig) { run(hits(), perfect_lookup, iterations); }
+BENCHMARK_WITH_CONFIG(switch_memcmp_hit, kConfig) { run(hits(), switch_lookup, iterations); }
+BENCHMARK_WITH_CONFIG(flat_hash_map_hit, kConfig) {
+    run(hits(), [](std::string_view s) { return flat_value(hits(), s); }, iterations);
+}
+BENCHMARK_WITH_CONFIG(unordered_map_hit, kConfig) {
+    run(hits(), [](std::string_view s) { return std_value(hits(), s); }, iterations);
+}
+
+// =============================================================================
+// 50% 未命中（同长度、末字符不同：switch 需比较完整条链）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(perfect_mixed, kConfig) { run(mixed(), perfect_lookup, iterations); }
+BENCHMARK_WITH_CONFIG(switch_memcmp_mixed, kConfig) { run(mixed(), switch_lookup, iterations); }
+BENCHMARK_WITH_CONFIG(flat_hash_map_mixed, kConfig) {
+    run(mixed(), [](std::string_view s) { return flat_value(mixed(), s); }, iterations);
+}
+BENCHMARK_WITH_CONFIG(unordered_map_mixed, kConfig) {
+    run(mixed(), [](std::string_view s) { return std_value(mixed(), s); }, iterations);
+}
+
+int main() {
+    std::cout << "PerfectHashMap Benchmark v" << benchmark::version() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("perfect_hash_map_results.json",
+                                          benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("perfect_hash_map_results.csv",
+                                          benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
@@ -0,0 +1,180 @@
+/**
+ * @file benchmark_small_vector.cpp
+ * @brief SmallVector / InplaceVector vs std::vector：每消息小集合的构造 + push + 遍历、扩容搬移、堆分配次数
+ *
+ * 模拟每条消息构建一个小集合（成交腿，32 字节平凡可复制）：构造空容器、push n 个元素、遍历求和后销毁。
+ * n = 4 / 16 时 SmallVector<Leg, 16> 与 InplaceVector 都不分配；n = 64 时 SmallVector 溢出到堆上。
+ * 另测扩容：可平凡重定位的 unique_ptr 元素按字节搬移，对比 std::vector 逐个移动构造。
+ * 全局 operator new 计数，运行结束后打印每 1000 条消息的堆分配次数。
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/inplace_vector.h"
+#include "../detail/small_vector.h"
+
+using namespace container;
+
+namespace {
+
+std::size_t g_allocations = 0;
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    ++g_allocations;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+const auto kConfig =
+    benchmark::Config::quick().min_iterations(1'000'000).max_iterations(1'000'000).repetitions(5);
+const auto kGrowConfig =
+    benchmark::Config::quick().min_iterations(10'000).max_iterations(10'000).repetitions(5);
+
+struct Leg {
+    uint64_t price_;
+    uint64_t quantity_;
+    uint64_t order_id_;
+    uint64_t flags_;
+};
+
+inline Leg make_leg(uint64_t i) noexcept { return {i * 3, i + 1, i, 0}; }
+
+/// 一条消息：构造空容器、push n 个元素、遍历求和
+template <typename Vector, std::size_t Count>
+[[gnu::always_inline]] inline uint64_t build_message(uint64_t seed) {
+    Vector legs;
+    for (uint64_t i = 0; i < Count; ++i) {
+        legs.push_back(make_leg(seed + i));
+    }
+    uint64_t sum = 0;
+    for (const Leg& leg : legs) {
+        sum += leg.price_ * leg.quantity_;
+    }
+    return sum;
+}
+
+template <typename Vector, std::size_t Count>
+void messages(benchmark::IterationCount iterations) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        DONT_OPTIMIZE((build_message<Vector, Count>(i)));
+    }
+}
+
+/// 从一个元素增长到 1024 个：std::vector 逐个移动构造 + 析构，SmallVector 按字节搬移
+template <typename Vector>
+void grow_unique_ptr(benchmark::IterationCount iterations) {
+    static std::vector<std::unique_ptr<uint64_t>> pool = [] {
+        std::vector<std::unique_ptr<uint64_t>> p;
+        for (uint64_t i = 0; i < 1024; ++i) {
+            p.push_back(std::make_unique<uint64_t>(i));
+        }
+        return p;
+    }();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Vector v;
+        for (auto& p : pool) {
+            v.push_back(std::move(p));
+        }
+        DONT_OPTIMIZE(*v.back());
+        for (std::size_t k = 0; k < pool.size(); ++k) {
+            pool[k] = std::move(v[k]);
+        }
+    }
+}
+
+using StdLegs = std::vector<Leg>;
+using SmallLegs = SmallVector<Leg, 16>;
+template <std::size_t N>
+using InplaceLegs = InplaceVector<Leg, N>;
+
+/// 每 1000 条消息的堆分配次数
+template <typename Vector, std::size_t Count>
+std::size_t allocations_per_1000() {
+    const std::size_t before = g_allocations;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        DONT_OPTIMIZE((build_message<Vector, Count>(i)));
+    }
+    return g_allocations - before;
+}
+
+}  // namespace
+
+// =============================================================================
+// 每条消息 4 个元素
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(std_vector_push_iterate_4, kConfig) { messages<StdLegs, 4>(iterations); }
+BENCHMARK_WITH_CONFIG(small_vector_push_iterate_4, kConfig) { messages<SmallLegs, 4>(iterations); }
+BENCHMARK_WITH_CONFIG(inplace_vector_push_iterate_4, kConfig) { messages<InplaceLegs<16>, 4>(iterations); }
+
+// =============================================================================
+// 每条消息 16 个元素（恰好填满内联容量）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(std_vector_push_iterate_16, kConfig) { messages<StdLegs, 16>(iterations); }
+BENCHMARK_WITH_CONFIG(small_vector_push_iterate_16, kConfig) { messages<SmallLegs, 16>(iterations); }
+BENCHMARK_WITH_CONFIG(inplace_vector_push_iterate_16, kConfig) { messages<InplaceLegs<16>, 16>(iterations); }
+
+// =============================================================================
+// 每条消息 64 个元素（SmallVector 溢出到堆上）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(std_vector_push_iterate_64, kConfig) { messages<StdLegs, 64>(iterations); }
+BENCHMARK_WITH_CONFIG(small_vector_push_iterate_64, kConfig) { messages<SmallLegs, 64>(iterations); }
+BENCHMARK_WITH_CONFIG(inplace_vector_push_iterate_64, kConfig) { messages<InplaceLegs<64>, 64>(iterations); }
+
+// =============================================================================
+// 扩容搬移：1024 个 unique_ptr
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(std_vector_grow_unique_ptr, kGrowConfig) {
+    grow_unique_ptr<std::vector<std::unique_ptr<uint64_t>>>(iterations);
+}
+BENCHMARK_WITH_CONFIG(small_vector_grow_unique_ptr, kGrowConfig) {
+    grow_unique_ptr<SmallVector<std::unique_ptr<uint64_t>, 4>>(iterations);
+}
+
+int main() {
+    std::cout << "SmallVector Benchmark v" << benchmark::version() << "\n";
+    std::cout << "Element: " << sizeof(Leg) << " bytes, SmallVector inline capacity "
+              << SmallLegs::kInlineCapacity << "\n\n";
+
+    std::cout << "Heap allocations per 1000 messages:\n";
+    std::cout << "  n=4   std::vector=" << allocations_per_1000<StdLegs, 4>()
+              << " SmallVector=" << allocations_per_1000<SmallLegs, 4>()
+              << " InplaceVector=" << allocations_per_1000<InplaceLegs<16>, 4>() << "\n";
+    std::cout << "  n=16  std::vector=" << allocations_per_1000<StdLegs, 16>()
+              << " SmallVector=" << allocations_per_1000<SmallLegs, 16>()
+              << " InplaceVector=" << allocations_per_1000<InplaceLegs<16>, 16>() << "\n";
+    std::cout << "  n=64  std::vector=" << allocations_per_1000<StdLegs, 64>()
+              << " SmallVector=" << allocations_per_1000<SmallLegs, 64>()
+              << " InplaceVector=" << allocations_per_1000<InplaceLegs<64>, 64>() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("small_vector_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("small_vector_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
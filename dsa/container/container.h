@@ -0,0 +1,36 @@
+/**
+ * @file container.h
+ * @brief 容器库主头文件
+ * @version 1.0.0
+ *
+ * 面向热路径的容器：SIMD 分组探测的开放寻址哈希表（可固定容量、支持透明字符串查找），
+ * 编译期生成的固定字符串键完美哈希表，SIMD lower_bound / Eytzinger 布局的有序平坦映射，
+ * 节点按缓存行定长、叶子链接的 B+ 树，不分配内存的侵入式链表 / 栈 / 队列 / 红黑树，
+ * 兄弟节点按缓存行成组的 d 叉堆（可 decrease-key）与单调基数堆，
+ * 预分配、不再分配内存的定容 LRU / CLOCK 缓存及其分片并发包装，
+ * 内联存储的小向量 SmallVector 与从不分配的定容向量 InplaceVector（平凡重定位类型按字节搬移），
+ * SIMD 集合运算 / popcount 的定长与变长位图及其秩/选择索引，
+ * 以未命中为主的查找前置的近似成员过滤器（缓存行分块 Bloom 过滤器、支持删除的 Cuckoo 过滤器）
+ */
+
+#pragma once
+
+#include "detail/bitset.h"
+#include "detail/bloom_filter.h"
+#include "detail/btree.h"
+#include "detail/cache.h"
+#include "detail/cuckoo_filter.h"
+#include "detail/dary_heap.h"
+#include "detail/flat_hash_map.h"
+#include "detail/flat_map.h"
+#include "detail/hash.h"
+#include "detail/inplace_vector.h"
+#include "detail/intrusive_hook.h"
+#include "detail/intrusive_list.h"
+#include "detail/intrusive_rbtree.h"
+#include "detail/perfect_hash_map.h"
+#include "detail/radix_heap.h"
+#include "detail/rank_select.h"
+#include "detail/relocate.h"
+#include "detail/simd_search.h"
+#include "detail/small_vector.h"
@@ -0,0 +1,579 @@
+/**
+ * @file bitset.h
+ * @brief 位图：定长 FixedBitset 与变长 DynamicBitset，按字 SIMD 与/或/异或/andnot/popcount，tzcnt 枚举置位
+ * @version 1.0.0
+ *
+ * 活跃合约集合、订阅掩码等大位图的批量集合运算：
+ * - 存储为 64 位字数组，首地址按缓存行对齐；最后一个字中超出 size() 的位始终为 0，
+ *   count / find / 比较都不必再掩码
+ * - 二元运算逐字处理：AVX-512 每次 8 个字，AVX2 每次 4 个字，余数与无 SIMD 时走标量
+ * - popcount：AVX-512 VPOPCNTDQ 直接按 64 位计数；AVX2 用半字节查表（vpshufb）+ vpsadbw 累加
+ * - count_and / intersects 不物化交集，订阅掩码与活跃集合求交只读两份内存
+ * - 置位枚举：逐字取最低置位（tzcnt）再清除（w &= w - 1），全零字一次跳过，代价与置位数成正比
+ *
+ * DynamicBitset 与不同长度的位图运算时，缺少的字视为全 0（&= 会清空多出的部分）。
+ * 秩/选择查询见 rank_select.h。
+ *
+ * 用法：
+ *   DynamicBitset active(kMaxInstruments);
+ *   active.set(id);
+ *   active &= subscribed;
+ *   active.for_each([](std::size_t id) { publish(id); });
+ */
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../common/constants.h"
+#include "../../memory/detail/aligned_allocator.h"
+
+namespace container {
+
+namespace detail {
+
+inline constexpr std::size_t kWordBits = 64;
+
+[[nodiscard]] constexpr std::size_t words_for(std::size_t bits) noexcept {
+    return (bits + kWordBits - 1) / kWordBits;
+}
+
+/// 最后一个字的有效位掩码
+[[nodiscard]] constexpr uint64_t tail_mask(std::size_t bits) noexcept {
+    return bits % kWordBits == 0 ? ~uint64_t{0} : (uint64_t{1} << (bits % kWordBits)) - 1;
+}
+
+// =============================================================================
+// 逐字二元运算
+// =============================================================================
+
+struct BitAnd {
+    static uint64_t scalar(uint64_t a, uint64_t b) noexcept { return a & b; }
+#ifdef __AVX2__
+    static __m256i avx2(__m256i a, __m256i b) noexcept { return _mm256_and_si256(a, b); }
+#endif
+#ifdef __AVX512F__
+    static __m512i avx512(__m512i a, __m512i b) noexcept { return _mm512_and_si512(a, b); }
+#endif
+};
+
+struct BitOr {
+    static uint64_t scalar(uint64_t a, uint64_t b) noexcept { return a | b; }
+#ifdef __AVX2__
+    static __m256i avx2(__m256i a, __m256i b) noexcept { return _mm256_or_si256(a, b); }
+#endif
+#ifdef __AVX512F__
+    static __m512i avx512(__m512i a, __m512i b) noexcept { return _mm512_or_si512(a, b); }
+#endif
+};
+
+struct BitXor {
+    static uint64_t scalar(uint64_t a, uint64_t b) noexcept { return a ^ b; }
+#ifdef __AVX2__
+    static __m256i avx2(__m256i a, __m256i b) noexcept { return _mm256_xor_si256(a, b); }
+#endif
+#ifdef __AVX512F__
+    static __m512i avx512(__m512i a, __m512i b) noexcept { return _mm512_xor_si512(a, b); }
+#endif
+};
+
+/// a & ~b
+struct BitAndNot {
+    static uint64_t scalar(uint64_t a, uint64_t b) noexcept { return a & ~b; }
+#ifdef __AVX2__
+    static __m256i avx2(__m256i a, __m256i b) noexcept { return _mm256_andnot_si256(b, a); }
+#endif
+#ifdef __AVX512F__
+    static __m512i avx512(__m512i a, __m512i b) noexcept { return _mm512_andnot_si512(b, a); }
+#endif
+};
+
+/// dst[i] = Op(a[i], b[i])；dst 可与 a 或 b 相同
+template <typename Op>
+[[gnu::hot]] inline void transform_words(uint64_t* dst, const uint64_t* a, const uint64_t* b,
+                                         std::size_t n) noexcept {
+    std::size_t i = 0;
+#if defined(__AVX512F__)
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_si512(dst + i, Op::avx512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+    }
+#elif defined(__AVX2__)
+    for (; i + 4 <= n; i += 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), Op::avx2(x, y));
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = Op::scalar(a[i], b[i]);
+    }
+}
+
+// =============================================================================
+// popcount
+// =============================================================================
+
+#if defined(__AVX2__) && !defined(__AVX512VPOPCNTDQ__)
+/// 每字节的置位数：高低半字节各查一次 16 项表
+[[nodiscard, gnu::always_inline]] inline __m256i popcount_bytes(__m256i v) noexcept {
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,  //
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0f);
+    const __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low));
+    const __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+    return _mm256_add_epi8(lo, hi);
+}
+#endif
+
+/// Op(a[i], b[i]) 的置位总数，不写回；Op 为 nullptr_t 时只统计 a
+template <typename Op>
+[[nodiscard, gnu::hot]] inline std::size_t count_words(const uint64_t* a, const uint64_t* b,
+                                                       std::size_t n) noexcept {
+    constexpr bool kUnary = std::is_same_v<Op, std::nullptr_t>;
+    std::size_t i = 0;
+    std::size_t count = 0;
+#if defined(__AVX512VPOPCNTDQ__)
+    __m512i acc = _mm512_setzero_si512();
+    for (; i + 8 <= n; i += 8) {
+        __m512i v = _mm512_loadu_si512(a + i);
+        if constexpr (!kUnary) {
+            v = Op::avx512(v, _mm512_loadu_si512(b + i));
+        }
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+    }
+    alignas(64) uint64_t lanes[8];
+    _mm512_store_si512(lanes, acc);
+    for (uint64_t lane : lanes) {
+        count += static_cast<std::size_t>(lane);
+    }
+#elif defined(__AVX2__)
+    __m256i acc = _mm256_setzero_si256();
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        if constexpr (!kUnary) {
+            v = Op::avx2(v, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+        }
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(popcount_bytes(v), _mm256_setzero_si256()));
+    }
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    count = static_cast<std::size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+#endif
+    for (; i < n; ++i) {
+        if constexpr (kUnary) {
+            count += static_cast<std::size_t>(std::popcount(a[i]));
+        } else {
+            count += static_cast<std::size_t>(std::popcount(Op::scalar(a[i], b[i])));
+        }
+    }
+    return count;
+}
+
+[[nodiscard]] inline std::size_t count_words(const uint64_t* words, std::size_t n) noexcept {
+    return count_words<std::nullptr_t>(words, words, n);
+}
+
+/// a 与 b 是否有公共置位（遇到第一个非零交集即返回）
+[[nodiscard]] inline bool intersects_words(const uint64_t* a, const uint64_t* b, std::size_t n) noexcept {
+    std::size_t i = 0;
+#if defined(__AVX512F__)
+    for (; i + 8 <= n; i += 8) {
+        if (_mm512_test_epi64_mask(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)) != 0) {
+            return true;
+        }
+    }
+#elif defined(__AVX2__)
+    for (; i + 4 <= n; i += 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        if (!_mm256_testz_si256(x, y)) {
+            return true;
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        if ((a[i] & b[i]) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// =============================================================================
+// 置位查找与枚举
+// =============================================================================
+
+/// 不小于 pos 的第一个置位；没有时返回 n * 64
+[[nodiscard]] inline std::size_t find_next_word_bit(const uint64_t* words, std::size_t n,
+                                                    std::size_t pos) noexcept {
+    std::size_t i = pos / kWordBits;
+    if (i >= n) {
+        return n * kWordBits;
+    }
+    uint64_t bits = words[i] & (~uint64_t{0} << (pos % kWordBits));
+    while (bits == 0) {
+        if (++i == n) {
+            return n * kWordBits;
+        }
+        bits = words[i];
+    }
+    return i * kWordBits + static_cast<std::size_t>(std::countr_zero(bits));
+}
+
+/// 按升序对每个置位调用 fn(index)
+template <typename Fn>
+[[gnu::always_inline]] inline void for_each_word_bit(const uint64_t* words, std::size_t n, Fn&& fn) {
+    for (std::size_t i = 0; i < n; ++i) {
+        for (uint64_t bits = words[i]; bits != 0; bits &= bits - 1) {
+            fn(i * kWordBits + static_cast<std::size_t>(std::countr_zero(bits)));
+        }
+    }
+}
+
+/// [0, pos) 内的置位数
+[[nodiscard]] inline std::size_t rank_words(const uint64_t* words, std::size_t pos) noexcept {
+    std::size_t count = count_words(words, pos / kWordBits);
+    if (pos % kWordBits != 0) {
+        count += static_cast<std::size_t>(
+            std::popcount(words[pos / kWordBits] & ((uint64_t{1} << (pos % kWordBits)) - 1)));
+    }
+    return count;
+}
+
+/// 字内第 k 个（从 0 起）置位的下标；调用方保证 k < popcount(word)
+[[nodiscard, gnu::always_inline]] inline unsigned select_in_word(uint64_t word, unsigned k) noexcept {
+#ifdef __BMI2__
+    return static_cast<unsigned>(std::countr_zero(_pdep_u64(uint64_t{1} << k, word)));
+#else
+    for (; k > 0; --k) {
+        word &= word - 1;
+    }
+    return static_cast<unsigned>(std::countr_zero(word));
+#endif
+}
+
+/// 第 k 个（从 0 起）置位的下标，线性扫描；没有时返回 n * 64
+[[nodiscard]] inline std::size_t select_words(const uint64_t* words, std::size_t n, std::size_t k) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto ones = static_cast<std::size_t>(std::popcount(words[i]));
+        if (k < ones) {
+            return i * kWordBits + select_in_word(words[i], static_cast<unsigned>(k));
+        }
+        k -= ones;
+    }
+    return n * kWordBits;
+}
+
+}  // namespace detail
+
+// =============================================================================
+// FixedBitset：编译期定长
+// =============================================================================
+
+template <std::size_t Bits>
+class FixedBitset {
+    static_assert(Bits > 0, "FixedBitset must hold at least one bit");
+
+public:
+    static constexpr std::size_t kWords = detail::words_for(Bits);
+
+    constexpr FixedBitset() noexcept = default;
+
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return Bits; }
+
+    // -------------------------------------------------------------------------
+    // 单个位
+    // -------------------------------------------------------------------------
+
+    [[nodiscard, gnu::always_inline]] inline bool test(std::size_t i) const noexcept {
+        return (words_[i / detail::kWordBits] >> (i % detail::kWordBits)) & 1;
+    }
+    [[nodiscard]] inline bool operator[](std::size_t i) const noexcept { return test(i); }
+
+    inline void set(std::size_t i) noexcept { words_[i / detail::kWordBits] |= bit(i); }
+    inline void set(std::size_t i, bool value) noexcept { value ? set(i) : reset(i); }
+    inline void reset(std::size_t i) noexcept { words_[i / detail::kWordBits] &= ~bit(i); }
+    inline void flip(std::size_t i) noexcept { words_[i / detail::kWordBits] ^= bit(i); }
+
+    // -------------------------------------------------------------------------
+    // 整体
+    // -------------------------------------------------------------------------
+
+    void set_all() noexcept {
+        words_.fill(~uint64_t{0});
+        words_[kWords - 1] &= detail::tail_mask(Bits);
+    }
+
+    void reset_all() noexcept { words_.fill(0); }
+
+    void flip_all() noexcept {
+        for (auto& w : words_) {
+            w = ~w;
+        }
+        words_[kWords - 1] &= detail::tail_mask(Bits);
+    }
+
+    [[nodiscard]] std::size_t count() const noexcept { return detail::count_words(words_.data(), kWords); }
+    [[nodiscard]] bool none() const noexcept { return find_first() == Bits; }
+    [[nodiscard]] bool any() const noexcept { return !none(); }
+    [[nodiscard]] bool all() const noexcept { return count() == Bits; }
+
+    // -------------------------------------------------------------------------
+    // 查找与枚举
+    // -------------------------------------------------------------------------
+
+    /// 第一个置位；没有时返回 size()
+    [[nodiscard]] std::size_t find_first() const noexcept { return find_next(0); }
+
+    /// 不小于 pos 的第一个置位；没有时返回 size()
+    [[nodiscard]] std::size_t find_next(std::size_t pos) const noexcept {
+        return std::min(detail::find_next_word_bit(words_.data(), kWords, pos), Bits);
+    }
+
+    /// 按升序对每个置位调用 fn(index)
+    template <typename Fn>
+    inline void for_each(Fn&& fn) const {
+        detail::for_each_word_bit(words_.data(), kWords, std::forward<Fn>(fn));
+    }
+
+    /// [0, pos) 内的置位数（逐字 popcount；频繁查询用 RankSelect）
+    [[nodiscard]] std::size_t rank(std::size_t pos) const noexcept {
+        return detail::rank_words(words_.data(), pos);
+    }
+
+    /// 第 k 个（从 0 起）置位的下标；没有时返回 size()
+    [[nodiscard]] std::size_t select(std::size_t k) const noexcept {
+        return std::min(detail::select_words(words_.data(), kWords, k), Bits);
+    }
+
+    // -------------------------------------------------------------------------
+    // 集合运算
+    // -------------------------------------------------------------------------
+
+    FixedBitset& operator&=(const FixedBitset& other) noexcept {
+        detail::transform_words<detail::BitAnd>(words_.data(), words_.data(), other.words_.data(), kWords);
+        return *this;
+    }
+
+    FixedBitset& operator|=(const FixedBitset& other) noexcept {
+        detail::transform_words<detail::BitOr>(words_.data(), words_.data(), other.words_.data(), kWords);
+        return *this;
+    }
+
+    FixedBitset& operator^=(const FixedBitset& other) noexcept {
+        detail::transform_words<detail::BitXor>(words_.data(), words_.data(), other.words_.data(), kWords);
+        return *this;
+    }
+
+    /// *this &= ~other
+    FixedBitset& and_not(const FixedBitset& other) noexcept {
+        detail::transform_words<detail::BitAndNot>(words_.data(), words_.data(), other.words_.data(), kWords);
+        return *this;
+    }
+
+    [[nodiscard]] friend FixedBitset operator&(FixedBitset a, const FixedBitset& b) noexcept {
+        return a &= b;
+    }
+    [[nodiscard]] friend FixedBitset operator|(FixedBitset a, const FixedBitset& b) noexcept {
+        return a |= b;
+    }
+    [[nodiscard]] friend FixedBitset operator^(FixedBitset a, const FixedBitset& b) noexcept {
+        return a ^= b;
+    }
+
+    /// (*this & other).count()，不物化交集
+    [[nodiscard]] std::size_t count_and(const FixedBitset& other) const noexcept {
+        return detail::count_words<detail::BitAnd>(words_.data(), other.words_.data(), kWords);
+    }
+
+    [[nodiscard]] bool intersects(const FixedBitset& other) const noexcept {
+        return detail::intersects_words(words_.data(), other.words_.data(), kWords);
+    }
+
+    [[nodiscard]] friend bool operator==(const FixedBitset& a, const FixedBitset& b) noexcept {
+        return a.words_ == b.words_;
+    }
+
+    [[nodiscard]] std::span<const uint64_t> words() const noexcept { return words_; }
+
+private:
+    [[nodiscard, gnu::always_inline]] static inline uint64_t bit(std::size_t i) noexcept {
+        return uint64_t{1} << (i % detail::kWordBits);
+    }
+
+    alignas(common::memory_constants::kCacheLineSize) std::array<uint64_t, kWords> words_{};
+};
+
+// =============================================================================
+// DynamicBitset：运行期定长，可 resize
+// =============================================================================
+
+class DynamicBitset {
+public:
+    DynamicBitset() = default;
+
+    explicit DynamicBitset(std::size_t bits, bool value = false) { resize(bits, value); }
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+
+    /// 新增的位取 value
+    void resize(std::size_t bits, bool value = false) {
+        const std::size_t old_size = size_;
+        words_.resize(detail::words_for(bits), value ? ~uint64_t{0} : 0);
+        size_ = bits;
+        if (value && bits > old_size && old_size % detail::kWordBits != 0) {
+            words_[old_size / detail::kWordBits] |= ~detail::tail_mask(old_size);
+        }
+        clear_tail();
+    }
+
+    // -------------------------------------------------------------------------
+    // 单个位
+    // -------------------------------------------------------------------------
+
+    [[nodiscard, gnu::always_inline]] inline bool test(std::size_t i) const noexcept {
+        return (words_[i / detail::kWordBits] >> (i % detail::kWordBits)) & 1;
+    }
+    [[nodiscard]] inline bool operator[](std::size_t i) const noexcept { return test(i); }
+
+    inline void set(std::size_t i) noexcept { words_[i / detail::kWordBits] |= bit(i); }
+    inline void set(std::size_t i, bool value) noexcept { value ? set(i) : reset(i); }
+    inline void reset(std::size_t i) noexcept { words_[i / detail::kWordBits] &= ~bit(i); }
+    inline void flip(std::size_t i) noexcept { words_[i / detail::kWordBits] ^= bit(i); }
+
+    // -------------------------------------------------------------------------
+    // 整体
+    // -------------------------------------------------------------------------
+
+    void set_all() noexcept {
+        std::fill(words_.begin(), words_.end(), ~uint64_t{0});
+        clear_tail();
+    }
+
+    void reset_all() noexcept { std::fill(words_.begin(), words_.end(), 0); }
+
+    void flip_all() noexcept {
+        for (auto& w : words_) {
+            w = ~w;
+        }
+        clear_tail();
+    }
+
+    [[nodiscard]] std::size_t count() const noexcept {
+        return detail::count_words(words_.data(), words_.size());
+    }
+    [[nodiscard]] bool none() const noexcept { return find_first() == size_; }
+    [[nodiscard]] bool any() const noexcept { return !none(); }
+    [[nodiscard]] bool all() const noexcept { return count() == size_; }
+
+    // -------------------------------------------------------------------------
+    // 查找与枚举
+    // -------------------------------------------------------------------------
+
+    /// 第一个置位；没有时返回 size()
+    [[nodiscard]] std::size_t find_first() const noexcept { return find_next(0); }
+
+    /// 不小于 pos 的第一个置位；没有时返回 size()
+    [[nodiscard]] std::size_t find_next(std::size_t pos) const noexcept {
+        return std::min(detail::find_next_word_bit(words_.data(), words_.size(), pos), size_);
+    }
+
+    /// 按升序对每个置位调用 fn(index)
+    template <typename Fn>
+    inline void for_each(Fn&& fn) const {
+        detail::for_each_word_bit(words_.data(), words_.size(), std::forward<Fn>(fn));
+    }
+
+    /// [0, pos) 内的置位数（逐字 popcount；频繁查询用 RankSelect）
+    [[nodiscard]] std::size_t rank(std::size_t pos) const noexcept {
+        return detail::rank_words(words_.data(), pos);
+    }
+
+    /// 第 k 个（从 0 起）置位的下标；没有时返回 size()
+    [[nodiscard]] std::size_t select(std::size_t k) const noexcept {
+        return std::min(detail::select_words(words_.data(), words_.size(), k), size_);
+    }
+
+    // -------------------------------------------------------------------------
+    // 集合运算：other 较短时缺少的字视为 0
+    // -------------------------------------------------------------------------
+
+    DynamicBitset& operator&=(const DynamicBitset& other) noexcept {
+        const std::size_t n = common_words(other);
+        detail::transform_words<detail::BitAnd>(words_.data(), words_.data(), other.words_.data(), n);
+        std::fill(words_.begin() + static_cast<std::ptrdiff_t>(n), words_.end(), 0);
+        return *this;
+    }
+
+    DynamicBitset& operator|=(const DynamicBitset& other) noexcept {
+        detail::transform_words<detail::BitOr>(words_.data(), words_.data(), other.words_.data(),
+                                               common_words(other));
+        clear_tail();
+        return *this;
+    }
+
+    DynamicBitset& operator^=(const DynamicBitset& other) noexcept {
+        detail::transform_words<detail::BitXor>(words_.data(), words_.data(), other.words_.data(),
+                                                common_words(other));
+        clear_tail();
+        return *this;
+    }
+
+    /// *this &= ~other
+    DynamicBitset& and_not(const DynamicBitset& other) noexcept {
+        detail::transform_words<detail::BitAndNot>(words_.data(), words_.data(), other.words_.data(),
+                                                   common_words(other));
+        return *this;
+    }
+
+    [[nodiscard]] friend DynamicBitset operator&(DynamicBitset a, const DynamicBitset& b) { return a &= b; }
+    [[nodiscard]] friend DynamicBitset operator|(DynamicBitset a, const DynamicBitset& b) { return a |= b; }
+    [[nodiscard]] friend DynamicBitset operator^(DynamicBitset a, const DynamicBitset& b) { return a ^= b; }
+
+    /// (*this & other).count()，不物化交集
+    [[nodiscard]] std::size_t count_and(const DynamicBitset& other) const noexcept {
+        return detail::count_words<detail::BitAnd>(words_.data(), other.words_.data(), common_words(other));
+    }
+
+    [[nodiscard]] bool intersects(const DynamicBitset& other) const noexcept {
+        return detail::intersects_words(words_.data(), other.words_.data(), common_words(other));
+    }
+
+    [[nodiscard]] friend bool operator==(const DynamicBitset& a, const DynamicBitset& b) noexcept {
+        return a.size_ == b.size_ && a.words_ == b.words_;
+    }
+
+    [[nodiscard]] std::span<const uint64_t> words() const noexcept { return words_; }
+
+private:
+    [[nodiscard, gnu::always_inline]] static inline uint64_t bit(std::size_t i) noexcept {
+        return uint64_t{1} << (i % detail::kWordBits);
+    }
+
+    [[nodiscard]] inline std::size_t common_words(const DynamicBitset& other) const noexcept {
+        return std::min(words_.size(), other.words_.size());
+    }
+
+    /// 保持"超出 size() 的位为 0"
+    inline void clear_tail() noexcept {
+        if (!words_.empty()) {
+            words_.back() &= detail::tail_mask(size_);
+        }
+    }
+
+    std::vector<uint64_t, memory::AlignedAllocator<uint64_t>> words_;
+    std::size_t size_{0};
+};
+
+}  // namespace container
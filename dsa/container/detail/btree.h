@@ -0,0 +1,668 @@
+/**
+ * @file btree.h
+ * @brief 缓存感知 B+ 树：节点为整数条缓存行，节点内 SIMD 搜索，叶子链表 + 预取的范围扫描
+ * @version 1.0.0
+ *
+ * 面向百万级按键（时间戳、序号）索引的记录，替代 std::map：
+ * - 节点大小 = NodeLines × kCacheLineSize，按缓存行对齐，从 memory::FixedPool 分配（2MB slab，
+ *   节点在内存中聚集，无 malloc 头部）；每次下降只触及一个节点的键所在缓存行
+ * - 节点内搜索：整数键的空位填最大键，对全部槽位做定长 count_less（AVX2 比较 + popcount），
+ *   无分支、无需有效键数；其他键类型用 std::lower_bound
+ * - 分隔键为左子树的最大键，下降时"小于 key 的分隔键个数"即子节点下标
+ * - 叶子双向链接，范围扫描进入一个叶子时用 prefetch_range 预取下一个叶子的全部缓存行
+ * - 插入：叶子满则分裂；在最右叶子末尾追加（时间戳递增）时左节点保持全满，不做对半分裂
+ * - 删除：free-at-empty（叶子空时才释放并从父节点摘除），不做合并/借位
+ * - 批量构造：有序输入自底向上逐层生成，各层节点均匀填满
+ *
+ * 键与值须可平凡复制（节点内以 memmove 移动，释放时不调用析构）。非线程安全。
+ *
+ * 用法：
+ *   BPlusTree<uint64_t, RecordId> index(sorted.begin(), sorted.end());   // 批量构造
+ *   index.try_emplace(ts, id);
+ *   if (RecordId* id = index.find(ts)) { ... }
+ *   index.scan(from, to, [](uint64_t ts, RecordId id) { ... });         // [from, to)
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../common/constants.h"
+#include "../../common/intrinsics.h"
+#include "../../memory/detail/pool.h"
+#include "simd_search.h"
+
+namespace container {
+
+using namespace common;
+
+template <typename K, typename V, std::size_t NodeLines = 4>
+class BPlusTree {
+    static_assert(std::is_trivially_copyable_v<K> && std::is_trivially_copyable_v<V>,
+                  "BPlusTree requires trivially copyable keys and values");
+    static_assert(NodeLines > 0, "BPlusTree node must span at least one cache line");
+
+    struct Leaf;
+    struct Inner;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+    /// 节点字节数
+    static constexpr std::size_t kNodeBytes = NodeLines * memory_constants::kCacheLineSize;
+    /// 叶子槽位数（键值对）：扣除前后链接与计数
+    static constexpr std::size_t kLeafSlots =
+        (kNodeBytes - 2 * sizeof(void*) - sizeof(uint64_t)) / (sizeof(K) + sizeof(V));
+    /// 内部节点槽位数（分隔键），子节点数为 kInnerSlots + 1
+    static constexpr std::size_t kInnerSlots =
+        (kNodeBytes - sizeof(void*) - sizeof(uint64_t)) / (sizeof(K) + sizeof(void*));
+    /// 内部节点层数上限（扇出不小于 5 时可容纳远超 2^64 个键）
+    static constexpr std::size_t kMaxHeight = 32;
+
+    static_assert(kLeafSlots >= 4 && kInnerSlots >= 4, "NodeLines too small for key/value size");
+
+private:
+    struct alignas(memory_constants::kCacheLineSize) Leaf {
+        K keys_[kLeafSlots];
+        V values_[kLeafSlots];
+        Leaf* next_;
+        Leaf* prev_;
+        uint32_t count_;
+    };
+
+    struct alignas(memory_constants::kCacheLineSize) Inner {
+        K keys_[kInnerSlots];
+        void* children_[kInnerSlots + 1];
+        uint32_t count_;
+    };
+
+    static_assert(sizeof(Leaf) <= kNodeBytes && sizeof(Inner) <= kNodeBytes, "node exceeds kNodeBytes");
+
+public:
+    template <bool Const>
+    class Iterator {
+        using LeafPtr = std::conditional_t<Const, const Leaf*, Leaf*>;
+        using ValueRef = std::conditional_t<Const, const V&, V&>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const K&, ValueRef>;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() noexcept = default;
+        Iterator(LeafPtr leaf, uint32_t index) noexcept : leaf_(leaf), index_(index) {}
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other) noexcept : leaf_(other.leaf_), index_(other.index_) {}
+
+        [[nodiscard]] inline const K& key() const noexcept { return leaf_->keys_[index_]; }
+        [[nodiscard]] inline ValueRef value() const noexcept { return leaf_->values_[index_]; }
+        [[nodiscard]] inline value_type operator*() const noexcept { return {key(), value()}; }
+
+        /// 进入新叶子时预取其后继
+        inline Iterator& operator++() noexcept {
+            if (++index_ == leaf_->count_) {
+                leaf_ = leaf_->next_;
+                index_ = 0;
+                if (leaf_ != nullptr && leaf_->next_ != nullptr) {
+                    prefetch_range(leaf_->next_, sizeof(Leaf));
+                }
+            }
+            return *this;
+        }
+
+        inline Iterator operator++(int) noexcept {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        [[nodiscard]] inline bool operator==(const Iterator& other) const noexcept {
+            return leaf_ == other.leaf_ && index_ == other.index_;
+        }
+
+    private:
+        friend class BPlusTree;
+        template <bool>
+        friend class Iterator;
+
+        LeafPtr leaf_{nullptr};
+        uint32_t index_{0};
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    BPlusTree() : pool_(kNodeBytes, memory_constants::kCacheLineSize) { root_ = new_leaf(); }
+
+    /// 由按键升序的 (键, 值) 批量构造
+    template <std::forward_iterator It>
+    BPlusTree(It first, It last) : BPlusTree() {
+        bulk_load(first, last);
+    }
+
+    // 节点归 pool_ 所有，FixedPool 不可移动
+    BPlusTree(const BPlusTree&) = delete;
+    BPlusTree& operator=(const BPlusTree&) = delete;
+    BPlusTree(BPlusTree&&) = delete;
+    BPlusTree& operator=(BPlusTree&&) = delete;
+
+    // -------------------------------------------------------------------------
+    // 批量构造
+    // -------------------------------------------------------------------------
+
+    /// 以按键升序的 (键, 值) 整体替换内容；相等键保留第一个，不大于前一键的项被忽略
+    template <std::forward_iterator It>
+    void bulk_load(It first, It last) {
+        clear();
+        const auto n = static_cast<std::size_t>(std::distance(first, last));
+        if (n == 0) {
+            return;
+        }
+
+        Leaf* head = static_cast<Leaf*>(root_);
+        std::vector<void*> nodes;  // 新分配的节点，失败时归还
+        try {
+            // 叶子层：各叶子键数相差不超过 1
+            const std::size_t leaves = (n + kLeafSlots - 1) / kLeafSlots;
+            std::vector<void*> level;
+            std::vector<K> maxes;
+            level.reserve(leaves);
+            maxes.reserve(leaves);
+            Leaf* leaf = head;
+            level.push_back(leaf);
+            for (; first != last; ++first) {
+                const auto& [key, value] = *first;
+                if (leaf->count_ > 0 && !(leaf->keys_[leaf->count_ - 1] < key)) {
+                    continue;
+                }
+                if (leaf->count_ == quota(n, leaves, level.size() - 1)) {
+                    maxes.push_back(leaf->keys_[leaf->count_ - 1]);
+                    Leaf* next = new_leaf();
+                    nodes.push_back(next);
+                    leaf->next_ = next;
+                    next->prev_ = leaf;
+                    leaf = next;
+                    level.push_back(leaf);
+                }
+                leaf->keys_[leaf->count_] = key;
+                leaf->values_[leaf->count_] = value;
+                ++leaf->count_;
+                ++size_;
+            }
+            maxes.push_back(leaf->keys_[leaf->count_ - 1]);
+
+            // 内部层：每组子节点数相差不超过 1，直到只剩一个节点
+            uint32_t height = 0;
+            while (level.size() > 1) {
+                const std::size_t groups = (level.size() + kInnerSlots) / (kInnerSlots + 1);
+                std::vector<void*> parents;
+                std::vector<K> parent_maxes;
+                parents.reserve(groups);
+                parent_maxes.reserve(groups);
+                std::size_t child = 0;
+                for (std::size_t g = 0; g < groups; ++g) {
+                    const std::size_t take = quota(level.size(), groups, g);
+                    Inner* node = new_inner();
+                    nodes.push_back(node);
+                    for (std::size_t j = 0; j < take; ++j) {
+                        node->children_[j] = level[child + j];
+                        if (j > 0) {
+                            node->keys_[j - 1] = maxes[child + j - 1];
+                        }
+                    }
+                    node->count_ = static_cast<uint32_t>(take - 1);
+                    parents.push_back(node);
+                    parent_maxes.push_back(maxes[child + take - 1]);
+                    child += take;
+                }
+                level.swap(parents);
+                maxes.swap(parent_maxes);
+                ++height;
+            }
+            root_ = level.front();
+            height_ = height;
+        } catch (...) {
+            for (void* node : nodes) {
+                pool_.deallocate(node);
+            }
+            root_ = reset_leaf(head);
+            size_ = 0;
+            height_ = 0;
+            throw;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // 查找
+    // -------------------------------------------------------------------------
+
+    /// 返回值指针，键不存在返回 nullptr
+    [[nodiscard, gnu::hot]]
+    inline V* find(const K& key) noexcept {
+        Leaf* leaf = find_leaf(key);
+        const uint32_t pos = search<kLeafSlots>(leaf->keys_, leaf->count_, key);
+        return pos < leaf->count_ && !(key < leaf->keys_[pos]) ? &leaf->values_[pos] : nullptr;
+    }
+
+    [[nodiscard, gnu::hot]]
+    inline const V* find(const K& key) const noexcept {
+        return const_cast<BPlusTree*>(this)->find(key);
+    }
+
+    [[nodiscard]] inline bool contains(const K& key) const noexcept { return find(key) != nullptr; }
+
+    /// 第一个不小于 key 的元素
+    [[nodiscard, gnu::hot]]
+    inline iterator lower_bound(const K& key) noexcept {
+        Leaf* leaf = find_leaf(key);
+        const uint32_t pos = search<kLeafSlots>(leaf->keys_, leaf->count_, key);
+        return pos < leaf->count_ ? iterator{leaf, pos} : iterator{leaf->next_, 0};
+    }
+
+    [[nodiscard, gnu::hot]]
+    inline const_iterator lower_bound(const K& key) const noexcept {
+        return const_cast<BPlusTree*>(this)->lower_bound(key);
+    }
+
+    /// 对 [from, to) 内的元素按键序调用 fn(key, value)，返回访问个数
+    template <typename Fn>
+    std::size_t scan(const K& from, const K& to, Fn&& fn) {
+        return scan_leaves(*this, from, to, fn);
+    }
+
+    template <typename Fn>
+    std::size_t scan(const K& from, const K& to, Fn&& fn) const {
+        return scan_leaves(*this, from, to, fn);
+    }
+
+    // -------------------------------------------------------------------------
+    // 修改
+    // -------------------------------------------------------------------------
+
+    /// 键不存在时插入；返回 {迭代器, 是否插入}。节点分配失败抛出 std::bad_alloc，树保持不变
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) {
+        PathEntry path[kMaxHeight];
+        Leaf* leaf = descend(key, path);
+        const uint32_t pos = search<kLeafSlots>(leaf->keys_, leaf->count_, key);
+        if (pos < leaf->count_ && !(key < leaf->keys_[pos])) {
+            return {{leaf, pos}, false};
+        }
+
+        const V value(std::forward<Args>(args)...);
+        if (leaf->count_ < kLeafSlots) [[likely]] {
+            insert_into_leaf(leaf, pos, key, value);
+            ++size_;
+            return {{leaf, pos}, true};
+        }
+        iterator it = split_leaf(leaf, pos, key, value, path);
+        ++size_;
+        return {it, true};
+    }
+
+    /// 插入或覆盖
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& value) {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first.value() = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    V& operator[](const K& key) { return try_emplace(key).first.value(); }
+
+    std::size_t erase(const K& key) noexcept {
+        PathEntry path[kMaxHeight];
+        Leaf* leaf = descend(key, path);
+        const uint32_t pos = search<kLeafSlots>(leaf->keys_, leaf->count_, key);
+        if (pos == leaf->count_ || key < leaf->keys_[pos]) {
+            return 0;
+        }
+
+        const uint32_t tail = leaf->count_ - pos - 1;
+        std::memmove(&leaf->keys_[pos], &leaf->keys_[pos + 1], tail * sizeof(K));
+        std::memmove(&leaf->values_[pos], &leaf->values_[pos + 1], tail * sizeof(V));
+        --leaf->count_;
+        pad(leaf->keys_, leaf->count_, leaf->count_ + 1);
+        --size_;
+
+        if (leaf->count_ == 0 && height_ > 0) {
+            remove_leaf(leaf, path);
+        }
+        return 1;
+    }
+
+    /// 归还全部节点（保留一个空的根叶子）
+    void clear() {
+        void* fresh = allocate_node();
+        free_subtree(root_, height_);
+        root_ = reset_leaf(static_cast<Leaf*>(fresh));
+        height_ = 0;
+        size_ = 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // 查询与遍历（按键序）
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+
+    /// 内部节点层数（仅有根叶子时为 0）
+    [[nodiscard]] inline uint32_t height() const noexcept { return height_; }
+
+    [[nodiscard]] inline iterator begin() noexcept {
+        Leaf* leaf = leftmost_leaf();
+        return leaf->count_ > 0 ? iterator{leaf, 0} : end();
+    }
+    [[nodiscard]] inline iterator end() noexcept { return {}; }
+    [[nodiscard]] inline const_iterator begin() const noexcept {
+        return const_cast<BPlusTree*>(this)->begin();
+    }
+    [[nodiscard]] inline const_iterator end() const noexcept { return {}; }
+
+private:
+    struct PathEntry {
+        Inner* node_;
+        uint32_t index_;
+    };
+
+    /// 整数键的空槽填最大键：定长 count_less 不会把空槽计入
+    static constexpr bool kPadded = detail::SimdSearchKey<K>;
+
+    static inline void pad(K* keys, std::size_t from, std::size_t to) noexcept {
+        if constexpr (kPadded) {
+            std::fill(keys + from, keys + to, std::numeric_limits<K>::max());
+        }
+    }
+
+    /// 节点内第一个不小于 key 的下标
+    template <std::size_t Slots>
+    [[nodiscard, gnu::hot, gnu::always_inline]]
+    static inline uint32_t search(const K* keys, uint32_t count, const K& key) noexcept {
+        if constexpr (kPadded) {
+            return static_cast<uint32_t>(detail::count_less<K, Slots>(keys, key));
+        } else {
+            return static_cast<uint32_t>(std::lower_bound(keys, keys + count, key) - keys);
+        }
+    }
+
+    /// 第 index 份（共 parts 份）分得的数量，各份相差不超过 1
+    [[nodiscard]] static constexpr std::size_t quota(std::size_t total, std::size_t parts,
+                                                     std::size_t index) noexcept {
+        return total / parts + (index < total % parts ? 1 : 0);
+    }
+
+    [[nodiscard, gnu::hot, gnu::always_inline]]
+    inline Leaf* find_leaf(const K& key) const noexcept {
+        void* node = root_;
+        for (uint32_t level = height_; level > 0; --level) {
+            const auto* inner = static_cast<const Inner*>(node);
+            node = inner->children_[search<kInnerSlots>(inner->keys_, inner->count_, key)];
+        }
+        return static_cast<Leaf*>(node);
+    }
+
+    /// 下降并记录路径：path[0] 为根
+    [[gnu::always_inline]] inline Leaf* descend(const K& key, PathEntry* path) const noexcept {
+        void* node = root_;
+        for (uint32_t level = 0; level < height_; ++level) {
+            auto* inner = static_cast<Inner*>(node);
+            const uint32_t index = search<kInnerSlots>(inner->keys_, inner->count_, key);
+            path[level] = {inner, index};
+            node = inner->children_[index];
+        }
+        return static_cast<Leaf*>(node);
+    }
+
+    [[nodiscard]] inline Leaf* leftmost_leaf() const noexcept {
+        void* node = root_;
+        for (uint32_t level = height_; level > 0; --level) {
+            node = static_cast<Inner*>(node)->children_[0];
+        }
+        return static_cast<Leaf*>(node);
+    }
+
+    template <typename Self, typename Fn>
+    static std::size_t scan_leaves(Self& self, const K& from, const K& to, Fn& fn) {
+        std::conditional_t<std::is_const_v<Self>, const Leaf*, Leaf*> leaf = self.find_leaf(from);
+        uint32_t i = search<kLeafSlots>(leaf->keys_, leaf->count_, from);
+        std::size_t visited = 0;
+        for (; leaf != nullptr; leaf = leaf->next_, i = 0) {
+            if (leaf->next_ != nullptr) {
+                prefetch_range(leaf->next_, sizeof(Leaf));
+            }
+            for (; i < leaf->count_; ++i) {
+                if (!(leaf->keys_[i] < to)) {
+                    return visited;
+                }
+                fn(leaf->keys_[i], leaf->values_[i]);
+                ++visited;
+            }
+        }
+        return visited;
+    }
+
+    // -------------------------------------------------------------------------
+    // 节点分配
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] void* allocate_node() {
+        void* p = pool_.allocate();
+        if (p == nullptr) [[unlikely]] {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+
+    static Leaf* reset_leaf(Leaf* leaf) noexcept {
+        leaf->next_ = nullptr;
+        leaf->prev_ = nullptr;
+        leaf->count_ = 0;
+        pad(leaf->keys_, 0, kLeafSlots);
+        return leaf;
+    }
+
+    static Inner* reset_inner(Inner* inner) noexcept {
+        inner->count_ = 0;
+        pad(inner->keys_, 0, kInnerSlots);
+        return inner;
+    }
+
+    [[nodiscard]] Leaf* new_leaf() { return reset_leaf(::new (allocate_node()) Leaf); }
+    [[nodiscard]] Inner* new_inner() { return reset_inner(::new (allocate_node()) Inner); }
+
+    void free_subtree(void* node, uint32_t level) noexcept {
+        if (level > 0) {
+            auto* inner = static_cast<Inner*>(node);
+            for (uint32_t i = 0; i <= inner->count_; ++i) {
+                free_subtree(inner->children_[i], level - 1);
+            }
+        }
+        pool_.deallocate(node);
+    }
+
+    // -------------------------------------------------------------------------
+    // 插入
+    // -------------------------------------------------------------------------
+
+    static void insert_into_leaf(Leaf* leaf, uint32_t pos, const K& key, const V& value) noexcept {
+        const uint32_t tail = leaf->count_ - pos;
+        std::memmove(&leaf->keys_[pos + 1], &leaf->keys_[pos], tail * sizeof(K));
+        std::memmove(&leaf->values_[pos + 1], &leaf->values_[pos], tail * sizeof(V));
+        leaf->keys_[pos] = key;
+        leaf->values_[pos] = value;
+        ++leaf->count_;
+    }
+
+    /// 满叶子分裂后插入；所需节点先全部分配好，分配失败时树不变
+    iterator split_leaf(Leaf* leaf, uint32_t pos, const K& key, const V& value, PathEntry* path) {
+        // 自底向上连续满的内部节点都要分裂；全满时根也分裂，另需一个新根
+        std::size_t needed = 1;
+        uint32_t level = height_;
+        while (level > 0 && path[level - 1].node_->count_ == kInnerSlots) {
+            ++needed;
+            --level;
+        }
+        if (level == 0) {
+            ++needed;
+        }
+        void* spare[kMaxHeight + 2];
+        std::size_t got = 0;
+        try {
+            for (; got < needed; ++got) {
+                spare[got] = allocate_node();
+            }
+        } catch (...) {
+            while (got > 0) {
+                pool_.deallocate(spare[--got]);
+            }
+            throw;
+        }
+
+        // 在最右叶子末尾追加：左叶子保持全满，新叶子只放新键
+        const bool append = pos == leaf->count_ && leaf->next_ == nullptr;
+        constexpr uint32_t kTotal = kLeafSlots + 1;
+        const uint32_t split = append ? static_cast<uint32_t>(kLeafSlots) : kTotal / 2;
+
+        Leaf* right = reset_leaf(::new (spare[--got]) Leaf);
+        const uint32_t moved_from = pos < split ? split - 1 : split;
+        const uint32_t moved = leaf->count_ - moved_from;
+        std::memcpy(right->keys_, &leaf->keys_[moved_from], moved * sizeof(K));
+        std::memcpy(right->values_, &leaf->values_[moved_from], moved * sizeof(V));
+        right->count_ = moved;
+        leaf->count_ = moved_from;
+        pad(leaf->keys_, moved_from, kLeafSlots);
+
+        right->next_ = leaf->next_;
+        right->prev_ = leaf;
+        if (right->next_ != nullptr) {
+            right->next_->prev_ = right;
+        }
+        leaf->next_ = right;
+
+        iterator it;
+        if (pos < split) {
+            insert_into_leaf(leaf, pos, key, value);
+            it = {leaf, pos};
+        } else {
+            insert_into_leaf(right, pos - split, key, value);
+            it = {right, pos - split};
+        }
+
+        insert_into_parent(path, leaf->keys_[leaf->count_ - 1], right, append, spare, got);
+        return it;
+    }
+
+    /// 把 (分隔键, 右兄弟) 插到 path 末端的父节点，满则继续向上分裂
+    void insert_into_parent(PathEntry* path, K separator, void* right, bool append, void** spare,
+                            std::size_t got) noexcept {
+        for (uint32_t level = height_; level > 0; --level) {
+            Inner* node = path[level - 1].node_;
+            const uint32_t index = path[level - 1].index_;
+            if (node->count_ < kInnerSlots) {
+                const uint32_t tail = node->count_ - index;
+                std::memmove(&node->keys_[index + 1], &node->keys_[index], tail * sizeof(K));
+                std::memmove(&node->children_[index + 2], &node->children_[index + 1],
+                             tail * sizeof(void*));
+                node->keys_[index] = separator;
+                node->children_[index + 1] = right;
+                ++node->count_;
+                return;
+            }
+
+            // 满节点：合并成 kInnerSlots + 1 个键再切分，中间键上移
+            constexpr uint32_t kTotal = kInnerSlots + 1;
+            K keys[kTotal];
+            void* children[kTotal + 1];
+            std::memcpy(keys, node->keys_, index * sizeof(K));
+            keys[index] = separator;
+            std::memcpy(&keys[index + 1], &node->keys_[index], (kInnerSlots - index) * sizeof(K));
+            std::memcpy(children, node->children_, (index + 1) * sizeof(void*));
+            children[index + 1] = right;
+            std::memcpy(&children[index + 2], &node->children_[index + 1],
+                        (kInnerSlots - index) * sizeof(void*));
+
+            const uint32_t mid = append ? kTotal - 1 : kTotal / 2;
+            Inner* sibling = reset_inner(::new (spare[--got]) Inner);
+            std::memcpy(node->keys_, keys, mid * sizeof(K));
+            std::memcpy(node->children_, children, (mid + 1) * sizeof(void*));
+            node->count_ = mid;
+            pad(node->keys_, mid, kInnerSlots);
+            std::memcpy(sibling->keys_, &keys[mid + 1], (kTotal - mid - 1) * sizeof(K));
+            std::memcpy(sibling->children_, &children[mid + 1], (kTotal - mid) * sizeof(void*));
+            sibling->count_ = kTotal - mid - 1;
+
+            separator = keys[mid];
+            right = sibling;
+        }
+
+        Inner* root = reset_inner(::new (spare[--got]) Inner);
+        root->keys_[0] = separator;
+        root->children_[0] = root_;
+        root->children_[1] = right;
+        root->count_ = 1;
+        root_ = root;
+        ++height_;
+    }
+
+    // -------------------------------------------------------------------------
+    // 删除
+    // -------------------------------------------------------------------------
+
+    /// 摘除空叶子；父节点随之变空则一并释放；根只剩一个子节点时降低树高
+    void remove_leaf(Leaf* leaf, PathEntry* path) noexcept {
+        if (leaf->prev_ != nullptr) {
+            leaf->prev_->next_ = leaf->next_;
+        }
+        if (leaf->next_ != nullptr) {
+            leaf->next_->prev_ = leaf->prev_;
+        }
+        pool_.deallocate(leaf);
+
+        for (uint32_t level = height_; level > 0; --level) {
+            Inner* node = path[level - 1].node_;
+            const uint32_t index = path[level - 1].index_;
+            if (node->count_ == 0) {
+                pool_.deallocate(node);
+                continue;
+            }
+            // 去掉子节点 index 及其一侧的分隔键，剩余分隔键仍是各左子树键的上界
+            const uint32_t key_index = index > 0 ? index - 1 : 0;
+            std::memmove(&node->keys_[key_index], &node->keys_[key_index + 1],
+                         (node->count_ - key_index - 1) * sizeof(K));
+            std::memmove(&node->children_[index], &node->children_[index + 1],
+                         (node->count_ - index) * sizeof(void*));
+            --node->count_;
+            pad(node->keys_, node->count_, node->count_ + 1);
+            break;
+        }
+
+        while (height_ > 0 && static_cast<Inner*>(root_)->count_ == 0) {
+            void* child = static_cast<Inner*>(root_)->children_[0];
+            pool_.deallocate(root_);
+            root_ = child;
+            --height_;
+        }
+    }
+
+    memory::FixedPool pool_;
+    void* root_{nullptr};
+    uint32_t height_{0};
+    std::size_t size_{0};
+};
+
+}  // namespace container
@@ -0,0 +1,897 @@
+/**
+ * @file cache.h
+ * @brief 定容缓存：LRU（开放寻址索引 + 下标链表）、CLOCK（命中不改链表）与分片并发包装
+ * @version 1.0.0
+ *
+ * 缓存解码后的参考数据、计算结果等；容量在构造时确定，全部存储一次分配，之后插入/淘汰不再分配内存：
+ * - 索引：线性探测开放寻址，桶 8 字节 {标签, 槽位}，负载不超过 1/2；删除采用后移（backward shift），
+ *   不留墓碑，长时间插入/淘汰后探测长度不退化。标签为混合后哈希的低 32 位，起始桶取标签低位
+ * - LruCache：近期使用顺序为 uint32 下标双向链表，链接存于独立数组（每项 8 字节，比节点紧凑）；
+ *   命中移到表头，已满时淘汰表尾，淘汰的槽位以赋值复用（std::string 等保留已有缓冲区）
+ * - ClockCache：每个槽位一个访问频率（0~3，原子字节），命中时只在未饱和时加一，不移动任何链表；
+ *   淘汰时指针循环扫过槽位，频率非 0 则减一，为 0 即淘汰。新插入的频率为 0，只访问一次的键
+ *   在下一轮扫描即被淘汰（抗扫描）。命中路径对共享结构只读（热键频率饱和后连频率字节也不写），
+ *   ConcurrentReads 为 true 时查找可在读锁下并发执行
+ * - ShardedCache：按哈希分到 2 的幂个分片（不超过 kMaxPartitions），每片一把 RwSpinLock；
+ *   ClockCache<..., true> 的查找取读锁，LruCache 的查找要移动链表，取写锁
+ *
+ * 统计命中、未命中、插入与淘汰次数（peek 不计入）；ConcurrentReads 时计数器为 relaxed 原子操作。
+ *
+ * 用法：
+ *   LruCache<uint64_t, RiskValue> risk(4096);
+ *   if (RiskValue* v = risk.find(id)) { ... } else { risk.insert_or_assign(id, compute(id)); }
+ *
+ *   ShardedCache<ClockCache<std::string, RefData, StringHash, StringEqual, true>> refs(1 << 20);
+ *   refs.visit(symbol, [](const RefData& r) { ... });
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../common/constants.h"
+#include "../../concurrent/detail/spinlock.h"
+#include "../../memory/detail/aligned_allocator.h"
+#include "hash.h"
+
+namespace container {
+
+using namespace common;
+
+// =============================================================================
+// 统计
+// =============================================================================
+
+struct CacheStats {
+    uint64_t hits_{0};
+    uint64_t misses_{0};
+    uint64_t insertions_{0};  // 新键插入次数（覆盖已有键不计）
+    uint64_t evictions_{0};   // 因容量已满淘汰的次数（erase 不计）
+
+    [[nodiscard]] inline double hit_ratio() const noexcept {
+        const uint64_t lookups = hits_ + misses_;
+        return lookups == 0 ? 0.0 : static_cast<double>(hits_) / static_cast<double>(lookups);
+    }
+
+    inline CacheStats& operator+=(const CacheStats& other) noexcept {
+        hits_ += other.hits_;
+        misses_ += other.misses_;
+        insertions_ += other.insertions_;
+        evictions_ += other.evictions_;
+        return *this;
+    }
+};
+
+namespace detail {
+
+template <bool Atomic>
+class CacheCounters;
+
+/// 单线程（或写锁内）使用：普通计数
+template <>
+class CacheCounters<false> {
+public:
+    [[gnu::always_inline]] inline void hit() noexcept { ++stats_.hits_; }
+    [[gnu::always_inline]] inline void miss() noexcept { ++stats_.misses_; }
+    [[gnu::always_inline]] inline void inserted() noexcept { ++stats_.insertions_; }
+    [[gnu::always_inline]] inline void evicted() noexcept { ++stats_.evictions_; }
+    [[nodiscard]] inline CacheStats snapshot() const noexcept { return stats_; }
+    inline void reset() noexcept { stats_ = {}; }
+
+private:
+    CacheStats stats_;
+};
+
+/// 查找可并发（读锁内）：relaxed 原子计数
+template <>
+class CacheCounters<true> {
+public:
+    [[gnu::always_inline]] inline void hit() noexcept { hits_.fetch_add(1, std::memory_order_relaxed); }
+    [[gnu::always_inline]] inline void miss() noexcept { misses_.fetch_add(1, std::memory_order_relaxed); }
+    [[gnu::always_inline]] inline void inserted() noexcept {
+        insertions_.fetch_add(1, std::memory_order_relaxed);
+    }
+    [[gnu::always_inline]] inline void evicted() noexcept {
+        evictions_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] inline CacheStats snapshot() const noexcept {
+        return {hits_.load(std::memory_order_relaxed), misses_.load(std::memory_order_relaxed),
+                insertions_.load(std::memory_order_relaxed), evictions_.load(std::memory_order_relaxed)};
+    }
+
+    inline void reset() noexcept {
+        hits_.store(0, std::memory_order_relaxed);
+        misses_.store(0, std::memory_order_relaxed);
+        insertions_.store(0, std::memory_order_relaxed);
+        evictions_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> insertions_{0};
+    std::atomic<uint64_t> evictions_{0};
+};
+
+// =============================================================================
+// 开放寻址索引
+// =============================================================================
+
+/// 键 → 槽位下标。只存标签不存键，匹配标签后由调用方比较键
+class CacheIndex {
+public:
+    static constexpr uint32_t kNone = UINT32_MAX;
+
+    explicit CacheIndex(std::size_t capacity)
+        : buckets_(std::bit_ceil(std::max(capacity * 2, kMinBuckets)), Bucket{0, kNone}),
+          mask_(buckets_.size() - 1) {}
+
+    /// 返回标签相同且 match(槽位) 为真的槽位，不存在返回 kNone
+    template <typename Match>
+    [[nodiscard, gnu::always_inline]]
+    inline uint32_t find(uint32_t tag, Match&& match) const noexcept {
+        for (std::size_t i = tag & mask_;; i = (i + 1) & mask_) {
+            const Bucket bucket = buckets_[i];
+            if (bucket.slot_ == kNone) {
+                return kNone;
+            }
+            if (bucket.tag_ == tag && match(bucket.slot_)) {
+                return bucket.slot_;
+            }
+        }
+    }
+
+    /// 调用方保证键不存在
+    inline void insert(uint32_t tag, uint32_t slot) noexcept {
+        std::size_t i = tag & mask_;
+        while (buckets_[i].slot_ != kNone) {
+            i = (i + 1) & mask_;
+        }
+        buckets_[i] = {tag, slot};
+    }
+
+    /// 按槽位定位（无需比较键），随后把探测链上可前移的桶逐个后移填补空位
+    inline void erase(uint32_t tag, uint32_t slot) noexcept {
+        std::size_t hole = tag & mask_;
+        while (buckets_[hole].slot_ != slot) {
+            hole = (hole + 1) & mask_;
+        }
+        for (std::size_t i = (hole + 1) & mask_; buckets_[i].slot_ != kNone; i = (i + 1) & mask_) {
+            const std::size_t home = buckets_[i].tag_ & mask_;
+            if (((i - home) & mask_) >= ((i - hole) & mask_)) {
+                buckets_[hole] = buckets_[i];
+                hole = i;
+            }
+        }
+        buckets_[hole].slot_ = kNone;
+    }
+
+    inline void clear() noexcept { std::fill(buckets_.begin(), buckets_.end(), Bucket{0, kNone}); }
+
+    [[nodiscard]] inline std::size_t bucket_count() const noexcept { return buckets_.size(); }
+
+private:
+    struct Bucket {
+        uint32_t tag_;
+        uint32_t slot_;
+    };
+
+    static constexpr std::size_t kMinBuckets = memory_constants::kCacheLineSize / sizeof(Bucket);
+
+    std::vector<Bucket, memory::AlignedAllocator<Bucket>> buckets_;
+    std::size_t mask_;
+};
+
+[[nodiscard, gnu::always_inline]]
+inline uint32_t cache_tag(std::size_t hash) noexcept {
+    return static_cast<uint32_t>(mix(hash));
+}
+
+/// 槽位原始存储：只负责分配与释放，元素按占用情况由缓存构造/析构
+template <typename T>
+class CacheSlots {
+public:
+    explicit CacheSlots(std::size_t count)
+        : slots_(static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{kAlign}))) {}
+
+    ~CacheSlots() { ::operator delete(slots_, std::align_val_t{kAlign}); }
+
+    CacheSlots(const CacheSlots&) = delete;
+    CacheSlots& operator=(const CacheSlots&) = delete;
+
+    [[nodiscard, gnu::always_inline]] inline T& operator[](std::size_t i) noexcept { return slots_[i]; }
+    [[nodiscard, gnu::always_inline]] inline const T& operator[](std::size_t i) const noexcept {
+        return slots_[i];
+    }
+
+    template <typename Q, typename M>
+    inline void construct(std::size_t i, Q&& key, M&& value) {
+        ::new (static_cast<void*>(&slots_[i]))
+            T(std::piecewise_construct, std::forward_as_tuple(std::forward<Q>(key)),
+              std::forward_as_tuple(std::forward<M>(value)));
+    }
+
+    inline void destroy(std::size_t i) noexcept { slots_[i].~T(); }
+
+private:
+    static constexpr std::size_t kAlign = std::max(alignof(T), memory_constants::kCacheLineSize);
+
+    T* slots_;
+};
+
+[[nodiscard]] inline std::size_t checked_capacity(std::size_t capacity, const char* message) {
+    if (capacity == 0 || capacity > memory_constants::kMaxCapacity) {
+        throw std::length_error(message);
+    }
+    return capacity;
+}
+
+}  // namespace detail
+
+// =============================================================================
+// LruCache
+// =============================================================================
+
+template <typename K, typename V, typename Hash = DefaultHash<K>, typename Eq = DefaultEqual<K>>
+class LruCache {
+    static constexpr uint32_t kNone = detail::CacheIndex::kNone;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using hasher = Hash;
+    using key_equal = Eq;
+
+    /// 命中要移动链表，查找不能并发
+    static constexpr bool kConcurrentReads = false;
+
+    /// capacity 取值 [1, kMaxCapacity]，否则抛 std::length_error
+    explicit LruCache(std::size_t capacity)
+        : capacity_(static_cast<uint32_t>(
+              detail::checked_capacity(capacity, "LruCache: capacity must be in [1, kMaxCapacity]"))),
+          slots_(capacity),
+          tags_(capacity),
+          links_(capacity + 1),
+          index_(capacity) {
+        reset_list();
+    }
+
+    ~LruCache() { destroy_all(); }
+
+    LruCache(const LruCache&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
+
+    // -------------------------------------------------------------------------
+    // 查找
+    // -------------------------------------------------------------------------
+
+    /// 命中时移到表头并返回值指针，未命中返回 nullptr
+    template <typename Q>
+    [[nodiscard, gnu::hot]]
+    inline V* find(const Q& key) noexcept {
+        return find(key, hash_(key));
+    }
+
+    /// 使用预先算好的哈希值（须等于 Hash{}(key)）
+    template <typename Q>
+    [[nodiscard, gnu::hot]]
+    inline V* find(const Q& key, std::size_t hash) noexcept {
+        const uint32_t slot = locate(key, detail::cache_tag(hash));
+        if (slot == kNone) {
+            counters_.miss();
+            return nullptr;
+        }
+        counters_.hit();
+        move_to_front(slot);
+        return &slots_[slot].second;
+    }
+
+    /// 不改变近期顺序、不计入统计
+    template <typename Q>
+    [[nodiscard]] inline const V* peek(const Q& key) const noexcept {
+        return peek(key, hash_(key));
+    }
+
+    template <typename Q>
+    [[nodiscard]] inline const V* peek(const Q& key, std::size_t hash) const noexcept {
+        const uint32_t slot = locate(key, detail::cache_tag(hash));
+        return slot == kNone ? nullptr : &slots_[slot].second;
+    }
+
+    template <typename Q>
+    [[nodiscard]] inline bool contains(const Q& key) const noexcept {
+        return peek(key) != nullptr;
+    }
+
+    // -------------------------------------------------------------------------
+    // 插入 / 删除
+    // -------------------------------------------------------------------------
+
+    /// 键存在时覆盖；否则插入，已满时淘汰最久未用者。结果位于表头
+    template <typename Q, typename M>
+    inline V& insert_or_assign(Q&& key, M&& value) {
+        const std::size_t hash = hash_(key);
+        return insert_or_assign(std::forward<Q>(key), hash, std::forward<M>(value));
+    }
+
+    template <typename Q, typename M>
+    V& insert_or_assign(Q&& key, std::size_t hash, M&& value) {
+        const uint32_t tag = detail::cache_tag(hash);
+        if (const uint32_t slot = locate(key, tag); slot != kNone) {
+            slots_[slot].second = std::forward<M>(value);
+            move_to_front(slot);
+            return slots_[slot].second;
+        }
+
+        uint32_t slot;
+        if (size_ == capacity_) {
+            slot = links_[sentinel()].prev_;
+            index_.erase(tags_[slot], slot);
+            unlink(slot);
+            counters_.evicted();
+            try {
+                slots_[slot].first = std::forward<Q>(key);
+                slots_[slot].second = std::forward<M>(value);
+            } catch (...) {
+                slots_.destroy(slot);
+                release_slot(slot);
+                --size_;
+                throw;
+            }
+        } else {
+            slot = acquire_slot();
+            try {
+                slots_.construct(slot, std::forward<Q>(key), std::forward<M>(value));
+            } catch (...) {
+                release_slot(slot);
+                throw;
+            }
+            ++size_;
+        }
+        tags_[slot] = tag;
+        index_.insert(tag, slot);
+        link_front(slot);
+        counters_.inserted();
+        return slots_[slot].second;
+    }
+
+    template <typename Q>
+    inline std::size_t erase(const Q& key) noexcept {
+        return erase(key, hash_(key));
+    }
+
+    template <typename Q>
+    std::size_t erase(const Q& key, std::size_t hash) noexcept {
+        const uint32_t slot = locate(key, detail::cache_tag(hash));
+        if (slot == kNone) {
+            return 0;
+        }
+        index_.erase(tags_[slot], slot);
+        unlink(slot);
+        slots_.destroy(slot);
+        release_slot(slot);
+        --size_;
+        return 1;
+    }
+
+    void clear() noexcept {
+        destroy_all();
+        index_.clear();
+        reset_list();
+    }
+
+    // -------------------------------------------------------------------------
+    // 遍历 / 容量 / 统计
+    // -------------------------------------------------------------------------
+
+    /// 按近期使用顺序（最近 → 最久）访问 f(const K&, const V&)
+    template <typename F>
+    void for_each(F&& f) const {
+        for (uint32_t slot = links_[sentinel()].next_; slot != sentinel(); slot = links_[slot].next_) {
+            f(std::as_const(slots_[slot].first), std::as_const(slots_[slot].second));
+        }
+    }
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline std::size_t capacity() const noexcept { return capacity_; }
+    [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] inline CacheStats stats() const noexcept { return counters_.snapshot(); }
+    inline void reset_stats() noexcept { counters_.reset(); }
+
+private:
+    /// 下标 capacity_ 为哨兵：next_ 为最近使用，prev_ 为最久未用；空闲槽位以 next_ 串成单链表
+    struct Link {
+        uint32_t prev_;
+        uint32_t next_;
+    };
+
+    [[nodiscard, gnu::always_inline]] inline uint32_t sentinel() const noexcept { return capacity_; }
+
+    template <typename Q>
+    [[nodiscard, gnu::always_inline]]
+    inline uint32_t locate(const Q& key, uint32_t tag) const noexcept {
+        return index_.find(tag, [&](uint32_t slot) { return eq_(slots_[slot].first, key); });
+    }
+
+    [[gnu::always_inline]] inline void unlink(uint32_t slot) noexcept {
+        const Link link = links_[slot];
+        links_[link.prev_].next_ = link.next_;
+        links_[link.next_].prev_ = link.prev_;
+    }
+
+    [[gnu::always_inline]] inline void link_front(uint32_t slot) noexcept {
+        const uint32_t first = links_[sentinel()].next_;
+        links_[slot] = {sentinel(), first};
+        links_[first].prev_ = slot;
+        links_[sentinel()].next_ = slot;
+    }
+
+    [[gnu::always_inline]] inline void move_to_front(uint32_t slot) noexcept {
+        if (links_[sentinel()].next_ != slot) {
+            unlink(slot);
+            link_front(slot);
+        }
+    }
+
+    [[nodiscard]] inline uint32_t acquire_slot() noexcept {
+        if (free_ != kNone) {
+            const uint32_t slot = free_;
+            free_ = links_[slot].next_;
+            return slot;
+        }
+        return unused_++;
+    }
+
+    inline void release_slot(uint32_t slot) noexcept {
+        links_[slot].next_ = free_;
+        free_ = slot;
+    }
+
+    void destroy_all() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (uint32_t slot = links_[sentinel()].next_; slot != sentinel(); slot = links_[slot].next_) {
+                slots_.destroy(slot);
+            }
+        }
+    }
+
+    void reset_list() noexcept {
+        links_[sentinel()] = {sentinel(), sentinel()};
+        free_ = kNone;
+        unused_ = 0;
+        size_ = 0;
+    }
+
+    uint32_t capacity_;
+    uint32_t size_{0};
+    uint32_t free_{kNone};  // 已删除槽位链表头
+    uint32_t unused_{0};    // 从未使用过的槽位从此处顺序取
+    detail::CacheSlots<value_type> slots_;
+    std::vector<uint32_t> tags_;
+    std::vector<Link> links_;
+    detail::CacheIndex index_;
+    [[no_unique_address]] detail::CacheCounters<false> counters_;
+    [[no_unique_address]] Hash hash_{};
+    [[no_unique_address]] Eq eq_{};
+};
+
+// =============================================================================
+// ClockCache
+// =============================================================================
+
+/// ConcurrentReads 为 true 时 find / peek 之间可并发（插入、删除仍需独占），计数器为原子
+template <typename K, typename V, typename Hash = DefaultHash<K>, typename Eq = DefaultEqual<K>,
+          bool ConcurrentReads = false>
+class ClockCache {
+    static constexpr uint32_t kNone = detail::CacheIndex::kNone;
+
+    /// 槽位状态：0 为空，1~4 对应访问频率 0~3
+    static constexpr uint8_t kEmpty = 0;
+    static constexpr uint8_t kCold = 1;
+    static constexpr uint8_t kHot = 4;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using hasher = Hash;
+    using key_equal = Eq;
+
+    static constexpr bool kConcurrentReads = ConcurrentReads;
+
+    /// capacity 取值 [1, kMaxCapacity]，否则抛 std::length_error
+    explicit ClockCache(std::size_t capacity)
+        : capacity_(static_cast<uint32_t>(
+              detail::checked_capacity(capacity, "ClockCache: capacity must be in [1, kMaxCapacity]"))),
+          slots_(capacity),
+          tags_(capacity),
+          states_(capacity),
+          index_(capacity) {
+        free_.reserve(capacity);
+    }
+
+    ~ClockCache() { destroy_all(); }
+
+    ClockCache(const ClockCache&) = delete;
+    ClockCache& operator=(const ClockCache&) = delete;
+
+    // -------------------------------------------------------------------------
+    // 查找
+    // -------------------------------------------------------------------------
+
+    /// 命中时频率加一（已饱和则不写），返回值指针；未命中返回 nullptr
+    template <typename Q>
+    [[nodiscard, gnu::hot]]
+    inline V* find(const Q& key) noexcept {
+        return find(key, hash_(key));
+    }
+
+    /// 使用预先算好的哈希值（须等于 Hash{}(key)）
+    template <typename Q>
+    [[nodiscard, gnu::hot]]
+    inline V* find(const Q& key, std::size_t hash) noexcept {
+        const uint32_t slot = locate(key, detail::cache_tag(hash));
+        if (slot == kNone) {
+            counters_.miss();
+            return nullptr;
+        }
+        counters_.hit();
+        touch(slot);
+        return &slots_[slot].second;
+    }
+
+    /// 不改变访问频率、不计入统计
+    template <typename Q>
+    [[nodiscard]] inline const V* peek(const Q& key) const noexcept {
+        return peek(key, hash_(key));
+    }
+
+    template <typename Q>
+    [[nodiscard]] inline const V* peek(const Q& key, std::size_t hash) const noexcept {
+        const uint32_t slot = locate(key, detail::cache_tag(hash));
+        return slot == kNone ? nullptr : &slots_[slot].second;
+    }
+
+    template <typename Q>
+    [[nodiscard]] inline bool contains(const Q& key) const noexcept {
+        return peek(key) != nullptr;
+    }
+
+    // -------------------------------------------------------------------------
+    // 插入 / 删除
+    // -------------------------------------------------------------------------
+
+    /// 键存在时覆盖并计一次访问；否则以频率 0 插入，已满时由时钟指针选出淘汰者
+    template <typename Q, typename M>
+    inline V& insert_or_assign(Q&& key, M&& value) {
+        const std::size_t hash = hash_(key);
+        return insert_or_assign(std::forward<Q>(key), hash, std::forward<M>(value));
+    }
+
+    template <typename Q, typename M>
+    V& insert_or_assign(Q&& key, std::size_t hash, M&& value) {
+        const uint32_t tag = detail::cache_tag(hash);
+        if (const uint32_t slot = locate(key, tag); slot != kNone) {
+            slots_[slot].second = std::forward<M>(value);
+            touch(slot);
+            return slots_[slot].second;
+        }
+
+        uint32_t slot;
+        if (size_ == capacity_) {
+            slot = evict();
+            index_.erase(tags_[slot], slot);
+            counters_.evicted();
+            try {
+                slots_[slot].first = std::forward<Q>(key);
+                slots_[slot].second = std::forward<M>(value);
+            } catch (...) {
+                slots_.destroy(slot);
+                release_slot(slot);
+                --size_;
+                throw;
+            }
+        } else {
+            slot = acquire_slot();
+            try {
+                slots_.construct(slot, std::forward<Q>(key), std::forward<M>(value));
+            } catch (...) {
+                free_.push_back(slot);
+                throw;
+            }
+            ++size_;
+        }
+        tags_[slot] = tag;
+        states_[slot].store(kCold, std::memory_order_relaxed);
+        index_.insert(tag, slot);
+        counters_.inserted();
+        return slots_[slot].second;
+    }
+
+    template <typename Q>
+    inline std::size_t erase(const Q& key) noexcept {
+        return erase(key, hash_(key));
+    }
+
+    template <typename Q>
+    std::size_t erase(const Q& key, std::size_t hash) noexcept {
+        const uint32_t slot = locate(key, detail::cache_tag(hash));
+        if (slot == kNone) {
+            return 0;
+        }
+        index_.erase(tags_[slot], slot);
+        slots_.destroy(slot);
+        release_slot(slot);
+        --size_;
+        return 1;
+    }
+
+    void clear() noexcept {
+        destroy_all();
+        index_.clear();
+        free_.clear();
+        unused_ = 0;
+        hand_ = 0;
+        size_ = 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // 遍历 / 容量 / 统计
+    // -------------------------------------------------------------------------
+
+    /// 按槽位顺序访问 f(const K&, const V&)
+    template <typename F>
+    void for_each(F&& f) const {
+        for (uint32_t slot = 0; slot < unused_; ++slot) {
+            if (states_[slot].load(std::memory_order_relaxed) != kEmpty) {
+                f(std::as_const(slots_[slot].first), std::as_const(slots_[slot].second));
+            }
+        }
+    }
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline std::size_t capacity() const noexcept { return capacity_; }
+    [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] inline CacheStats stats() const noexcept { return counters_.snapshot(); }
+    inline void reset_stats() noexcept { counters_.reset(); }
+
+private:
+    template <typename Q>
+    [[nodiscard, gnu::always_inline]]
+    inline uint32_t locate(const Q& key, uint32_t tag) const noexcept {
+        return index_.find(tag, [&](uint32_t slot) { return eq_(slots_[slot].first, key); });
+    }
+
+    /// 并发命中之间的竞争只会少计几次访问，不用读-改-写
+    [[gnu::always_inline]] inline void touch(uint32_t slot) noexcept {
+        const uint8_t state = states_[slot].load(std::memory_order_relaxed);
+        if (state < kHot) {
+            states_[slot].store(state + 1, std::memory_order_relaxed);
+        }
+    }
+
+    /// 已满时调用：没有空槽位，每转一圈所有频率至少减一，最多四圈内必有淘汰者
+    [[nodiscard]] uint32_t evict() noexcept {
+        while (true) {
+            const uint32_t slot = hand_;
+            hand_ = hand_ + 1 == capacity_ ? 0 : hand_ + 1;
+            const uint8_t state = states_[slot].load(std::memory_order_relaxed);
+            if (state == kCold) {
+                return slot;
+            }
+            states_[slot].store(state - 1, std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] inline uint32_t acquire_slot() noexcept {
+        if (!free_.empty()) {
+            const uint32_t slot = free_.back();
+            free_.pop_back();
+            return slot;
+        }
+        return unused_++;
+    }
+
+    /// free_ 预留了 capacity 个位置，push_back 不分配
+    inline void release_slot(uint32_t slot) noexcept {
+        states_[slot].store(kEmpty, std::memory_order_relaxed);
+        free_.push_back(slot);
+    }
+
+    void destroy_all() noexcept {
+        for (uint32_t slot = 0; slot < unused_; ++slot) {
+            if (states_[slot].load(std::memory_order_relaxed) != kEmpty) {
+                if constexpr (!std::is_trivially_destructible_v<value_type>) {
+                    slots_.destroy(slot);
+                }
+                states_[slot].store(kEmpty, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    uint32_t capacity_;
+    uint32_t size_{0};
+    uint32_t unused_{0};  // 从未使用过的槽位从此处顺序取
+    uint32_t hand_{0};    // 时钟指针
+    detail::CacheSlots<value_type> slots_;
+    std::vector<uint32_t> tags_;
+    std::vector<std::atomic<uint8_t>> states_;
+    std::vector<uint32_t> free_;  // 已删除的槽位
+    detail::CacheIndex index_;
+    [[no_unique_address]] detail::CacheCounters<ConcurrentReads> counters_;
+    [[no_unique_address]] Hash hash_{};
+    [[no_unique_address]] Eq eq_{};
+};
+
+// =============================================================================
+// ShardedCache
+// =============================================================================
+
+/// 分片并发包装：Cache 为 LruCache 或 ClockCache；值通过拷贝（get）或锁内回调（visit）取出
+template <typename Cache>
+class ShardedCache {
+public:
+    using key_type = typename Cache::key_type;
+    using mapped_type = typename Cache::mapped_type;
+    using hasher = typename Cache::hasher;
+
+    /// 查找是否只取读锁
+    static constexpr bool kSharedReads = Cache::kConcurrentReads;
+
+    /// capacity 为总容量，均分到各分片（向上取整）；shards 向上取 2 的幂，最多 kMaxPartitions
+    explicit ShardedCache(std::size_t capacity, std::size_t shards = memory_constants::kMaxPartitions)
+        : shard_mask_(
+              std::bit_ceil(std::clamp<std::size_t>(shards, 1, memory_constants::kMaxPartitions)) - 1) {
+        const std::size_t count = shard_mask_ + 1;
+        const std::size_t per_shard = (std::max<std::size_t>(capacity, 1) + count - 1) / count;
+        shards_.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            shards_.push_back(std::make_unique<Shard>(per_shard));
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // 查找
+    // -------------------------------------------------------------------------
+
+    /// 命中时返回值的拷贝
+    template <typename Q>
+    [[nodiscard]] inline std::optional<mapped_type> get(const Q& key) {
+        std::optional<mapped_type> result;
+        visit(key, [&](const mapped_type& value) { result.emplace(value); });
+        return result;
+    }
+
+    /// 命中时在分片锁内调用 f(const V&)（避免拷贝大对象），返回是否命中
+    template <typename Q, typename F>
+    [[gnu::hot]]
+    bool visit(const Q& key, F&& f) {
+        const std::size_t hash = hash_(key);
+        Shard& shard = shard_for(hash);
+        if constexpr (kSharedReads) {
+            std::shared_lock lock(shard.lock_);
+            return apply(shard.cache_.find(key, hash), f);
+        } else {
+            std::lock_guard lock(shard.lock_);
+            return apply(shard.cache_.find(key, hash), f);
+        }
+    }
+
+    template <typename Q>
+    [[nodiscard]] inline bool contains(const Q& key) {
+        const std::size_t hash = hash_(key);
+        Shard& shard = shard_for(hash);
+        std::shared_lock lock(shard.lock_);
+        return shard.cache_.peek(key, hash) != nullptr;
+    }
+
+    // -------------------------------------------------------------------------
+    // 插入 / 删除
+    // -------------------------------------------------------------------------
+
+    template <typename Q, typename M>
+    void insert_or_assign(Q&& key, M&& value) {
+        const std::size_t hash = hash_(key);
+        Shard& shard = shard_for(hash);
+        std::lock_guard lock(shard.lock_);
+        shard.cache_.insert_or_assign(std::forward<Q>(key), hash, std::forward<M>(value));
+    }
+
+    template <typename Q>
+    std::size_t erase(const Q& key) {
+        const std::size_t hash = hash_(key);
+        Shard& shard = shard_for(hash);
+        std::lock_guard lock(shard.lock_);
+        return shard.cache_.erase(key, hash);
+    }
+
+    void clear() {
+        for (auto& shard : shards_) {
+            std::lock_guard lock(shard->lock_);
+            shard->cache_.clear();
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // 容量 / 统计（逐片加锁汇总，并发修改时为近似值）
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] std::size_t size() const {
+        std::size_t total = 0;
+        for (const auto& shard : shards_) {
+            std::shared_lock lock(shard->lock_);
+            total += shard->cache_.size();
+        }
+        return total;
+    }
+
+    [[nodiscard]] inline std::size_t capacity() const noexcept {
+        return shards_.size() * shards_.front()->cache_.capacity();
+    }
+
+    [[nodiscard]] inline std::size_t shard_count() const noexcept { return shards_.size(); }
+
+    [[nodiscard]] CacheStats stats() const {
+        CacheStats total;
+        for (const auto& shard : shards_) {
+            std::shared_lock lock(shard->lock_);
+            total += shard->cache_.stats();
+        }
+        return total;
+    }
+
+    void reset_stats() {
+        for (auto& shard : shards_) {
+            std::lock_guard lock(shard->lock_);
+            shard->cache_.reset_stats();
+        }
+    }
+
+private:
+    /// 锁独占一条缓存行，分片各自单独分配
+    struct Shard {
+        explicit Shard(std::size_t capacity) : cache_(capacity) {}
+
+        mutable concurrent::RwSpinLock<> lock_;
+        Cache cache_;
+    };
+
+    /// 分片取混合哈希的高 32 位，与缓存内部标签（低 32 位）无关
+    [[nodiscard, gnu::always_inline]]
+    inline Shard& shard_for(std::size_t hash) const noexcept {
+        return *shards_[(mix(hash) >> 32) & shard_mask_];
+    }
+
+    template <typename F>
+    [[gnu::always_inline]] static inline bool apply(const mapped_type* value, F& f) {
+        if (value == nullptr) {
+            return false;
+        }
+        f(*value);
+        return true;
+    }
+
+    std::size_t shard_mask_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    [[no_unique_address]] hasher hash_{};
+};
+
+}  // namespace container
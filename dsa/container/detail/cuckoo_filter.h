@@ -0,0 +1,317 @@
+/**
+ * @file cuckoo_filter.h
+ * @brief Cuckoo 过滤器：支持删除的近似成员查询，每键 8/16 位指纹，两个候选桶
+ * @version 1.0.0
+ *
+ * 与 bloom_filter.h 相同的用途（以未命中为主的查找先过过滤器），另外支持 erase：
+ * - 每个桶 4 个指纹槽，整桶存放在一个 32 位（8 位指纹）或 64 位（16 位指纹）字中，8 位指纹时
+ *   16 个桶、16 位指纹时 8 个桶共用一条缓存行；指纹 0 表示空槽
+ * - 部分键 cuckoo 哈希：i2 = i1 ^ hash(fingerprint)，任一候选桶都能只凭指纹算出另一个，
+ *   踢出时不需要原键；桶数为 2 的幂
+ * - 查询把指纹广播到桶内 4 个槽，与两个桶各异或一次，用字内 SIMD（SWAR）零槽检测判断是否存在，
+ *   无分支；contains_batch 测试当前键时预取 kPrefetchDistance 个键之后的候选桶
+ * - 误判率约为 2 * 4 / 2^f（f 为指纹位数）：uint8_t 约 3%，uint16_t 约 0.012%；
+ *   CuckooFilterFor<K, fpr> 按目标误判率在编译期选指纹宽度
+ * - 容量按 95% 装载率预留；插入多次踢出（kMaxKicks）仍无空槽时，最后被踢出的指纹暂存在 victim 中
+ *   （查询与删除同样检查它，不会漏报），此后 insert 返回 false，直到 erase 腾出位置
+ *
+ * erase 只能删除确实插入过的键，否则可能删掉共享指纹的其他键。同一键插入 n 次需删除 n 次。
+ *
+ * 用法：
+ *   CuckooFilterFor<uint64_t, 0.001> filter(kInstruments);
+ *   filter.insert(id);
+ *   if (filter.contains(id)) { ... }
+ *   filter.erase(id);
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "../../common/constants.h"
+#include "../../common/intrinsics.h"
+#include "../../memory/detail/aligned_allocator.h"
+#include "hash.h"
+
+namespace container {
+
+namespace detail {
+
+/// 桶内 4 个槽打包成一个字
+template <typename Fingerprint>
+using cuckoo_bucket_t = std::conditional_t<sizeof(Fingerprint) == 1, uint32_t, uint64_t>;
+
+/// 每个槽的最低位 / 最高位组成的掩码
+template <typename Fingerprint>
+inline constexpr cuckoo_bucket_t<Fingerprint> kCuckooLow =
+    sizeof(Fingerprint) == 1 ? cuckoo_bucket_t<Fingerprint>(0x01010101U)
+                             : cuckoo_bucket_t<Fingerprint>(0x0001000100010001ULL);
+
+template <typename Fingerprint>
+inline constexpr cuckoo_bucket_t<Fingerprint> kCuckooHigh =
+    kCuckooLow<Fingerprint> << (8 * sizeof(Fingerprint) - 1);
+
+/// 值为 0 的槽的最高位置 1。任一槽为 0 时结果非 0；最低的置位一定对应真正为 0 的槽
+/// （借位只向高位传播，更高的槽可能误标）
+template <typename Fingerprint>
+[[nodiscard, gnu::always_inline]]
+constexpr cuckoo_bucket_t<Fingerprint> zero_slots(cuckoo_bucket_t<Fingerprint> bucket) noexcept {
+    return (bucket - kCuckooLow<Fingerprint>) & ~bucket & kCuckooHigh<Fingerprint>;
+}
+
+/// 目标误判率所需的指纹类型：8 / 255 即 3.1% 以上用 8 位，否则 16 位
+template <double Fpr>
+using cuckoo_fingerprint_t = std::conditional_t<(Fpr >= 8.0 / 255.0), uint8_t, uint16_t>;
+
+}  // namespace detail
+
+template <typename K, typename Fingerprint = uint16_t, typename Hash = DefaultHash<K>>
+class CuckooFilter {
+    static_assert(std::is_same_v<Fingerprint, uint8_t> || std::is_same_v<Fingerprint, uint16_t>,
+                  "CuckooFilter: fingerprint must be uint8_t or uint16_t");
+
+    using Bucket = detail::cuckoo_bucket_t<Fingerprint>;
+
+public:
+    static constexpr std::size_t kSlots = 4;
+    static constexpr unsigned kFingerprintBits = 8 * sizeof(Fingerprint);
+    /// 插入时最多踢出的次数
+    static constexpr std::size_t kMaxKicks = 500;
+    /// contains_batch 的预取距离（键数，每键两个桶）
+    static constexpr std::size_t kPrefetchDistance = 16;
+
+    /// 满载时的理论误判率：两个桶共 8 个槽，每槽与查询指纹碰撞的概率为 1 / (2^f - 1)
+    static constexpr double kFpr = 2.0 * kSlots / static_cast<double>((1U << kFingerprintBits) - 1);
+
+    /// 至少容纳 capacity 个键（按 95% 装载率取 2 的幂个桶）
+    explicit CuckooFilter(std::size_t capacity)
+        : buckets_(buckets_for(capacity), Bucket{0}), mask_(buckets_.size() - 1) {}
+
+    // -------------------------------------------------------------------------
+    // 插入 / 删除 / 查询
+    // -------------------------------------------------------------------------
+
+    /// 过滤器已满（有暂存的 victim）时返回 false，key 未插入
+    template <typename Q>
+    [[nodiscard, gnu::hot]] inline bool insert(const Q& key) noexcept {
+        return insert_hash(hash_(key));
+    }
+
+    [[nodiscard, gnu::hot]] bool insert_hash(std::size_t hash) noexcept {
+        if (has_victim_) [[unlikely]] {
+            return false;
+        }
+        const Position pos = position(hash);
+        if (!try_place(pos.index_, pos.fingerprint_) &&
+            !try_place(alternate(pos.index_, pos.fingerprint_), pos.fingerprint_)) {
+            kick(pos.index_, pos.fingerprint_);  // 踢出失败时某个指纹留在 victim 中，仍可查到
+        }
+        ++size_;
+        return true;
+    }
+
+    /// 删除一次插入的 key；未找到时返回 false
+    template <typename Q>
+    inline bool erase(const Q& key) noexcept {
+        return erase_hash(hash_(key));
+    }
+
+    bool erase_hash(std::size_t hash) noexcept {
+        const Position pos = position(hash);
+        const std::size_t alt = alternate(pos.index_, pos.fingerprint_);
+        if (remove_from(pos.index_, pos.fingerprint_) || remove_from(alt, pos.fingerprint_)) {
+            --size_;
+            if (has_victim_) {  // 腾出了位置：重新放入 victim
+                has_victim_ = false;
+                kick(victim_index_, victim_);
+            }
+            return true;
+        }
+        if (has_victim_ && victim_ == pos.fingerprint_ &&
+            (victim_index_ == pos.index_ || victim_index_ == alt)) {
+            has_victim_ = false;
+            --size_;
+            return true;
+        }
+        return false;
+    }
+
+    /// false 表示 key 一定不在集合中；true 表示可能在
+    template <typename Q>
+    [[nodiscard, gnu::hot]] inline bool contains(const Q& key) const noexcept {
+        return contains_hash(hash_(key));
+    }
+
+    [[nodiscard, gnu::hot]] inline bool contains_hash(std::size_t hash) const noexcept {
+        const Position pos = position(hash);
+        return test(pos.index_, alternate(pos.index_, pos.fingerprint_), pos.fingerprint_);
+    }
+
+    /// 批量查询：hits[i] = contains(keys[i])，返回可能命中的个数。
+    /// 流水线方式：测试第 i 个键时预取第 i + kPrefetchDistance 个键的两个候选桶
+    template <typename Q>
+    [[gnu::hot]] std::size_t contains_batch(std::span<const Q> keys, bool* hits) const noexcept {
+        const std::size_t n = keys.size();
+        Position pos[kPrefetchDistance];
+        std::size_t alt[kPrefetchDistance];
+        const auto lookahead = [&](std::size_t slot, std::size_t i) {
+            constexpr auto kLocality = common::PrefetchLocality::HighTemporalLocality;
+            pos[slot] = position(hash_(keys[i]));
+            alt[slot] = alternate(pos[slot].index_, pos[slot].fingerprint_);
+            common::prefetch_read<kLocality>(&buckets_[pos[slot].index_]);
+            common::prefetch_read<kLocality>(&buckets_[alt[slot]]);
+        };
+        for (std::size_t i = 0; i < std::min(kPrefetchDistance, n); ++i) {
+            lookahead(i, i);
+        }
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t slot = i % kPrefetchDistance;
+            const bool hit = test(pos[slot].index_, alt[slot], pos[slot].fingerprint_);
+            if (i + kPrefetchDistance < n) {
+                lookahead(slot, i + kPrefetchDistance);
+            }
+            hits[i] = hit;
+            count += hit;
+        }
+        return count;
+    }
+
+    inline void clear() noexcept {
+        std::fill(buckets_.begin(), buckets_.end(), Bucket{0});
+        size_ = 0;
+        has_victim_ = false;
+    }
+
+    // -------------------------------------------------------------------------
+    // 容量
+    // -------------------------------------------------------------------------
+
+    /// 当前键数（重复插入分别计数）
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+    /// 过滤器已满：此后 insert 返回 false
+    [[nodiscard]] inline bool full() const noexcept { return has_victim_; }
+    [[nodiscard]] inline std::size_t capacity() const noexcept { return buckets_.size() * kSlots; }
+    [[nodiscard]] inline std::size_t buckets() const noexcept { return buckets_.size(); }
+    [[nodiscard]] inline std::size_t bytes() const noexcept { return buckets_.size() * sizeof(Bucket); }
+    [[nodiscard]] inline double load_factor() const noexcept {
+        return static_cast<double>(size_) / static_cast<double>(capacity());
+    }
+
+private:
+    struct Position {
+        std::size_t index_;
+        Bucket fingerprint_;
+    };
+
+    /// 95% 装载率下容纳 capacity 个键的桶数（2 的幂）
+    [[nodiscard]] static std::size_t buckets_for(std::size_t capacity) {
+        if (capacity == 0 || capacity > common::memory_constants::kMaxCapacity) {
+            throw std::length_error("CuckooFilter: invalid capacity");
+        }
+        const std::size_t needed = (capacity * 100 + kSlots * 95 - 1) / (kSlots * 95);
+        return std::bit_ceil(std::max<std::size_t>(needed, 2));
+    }
+
+    /// 低位选桶，高位取指纹（0 保留给空槽）
+    [[nodiscard, gnu::always_inline]] inline Position position(std::size_t hash) const noexcept {
+        const uint64_t mixed = mix(hash);
+        auto fingerprint = static_cast<Bucket>(mixed >> (64 - kFingerprintBits));
+        fingerprint += fingerprint == 0;
+        return Position{static_cast<std::size_t>(mixed) & mask_, fingerprint};
+    }
+
+    /// 另一个候选桶：对两个桶互逆
+    [[nodiscard, gnu::always_inline]]
+    inline std::size_t alternate(std::size_t index, Bucket fingerprint) const noexcept {
+        return (index ^ static_cast<std::size_t>(fingerprint * 0x5bd1e995U)) & mask_;
+    }
+
+    [[nodiscard, gnu::always_inline]]
+    inline bool test(std::size_t i1, std::size_t i2, Bucket fingerprint) const noexcept {
+        const Bucket pattern = fingerprint * detail::kCuckooLow<Fingerprint>;
+        const Bucket found = detail::zero_slots<Fingerprint>(buckets_[i1] ^ pattern) |
+                             detail::zero_slots<Fingerprint>(buckets_[i2] ^ pattern);
+        return found != 0 || (has_victim_ && victim_ == fingerprint &&
+                              (victim_index_ == i1 || victim_index_ == i2));
+    }
+
+    /// 桶内第 i 个槽
+    [[nodiscard, gnu::always_inline]] static inline Bucket slot(Bucket bucket, unsigned i) noexcept {
+        return (bucket >> (i * kFingerprintBits)) & ((Bucket{1} << kFingerprintBits) - 1);
+    }
+
+    /// 第一个值为 value 的槽，不存在时返回 kSlots
+    [[nodiscard, gnu::always_inline]] static inline unsigned find_slot(Bucket bucket, Bucket value) noexcept {
+        const Bucket pattern = value * detail::kCuckooLow<Fingerprint>;
+        const Bucket found = detail::zero_slots<Fingerprint>(bucket ^ pattern);
+        return found == 0 ? kSlots : static_cast<unsigned>(std::countr_zero(found)) / kFingerprintBits;
+    }
+
+    [[gnu::always_inline]] inline void store(std::size_t index, unsigned i, Bucket fingerprint) noexcept {
+        const unsigned shift = i * kFingerprintBits;
+        Bucket& bucket = buckets_[index];
+        bucket = (bucket & ~(((Bucket{1} << kFingerprintBits) - 1) << shift)) | (fingerprint << shift);
+    }
+
+    inline bool try_place(std::size_t index, Bucket fingerprint) noexcept {
+        const unsigned s = find_slot(buckets_[index], 0);
+        if (s == kSlots) {
+            return false;
+        }
+        store(index, s, fingerprint);
+        return true;
+    }
+
+    inline bool remove_from(std::size_t index, Bucket fingerprint) noexcept {
+        const unsigned s = find_slot(buckets_[index], fingerprint);
+        if (s == kSlots) {
+            return false;
+        }
+        store(index, s, 0);
+        return true;
+    }
+
+    /// 从 index 开始踢出：与随机槽交换，被换出的指纹移到它的另一个桶；用尽次数时暂存为 victim
+    void kick(std::size_t index, Bucket fingerprint) noexcept {
+        for (std::size_t n = 0; n < kMaxKicks; ++n) {
+            if (try_place(index, fingerprint)) {
+                return;
+            }
+            rng_ ^= rng_ << 13;
+            rng_ ^= rng_ >> 7;
+            rng_ ^= rng_ << 17;
+            const auto s = static_cast<unsigned>(rng_ % kSlots);
+            const Bucket evicted = slot(buckets_[index], s);
+            store(index, s, fingerprint);
+            fingerprint = evicted;
+            index = alternate(index, fingerprint);
+        }
+        victim_ = fingerprint;
+        victim_index_ = index;
+        has_victim_ = true;
+    }
+
+    std::vector<Bucket, memory::AlignedAllocator<Bucket>> buckets_;
+    std::size_t mask_;
+    std::size_t size_{0};
+    uint64_t rng_{0x9E3779B97F4A7C15ULL};
+    Bucket victim_{0};
+    std::size_t victim_index_{0};
+    bool has_victim_{false};
+    [[no_unique_address]] Hash hash_{};
+};
+
+/// 按目标误判率选择指纹宽度：CuckooFilterFor<uint64_t, 0.01> 用 16 位指纹，0.05 用 8 位
+template <typename K, double Fpr, typename Hash = DefaultHash<K>>
+using CuckooFilterFor = CuckooFilter<K, detail::cuckoo_fingerprint_t<Fpr>, Hash>;
+
+}  // namespace container
@@ -0,0 +1,383 @@
+/**
+ * @file dary_heap.h
+ * @brief d 叉隐式堆：每组兄弟节点占满一条缓存行，可选位置句柄支持 decrease-key
+ * @version 1.0.0
+ *
+ * 面向调度、定时器与 top-K，替代 std::priority_queue（二叉堆每层一次缓存未命中，树高 log2 n）：
+ * - 每个节点 Arity 个子节点，树高降为 log_Arity n；一层的所有子节点连续存放
+ * - 存储下标整体偏移 Arity - 1，使每组兄弟从 Arity 的整数倍开始；首地址按缓存行对齐，
+ *   Arity * sizeof(T) == 64 时（8 字节键取 8 叉、16 字节取 4 叉）每层下沉只触及一条缓存行
+ * - 下沉/上浮移动"空穴"而非逐层交换，每层一次移动
+ *
+ * top() 为 Compare 意义下的最小元素（与 std::priority_queue 相反，std::less 即小顶堆）。
+ *
+ * IndexedDaryHeap 额外维护 句柄 -> 位置 表：push 返回句柄，update / erase 按句柄 O(log n)，
+ * 用于可撤销、可改期的定时器与 Dijkstra 式 decrease-key。
+ *
+ * 用法：
+ *   DaryHeap<uint64_t, 8> deadlines;                 // 8 字节键，8 叉
+ *   deadlines.push(t);  uint64_t next = deadlines.top();  deadlines.pop();
+ *   IndexedDaryHeap<uint64_t> timers;
+ *   auto h = timers.push(deadline);  timers.update(h, earlier);  timers.erase(h);
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../common/constants.h"
+#include "../../common/intrinsics.h"
+#include "../../memory/detail/aligned_allocator.h"
+
+namespace container {
+
+namespace detail {
+
+/// 堆存储首地址按缓存行对齐（元素对齐要求更大时取其对齐）
+template <typename T>
+inline constexpr std::size_t kHeapAlignment = std::max(common::memory_constants::kCacheLineSize, alignof(T));
+
+/// 偏移后的 d 叉堆下标：逻辑下标 l 存于 l + Arity - 1，逻辑子节点 Arity*l+1.. 存于 Arity*(l+1)..
+template <std::size_t Arity>
+struct DaryIndex {
+    static_assert(Arity >= 2, "heap arity must be at least 2");
+
+    /// 根的存储下标（之前为填充位）
+    static constexpr std::size_t kRoot = Arity - 1;
+
+    [[nodiscard, gnu::always_inline]] static constexpr std::size_t parent(std::size_t i) noexcept {
+        return i / Arity + Arity - 2;
+    }
+
+    [[nodiscard, gnu::always_inline]] static constexpr std::size_t first_child(std::size_t i) noexcept {
+        return Arity * (i - Arity + 2);
+    }
+};
+
+/// 无分支二选一：随机键下子节点比较约一半判断失误，写成掩码运算以免编译为条件跳转
+[[nodiscard, gnu::always_inline]] inline std::size_t select(bool pick_b, std::size_t b,
+                                                            std::size_t a) noexcept {
+    return a ^ ((a ^ b) & (std::size_t{0} - static_cast<std::size_t>(pick_b)));
+}
+
+/// [first, first + Count) 中最小元素的下标：两两锦标赛归约，依赖链长 log2(Count) 而非 Count - 1
+template <std::size_t Count, typename Values, typename Compare>
+[[nodiscard, gnu::always_inline]] inline std::size_t tournament(const Values& values, std::size_t first,
+                                                                const Compare& compare) {
+    if constexpr (Count == 1) {
+        return first;
+    } else {
+        constexpr std::size_t kHalf = Count / 2;
+        const std::size_t a = tournament<kHalf>(values, first, compare);
+        const std::size_t b = tournament<Count - kHalf>(values, first + kHalf, compare);
+        return select(compare(values(b), values(a)), b, a);
+    }
+}
+
+/// [first, min(first + Arity, end)) 中最小元素的下标；整组在界内时走定长归约
+template <std::size_t Arity, typename Values, typename Compare>
+[[nodiscard, gnu::always_inline]] inline std::size_t min_child(const Values& values, std::size_t first,
+                                                               std::size_t end, const Compare& compare) {
+    if (first + Arity <= end) [[likely]] {
+        return tournament<Arity>(values, first, compare);
+    }
+    std::size_t best = first;
+    for (std::size_t c = first + 1; c < end; ++c) {
+        best = select(compare(values(c), values(best)), c, best);
+    }
+    return best;
+}
+
+/// 预取 child 组各节点的子节点（Arity * Arity 个连续元素）：比较本层的同时下一层已在途，
+/// 大于 LLC 时把每层一次串行访存延迟与比较重叠；预取越界不会出错
+template <std::size_t Arity, typename T>
+[[gnu::always_inline]] inline void prefetch_grandchildren(const T* base, std::size_t child) noexcept {
+    constexpr std::size_t kBytes = Arity * Arity * sizeof(T);
+    const auto* first = reinterpret_cast<const char*>(base + DaryIndex<Arity>::first_child(child));
+    for (std::size_t offset = 0; offset < kBytes; offset += common::memory_constants::kCacheLineSize) {
+        common::prefetch_read<common::PrefetchLocality::HighTemporalLocality>(first + offset);
+    }
+}
+
+}  // namespace detail
+
+// =============================================================================
+// d 叉堆
+// =============================================================================
+
+template <typename T, std::size_t Arity = 4, typename Compare = std::less<T>>
+class DaryHeap {
+    static_assert(std::is_default_constructible_v<T>, "DaryHeap pads the front slots with default T");
+
+    using Index = detail::DaryIndex<Arity>;
+    using Storage = std::vector<T, memory::AlignedAllocator<T, detail::kHeapAlignment<T>>>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using value_compare = Compare;
+
+    static constexpr std::size_t kArity = Arity;
+
+    explicit DaryHeap(Compare compare = Compare()) : compare_(std::move(compare)) {
+        data_.resize(Index::kRoot);
+    }
+
+    /// 由无序区间建堆，O(n)
+    template <std::input_iterator It>
+    DaryHeap(It first, It last, Compare compare = Compare()) : DaryHeap(std::move(compare)) {
+        data_.insert(data_.end(), first, last);
+        heapify();
+    }
+
+    // -------------------------------------------------------------------------
+    // 修改
+    // -------------------------------------------------------------------------
+
+    void push(const T& value) { emplace(value); }
+    void push(T&& value) { emplace(std::move(value)); }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        data_.emplace_back(std::forward<Args>(args)...);
+        T value = std::move(data_.back());
+        sift_up(data_.size() - 1, std::move(value));
+    }
+
+    /// 移除堆顶（非空）
+    void pop() {
+        T value = std::move(data_.back());
+        data_.pop_back();
+        if (data_.size() > Index::kRoot) {
+            sift_down(Index::kRoot, std::move(value));
+        }
+    }
+
+    /// 以 value 替换堆顶（非空），等价于 pop() + push(value) 但只下沉一次
+    void replace_top(T value) { sift_down(Index::kRoot, std::move(value)); }
+
+    void clear() noexcept { data_.resize(Index::kRoot); }
+    void reserve(std::size_t n) { data_.reserve(n + Index::kRoot); }
+
+    // -------------------------------------------------------------------------
+    // 查询
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline const T& top() const noexcept { return data_[Index::kRoot]; }
+    [[nodiscard]] inline std::size_t size() const noexcept { return data_.size() - Index::kRoot; }
+    [[nodiscard]] inline bool empty() const noexcept { return data_.size() == Index::kRoot; }
+
+    /// 按存储顺序（非有序）遍历
+    [[nodiscard]] inline auto begin() const noexcept { return data_.begin() + Index::kRoot; }
+    [[nodiscard]] inline auto end() const noexcept { return data_.end(); }
+
+private:
+    void heapify() {
+        const std::size_t end = data_.size();
+        if (end <= Index::kRoot + 1) {
+            return;
+        }
+        for (std::size_t i = Index::parent(end - 1) + 1; i-- > Index::kRoot;) {
+            T value = std::move(data_[i]);
+            sift_down(i, std::move(value));
+        }
+    }
+
+    [[gnu::hot]] void sift_up(std::size_t hole, T value) {
+        while (hole > Index::kRoot) {
+            const std::size_t parent = Index::parent(hole);
+            if (!compare_(value, data_[parent])) {
+                break;
+            }
+            data_[hole] = std::move(data_[parent]);
+            hole = parent;
+        }
+        data_[hole] = std::move(value);
+    }
+
+    [[gnu::hot]] void sift_down(std::size_t hole, T value) {
+        const std::size_t end = data_.size();
+        const auto values = [this](std::size_t i) -> const T& { return data_[i]; };
+        for (std::size_t child = Index::first_child(hole); child < end; child = Index::first_child(hole)) {
+            detail::prefetch_grandchildren<Arity>(data_.data(), child);
+            const std::size_t best = detail::min_child<Arity>(values, child, end, compare_);
+            if (!compare_(data_[best], value)) {
+                break;
+            }
+            data_[hole] = std::move(data_[best]);
+            hole = best;
+        }
+        data_[hole] = std::move(value);
+    }
+
+    [[no_unique_address]] Compare compare_;
+    Storage data_;
+};
+
+// =============================================================================
+// 带位置句柄的 d 叉堆
+// =============================================================================
+
+template <typename T, std::size_t Arity = 4, typename Compare = std::less<T>>
+class IndexedDaryHeap {
+    using Index = detail::DaryIndex<Arity>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    /// 句柄在元素出堆前保持有效；出堆（pop / erase）后可能被后续 push 复用
+    using Handle = uint32_t;
+
+    static constexpr std::size_t kArity = Arity;
+    static constexpr Handle kInvalidHandle = std::numeric_limits<Handle>::max();
+
+private:
+    struct Node {
+        T value_;
+        Handle handle_;
+    };
+
+    using Storage = std::vector<Node, memory::AlignedAllocator<Node, detail::kHeapAlignment<Node>>>;
+
+    /// positions_ 中表示"不在堆中"（存储下标从 kRoot 起，Arity >= 2 时 0 永不为有效位置）
+    static constexpr uint32_t kAbsent = 0;
+
+public:
+    explicit IndexedDaryHeap(Compare compare = Compare()) : compare_(std::move(compare)) {
+        nodes_.resize(Index::kRoot);
+    }
+
+    // -------------------------------------------------------------------------
+    // 修改
+    // -------------------------------------------------------------------------
+
+    /// 插入并返回句柄
+    Handle push(T value) {
+        Handle handle;
+        if (!free_.empty()) {
+            handle = free_.back();
+            free_.pop_back();
+        } else {
+            handle = static_cast<Handle>(positions_.size());
+            positions_.push_back(kAbsent);
+        }
+        nodes_.push_back(Node{std::move(value), handle});
+        Node node = std::move(nodes_.back());
+        sift_up(nodes_.size() - 1, std::move(node));
+        return handle;
+    }
+
+    /// 移除堆顶（非空），返回其句柄（随即释放）
+    Handle pop() {
+        const Handle handle = nodes_[Index::kRoot].handle_;
+        remove_at(Index::kRoot);
+        return handle;
+    }
+
+    /// 修改句柄对应元素的值，按变化方向上浮或下沉（decrease-key / increase-key）
+    void update(Handle handle, T value) {
+        const std::size_t pos = positions_[handle];
+        Node node{std::move(value), handle};
+        if (pos > Index::kRoot && compare_(node.value_, nodes_[Index::parent(pos)].value_)) {
+            sift_up(pos, std::move(node));
+        } else {
+            sift_down(pos, std::move(node));
+        }
+    }
+
+    /// 移除句柄对应元素
+    void erase(Handle handle) { remove_at(positions_[handle]); }
+
+    void clear() noexcept {
+        nodes_.resize(Index::kRoot);
+        positions_.clear();
+        free_.clear();
+    }
+
+    void reserve(std::size_t n) {
+        nodes_.reserve(n + Index::kRoot);
+        positions_.reserve(n);
+    }
+
+    // -------------------------------------------------------------------------
+    // 查询
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline const T& top() const noexcept { return nodes_[Index::kRoot].value_; }
+    [[nodiscard]] inline Handle top_handle() const noexcept { return nodes_[Index::kRoot].handle_; }
+
+    [[nodiscard]] inline bool contains(Handle handle) const noexcept {
+        return handle < positions_.size() && positions_[handle] != kAbsent;
+    }
+
+    /// 句柄对应的当前值（须 contains）
+    [[nodiscard]] inline const T& value(Handle handle) const noexcept {
+        return nodes_[positions_[handle]].value_;
+    }
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return nodes_.size() - Index::kRoot; }
+    [[nodiscard]] inline bool empty() const noexcept { return nodes_.size() == Index::kRoot; }
+
+private:
+    void remove_at(std::size_t pos) {
+        positions_[nodes_[pos].handle_] = kAbsent;
+        free_.push_back(nodes_[pos].handle_);
+        Node last = std::move(nodes_.back());
+        nodes_.pop_back();
+        if (pos == nodes_.size()) {
+            return;  // 移除的就是末尾元素
+        }
+        if (pos > Index::kRoot && compare_(last.value_, nodes_[Index::parent(pos)].value_)) {
+            sift_up(pos, std::move(last));
+        } else {
+            sift_down(pos, std::move(last));
+        }
+    }
+
+    [[gnu::always_inline]] inline void place(std::size_t pos, Node&& node) {
+        positions_[node.handle_] = static_cast<uint32_t>(pos);
+        nodes_[pos] = std::move(node);
+    }
+
+    [[gnu::hot]] void sift_up(std::size_t hole, Node node) {
+        while (hole > Index::kRoot) {
+            const std::size_t parent = Index::parent(hole);
+            if (!compare_(node.value_, nodes_[parent].value_)) {
+                break;
+            }
+            place(hole, std::move(nodes_[parent]));
+            hole = parent;
+        }
+        place(hole, std::move(node));
+    }
+
+    [[gnu::hot]] void sift_down(std::size_t hole, Node node) {
+        const std::size_t end = nodes_.size();
+        const auto values = [this](std::size_t i) -> const T& { return nodes_[i].value_; };
+        for (std::size_t child = Index::first_child(hole); child < end; child = Index::first_child(hole)) {
+            detail::prefetch_grandchildren<Arity>(nodes_.data(), child);
+            const std::size_t best = detail::min_child<Arity>(values, child, end, compare_);
+            if (!compare_(nodes_[best].value_, node.value_)) {
+                break;
+            }
+            place(hole, std::move(nodes_[best]));
+            hole = best;
+        }
+        place(hole, std::move(node));
+    }
+
+    [[no_unique_address]] Compare compare_;
+    Storage nodes_;
+    std::vector<uint32_t> positions_;  // 句柄 -> 存储下标
+    std::vector<Handle> free_;         // 可复用的句柄
+};
+
+}  // namespace container
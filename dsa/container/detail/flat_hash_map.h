@@ -0,0 +1,555 @@
+/**
+ * @file flat_hash_map.h
+ * @brief SIMD 控制字节分组探测的开放寻址哈希表（Swiss table 风格）
+ * @version 1.0.0
+ *
+ * 替代热路径上的 std::unordered_map（每次探测一次指针追逐）：
+ * - 控制字节数组与槽位数组分离；控制字节按缓存行对齐，组宽 kGroupWidth
+ *   （AVX2 可用时 32 字节，否则 SSE2 16 字节），一条比较指令匹配整组
+ * - 每个控制字节为 空(0x80) / 已删除(0xFE) / 满（哈希低 7 位 H2）；H1 选择起始组，组间三角探测
+ * - 删除沿用 Swiss table 规则：所在组仍有空位时直接置空（不产生墓碑），否则置为已删除
+ * - 最大负载 7/8；FixedCapacity 为 true 时从不扩容/重哈希，元素数达到上限时插入失败
+ *   （该模式下墓碑只在 clear() 时清除，频繁删除会拉长探测序列）
+ * - 透明查找：字符串键可用 std::string_view / const char* / CompileTimeString 查找，
+ *   也可传入预先算好（如编译期）的哈希值跳过哈希计算
+ *
+ * 迭代器在插入（可能扩容）后失效；删除只使被删元素的迭代器失效。
+ *
+ * 用法：
+ *   FlatHashMap<std::string, Position> book;
+ *   book.try_emplace("AAPL", ...);
+ *   constexpr auto kAapl = utils::CompileTimeString<4>("AAPL");
+ *   auto it = book.find(kAapl, kAapl.hash());
+ */
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../../common/constants.h"
+#include "hash.h"
+
+namespace container {
+
+using namespace common;
+
+namespace detail {
+
+// =============================================================================
+// 控制字节组
+// =============================================================================
+
+namespace ctrl {
+
+inline constexpr int8_t kEmpty = static_cast<int8_t>(0x80);
+inline constexpr int8_t kDeleted = static_cast<int8_t>(0xFE);
+
+[[nodiscard, gnu::always_inline]] constexpr bool is_full(int8_t c) noexcept { return c >= 0; }
+
+}  // namespace ctrl
+
+#ifdef __AVX2__
+/// 32 个控制字节，AVX2 一次比较
+struct Group {
+    static constexpr std::size_t kWidth = 32;
+    using Mask = uint32_t;
+
+    [[gnu::always_inline]] explicit Group(const int8_t* p) noexcept
+        : ctrl_(_mm256_load_si256(reinterpret_cast<const __m256i*>(p))) {}
+
+    [[nodiscard, gnu::always_inline]] inline Mask match(int8_t h2) const noexcept {
+        return static_cast<Mask>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(h2), ctrl_)));
+    }
+
+    [[nodiscard, gnu::always_inline]] inline Mask match_empty() const noexcept { return match(ctrl::kEmpty); }
+
+    /// 空或已删除（最高位为 1）
+    [[nodiscard, gnu::always_inline]] inline Mask match_empty_or_deleted() const noexcept {
+        return static_cast<Mask>(_mm256_movemask_epi8(ctrl_));
+    }
+
+    __m256i ctrl_;
+};
+#else
+/// 16 个控制字节，SSE2 一次比较
+struct Group {
+    static constexpr std::size_t kWidth = 16;
+    using Mask = uint32_t;
+
+    [[gnu::always_inline]] explicit Group(const int8_t* p) noexcept
+        : ctrl_(_mm_load_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+    [[nodiscard, gnu::always_inline]] inline Mask match(int8_t h2) const noexcept {
+        return static_cast<Mask>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+    }
+
+    [[nodiscard, gnu::always_inline]] inline Mask match_empty() const noexcept { return match(ctrl::kEmpty); }
+
+    [[nodiscard, gnu::always_inline]] inline Mask match_empty_or_deleted() const noexcept {
+        return static_cast<Mask>(_mm_movemask_epi8(ctrl_));
+    }
+
+    __m128i ctrl_;
+};
+#endif
+
+}  // namespace detail
+
+// =============================================================================
+// FlatHashMap
+// =============================================================================
+
+template <typename K, typename V, typename Hash = DefaultHash<K>, typename Eq = DefaultEqual<K>,
+          bool FixedCapacity = false>
+class FlatHashMap {
+    using Group = detail::Group;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    /// 键不可修改（修改会破坏表结构）；为支持扩容时移动，存储类型不带 const
+    using value_type = std::pair<K, V>;
+    using size_type = std::size_t;
+
+    static constexpr std::size_t kGroupWidth = Group::kWidth;
+
+    template <bool Const>
+    class Iterator {
+        using Ref = std::conditional_t<Const, const value_type&, value_type&>;
+        using Ptr = std::conditional_t<Const, const value_type*, value_type*>;
+
+    public:
+        Iterator() noexcept = default;
+        Iterator(const int8_t* ctrl, const int8_t* end, Ptr slot) noexcept
+            : ctrl_(ctrl), end_(end), slot_(slot) {
+            skip_empty();
+        }
+
+        /// 非常量迭代器可转换为常量迭代器
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other) noexcept
+            : ctrl_(other.ctrl_), end_(other.end_), slot_(other.slot_) {}
+
+        [[nodiscard]] inline Ref operator*() const noexcept { return *slot_; }
+        [[nodiscard]] inline Ptr operator->() const noexcept { return slot_; }
+
+        inline Iterator& operator++() noexcept {
+            ++ctrl_;
+            ++slot_;
+            skip_empty();
+            return *this;
+        }
+
+        [[nodiscard]] inline bool operator==(const Iterator& other) const noexcept {
+            return ctrl_ == other.ctrl_;
+        }
+
+    private:
+        friend class FlatHashMap;
+        template <bool>
+        friend class Iterator;
+
+        inline void skip_empty() noexcept {
+            while (ctrl_ != end_ && !detail::ctrl::is_full(*ctrl_)) {
+                ++ctrl_;
+                ++slot_;
+            }
+        }
+
+        const int8_t* ctrl_{nullptr};
+        const int8_t* end_{nullptr};
+        Ptr slot_{nullptr};
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashMap() noexcept requires(!FixedCapacity) = default;
+
+    /// 预留至少 capacity 个元素的空间；FixedCapacity 时即为容量上限
+    explicit FlatHashMap(std::size_t capacity) { allocate(slots_for(capacity)); }
+
+    ~FlatHashMap() { release(); }
+
+    FlatHashMap(const FlatHashMap&) = delete;
+    FlatHashMap& operator=(const FlatHashMap&) = delete;
+
+    FlatHashMap(FlatHashMap&& other) noexcept
+        : ctrl_(std::exchange(other.ctrl_, nullptr)),
+          slots_(std::exchange(other.slots_, nullptr)),
+          capacity_(std::exchange(other.capacity_, 0)),
+          size_(std::exchange(other.size_, 0)),
+          growth_left_(std::exchange(other.growth_left_, 0)) {}
+
+    FlatHashMap& operator=(FlatHashMap&& other) noexcept {
+        if (this != &other) {
+            release();
+            ctrl_ = std::exchange(other.ctrl_, nullptr);
+            slots_ = std::exchange(other.slots_, nullptr);
+            capacity_ = std::exchange(other.capacity_, 0);
+            size_ = std::exchange(other.size_, 0);
+            growth_left_ = std::exchange(other.growth_left_, 0);
+        }
+        return *this;
+    }
+
+    // -------------------------------------------------------------------------
+    // 查找
+    // -------------------------------------------------------------------------
+
+    template <typename Q>
+    [[nodiscard, gnu::hot]]
+    inline iterator find(const Q& key) noexcept {
+        return find(key, hash_(key));
+    }
+
+    /// 使用预先算好的哈希值（须等于 Hash{}(key)）
+    template <typename Q>
+    [[nodiscard, gnu::hot]]
+    inline iterator find(const Q& key, std::size_t hash) noexcept {
+        const std::size_t index = find_index(key, hash);
+        return index == kNotFound ? end() : iterator_at(index);
+    }
+
+    template <typename Q>
+    [[nodiscard, gnu::hot]]
+    inline const_iterator find(const Q& key) const noexcept {
+        return const_cast<FlatHashMap*>(this)->find(key);
+    }
+
+    template <typename Q>
+    [[nodiscard, gnu::hot]]
+    inline const_iterator find(const Q& key, std::size_t hash) const noexcept {
+        return const_cast<FlatHashMap*>(this)->find(key, hash);
+    }
+
+    template <typename Q>
+    [[nodiscard]] inline bool contains(const Q& key) const noexcept {
+        return find_index(key, hash_(key)) != kNotFound;
+    }
+
+    /// 查找值指针，不存在返回 nullptr（热路径上比迭代器比较更直接）
+    template <typename Q>
+    [[nodiscard, gnu::hot]]
+    inline V* get(const Q& key) noexcept {
+        const std::size_t index = find_index(key, hash_(key));
+        return index == kNotFound ? nullptr : &slots_[index].second;
+    }
+
+    template <typename Q>
+    [[nodiscard, gnu::hot]]
+    inline const V* get(const Q& key) const noexcept {
+        return const_cast<FlatHashMap*>(this)->get(key);
+    }
+
+    // -------------------------------------------------------------------------
+    // 插入
+    // -------------------------------------------------------------------------
+
+    /// 键不存在时以 args 构造值；返回 {迭代器, 是否插入}。FixedCapacity 且已满时返回 {end(), false}
+    template <typename Q, typename... Args>
+    inline std::pair<iterator, bool> try_emplace(Q&& key, Args&&... args) {
+        const std::size_t hash = hash_(key);
+        if (const std::size_t index = find_index(key, hash); index != kNotFound) {
+            return {iterator_at(index), false};
+        }
+
+        const std::size_t index = prepare_insert(hash);
+        if (index == kNotFound) {
+            return {end(), false};
+        }
+        // 先构造再标记为占用：构造抛异常时表保持不变
+        ::new (static_cast<void*>(&slots_[index]))
+            value_type(std::piecewise_construct, std::forward_as_tuple(std::forward<Q>(key)),
+                       std::forward_as_tuple(std::forward<Args>(args)...));
+        commit_insert(index, hash);
+        return {iterator_at(index), true};
+    }
+
+    inline std::pair<iterator, bool> insert(value_type value) {
+        return try_emplace(std::move(value.first), std::move(value.second));
+    }
+
+    /// 插入或覆盖
+    template <typename Q, typename M>
+    inline std::pair<iterator, bool> insert_or_assign(Q&& key, M&& value) {
+        auto result = try_emplace(std::forward<Q>(key), std::forward<M>(value));
+        if (!result.second && result.first != end()) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    /// 不存在时默认构造（FixedCapacity 下可能失败，不提供）
+    template <typename Q>
+    inline V& operator[](Q&& key) requires(!FixedCapacity)
+    {
+        return try_emplace(std::forward<Q>(key)).first->second;
+    }
+
+    // -------------------------------------------------------------------------
+    // 删除
+    // -------------------------------------------------------------------------
+
+    template <typename Q>
+    inline std::size_t erase(const Q& key) noexcept {
+        const std::size_t index = find_index(key, hash_(key));
+        if (index == kNotFound) {
+            return 0;
+        }
+        erase_at(index);
+        return 1;
+    }
+
+    inline void erase(const_iterator it) noexcept { erase_at(static_cast<std::size_t>(it.ctrl_ - ctrl_)); }
+    inline void erase(iterator it) noexcept { erase_at(static_cast<std::size_t>(it.ctrl_ - ctrl_)); }
+
+    inline void clear() noexcept {
+        destroy_all();
+        if (capacity_ > 0) {
+            std::memset(ctrl_, detail::ctrl::kEmpty, capacity_);
+        }
+        size_ = 0;
+        growth_left_ = max_load(capacity_);
+    }
+
+    // -------------------------------------------------------------------------
+    // 容量
+    // -------------------------------------------------------------------------
+
+    /// 确保可容纳 count 个元素而不扩容
+    void reserve(std::size_t count) requires(!FixedCapacity)
+    {
+        const std::size_t slots = slots_for(count);
+        if (slots > capacity_) {
+            rehash(slots);
+        }
+    }
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] inline std::size_t capacity() const noexcept { return capacity_; }
+
+    /// 不扩容时还能插入的元素数
+    [[nodiscard]] inline std::size_t growth_left() const noexcept {
+        return FixedCapacity ? max_load(capacity_) - size_ : growth_left_;
+    }
+
+    [[nodiscard]] inline double load_factor() const noexcept {
+        return capacity_ == 0 ? 0.0 : static_cast<double>(size_) / static_cast<double>(capacity_);
+    }
+
+    // -------------------------------------------------------------------------
+    // 迭代
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline iterator begin() noexcept { return {ctrl_, ctrl_ + capacity_, slots_}; }
+    [[nodiscard]] inline iterator end() noexcept {
+        return {ctrl_ + capacity_, ctrl_ + capacity_, slots_ + capacity_};
+    }
+    [[nodiscard]] inline const_iterator begin() const noexcept { return {ctrl_, ctrl_ + capacity_, slots_}; }
+    [[nodiscard]] inline const_iterator end() const noexcept {
+        return {ctrl_ + capacity_, ctrl_ + capacity_, slots_ + capacity_};
+    }
+
+private:
+    static constexpr std::size_t kNotFound = ~std::size_t{0};
+
+    /// 最大负载 7/8
+    [[nodiscard]] static constexpr std::size_t max_load(std::size_t capacity) noexcept {
+        return capacity - capacity / 8;
+    }
+
+    /// 容纳 count 个元素所需的槽位数（2 的幂，不小于一组）
+    [[nodiscard]] static constexpr std::size_t slots_for(std::size_t count) noexcept {
+        const std::size_t needed = count + (count + 6) / 7;
+        return std::bit_ceil(std::max(needed, kGroupWidth));
+    }
+
+    /// H1 选组，H2 存入控制字节
+    [[nodiscard, gnu::always_inline]] static inline std::size_t h1(uint64_t mixed) noexcept {
+        return mixed >> 7;
+    }
+    [[nodiscard, gnu::always_inline]] static inline int8_t h2(uint64_t mixed) noexcept {
+        return static_cast<int8_t>(mixed & 0x7F);
+    }
+
+    template <typename Q>
+    [[nodiscard, gnu::hot, gnu::always_inline]]
+    inline std::size_t find_index(const Q& key, std::size_t hash) const noexcept {
+        if (capacity_ == 0) [[unlikely]] {
+            return kNotFound;
+        }
+        const uint64_t mixed = mix(hash);
+        const int8_t tag = h2(mixed);
+        const std::size_t group_mask = capacity_ / kGroupWidth - 1;
+
+        std::size_t group = h1(mixed) & group_mask;
+        for (std::size_t step = 1;; ++step) {
+            const std::size_t base = group * kGroupWidth;
+            const Group g(ctrl_ + base);
+            for (auto m = g.match(tag); m != 0; m &= m - 1) {
+                const std::size_t index = base + static_cast<std::size_t>(std::countr_zero(m));
+                if (eq_(slots_[index].first, key)) [[likely]] {
+                    return index;
+                }
+            }
+            if (g.match_empty() != 0) [[likely]] {
+                return kNotFound;
+            }
+            if (step > group_mask) [[unlikely]] {
+                return kNotFound;  // 全部组已探测（只可能在满是墓碑时出现）
+            }
+            group = (group + step) & group_mask;
+        }
+    }
+
+    /// 沿探测序列找到第一个空或已删除的槽位
+    [[nodiscard]] inline std::size_t find_insert_slot(uint64_t mixed) const noexcept {
+        const std::size_t group_mask = capacity_ / kGroupWidth - 1;
+        std::size_t group = h1(mixed) & group_mask;
+        for (std::size_t step = 1;; ++step) {
+            const std::size_t base = group * kGroupWidth;
+            if (const auto m = Group(ctrl_ + base).match_empty_or_deleted(); m != 0) {
+                return base + static_cast<std::size_t>(std::countr_zero(m));
+            }
+            group = (group + step) & group_mask;
+        }
+    }
+
+    /// 为新键选择槽位，必要时扩容；不修改控制字节与计数。FixedCapacity 且已满时返回 kNotFound
+    inline std::size_t prepare_insert(std::size_t hash) {
+        const uint64_t mixed = mix(hash);
+        if (capacity_ == 0) [[unlikely]] {
+            if constexpr (FixedCapacity) {
+                return kNotFound;
+            } else {
+                allocate(kGroupWidth);
+            }
+        }
+
+        if constexpr (FixedCapacity) {
+            // 不重哈希：只按元素数限制负载，墓碑保留到 clear()
+            if (size_ >= max_load(capacity_)) [[unlikely]] {
+                return kNotFound;
+            }
+        }
+
+        std::size_t index = find_insert_slot(mixed);
+        // 复用已删除槽位不消耗增长额度
+        if constexpr (!FixedCapacity) {
+            if (growth_left_ == 0 && ctrl_[index] == detail::ctrl::kEmpty) [[unlikely]] {
+                // 墓碑过多时同容量重哈希，否则翻倍
+                rehash(size_ * 2 < max_load(capacity_) ? capacity_ : capacity_ * 2);
+                index = find_insert_slot(mixed);
+            }
+        }
+        return index;
+    }
+
+    /// 槽位中的值已构造完成后调用：写入控制字节并更新计数
+    inline void commit_insert(std::size_t index, std::size_t hash) noexcept {
+        if constexpr (!FixedCapacity) {
+            growth_left_ -= ctrl_[index] == detail::ctrl::kEmpty ? 1 : 0;
+        }
+        ctrl_[index] = h2(mix(hash));
+        ++size_;
+    }
+
+    inline void erase_at(std::size_t index) noexcept {
+        slots_[index].~value_type();
+        --size_;
+
+        // 所在组仍有空位：任何经过该组的探测都会在此组终止，可直接置空
+        const std::size_t base = index & ~(kGroupWidth - 1);
+        if (Group(ctrl_ + base).match_empty() != 0) {
+            ctrl_[index] = detail::ctrl::kEmpty;
+            ++growth_left_;
+        } else {
+            ctrl_[index] = detail::ctrl::kDeleted;
+        }
+    }
+
+    [[nodiscard]] inline iterator iterator_at(std::size_t index) noexcept {
+        return {ctrl_ + index, ctrl_ + capacity_, slots_ + index};
+    }
+
+    void allocate(std::size_t capacity) {
+        ctrl_ = static_cast<int8_t*>(
+            ::operator new(capacity, std::align_val_t{memory_constants::kCacheLineSize}));
+        std::memset(ctrl_, detail::ctrl::kEmpty, capacity);
+        slots_ = static_cast<value_type*>(::operator new(
+            capacity * sizeof(value_type), std::align_val_t{std::max(alignof(value_type), kSlotAlign)}));
+        capacity_ = capacity;
+        growth_left_ = max_load(capacity);
+    }
+
+    void rehash(std::size_t capacity) {
+        int8_t* old_ctrl = ctrl_;
+        value_type* old_slots = slots_;
+        const std::size_t old_capacity = capacity_;
+
+        allocate(capacity);
+        for (std::size_t i = 0; i < old_capacity; ++i) {
+            if (detail::ctrl::is_full(old_ctrl[i])) {
+                const uint64_t mixed = mix(hash_(old_slots[i].first));
+                const std::size_t index = find_insert_slot(mixed);
+                ctrl_[index] = h2(mixed);
+                ::new (static_cast<void*>(&slots_[index])) value_type(std::move(old_slots[i]));
+                old_slots[i].~value_type();
+            }
+        }
+        growth_left_ -= size_;
+        deallocate(old_ctrl, old_slots);
+    }
+
+    void destroy_all() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (std::size_t i = 0; i < capacity_; ++i) {
+                if (detail::ctrl::is_full(ctrl_[i])) {
+                    slots_[i].~value_type();
+                }
+            }
+        }
+    }
+
+    static void deallocate(int8_t* ctrl, value_type* slots) noexcept {
+        if (ctrl != nullptr) {
+            ::operator delete(ctrl, std::align_val_t{memory_constants::kCacheLineSize});
+            ::operator delete(slots, std::align_val_t{std::max(alignof(value_type), kSlotAlign)});
+        }
+    }
+
+    void release() noexcept {
+        destroy_all();
+        deallocate(ctrl_, slots_);
+        ctrl_ = nullptr;
+        slots_ = nullptr;
+        capacity_ = size_ = growth_left_ = 0;
+    }
+
+    static constexpr std::size_t kSlotAlign = memory_constants::kCacheLineSize;
+
+    int8_t* ctrl_{nullptr};
+    value_type* slots_{nullptr};
+    std::size_t capacity_{0};
+    std::size_t size_{0};
+    std::size_t growth_left_{0};
+    [[no_unique_address]] Hash hash_{};
+    [[no_unique_address]] Eq eq_{};
+};
+
+/// 固定容量、从不重哈希的哈希表
+template <typename K, typename V, typename Hash = DefaultHash<K>, typename Eq = DefaultEqual<K>>
+using FixedFlatHashMap = FlatHashMap<K, V, Hash, Eq, true>;
+
+}  // namespace container
@@ -0,0 +1,381 @@
+/**
+ * @file flat_map.h
+ * @brief 连续存储的有序映射：SIMD 无分支 lower_bound，可选 Eytzinger（BFS 顺序）布局
+ * @version 1.0.0
+ *
+ * 面向读多写少的中小型有序映射（价位、合约号），替代节点式 std::map：
+ * - 键与值分开存放（SoA），搜索只触及键数组
+ * - Sorted 布局: 无分支二分（条件传送）缩小到 kWindow 个键后，AVX2 一次比较 4/8 个整数键，
+ *   计数"小于目标的键"即得下标；支持插入/删除（O(n) 移动）
+ * - Eytzinger 布局: 键按完全二叉树的 BFS 顺序存放（下标从 1 开始，首地址按缓存行对齐），
+ *   每层用 prefetch_read 预取 log2(每行键数) 层之后的整行后代，大于 L1 时隐藏访存延迟；只读
+ * - 批量构造：无序输入只排序一次（稳定排序，重复键保留先出现者），再线性生成目标布局
+ *
+ * 两种布局都支持按键序遍历与 lower_bound；SIMD 路径仅用于 4/8 字节整数键，其他键类型用标量无分支二分。
+ *
+ * 用法：
+ *   FlatMap<int64_t, Level> levels(std::move(entries));                 // 一次排序
+ *   if (Level* l = levels.find(price)) { ... }
+ *   FlatMap<uint32_t, Instrument, FlatMapLayout::Eytzinger> universe(std::move(all));
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../common/constants.h"
+#include "../../common/intrinsics.h"
+#include "../../memory/detail/aligned_allocator.h"
+#include "simd_search.h"
+
+namespace container {
+
+using namespace common;
+
+enum class FlatMapLayout : uint8_t {
+    Sorted,     // 升序数组，可插入/删除
+    Eytzinger,  // BFS 顺序，只读，带软件预取
+};
+
+namespace detail {
+
+/// 升序数组 [keys, keys + n) 上的 lower_bound 下标
+template <typename K>
+[[nodiscard, gnu::hot]]
+inline std::size_t sorted_lower_bound(const K* keys, std::size_t n, const K& key) noexcept {
+#ifdef __AVX2__
+    if constexpr (SimdSearchKey<K>) {
+        // 窗口为两条缓存行的键
+        constexpr std::size_t kWindow = 2 * memory_constants::kCacheLineSize / sizeof(K);
+        if (n < kWindow) {
+            return count_less_scalar(keys, n, key);
+        }
+        // 不变式：[keys, base) 全部小于 key，[base + len, keys + n) 全部不小于 key
+        const K* base = keys;
+        std::size_t len = n;
+        while (len > kWindow) {
+            const std::size_t half = len / 2;
+            base = base[half] < key ? base + half : base;
+            len -= half;
+        }
+        // 窗口左端前移到末尾 kWindow 个元素以内，不越界；窗口左侧多出的元素都小于 key
+        const K* window = std::min(base, keys + n - kWindow);
+        return static_cast<std::size_t>(window - keys) + count_less_simd<K, kWindow>(window, key);
+    }
+#endif
+    const K* base = keys;
+    std::size_t len = n;
+    while (len > 1) {
+        const std::size_t half = len / 2;
+        base = base[half - 1] < key ? base + half : base;
+        len -= half;
+    }
+    return static_cast<std::size_t>(base - keys) + (len == 1 && *base < key ? 1 : 0);
+}
+
+}  // namespace detail
+
+// =============================================================================
+// FlatMap
+// =============================================================================
+
+template <typename K, typename V, FlatMapLayout Layout = FlatMapLayout::Sorted>
+class FlatMap {
+    static constexpr bool kEytzinger = Layout == FlatMapLayout::Eytzinger;
+
+    /// Eytzinger 布局首地址按缓存行对齐，预取的后代恰好占满一行
+    using KeyVector =
+        std::conditional_t<kEytzinger, std::vector<K, memory::AlignedAllocator<K>>, std::vector<K>>;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+    static constexpr FlatMapLayout kLayout = Layout;
+
+    /// 每条缓存行的键数（Eytzinger 预取跨度）
+    static constexpr std::size_t kKeysPerLine =
+        std::max<std::size_t>(1, memory_constants::kCacheLineSize / sizeof(K));
+
+    /// 键数组超过该字节数时 Eytzinger 查找启用预取
+    static constexpr std::size_t kPrefetchThresholdBytes = memory_constants::kL1CacheSize;
+
+    template <bool Const>
+    class Iterator {
+        using Map = std::conditional_t<Const, const FlatMap, FlatMap>;
+        using ValueRef = std::conditional_t<Const, const V&, V&>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const K&, ValueRef>;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() noexcept = default;
+        Iterator(Map* map, std::size_t index) noexcept : map_(map), index_(index) {}
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other) noexcept : map_(other.map_), index_(other.index_) {}
+
+        [[nodiscard]] inline const K& key() const noexcept { return map_->keys_[index_]; }
+        [[nodiscard]] inline ValueRef value() const noexcept { return map_->values_[index_]; }
+        [[nodiscard]] inline value_type operator*() const noexcept { return {key(), value()}; }
+
+        inline Iterator& operator++() noexcept {
+            index_ = map_->next_index(index_);
+            return *this;
+        }
+
+        inline Iterator operator++(int) noexcept {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        [[nodiscard]] inline bool operator==(const Iterator& other) const noexcept {
+            return index_ == other.index_;
+        }
+
+    private:
+        friend class FlatMap;
+        template <bool>
+        friend class Iterator;
+
+        Map* map_{nullptr};
+        std::size_t index_{0};
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatMap() { clear(); }
+
+    /// 由无序 (键, 值) 批量构造：一次稳定排序，重复键保留先出现者
+    explicit FlatMap(std::vector<std::pair<K, V>> entries) { assign(std::move(entries)); }
+
+    template <std::input_iterator It>
+    FlatMap(It first, It last) : FlatMap(std::vector<std::pair<K, V>>(first, last)) {}
+
+    /// 以无序 (键, 值) 整体替换内容
+    void assign(std::vector<std::pair<K, V>> entries) {
+        std::stable_sort(entries.begin(), entries.end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+        auto last = std::unique(entries.begin(), entries.end(),
+                                [](const auto& a, const auto& b) { return !(a.first < b.first); });
+        entries.erase(last, entries.end());
+
+        if constexpr (kEytzinger) {
+            // 下标 0 不用：节点 k 的子节点为 2k、2k+1
+            keys_.assign(entries.size() + 1, K{});
+            values_.clear();
+            values_.resize(entries.size() + 1);
+            std::size_t next = 0;
+            fill_eytzinger(entries, next, 1);
+        } else {
+            keys_.clear();
+            values_.clear();
+            keys_.reserve(entries.size());
+            values_.reserve(entries.size());
+            for (auto& [key, value] : entries) {
+                keys_.push_back(key);
+                values_.push_back(std::move(value));
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // 查找
+    // -------------------------------------------------------------------------
+
+    /// 返回值指针，键不存在返回 nullptr
+    [[nodiscard, gnu::hot]]
+    inline V* find(const K& key) noexcept {
+        const std::size_t index = lower_bound_index(key);
+        return index != end_index() && !(key < keys_[index]) ? &values_[index] : nullptr;
+    }
+
+    [[nodiscard, gnu::hot]]
+    inline const V* find(const K& key) const noexcept {
+        return const_cast<FlatMap*>(this)->find(key);
+    }
+
+    [[nodiscard]] inline bool contains(const K& key) const noexcept { return find(key) != nullptr; }
+
+    /// 第一个不小于 key 的元素
+    [[nodiscard, gnu::hot]]
+    inline iterator lower_bound(const K& key) noexcept {
+        return {this, lower_bound_index(key)};
+    }
+
+    [[nodiscard, gnu::hot]]
+    inline const_iterator lower_bound(const K& key) const noexcept {
+        return {this, lower_bound_index(key)};
+    }
+
+    // -------------------------------------------------------------------------
+    // 修改（仅 Sorted 布局）
+    // -------------------------------------------------------------------------
+
+    /// 键不存在时插入；返回 {迭代器, 是否插入}
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) requires(!kEytzinger)
+    {
+        const std::size_t index = lower_bound_index(key);
+        if (index != keys_.size() && !(key < keys_[index])) {
+            return {{this, index}, false};
+        }
+        // 先构造值：值构造或 values_ 扩容抛异常时两个数组都未改变；键插入失败时撤销值
+        const auto offset = static_cast<std::ptrdiff_t>(index);
+        values_.emplace(values_.begin() + offset, std::forward<Args>(args)...);
+        try {
+            keys_.insert(keys_.begin() + offset, key);
+        } catch (...) {
+            values_.erase(values_.begin() + offset);
+            throw;
+        }
+        return {{this, index}, true};
+    }
+
+    /// 插入或覆盖
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& value) requires(!kEytzinger)
+    {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first.value() = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    V& operator[](const K& key) requires(!kEytzinger)
+    {
+        return try_emplace(key).first.value();
+    }
+
+    std::size_t erase(const K& key) requires(!kEytzinger)
+    {
+        const std::size_t index = lower_bound_index(key);
+        if (index == keys_.size() || key < keys_[index]) {
+            return 0;
+        }
+        // 先删值：值的移动赋值抛异常时键数组尚未改变（键的移动赋值不应抛异常）
+        values_.erase(values_.begin() + static_cast<std::ptrdiff_t>(index));
+        keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(index));
+        return 1;
+    }
+
+    void reserve(std::size_t count) requires(!kEytzinger)
+    {
+        keys_.reserve(count);
+        values_.reserve(count);
+    }
+
+    void clear() noexcept {
+        keys_.clear();
+        values_.clear();
+        if constexpr (kEytzinger) {
+            keys_.emplace_back();
+            values_.emplace_back();
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // 查询与遍历（按键序）
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return keys_.size() - (kEytzinger ? 1 : 0); }
+    [[nodiscard]] inline bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] inline iterator begin() noexcept { return {this, first_index()}; }
+    [[nodiscard]] inline iterator end() noexcept { return {this, end_index()}; }
+    [[nodiscard]] inline const_iterator begin() const noexcept { return {this, first_index()}; }
+    [[nodiscard]] inline const_iterator end() const noexcept { return {this, end_index()}; }
+
+    /// 键数组（Sorted 为升序；Eytzinger 为 BFS 顺序，下标 0 不用）
+    [[nodiscard]] inline const K* key_data() const noexcept { return keys_.data(); }
+
+private:
+    /// 中序填充：BFS 下标 k 处放入中序第 next 个元素
+    void fill_eytzinger(std::vector<std::pair<K, V>>& sorted, std::size_t& next, std::size_t k) {
+        if (k > sorted.size()) {
+            return;
+        }
+        fill_eytzinger(sorted, next, 2 * k);
+        keys_[k] = sorted[next].first;
+        values_[k] = std::move(sorted[next].second);
+        ++next;
+        fill_eytzinger(sorted, next, 2 * k + 1);
+    }
+
+    /// Eytzinger 的 end 为下标 0（不存放元素）
+    [[nodiscard]] inline std::size_t end_index() const noexcept { return kEytzinger ? 0 : keys_.size(); }
+
+    [[nodiscard]] inline std::size_t first_index() const noexcept {
+        if constexpr (kEytzinger) {
+            const std::size_t n = size();
+            if (n == 0) {
+                return 0;
+            }
+            // 最左节点：从根一直向左
+            return std::size_t{1} << (std::bit_width(n) - 1);
+        } else {
+            return 0;
+        }
+    }
+
+    /// 中序后继
+    [[nodiscard]] inline std::size_t next_index(std::size_t k) const noexcept {
+        if constexpr (kEytzinger) {
+            const std::size_t n = size();
+            if (2 * k + 1 <= n) {
+                // 有右子树：右子节点的最左后代
+                k = 2 * k + 1;
+                while (2 * k <= n) {
+                    k *= 2;
+                }
+                return k;
+            }
+            // 无右子树：上溯到第一个"作为左子节点"的祖先，再取其父节点
+            return k >> std::countr_one(k) >> 1;
+        } else {
+            return k + 1;
+        }
+    }
+
+    [[nodiscard, gnu::hot, gnu::always_inline]]
+    inline std::size_t lower_bound_index(const K& key) const noexcept {
+        if constexpr (kEytzinger) {
+            const K* keys = keys_.data();
+            const std::size_t n = size();
+            std::size_t k = 1;
+            if (n * sizeof(K) > kPrefetchThresholdBytes) {
+                // k 之下 log2(kKeysPerLine) 层的后代连续存放在下标 kKeysPerLine * k 起的一整行
+                while (k <= n) {
+                    prefetch_read(keys + std::min(kKeysPerLine * k, n));
+                    k = 2 * k + static_cast<std::size_t>(keys[k] < key);
+                }
+            } else {
+                while (k <= n) {
+                    k = 2 * k + static_cast<std::size_t>(keys[k] < key);
+                }
+            }
+            // 去掉末尾连续的"向右"步与最后一次"向左"步，得到最后一个向左转的节点（无则为 0 = end）
+            return k >> (std::countr_one(k) + 1);
+        } else {
+            return detail::sorted_lower_bound(keys_.data(), keys_.size(), key);
+        }
+    }
+
+    KeyVector keys_;
+    std::vector<V> values_;
+};
+
+}  // namespace container
@@ -0,0 +1,188 @@
+/**
+ * @file hash.h
+ * @brief 容器共用的哈希工具：透明字符串哈希/比较、哈希混合
+ * @version 1.0.0
+ *
+ * StringHash 对 std::string / std::string_view / const char* / CompileTimeString 给出相同结果
+ * （FNV-1a，与 CompileTimeString::hash() 一致），编译期字符串的哈希可在编译期算好直接传给查找接口。
+ * FNV-1a 与 std::hash<整数>（恒等映射）的低位/高位分布较差，容器内部再经 mix() 混合。
+ *
+ * hash_bytes() 为带种子的分块哈希（wyhash 式），供需要换种子重试的结构（编译期完美哈希）使用；
+ * hash_sampled() 只读长度与首尾各 8 字节，代价与键长无关。两者编译期与运行期结果一致。
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "../../cts/compileTimeString.h"
+
+namespace container {
+
+// =============================================================================
+// 哈希混合
+// =============================================================================
+
+/// 128 位乘法折叠：输入任一位的变化扩散到输出的高低位
+[[nodiscard, gnu::always_inline]]
+constexpr uint64_t mix(uint64_t h) noexcept {
+    constexpr uint64_t kMul = 0x9E3779B97F4A7C15ULL;
+    const __uint128_t r = static_cast<__uint128_t>(h) * kMul;
+    return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+}
+
+/// FNV-1a（与 utils::CompileTimeString::hash() 相同）
+[[nodiscard]] constexpr std::size_t fnv1a(std::string_view s) noexcept {
+    std::size_t result = 14695981039346656037ULL;
+    for (char c : s) {
+        result ^= std::char_traits<char>::to_int_type(c);
+        result *= 1099511628211ULL;
+    }
+    return result;
+}
+
+// =============================================================================
+// 带种子的分块哈希
+// =============================================================================
+
+namespace detail {
+
+/// 128 位乘积的高低位异或
+[[nodiscard, gnu::always_inline]]
+constexpr uint64_t mum(uint64_t a, uint64_t b) noexcept {
+    const __uint128_t r = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+}
+
+/// 小端读取 Bytes（4 或 8）个字节：常量求值时逐字节拼装，运行期为一次非对齐加载
+template <std::size_t Bytes>
+[[nodiscard, gnu::always_inline]]
+constexpr uint64_t load_le(const char* p) noexcept {
+    static_assert(Bytes == 4 || Bytes == 8);
+    if (std::is_constant_evaluated()) {
+        uint64_t v = 0;
+        for (std::size_t i = 0; i < Bytes; ++i) {
+            v |= uint64_t{static_cast<unsigned char>(p[i])} << (8 * i);
+        }
+        return v;
+    }
+    std::conditional_t<Bytes == 8, uint64_t, uint32_t> v;
+    std::memcpy(&v, p, Bytes);
+    return v;
+}
+
+/// 不超过 16 字节的键：首尾各两次 4 字节加载（可重叠）覆盖全部字节
+[[gnu::always_inline]]
+constexpr void load_short(const char* p, std::size_t n, uint64_t& a, uint64_t& b) noexcept {
+    if (n >= 4) {
+        const std::size_t mid = (n >> 3) << 2;
+        a = (load_le<4>(p) << 32) | load_le<4>(p + mid);
+        b = (load_le<4>(p + n - 4) << 32) | load_le<4>(p + n - 4 - mid);
+    } else if (n > 0) {
+        a = (uint64_t{static_cast<unsigned char>(p[0])} << 16) |
+            (uint64_t{static_cast<unsigned char>(p[n >> 1])} << 8) | static_cast<unsigned char>(p[n - 1]);
+        b = 0;
+    } else {
+        a = b = 0;
+    }
+}
+
+inline constexpr uint64_t kHashSecret0 = 0xA0761D6478BD642FULL;
+inline constexpr uint64_t kHashSecret1 = 0xE7037ED1A0B428DBULL;
+
+[[nodiscard, gnu::always_inline]]
+constexpr uint64_t finish(std::size_t n, uint64_t a, uint64_t b, uint64_t h) noexcept {
+    return mum(kHashSecret1 ^ n, mum(a ^ kHashSecret1, b ^ h));
+}
+
+}  // namespace detail
+
+/// 带种子的字符串哈希：不超过 16 字节的键只做重叠加载与两次乘法，更长的键按 16 字节分块
+[[nodiscard, gnu::always_inline]]
+constexpr uint64_t hash_bytes(std::string_view s, uint64_t seed) noexcept {
+    const char* p = s.data();
+    std::size_t n = s.size();
+    uint64_t h = seed ^ detail::kHashSecret0;
+    uint64_t a = 0;
+    uint64_t b = 0;
+    if (n <= 16) [[likely]] {
+        detail::load_short(p, n, a, b);
+    } else {
+        for (; n > 16; n -= 16, p += 16) {
+            h = detail::mum(detail::load_le<8>(p) ^ detail::kHashSecret1, detail::load_le<8>(p + 8) ^ h);
+        }
+        a = detail::load_le<8>(p + n - 16);
+        b = detail::load_le<8>(p + n - 8);
+    }
+    return detail::finish(s.size(), a, b, h);
+}
+
+/// 只取长度与首尾各至多 8 字节的哈希：代价与键长无关，
+/// 适用于键集合已知、且各键在这些字节上互不相同的场合（由调用方在构造时检查）
+[[nodiscard, gnu::always_inline]]
+constexpr uint64_t hash_sampled(std::string_view s, uint64_t seed) noexcept {
+    const char* p = s.data();
+    const std::size_t n = s.size();
+    uint64_t a = 0;
+    uint64_t b = 0;
+    if (n >= 8) {
+        a = detail::load_le<8>(p);
+        b = detail::load_le<8>(p + n - 8);
+    } else {
+        detail::load_short(p, n, a, b);
+    }
+    return detail::finish(n, a, b, seed ^ detail::kHashSecret0);
+}
+
+// =============================================================================
+// 透明字符串哈希与比较
+// =============================================================================
+
+struct StringHash {
+    using is_transparent = void;
+
+    [[nodiscard]] constexpr std::size_t operator()(std::string_view s) const noexcept { return fnv1a(s); }
+
+    template <std::size_t N>
+    [[nodiscard]] constexpr std::size_t operator()(const utils::CompileTimeString<N>& s) const noexcept {
+        return s.hash();
+    }
+};
+
+struct StringEqual {
+    using is_transparent = void;
+
+    template <typename A, typename B>
+    [[nodiscard]] constexpr bool operator()(const A& a, const B& b) const noexcept {
+        return std::string_view(a) == std::string_view(b);
+    }
+};
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_compile_time_string_v = false;
+
+template <std::size_t N>
+inline constexpr bool is_compile_time_string_v<utils::CompileTimeString<N>> = true;
+
+template <typename K>
+inline constexpr bool is_string_key_v =
+    std::is_same_v<K, std::string> || std::is_same_v<K, std::string_view> || is_compile_time_string_v<K>;
+
+}  // namespace detail
+
+/// 字符串类键使用透明哈希/比较，其他类型使用 std::hash / std::equal_to<>
+template <typename K>
+using DefaultHash = std::conditional_t<detail::is_string_key_v<K>, StringHash, std::hash<K>>;
+
+template <typename K>
+using DefaultEqual = std::conditional_t<detail::is_string_key_v<K>, StringEqual, std::equal_to<>>;
+
+}  // namespace container
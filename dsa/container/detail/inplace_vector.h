@@ -0,0 +1,284 @@
+/**
+ * @file inplace_vector.h
+ * @brief 定容内联向量（P0843 inplace_vector 风格）：元素存于对象内部，从不分配堆内存
+ * @version 1.0.0
+ *
+ * 容量 N 编译期固定，适合元素数有确定上限的每消息小集合（成交腿、订单修改字段等）：
+ * - 存储为对象内的 N 个槽位，大小字段取能容纳 N 的最小无符号整数（至少 uint16_t）
+ * - T 平凡可复制时 InplaceVector 本身也平凡可复制（复制/移动/析构均为默认），可整体 memcpy
+ * - 中间插入/删除对平凡重定位类型（is_trivially_relocatable）用 memmove 整体搬移
+ *
+ * 超出容量：push_back / emplace_back / insert 抛 std::bad_alloc（与 P0843 一致）；
+ * try_push_back / try_emplace_back 返回 nullptr；unchecked_* 不检查（调用方保证未满）。
+ *
+ * 用法：
+ *   InplaceVector<Fill, 16> fills;
+ *   if (fills.try_push_back(fill) == nullptr) { ... }
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "relocate.h"
+
+namespace container {
+
+namespace detail {
+
+/// 能表示 [0, N] 的最小无符号整数，至少 uint16_t：uint8_t 是字符类型，与任何类型互为别名，
+/// 每写入一个元素编译器都要重新从内存读取大小字段，连续 push_back 会串成一条存储转发依赖链
+template <std::size_t N>
+using SmallestSize =
+    std::conditional_t<N <= std::numeric_limits<uint16_t>::max(), uint16_t,
+                       std::conditional_t<N <= std::numeric_limits<uint32_t>::max(), uint32_t, std::size_t>>;
+
+}  // namespace detail
+
+template <typename T, std::size_t N>
+class InplaceVector {
+    static_assert(N > 0, "InplaceVector capacity must be positive");
+
+    using SizeType = detail::SmallestSize<N>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    InplaceVector() noexcept = default;
+
+    explicit InplaceVector(std::size_t count) { resize(count); }
+
+    InplaceVector(std::size_t count, const T& value) { resize(count, value); }
+
+    template <std::input_iterator It>
+    InplaceVector(It first, It last) {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    InplaceVector(std::initializer_list<T> init) : InplaceVector(init.begin(), init.end()) {}
+
+    // -------------------------------------------------------------------------
+    // 复制 / 移动：T 平凡时全部为默认（整体按字节复制 N 个槽位）
+    // -------------------------------------------------------------------------
+
+    InplaceVector(const InplaceVector&) requires std::is_trivially_copy_constructible_v<T> = default;
+
+    InplaceVector(const InplaceVector& other) noexcept(std::is_nothrow_copy_constructible_v<T>) {
+        detail::copy_construct(data(), other.data(), other.size());
+        size_ = other.size_;
+    }
+
+    InplaceVector(InplaceVector&&) requires std::is_trivially_move_constructible_v<T> = default;
+
+    /// 逐元素移动；源保留其（已移走的）元素，与 std::vector 不同但与 P0843 一致
+    InplaceVector(InplaceVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        std::uninitialized_move_n(other.data(), other.size(), data());
+        size_ = other.size_;
+    }
+
+    InplaceVector& operator=(const InplaceVector&)
+        requires(std::is_trivially_copy_assignable_v<T> && std::is_trivially_copy_constructible_v<T> &&
+                 std::is_trivially_destructible_v<T>)
+    = default;
+
+    InplaceVector& operator=(const InplaceVector& other) {
+        if (this != &other) {
+            clear();
+            detail::copy_construct(data(), other.data(), other.size());
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    InplaceVector& operator=(InplaceVector&&)
+        requires(std::is_trivially_move_assignable_v<T> && std::is_trivially_move_constructible_v<T> &&
+                 std::is_trivially_destructible_v<T>)
+    = default;
+
+    InplaceVector& operator=(InplaceVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            std::uninitialized_move_n(other.data(), other.size(), data());
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    ~InplaceVector() requires std::is_trivially_destructible_v<T> = default;
+
+    ~InplaceVector() { clear(); }
+
+    // -------------------------------------------------------------------------
+    // 访问
+    // -------------------------------------------------------------------------
+
+    [[nodiscard, gnu::always_inline]] inline T* data() noexcept {
+        return std::launder(reinterpret_cast<T*>(storage_));
+    }
+    [[nodiscard, gnu::always_inline]] inline const T* data() const noexcept {
+        return std::launder(reinterpret_cast<const T*>(storage_));
+    }
+
+    [[nodiscard]] inline T& operator[](std::size_t i) noexcept { return data()[i]; }
+    [[nodiscard]] inline const T& operator[](std::size_t i) const noexcept { return data()[i]; }
+    [[nodiscard]] inline T& front() noexcept { return data()[0]; }
+    [[nodiscard]] inline const T& front() const noexcept { return data()[0]; }
+    [[nodiscard]] inline T& back() noexcept { return data()[size_ - 1]; }
+    [[nodiscard]] inline const T& back() const noexcept { return data()[size_ - 1]; }
+
+    [[nodiscard]] inline iterator begin() noexcept { return data(); }
+    [[nodiscard]] inline iterator end() noexcept { return data() + size_; }
+    [[nodiscard]] inline const_iterator begin() const noexcept { return data(); }
+    [[nodiscard]] inline const_iterator end() const noexcept { return data() + size_; }
+    [[nodiscard]] inline const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] inline const_iterator cend() const noexcept { return end(); }
+    [[nodiscard]] inline reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    [[nodiscard]] inline reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    [[nodiscard]] inline const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    [[nodiscard]] inline const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    // -------------------------------------------------------------------------
+    // 容量
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] inline bool full() const noexcept { return size_ == N; }
+    [[nodiscard]] static constexpr std::size_t capacity() noexcept { return N; }
+    [[nodiscard]] static constexpr std::size_t max_size() noexcept { return N; }
+
+    // -------------------------------------------------------------------------
+    // 尾部插入 / 删除
+    // -------------------------------------------------------------------------
+
+    /// 已满时抛 std::bad_alloc
+    template <typename... Args>
+    inline T& emplace_back(Args&&... args) {
+        if (full()) [[unlikely]] {
+            throw std::bad_alloc();
+        }
+        return unchecked_emplace_back(std::forward<Args>(args)...);
+    }
+
+    inline T& push_back(const T& value) { return emplace_back(value); }
+    inline T& push_back(T&& value) { return emplace_back(std::move(value)); }
+
+    /// 已满时返回 nullptr，不构造
+    template <typename... Args>
+    [[nodiscard]] inline T* try_emplace_back(Args&&... args) {
+        if (full()) [[unlikely]] {
+            return nullptr;
+        }
+        return &unchecked_emplace_back(std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]] inline T* try_push_back(const T& value) { return try_emplace_back(value); }
+    [[nodiscard]] inline T* try_push_back(T&& value) { return try_emplace_back(std::move(value)); }
+
+    /// 调用方保证未满
+    template <typename... Args>
+    [[gnu::always_inline]] inline T& unchecked_emplace_back(Args&&... args) {
+        T* slot = ::new (static_cast<void*>(data() + size_)) T(std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    inline T& unchecked_push_back(const T& value) { return unchecked_emplace_back(value); }
+    inline T& unchecked_push_back(T&& value) { return unchecked_emplace_back(std::move(value)); }
+
+    inline void pop_back() noexcept {
+        --size_;
+        std::destroy_at(data() + size_);
+    }
+
+    inline void clear() noexcept {
+        std::destroy_n(data(), size_);
+        size_ = 0;
+    }
+
+    /// 超过容量时抛 std::bad_alloc
+    void resize(std::size_t count) { resize_with(count, [](T* p) { ::new (static_cast<void*>(p)) T(); }); }
+
+    void resize(std::size_t count, const T& value) {
+        resize_with(count, [&](T* p) { ::new (static_cast<void*>(p)) T(value); });
+    }
+
+    // -------------------------------------------------------------------------
+    // 中间插入 / 删除
+    // -------------------------------------------------------------------------
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        if (full()) [[unlikely]] {
+            throw std::bad_alloc();
+        }
+        T* at = data() + (pos - begin());
+        T value(std::forward<Args>(args)...);
+        detail::insert_shift(at, end(), std::move(value));
+        ++size_;
+        return at;
+    }
+
+    inline iterator insert(const_iterator pos, const T& value) { return emplace(pos, value); }
+    inline iterator insert(const_iterator pos, T&& value) { return emplace(pos, std::move(value)); }
+
+    inline iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        T* from = data() + (first - begin());
+        T* to = data() + (last - begin());
+        size_ = static_cast<SizeType>(detail::erase_shift(from, to, end()) - data());
+        return from;
+    }
+
+    [[nodiscard]] friend bool operator==(const InplaceVector& a, const InplaceVector& b) {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+private:
+    template <typename Construct>
+    void resize_with(std::size_t count, Construct&& construct) {
+        if (count > N) [[unlikely]] {
+            throw std::bad_alloc();
+        }
+        if (count < size_) {
+            std::destroy(data() + count, end());
+            size_ = static_cast<SizeType>(count);
+            return;
+        }
+        while (size_ < count) {
+            construct(data() + size_);
+            ++size_;
+        }
+    }
+
+    alignas(T) std::byte storage_[N * sizeof(T)];
+    SizeType size_{0};
+};
+
+}  // namespace container
@@ -0,0 +1,73 @@
+/**
+ * @file intrusive_hook.h
+ * @brief 侵入式容器公共部分：成员钩子到宿主对象的换算（container_of），safe-link 检查
+ * @version 1.0.0
+ *
+ * 侵入式容器不分配内存：链接字段（钩子）嵌在用户对象里，容器只串联钩子。
+ * 容器以钩子成员指针为模板参数（IntrusiveList<&Order::hook_>），由钩子地址减去成员偏移得到宿主，
+ * 与 container_of(hook, Order, hook_) 相同；偏移取自成员指针的 Itanium ABI 表示（即字节偏移）。
+ *
+ * 钩子在未链接时为零状态，linked() 始终准确（摘除时清零）。钩子模板参数 SafeLink 为 true 时，
+ * 重复链接、摘除未链接钩子、销毁仍在容器中的对象都会打印原因并 abort，用于调试构建；
+ * 为 false 时无任何检查开销。复制宿主对象不会复制链接状态。
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+
+namespace container::detail {
+
+/// safe-link 违规：打印并终止
+[[noreturn, gnu::cold, gnu::noinline]] inline void link_violation(const char* what) noexcept {
+    std::fprintf(stderr, "intrusive container: %s\n", what);
+    std::abort();
+}
+
+template <bool SafeLink>
+[[gnu::always_inline]] inline void link_check(bool ok, const char* what) noexcept {
+    if constexpr (SafeLink) {
+        if (!ok) [[unlikely]] {
+            link_violation(what);
+        }
+    }
+}
+
+template <typename>
+struct MemberPointer;
+
+template <typename T, typename H>
+struct MemberPointer<H T::*> {
+    using Object = T;
+    using Hook = H;
+};
+
+/// 钩子成员指针 Member 对应的宿主类型、钩子类型与双向换算
+template <auto Member>
+struct HookTraits {
+    using Object = typename MemberPointer<decltype(Member)>::Object;
+    using Hook = typename MemberPointer<decltype(Member)>::Hook;
+
+    static_assert(std::is_standard_layout_v<Object>, "Type must be standard layout!");
+    static_assert(sizeof(Member) == sizeof(std::ptrdiff_t), "unsupported member pointer representation");
+
+    [[nodiscard, gnu::always_inline]] static inline Hook* hook(Object& object) noexcept {
+        return &(object.*Member);
+    }
+
+    [[nodiscard, gnu::always_inline]] static inline const Hook* hook(const Object& object) noexcept {
+        return &(object.*Member);
+    }
+
+    /// container_of(hook, Object, member)
+    [[nodiscard, gnu::always_inline]] static inline Object* owner(const Hook* hook) noexcept {
+        const auto offset = std::bit_cast<std::ptrdiff_t>(Member);
+        return reinterpret_cast<Object*>(const_cast<char*>(reinterpret_cast<const char*>(hook)) - offset);
+    }
+};
+
+}  // namespace container::detail
@@ -0,0 +1,584 @@
+/**
+ * @file intrusive_list.h
+ * @brief 侵入式双向链表、单向栈与队列：节点嵌在用户对象中，不分配内存
+ * @version 1.0.0
+ *
+ * 面向无分配的定时器链、LRU 链、订单队列：
+ * - IntrusiveList: 带哨兵的循环双向链表，任意位置 O(1) 摘除 / 移到首尾 / 整表拼接
+ * - IntrusiveStack: 单向 LIFO（空闲链表、批处理）
+ * - IntrusiveQueue: 单向 FIFO，头出尾入，O(1) 整体接续
+ * 单向链表的末尾节点 next_ 指向自身，未链接为 nullptr，因此 linked() 同样准确且容器可移动。
+ *
+ * 用法：
+ *   struct Order { ListHook<> hook_; uint64_t id_; };
+ *   IntrusiveList<&Order::hook_> queue;
+ *   queue.push_back(order);
+ *   queue.erase(order);                 // 撤单：O(1)，无需查找
+ *   while (Order* o = queue.pop_front()) { ... }
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "intrusive_hook.h"
+
+namespace container {
+
+template <auto Member>
+class IntrusiveList;
+template <auto Member>
+class IntrusiveStack;
+template <auto Member>
+class IntrusiveQueue;
+
+// =============================================================================
+// 钩子
+// =============================================================================
+
+/// 双向链表钩子
+template <bool SafeLink = false>
+class ListHook {
+public:
+    static constexpr bool kSafeLink = SafeLink;
+
+    ListHook() noexcept = default;
+    ListHook(const ListHook&) noexcept {}
+    ListHook& operator=(const ListHook&) noexcept { return *this; }
+
+    ~ListHook() requires(!SafeLink) = default;
+    ~ListHook() requires SafeLink { detail::link_check<true>(!linked(), "object destroyed while linked"); }
+
+    [[nodiscard]] inline bool linked() const noexcept { return next_ != nullptr; }
+
+private:
+    template <auto>
+    friend class IntrusiveList;
+
+    ListHook* prev_{nullptr};
+    ListHook* next_{nullptr};
+};
+
+/// 单向链表钩子（栈 / 队列）
+template <bool SafeLink = false>
+class SListHook {
+public:
+    static constexpr bool kSafeLink = SafeLink;
+
+    SListHook() noexcept = default;
+    SListHook(const SListHook&) noexcept {}
+    SListHook& operator=(const SListHook&) noexcept { return *this; }
+
+    ~SListHook() requires(!SafeLink) = default;
+    ~SListHook() requires SafeLink { detail::link_check<true>(!linked(), "object destroyed while linked"); }
+
+    [[nodiscard]] inline bool linked() const noexcept { return next_ != nullptr; }
+
+private:
+    template <auto>
+    friend class IntrusiveStack;
+    template <auto>
+    friend class IntrusiveQueue;
+    template <typename, typename>
+    friend class SListIterator;
+
+    /// 后继；末尾节点指向自身
+    [[nodiscard, gnu::always_inline]] inline SListHook* successor() const noexcept {
+        return next_ == this ? nullptr : next_;
+    }
+
+    SListHook* next_{nullptr};
+};
+
+/// 单向链表前向迭代器
+template <typename Traits, typename Object>
+class SListIterator {
+    using Hook = typename Traits::Hook;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_const_t<Object>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Object*;
+    using reference = Object&;
+
+    SListIterator() noexcept = default;
+    explicit SListIterator(Hook* hook) noexcept : hook_(hook) {}
+
+    [[nodiscard]] inline Object& operator*() const noexcept { return *Traits::owner(hook_); }
+    [[nodiscard]] inline Object* operator->() const noexcept { return Traits::owner(hook_); }
+
+    inline SListIterator& operator++() noexcept {
+        hook_ = hook_->successor();
+        return *this;
+    }
+
+    inline SListIterator operator++(int) noexcept {
+        SListIterator tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    [[nodiscard]] inline bool operator==(const SListIterator& other) const noexcept {
+        return hook_ == other.hook_;
+    }
+
+private:
+    Hook* hook_{nullptr};
+};
+
+// =============================================================================
+// 双向链表
+// =============================================================================
+
+template <auto Member>
+class IntrusiveList {
+    using Traits = detail::HookTraits<Member>;
+
+public:
+    using value_type = typename Traits::Object;
+    using Hook = typename Traits::Hook;
+    using size_type = std::size_t;
+
+    static constexpr bool kSafeLink = Hook::kSafeLink;
+
+    template <bool Const>
+    class Iterator {
+        using Object = std::conditional_t<Const, const typename Traits::Object, typename Traits::Object>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename Traits::Object;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Object*;
+        using reference = Object&;
+
+        Iterator() noexcept = default;
+        explicit Iterator(Hook* hook) noexcept : hook_(hook) {}
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other) noexcept : hook_(other.hook_) {}
+
+        [[nodiscard]] inline Object& operator*() const noexcept { return *Traits::owner(hook_); }
+        [[nodiscard]] inline Object* operator->() const noexcept { return Traits::owner(hook_); }
+
+        inline Iterator& operator++() noexcept {
+            hook_ = hook_->next_;
+            return *this;
+        }
+
+        inline Iterator operator++(int) noexcept {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        inline Iterator& operator--() noexcept {
+            hook_ = hook_->prev_;
+            return *this;
+        }
+
+        inline Iterator operator--(int) noexcept {
+            Iterator tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        [[nodiscard]] inline bool operator==(const Iterator& other) const noexcept {
+            return hook_ == other.hook_;
+        }
+
+    private:
+        friend class IntrusiveList;
+        template <bool>
+        friend class Iterator;
+
+        Hook* hook_{nullptr};
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    IntrusiveList() noexcept { head_.prev_ = head_.next_ = &head_; }
+
+    /// 析构时摘除全部节点（节点对象不受影响）
+    ~IntrusiveList() {
+        clear();
+        head_.prev_ = head_.next_ = nullptr;
+    }
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList() { splice(end(), other); }
+
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            splice(end(), other);
+        }
+        return *this;
+    }
+
+    // -------------------------------------------------------------------------
+    // 插入 / 摘除（均为 O(1)）
+    // -------------------------------------------------------------------------
+
+    inline void push_front(value_type& object) noexcept { link_before(head_.next_, Traits::hook(object)); }
+    inline void push_back(value_type& object) noexcept { link_before(&head_, Traits::hook(object)); }
+
+    /// 插到 pos 之前
+    inline iterator insert(const_iterator pos, value_type& object) noexcept {
+        Hook* hook = Traits::hook(object);
+        link_before(pos.hook_, hook);
+        return iterator{hook};
+    }
+
+    /// 摘除首元素，空表返回 nullptr
+    [[nodiscard]] inline value_type* pop_front() noexcept {
+        if (empty()) {
+            return nullptr;
+        }
+        Hook* hook = head_.next_;
+        unlink(hook);
+        return Traits::owner(hook);
+    }
+
+    [[nodiscard]] inline value_type* pop_back() noexcept {
+        if (empty()) {
+            return nullptr;
+        }
+        Hook* hook = head_.prev_;
+        unlink(hook);
+        return Traits::owner(hook);
+    }
+
+    /// 摘除本表中的任意对象
+    inline void erase(value_type& object) noexcept { unlink(Traits::hook(object)); }
+
+    /// 摘除 pos，返回其后继
+    inline iterator erase(const_iterator pos) noexcept {
+        Hook* next = pos.hook_->next_;
+        unlink(pos.hook_);
+        return iterator{next};
+    }
+
+    /// 把本表中的对象移到表头 / 表尾（LRU 提升）
+    inline void move_to_front(value_type& object) noexcept {
+        Hook* hook = Traits::hook(object);
+        detail::link_check<kSafeLink>(hook->linked(), "move of unlinked object");
+        if (head_.next_ != hook) {
+            detach(hook);
+            attach_before(head_.next_, hook);
+        }
+    }
+
+    inline void move_to_back(value_type& object) noexcept {
+        Hook* hook = Traits::hook(object);
+        detail::link_check<kSafeLink>(hook->linked(), "move of unlinked object");
+        if (head_.prev_ != hook) {
+            detach(hook);
+            attach_before(&head_, hook);
+        }
+    }
+
+    /// 把 other 的全部节点按序接到 pos 之前，O(1)
+    inline void splice(const_iterator pos, IntrusiveList& other) noexcept {
+        if (other.empty() || &other == this) {
+            return;
+        }
+        Hook* first = other.head_.next_;
+        Hook* last = other.head_.prev_;
+        Hook* next = pos.hook_;
+        Hook* prev = next->prev_;
+        prev->next_ = first;
+        first->prev_ = prev;
+        last->next_ = next;
+        next->prev_ = last;
+        size_ += other.size_;
+        other.head_.prev_ = other.head_.next_ = &other.head_;
+        other.size_ = 0;
+    }
+
+    /// 摘除全部节点并清零其钩子，O(n)
+    void clear() noexcept {
+        Hook* hook = head_.next_;
+        while (hook != &head_) {
+            Hook* next = hook->next_;
+            hook->prev_ = hook->next_ = nullptr;
+            hook = next;
+        }
+        head_.prev_ = head_.next_ = &head_;
+        size_ = 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // 查询与遍历
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline value_type* front() noexcept {
+        return empty() ? nullptr : Traits::owner(head_.next_);
+    }
+    [[nodiscard]] inline value_type* back() noexcept {
+        return empty() ? nullptr : Traits::owner(head_.prev_);
+    }
+    [[nodiscard]] inline const value_type* front() const noexcept {
+        return empty() ? nullptr : Traits::owner(head_.next_);
+    }
+    [[nodiscard]] inline const value_type* back() const noexcept {
+        return empty() ? nullptr : Traits::owner(head_.prev_);
+    }
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+
+    /// 对象在本表中的迭代器，O(1)
+    [[nodiscard]] inline iterator iterator_to(value_type& object) noexcept {
+        return iterator{Traits::hook(object)};
+    }
+
+    [[nodiscard]] inline iterator begin() noexcept { return iterator{head_.next_}; }
+    [[nodiscard]] inline iterator end() noexcept { return iterator{&head_}; }
+    [[nodiscard]] inline const_iterator begin() const noexcept { return const_iterator{head_.next_}; }
+    [[nodiscard]] inline const_iterator end() const noexcept { return const_iterator{sentinel()}; }
+
+private:
+    [[nodiscard]] inline Hook* sentinel() const noexcept { return const_cast<Hook*>(&head_); }
+
+    [[gnu::always_inline]] static inline void attach_before(Hook* next, Hook* hook) noexcept {
+        Hook* prev = next->prev_;
+        hook->prev_ = prev;
+        hook->next_ = next;
+        prev->next_ = hook;
+        next->prev_ = hook;
+    }
+
+    [[gnu::always_inline]] static inline void detach(Hook* hook) noexcept {
+        hook->prev_->next_ = hook->next_;
+        hook->next_->prev_ = hook->prev_;
+    }
+
+    [[gnu::always_inline]] inline void link_before(Hook* next, Hook* hook) noexcept {
+        detail::link_check<kSafeLink>(!hook->linked(), "insert of already linked object");
+        attach_before(next, hook);
+        ++size_;
+    }
+
+    [[gnu::always_inline]] inline void unlink(Hook* hook) noexcept {
+        detail::link_check<kSafeLink>(hook->linked() && hook != &head_, "erase of unlinked object");
+        detach(hook);
+        hook->prev_ = hook->next_ = nullptr;
+        --size_;
+    }
+
+    Hook head_;
+    std::size_t size_{0};
+};
+
+// =============================================================================
+// 单向栈
+// =============================================================================
+
+template <auto Member>
+class IntrusiveStack {
+    using Traits = detail::HookTraits<Member>;
+
+public:
+    using value_type = typename Traits::Object;
+    using Hook = typename Traits::Hook;
+    using iterator = SListIterator<Traits, value_type>;
+    using const_iterator = SListIterator<Traits, const value_type>;
+
+    static constexpr bool kSafeLink = Hook::kSafeLink;
+
+    IntrusiveStack() noexcept = default;
+    ~IntrusiveStack() { clear(); }
+
+    IntrusiveStack(const IntrusiveStack&) = delete;
+    IntrusiveStack& operator=(const IntrusiveStack&) = delete;
+
+    IntrusiveStack(IntrusiveStack&& other) noexcept
+        : top_(std::exchange(other.top_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+    IntrusiveStack& operator=(IntrusiveStack&& other) noexcept {
+        if (this != &other) {
+            clear();
+            top_ = std::exchange(other.top_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    inline void push(value_type& object) noexcept {
+        Hook* hook = Traits::hook(object);
+        detail::link_check<kSafeLink>(!hook->linked(), "push of already linked object");
+        hook->next_ = top_ != nullptr ? top_ : hook;
+        top_ = hook;
+        ++size_;
+    }
+
+    /// 弹出栈顶，空栈返回 nullptr
+    [[nodiscard]] inline value_type* pop() noexcept {
+        Hook* hook = top_;
+        if (hook == nullptr) {
+            return nullptr;
+        }
+        top_ = hook->successor();
+        hook->next_ = nullptr;
+        --size_;
+        return Traits::owner(hook);
+    }
+
+    [[nodiscard]] inline value_type* top() const noexcept {
+        return top_ != nullptr ? Traits::owner(top_) : nullptr;
+    }
+
+    void clear() noexcept {
+        while (top_ != nullptr) {
+            Hook* next = top_->successor();
+            top_->next_ = nullptr;
+            top_ = next;
+        }
+        size_ = 0;
+    }
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline bool empty() const noexcept { return top_ == nullptr; }
+
+    [[nodiscard]] inline iterator begin() noexcept { return iterator{top_}; }
+    [[nodiscard]] inline iterator end() noexcept { return {}; }
+    [[nodiscard]] inline const_iterator begin() const noexcept { return const_iterator{top_}; }
+    [[nodiscard]] inline const_iterator end() const noexcept { return {}; }
+
+private:
+    Hook* top_{nullptr};
+    std::size_t size_{0};
+};
+
+// =============================================================================
+// 单向队列
+// =============================================================================
+
+template <auto Member>
+class IntrusiveQueue {
+    using Traits = detail::HookTraits<Member>;
+
+public:
+    using value_type = typename Traits::Object;
+    using Hook = typename Traits::Hook;
+    using iterator = SListIterator<Traits, value_type>;
+    using const_iterator = SListIterator<Traits, const value_type>;
+
+    static constexpr bool kSafeLink = Hook::kSafeLink;
+
+    IntrusiveQueue() noexcept = default;
+    ~IntrusiveQueue() { clear(); }
+
+    IntrusiveQueue(const IntrusiveQueue&) = delete;
+    IntrusiveQueue& operator=(const IntrusiveQueue&) = delete;
+
+    IntrusiveQueue(IntrusiveQueue&& other) noexcept
+        : head_(std::exchange(other.head_, nullptr)),
+          tail_(std::exchange(other.tail_, nullptr)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    IntrusiveQueue& operator=(IntrusiveQueue&& other) noexcept {
+        if (this != &other) {
+            clear();
+            head_ = std::exchange(other.head_, nullptr);
+            tail_ = std::exchange(other.tail_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    inline void push_back(value_type& object) noexcept {
+        Hook* hook = Traits::hook(object);
+        detail::link_check<kSafeLink>(!hook->linked(), "push of already linked object");
+        hook->next_ = hook;
+        if (tail_ != nullptr) {
+            tail_->next_ = hook;
+        } else {
+            head_ = hook;
+        }
+        tail_ = hook;
+        ++size_;
+    }
+
+    inline void push_front(value_type& object) noexcept {
+        Hook* hook = Traits::hook(object);
+        detail::link_check<kSafeLink>(!hook->linked(), "push of already linked object");
+        hook->next_ = head_ != nullptr ? head_ : hook;
+        head_ = hook;
+        if (tail_ == nullptr) {
+            tail_ = hook;
+        }
+        ++size_;
+    }
+
+    /// 取出队首，空队列返回 nullptr
+    [[nodiscard]] inline value_type* pop_front() noexcept {
+        Hook* hook = head_;
+        if (hook == nullptr) {
+            return nullptr;
+        }
+        head_ = hook->successor();
+        if (head_ == nullptr) {
+            tail_ = nullptr;
+        }
+        hook->next_ = nullptr;
+        --size_;
+        return Traits::owner(hook);
+    }
+
+    /// 把 other 整体接到队尾，O(1)
+    inline void append(IntrusiveQueue& other) noexcept {
+        if (other.head_ == nullptr || &other == this) {
+            return;
+        }
+        if (tail_ != nullptr) {
+            tail_->next_ = other.head_;
+        } else {
+            head_ = other.head_;
+        }
+        tail_ = other.tail_;
+        size_ += other.size_;
+        other.head_ = other.tail_ = nullptr;
+        other.size_ = 0;
+    }
+
+    [[nodiscard]] inline value_type* front() const noexcept {
+        return head_ != nullptr ? Traits::owner(head_) : nullptr;
+    }
+    [[nodiscard]] inline value_type* back() const noexcept {
+        return tail_ != nullptr ? Traits::owner(tail_) : nullptr;
+    }
+
+    void clear() noexcept {
+        while (head_ != nullptr) {
+            Hook* next = head_->successor();
+            head_->next_ = nullptr;
+            head_ = next;
+        }
+        tail_ = nullptr;
+        size_ = 0;
+    }
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline bool empty() const noexcept { return head_ == nullptr; }
+
+    [[nodiscard]] inline iterator begin() noexcept { return iterator{head_}; }
+    [[nodiscard]] inline iterator end() noexcept { return {}; }
+    [[nodiscard]] inline const_iterator begin() const noexcept { return const_iterator{head_}; }
+    [[nodiscard]] inline const_iterator end() const noexcept { return {}; }
+
+private:
+    Hook* head_{nullptr};
+    Hook* tail_{nullptr};
+    std::size_t size_{0};
+};
+
+}  // namespace container
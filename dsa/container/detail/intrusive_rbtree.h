@@ -0,0 +1,571 @@
+/**
+ * @file intrusive_rbtree.h
+ * @brief 侵入式红黑树：节点嵌在用户对象中，不分配内存，按对象比较排序（允许相等键）
+ * @version 1.0.0
+ *
+ * 面向无分配的定时器、按价格排序的订单簿层级：
+ * - 插入 O(log n)；相等元素插到已有元素之后（同一截止时间按到达顺序 FIFO）
+ * - 由对象直接摘除 O(log n) 摊还常数次旋转，无需先查找
+ * - 最小元素缓存在 leftmost_，front() 为 O(1)，pop_front() 常用于"取最早到期"
+ * - 钩子 24 字节：父指针最低位存颜色，未链接时全零
+ *
+ * Compare 对两个宿主对象比较；lower_bound / find 也接受其他键类型，需 Compare 提供
+ * (const T&, const Key&) 与 (const Key&, const T&) 两个重载。
+ *
+ * 用法：
+ *   struct Timer { RbHook<> hook_; uint64_t deadline_; };
+ *   struct ByDeadline { bool operator()(const Timer& a, const Timer& b) const { ... } };
+ *   IntrusiveRbTree<&Timer::hook_, ByDeadline> timers;
+ *   timers.insert(t);  timers.erase(t);  Timer* next = timers.front();
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "intrusive_hook.h"
+
+namespace container {
+
+template <auto Member, typename Compare>
+class IntrusiveRbTree;
+
+/// 红黑树钩子
+template <bool SafeLink = false>
+class RbHook {
+public:
+    static constexpr bool kSafeLink = SafeLink;
+
+    RbHook() noexcept = default;
+    RbHook(const RbHook&) noexcept {}
+    RbHook& operator=(const RbHook&) noexcept { return *this; }
+
+    ~RbHook() requires(!SafeLink) = default;
+    ~RbHook() requires SafeLink { detail::link_check<true>(!linked(), "object destroyed while linked"); }
+
+    /// 已链接节点的 parent_color_ 不为 0：根为黑色（最低位 1），非根节点父指针非空
+    [[nodiscard]] inline bool linked() const noexcept { return parent_color_ != 0; }
+
+private:
+    template <auto, typename>
+    friend class IntrusiveRbTree;
+
+    static constexpr uintptr_t kBlack = 1;
+
+    [[nodiscard, gnu::always_inline]] inline RbHook* parent() const noexcept {
+        return reinterpret_cast<RbHook*>(parent_color_ & ~kBlack);
+    }
+    [[nodiscard, gnu::always_inline]] inline bool black() const noexcept {
+        return (parent_color_ & kBlack) != 0;
+    }
+
+    [[gnu::always_inline]] inline void set_parent(RbHook* parent) noexcept {
+        parent_color_ = reinterpret_cast<uintptr_t>(parent) | (parent_color_ & kBlack);
+    }
+    [[gnu::always_inline]] inline void set_black(bool black) noexcept {
+        parent_color_ = (parent_color_ & ~kBlack) | (black ? kBlack : 0);
+    }
+
+    uintptr_t parent_color_{0};
+    RbHook* left_{nullptr};
+    RbHook* right_{nullptr};
+};
+
+template <auto Member, typename Compare = std::less<>>
+class IntrusiveRbTree {
+    using Traits = detail::HookTraits<Member>;
+
+public:
+    using value_type = typename Traits::Object;
+    using Hook = typename Traits::Hook;
+    using size_type = std::size_t;
+
+    static constexpr bool kSafeLink = Hook::kSafeLink;
+
+    template <bool Const>
+    class Iterator {
+        using Object = std::conditional_t<Const, const typename Traits::Object, typename Traits::Object>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename Traits::Object;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Object*;
+        using reference = Object&;
+
+        Iterator() noexcept = default;
+        Iterator(const IntrusiveRbTree* tree, Hook* hook) noexcept : tree_(tree), hook_(hook) {}
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other) noexcept : tree_(other.tree_), hook_(other.hook_) {}
+
+        [[nodiscard]] inline Object& operator*() const noexcept { return *Traits::owner(hook_); }
+        [[nodiscard]] inline Object* operator->() const noexcept { return Traits::owner(hook_); }
+
+        inline Iterator& operator++() noexcept {
+            hook_ = next(hook_);
+            return *this;
+        }
+
+        inline Iterator operator++(int) noexcept {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        /// end() 的前驱为最大元素
+        inline Iterator& operator--() noexcept {
+            hook_ = hook_ != nullptr ? prev(hook_) : tree_->rightmost();
+            return *this;
+        }
+
+        inline Iterator operator--(int) noexcept {
+            Iterator tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        [[nodiscard]] inline bool operator==(const Iterator& other) const noexcept {
+            return hook_ == other.hook_;
+        }
+
+    private:
+        friend class IntrusiveRbTree;
+        template <bool>
+        friend class Iterator;
+
+        const IntrusiveRbTree* tree_{nullptr};
+        Hook* hook_{nullptr};
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    explicit IntrusiveRbTree(Compare compare = Compare()) noexcept(
+        std::is_nothrow_move_constructible_v<Compare>)
+        : compare_(std::move(compare)) {}
+
+    /// 析构时摘除全部节点（节点对象不受影响）
+    ~IntrusiveRbTree() { clear(); }
+
+    IntrusiveRbTree(const IntrusiveRbTree&) = delete;
+    IntrusiveRbTree& operator=(const IntrusiveRbTree&) = delete;
+
+    IntrusiveRbTree(IntrusiveRbTree&& other) noexcept
+        : compare_(std::move(other.compare_)),
+          root_(std::exchange(other.root_, nullptr)),
+          leftmost_(std::exchange(other.leftmost_, nullptr)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    IntrusiveRbTree& operator=(IntrusiveRbTree&& other) noexcept {
+        if (this != &other) {
+            clear();
+            compare_ = std::move(other.compare_);
+            root_ = std::exchange(other.root_, nullptr);
+            leftmost_ = std::exchange(other.leftmost_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    // -------------------------------------------------------------------------
+    // 插入 / 摘除
+    // -------------------------------------------------------------------------
+
+    /// 插入对象；与已有元素相等时排在其后
+    iterator insert(value_type& object) noexcept {
+        Hook* hook = Traits::hook(object);
+        detail::link_check<kSafeLink>(!hook->linked(), "insert of already linked object");
+
+        Hook* parent = nullptr;
+        Hook** link = &root_;
+        bool leftmost = true;
+        while (*link != nullptr) {
+            parent = *link;
+            if (compare_(object, *Traits::owner(parent))) {
+                link = &parent->left_;
+            } else {
+                link = &parent->right_;
+                leftmost = false;
+            }
+        }
+
+        hook->parent_color_ = reinterpret_cast<uintptr_t>(parent);  // 红色
+        hook->left_ = hook->right_ = nullptr;
+        *link = hook;
+        if (leftmost) {
+            leftmost_ = hook;
+        }
+        insert_fixup(hook);
+        ++size_;
+        return {this, hook};
+    }
+
+    /// 摘除本树中的任意对象
+    void erase(value_type& object) noexcept {
+        Hook* hook = Traits::hook(object);
+        detail::link_check<kSafeLink>(hook->linked(), "erase of unlinked object");
+        if (hook == leftmost_) {
+            leftmost_ = next(hook);
+        }
+        erase_node(hook);
+        hook->parent_color_ = 0;
+        hook->left_ = hook->right_ = nullptr;
+        --size_;
+    }
+
+    /// 摘除 pos，返回其后继
+    iterator erase(const_iterator pos) noexcept {
+        Hook* successor = next(pos.hook_);
+        erase(*Traits::owner(pos.hook_));
+        return {this, successor};
+    }
+
+    /// 摘除最小元素，空树返回 nullptr
+    [[nodiscard]] value_type* pop_front() noexcept {
+        if (leftmost_ == nullptr) {
+            return nullptr;
+        }
+        value_type* object = Traits::owner(leftmost_);
+        erase(*object);
+        return object;
+    }
+
+    /// 摘除全部节点并清零其钩子，O(n)
+    void clear() noexcept {
+        // 后序逐个清零：先下到最左叶子，清零后回到父节点
+        Hook* hook = root_;
+        while (hook != nullptr) {
+            if (hook->left_ != nullptr) {
+                hook = hook->left_;
+            } else if (hook->right_ != nullptr) {
+                hook = hook->right_;
+            } else {
+                Hook* parent = hook->parent();
+                if (parent != nullptr) {
+                    (parent->left_ == hook ? parent->left_ : parent->right_) = nullptr;
+                }
+                hook->parent_color_ = 0;
+                hook = parent;
+            }
+        }
+        root_ = leftmost_ = nullptr;
+        size_ = 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // 查找
+    // -------------------------------------------------------------------------
+
+    /// 最小 / 最大元素，空树返回 nullptr
+    [[nodiscard]] inline value_type* front() const noexcept {
+        return leftmost_ != nullptr ? Traits::owner(leftmost_) : nullptr;
+    }
+    [[nodiscard]] inline value_type* back() const noexcept {
+        Hook* hook = rightmost();
+        return hook != nullptr ? Traits::owner(hook) : nullptr;
+    }
+
+    /// 第一个不小于 key 的元素
+    template <typename Key>
+    [[nodiscard]] iterator lower_bound(const Key& key) const noexcept {
+        Hook* hook = root_;
+        Hook* result = nullptr;
+        while (hook != nullptr) {
+            if (compare_(*Traits::owner(hook), key)) {
+                hook = hook->right_;
+            } else {
+                result = hook;
+                hook = hook->left_;
+            }
+        }
+        return {this, result};
+    }
+
+    /// 第一个与 key 相等的元素，不存在返回 nullptr
+    template <typename Key>
+    [[nodiscard]] value_type* find(const Key& key) const noexcept {
+        iterator it = lower_bound(key);
+        return it.hook_ != nullptr && !compare_(key, *it) ? &*it : nullptr;
+    }
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+
+    /// 对象在本树中的迭代器，O(1)
+    [[nodiscard]] inline iterator iterator_to(value_type& object) noexcept {
+        return {this, Traits::hook(object)};
+    }
+
+    [[nodiscard]] inline iterator begin() noexcept { return {this, leftmost_}; }
+    [[nodiscard]] inline iterator end() noexcept { return {this, nullptr}; }
+    [[nodiscard]] inline const_iterator begin() const noexcept { return {this, leftmost_}; }
+    [[nodiscard]] inline const_iterator end() const noexcept { return {this, nullptr}; }
+
+    /// 校验红黑性质与父指针，返回黑高；不满足返回 -1（测试用）
+    [[nodiscard]] int verify() const noexcept { return verify(root_, nullptr); }
+
+private:
+    [[nodiscard]] static inline bool is_black(const Hook* hook) noexcept {
+        return hook == nullptr || hook->black();
+    }
+
+    [[nodiscard]] static Hook* next(Hook* hook) noexcept {
+        if (hook->right_ != nullptr) {
+            hook = hook->right_;
+            while (hook->left_ != nullptr) {
+                hook = hook->left_;
+            }
+            return hook;
+        }
+        Hook* parent = hook->parent();
+        while (parent != nullptr && hook == parent->right_) {
+            hook = parent;
+            parent = parent->parent();
+        }
+        return parent;
+    }
+
+    [[nodiscard]] static Hook* prev(Hook* hook) noexcept {
+        if (hook->left_ != nullptr) {
+            hook = hook->left_;
+            while (hook->right_ != nullptr) {
+                hook = hook->right_;
+            }
+            return hook;
+        }
+        Hook* parent = hook->parent();
+        while (parent != nullptr && hook == parent->left_) {
+            hook = parent;
+            parent = parent->parent();
+        }
+        return parent;
+    }
+
+    [[nodiscard]] Hook* rightmost() const noexcept {
+        Hook* hook = root_;
+        while (hook != nullptr && hook->right_ != nullptr) {
+            hook = hook->right_;
+        }
+        return hook;
+    }
+
+    /// 用 to 替换 from 在其父节点（或根）中的位置
+    void replace_child(Hook* parent, Hook* from, Hook* to) noexcept {
+        if (parent == nullptr) {
+            root_ = to;
+        } else if (parent->left_ == from) {
+            parent->left_ = to;
+        } else {
+            parent->right_ = to;
+        }
+    }
+
+    void rotate_left(Hook* x) noexcept {
+        Hook* y = x->right_;
+        x->right_ = y->left_;
+        if (y->left_ != nullptr) {
+            y->left_->set_parent(x);
+        }
+        Hook* parent = x->parent();
+        y->set_parent(parent);
+        replace_child(parent, x, y);
+        y->left_ = x;
+        x->set_parent(y);
+    }
+
+    void rotate_right(Hook* x) noexcept {
+        Hook* y = x->left_;
+        x->left_ = y->right_;
+        if (y->right_ != nullptr) {
+            y->right_->set_parent(x);
+        }
+        Hook* parent = x->parent();
+        y->set_parent(parent);
+        replace_child(parent, x, y);
+        y->right_ = x;
+        x->set_parent(y);
+    }
+
+    void insert_fixup(Hook* node) noexcept {
+        Hook* parent;
+        while ((parent = node->parent()) != nullptr && !parent->black()) {
+            Hook* grand = parent->parent();  // 父节点为红，必非根
+            if (parent == grand->left_) {
+                Hook* uncle = grand->right_;
+                if (!is_black(uncle)) {
+                    parent->set_black(true);
+                    uncle->set_black(true);
+                    grand->set_black(false);
+                    node = grand;
+                    continue;
+                }
+                if (node == parent->right_) {
+                    rotate_left(parent);
+                    node = parent;
+                    parent = node->parent();
+                }
+                parent->set_black(true);
+                grand->set_black(false);
+                rotate_right(grand);
+            } else {
+                Hook* uncle = grand->left_;
+                if (!is_black(uncle)) {
+                    parent->set_black(true);
+                    uncle->set_black(true);
+                    grand->set_black(false);
+                    node = grand;
+                    continue;
+                }
+                if (node == parent->left_) {
+                    rotate_right(parent);
+                    node = parent;
+                    parent = node->parent();
+                }
+                parent->set_black(true);
+                grand->set_black(false);
+                rotate_left(grand);
+            }
+        }
+        root_->set_black(true);
+    }
+
+    void erase_node(Hook* z) noexcept {
+        Hook* x;         // 顶替被移走节点的子树（可能为空）
+        Hook* x_parent;  // x 的父节点
+        bool removed_black;
+
+        if (z->left_ == nullptr || z->right_ == nullptr) {
+            x = z->left_ != nullptr ? z->left_ : z->right_;
+            x_parent = z->parent();
+            removed_black = z->black();
+            if (x != nullptr) {
+                x->set_parent(x_parent);
+            }
+            replace_child(x_parent, z, x);
+        } else {
+            // 两个子节点：用后继 y 顶替 z 的位置与颜色
+            Hook* y = z->right_;
+            while (y->left_ != nullptr) {
+                y = y->left_;
+            }
+            removed_black = y->black();
+            x = y->right_;
+            if (y->parent() == z) {
+                x_parent = y;
+            } else {
+                x_parent = y->parent();
+                if (x != nullptr) {
+                    x->set_parent(x_parent);
+                }
+                x_parent->left_ = x;
+                y->right_ = z->right_;
+                y->right_->set_parent(y);
+            }
+            Hook* parent = z->parent();
+            replace_child(parent, z, y);
+            y->parent_color_ = z->parent_color_;
+            y->left_ = z->left_;
+            y->left_->set_parent(y);
+        }
+
+        if (removed_black) {
+            erase_fixup(x, x_parent);
+        }
+    }
+
+    void erase_fixup(Hook* x, Hook* parent) noexcept {
+        while (x != root_ && is_black(x)) {
+            if (x == parent->left_) {
+                Hook* w = parent->right_;
+                if (!w->black()) {
+                    w->set_black(true);
+                    parent->set_black(false);
+                    rotate_left(parent);
+                    w = parent->right_;
+                }
+                if (is_black(w->left_) && is_black(w->right_)) {
+                    w->set_black(false);
+                    x = parent;
+                    parent = x->parent();
+                } else {
+                    if (is_black(w->right_)) {
+                        w->left_->set_black(true);
+                        w->set_black(false);
+                        rotate_right(w);
+                        w = parent->right_;
+                    }
+                    w->set_black(parent->black());
+                    parent->set_black(true);
+                    w->right_->set_black(true);
+                    rotate_left(parent);
+                    x = root_;
+                    break;
+                }
+            } else {
+                Hook* w = parent->left_;
+                if (!w->black()) {
+                    w->set_black(true);
+                    parent->set_black(false);
+                    rotate_right(parent);
+                    w = parent->left_;
+                }
+                if (is_black(w->left_) && is_black(w->right_)) {
+                    w->set_black(false);
+                    x = parent;
+                    parent = x->parent();
+                } else {
+                    if (is_black(w->left_)) {
+                        w->right_->set_black(true);
+                        w->set_black(false);
+                        rotate_left(w);
+                        w = parent->left_;
+                    }
+                    w->set_black(parent->black());
+                    parent->set_black(true);
+                    w->left_->set_black(true);
+                    rotate_right(parent);
+                    x = root_;
+                    break;
+                }
+            }
+        }
+        if (x != nullptr) {
+            x->set_black(true);
+        }
+    }
+
+    int verify(const Hook* hook, const Hook* parent) const noexcept {
+        if (hook == nullptr) {
+            return 1;
+        }
+        if (hook->parent() != parent || (parent == nullptr && !hook->black())) {
+            return -1;
+        }
+        if (!hook->black() && (!is_black(hook->left_) || !is_black(hook->right_))) {
+            return -1;
+        }
+        if ((hook->left_ != nullptr && compare_(*Traits::owner(hook), *Traits::owner(hook->left_))) ||
+            (hook->right_ != nullptr && compare_(*Traits::owner(hook->right_), *Traits::owner(hook)))) {
+            return -1;
+        }
+        const int left = verify(hook->left_, hook);
+        const int right = verify(hook->right_, hook);
+        if (left < 0 || left != right) {
+            return -1;
+        }
+        return left + (hook->black() ? 1 : 0);
+    }
+
+    [[no_unique_address]] Compare compare_;
+    Hook* root_{nullptr};
+    Hook* leftmost_{nullptr};
+    std::size_t size_{0};
+};
+
+}  // namespace container
@@ -0,0 +1,273 @@
+/**
+ * @file perfect_hash_map.h
+ * @brief 编译期生成的完美哈希表：固定字符串键集合（消息类型、字段名）到值的映射
+ * @version 1.0.0
+ *
+ * PTHash 风格构造（全部在 consteval 中完成）：
+ * - 键的 64 位哈希 h 高位选桶，桶内键共用一个 16 位 pilot。若各键的长度与首尾各 8 字节已互不相同，
+ *   用 hash_sampled（代价与键长无关，gperf 式只取部分字节），否则用 hash_bytes（读取全部字节）
+ * - 槽位 = mum(h ^ pilot * K, K) & (kSlots - 1)；按桶大小降序逐桶搜索使桶内键全部落入空槽的 pilot
+ * - 某个种子下哈希重复或有桶找不到 pilot 则换种子重试；全部种子失败、键重复或键超长时编译失败
+ *
+ * 运行期查找：一次哈希、一次 pilot 读取、一次槽位读取、一次比较（长度 + 字节），无分支链。
+ * 槽位数为不小于 1.25 × 键数的 2 的幂，键内联存放在槽位中，命中与未命中都只触及一个槽位。
+ *
+ * 用法：
+ *   constexpr auto kRoutes = make_perfect_hash_map(std::pair{"Logon"_cs, Route::Session},
+ *                                                  std::pair{"NewOrderSingle"_cs, Route::Order});
+ *   if (const Route* r = kRoutes.find(msg_type)) { ... }
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "hash.h"
+
+namespace container {
+
+template <typename V, std::size_t N, std::size_t L>
+class PerfectHashMap {
+    static_assert(N > 0, "PerfectHashMap needs at least one key");
+    static_assert(L < UINT32_MAX, "PerfectHashMap key capacity too large");
+
+public:
+    using mapped_type = V;
+
+    /// 键数
+    static constexpr std::size_t kSize = N;
+    /// 槽位数：负载不超过 0.8
+    static constexpr std::size_t kSlots = std::bit_ceil(N + N / 4);
+    /// 桶数：平均每桶约 2 个键
+    static constexpr std::size_t kBuckets = std::bit_ceil(std::max<std::size_t>(1, N / 2));
+    /// 每个种子下单桶尝试的 pilot 上限 / 种子上限
+    static constexpr uint32_t kMaxPilot = UINT16_MAX;
+    static constexpr uint64_t kMaxSeeds = 64;
+
+    struct Slot {
+        std::array<char, L> key_{};
+        uint32_t length_{kEmptySlot};
+        V value_{};
+    };
+
+    /// 由 (键, 值) 构造；只能在编译期求值
+    consteval explicit PerfectHashMap(const std::array<std::pair<std::string_view, V>, N>& entries) {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (entries[i].first.size() > L) {
+                throw std::length_error("PerfectHashMap: key longer than key capacity");
+            }
+            for (std::size_t j = i + 1; j < N; ++j) {
+                if (entries[i].first == entries[j].first) {
+                    throw std::invalid_argument("PerfectHashMap: duplicate key");
+                }
+            }
+        }
+
+        sampled_ = true;
+        for (std::size_t i = 0; i < N && sampled_; ++i) {
+            for (std::size_t j = i + 1; j < N && sampled_; ++j) {
+                sampled_ = !same_samples(entries[i].first, entries[j].first);
+            }
+        }
+
+        for (uint64_t attempt = 0; attempt < kMaxSeeds; ++attempt) {
+            if (try_build(entries, mix(attempt + 1))) {
+                return;
+            }
+        }
+        throw std::logic_error("PerfectHashMap: no seed yields a collision-free table");
+    }
+
+    // -------------------------------------------------------------------------
+    // 查找
+    // -------------------------------------------------------------------------
+
+    /// 返回值指针，键不存在返回 nullptr
+    [[nodiscard, gnu::hot]]
+    constexpr const V* find(std::string_view key) const noexcept {
+        const Slot& slot = slots_[slot_of(hash_of(key))];
+        if (slot.length_ != key.size() || !equal_bytes(slot.key_.data(), key.data(), key.size())) {
+            return nullptr;
+        }
+        return &slot.value_;
+    }
+
+    [[nodiscard]] constexpr bool contains(std::string_view key) const noexcept {
+        return find(key) != nullptr;
+    }
+
+    [[nodiscard]] constexpr V value_or(std::string_view key, V fallback) const noexcept {
+        const V* value = find(key);
+        return value != nullptr ? *value : fallback;
+    }
+
+    // -------------------------------------------------------------------------
+    // 查询
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return N; }
+    [[nodiscard]] static constexpr std::size_t capacity() noexcept { return kSlots; }
+
+    /// 构造时选中的种子
+    [[nodiscard]] constexpr uint64_t seed() const noexcept { return seed_; }
+
+    /// 是否只对长度与首尾字节取哈希
+    [[nodiscard]] constexpr bool sampled() const noexcept { return sampled_; }
+
+    /// 全部槽位（length_ == kEmptySlot 表示空槽），用于遍历键集合
+    [[nodiscard]] constexpr const std::array<Slot, kSlots>& slots() const noexcept { return slots_; }
+
+    static constexpr uint32_t kEmptySlot = UINT32_MAX;
+
+private:
+    static constexpr uint64_t kPilotMul = 0x9E3779B97F4A7C15ULL;
+
+    [[nodiscard, gnu::always_inline]] static constexpr std::size_t bucket_of(uint64_t h) noexcept {
+        return static_cast<std::size_t>(h >> 32) & (kBuckets - 1);
+    }
+
+    /// pilot 经乘法扩散后与哈希异或再混合，桶内两个键是否冲突随 pilot 变化
+    [[nodiscard, gnu::always_inline]]
+    static constexpr std::size_t position(uint64_t h, uint64_t pilot) noexcept {
+        return static_cast<std::size_t>(detail::mum(h ^ (pilot * kPilotMul), kPilotMul)) & (kSlots - 1);
+    }
+
+    /// 等长字节比较：8 字节一块异或累积，末块与前一块重叠，不调用 memcmp
+    [[nodiscard, gnu::always_inline]]
+    static constexpr bool equal_bytes(const char* a, const char* b, std::size_t n) noexcept {
+        if (std::is_constant_evaluated()) {
+            return std::char_traits<char>::compare(a, b, n) == 0;
+        }
+        if (n >= 8) {
+            uint64_t diff = 0;
+            for (std::size_t i = 0; i + 8 < n; i += 8) {
+                diff |= detail::load_le<8>(a + i) ^ detail::load_le<8>(b + i);
+            }
+            return (diff | (detail::load_le<8>(a + n - 8) ^ detail::load_le<8>(b + n - 8))) == 0;
+        }
+        uint64_t x = 0;
+        uint64_t y = 0;
+        detail::load_short(a, n, x, y);
+        uint64_t u = 0;
+        uint64_t v = 0;
+        detail::load_short(b, n, u, v);
+        return ((x ^ u) | (y ^ v)) == 0;
+    }
+
+    /// 首尾各 8 字节与长度都相同的两个键在 hash_sampled 下必然冲突
+    [[nodiscard]] static consteval bool same_samples(std::string_view a, std::string_view b) {
+        const std::size_t n = std::min<std::size_t>(a.size(), 8);
+        return a.size() == b.size() && a.substr(0, n) == b.substr(0, n) &&
+               a.substr(a.size() - n) == b.substr(b.size() - n);
+    }
+
+    [[nodiscard, gnu::always_inline]] constexpr uint64_t hash_of(std::string_view key) const noexcept {
+        return sampled_ ? hash_sampled(key, seed_) : hash_bytes(key, seed_);
+    }
+
+    [[nodiscard, gnu::always_inline]] constexpr std::size_t slot_of(uint64_t h) const noexcept {
+        return position(h, pilots_[bucket_of(h)]);
+    }
+
+    consteval bool try_build(const std::array<std::pair<std::string_view, V>, N>& entries, uint64_t seed) {
+        seed_ = seed;
+        std::array<uint64_t, N> hashes{};
+        std::array<std::size_t, N> order{};
+        std::array<std::size_t, kBuckets> counts{};
+        for (std::size_t i = 0; i < N; ++i) {
+            hashes[i] = hash_of(entries[i].first);
+            ++counts[bucket_of(hashes[i])];
+            order[i] = i;
+        }
+        // 哈希相同的键对任何 pilot 都冲突
+        std::array<uint64_t, N> sorted = hashes;
+        std::sort(sorted.begin(), sorted.end());
+        if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+            return false;
+        }
+
+        // 大桶先放：空槽多时更容易为多个键同时找到位置
+        std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+            const std::size_t ba = bucket_of(hashes[a]);
+            const std::size_t bb = bucket_of(hashes[b]);
+            return counts[ba] != counts[bb] ? counts[ba] > counts[bb] : ba < bb;
+        });
+
+        std::array<bool, kSlots> taken{};
+        std::array<std::size_t, N> placed{};
+        pilots_ = {};
+        for (std::size_t begin = 0; begin < N;) {
+            const std::size_t bucket = bucket_of(hashes[order[begin]]);
+            const std::size_t end = begin + counts[bucket];
+
+            bool found = false;
+            for (uint32_t pilot = 0; pilot <= kMaxPilot && !found; ++pilot) {
+                found = true;
+                for (std::size_t k = begin; k < end && found; ++k) {
+                    placed[k] = position(hashes[order[k]], pilot);
+                    const std::size_t* seen = std::find(&placed[begin], &placed[k], placed[k]);
+                    found = !taken[placed[k]] && seen == &placed[k];
+                }
+                if (found) {
+                    pilots_[bucket] = static_cast<uint16_t>(pilot);
+                }
+            }
+            if (!found) {
+                return false;
+            }
+            for (std::size_t k = begin; k < end; ++k) {
+                taken[placed[k]] = true;
+            }
+            begin = end;
+        }
+
+        slots_ = {};
+        for (std::size_t k = 0; k < N; ++k) {
+            const auto& [key, value] = entries[order[k]];
+            Slot& slot = slots_[placed[k]];
+            std::copy(key.begin(), key.end(), slot.key_.begin());
+            slot.length_ = static_cast<uint32_t>(key.size());
+            slot.value_ = value;
+        }
+        return true;
+    }
+
+    uint64_t seed_{0};
+    bool sampled_{false};
+    std::array<uint16_t, kBuckets> pilots_{};
+    std::array<Slot, kSlots> slots_{};
+};
+
+// =============================================================================
+// 构造
+// =============================================================================
+
+/// 由 CompileTimeString 键数组构造
+template <typename V, std::size_t L, std::size_t N>
+consteval PerfectHashMap<V, N, L> make_perfect_hash_map(
+    const std::array<std::pair<utils::CompileTimeString<L>, V>, N>& entries) {
+    std::array<std::pair<std::string_view, V>, N> views{};
+    for (std::size_t i = 0; i < N; ++i) {
+        views[i] = {std::string_view(entries[i].first), entries[i].second};
+    }
+    return PerfectHashMap<V, N, L>(views);
+}
+
+/// 由长度各异的 (CompileTimeString, 值) 对构造，键容量取最长者
+template <typename V, std::size_t... Ls>
+consteval auto make_perfect_hash_map(const std::pair<utils::CompileTimeString<Ls>, V>&... entries) {
+    constexpr std::size_t kCapacity = std::max({Ls...});
+    return PerfectHashMap<V, sizeof...(Ls), kCapacity>(
+        std::array<std::pair<std::string_view, V>, sizeof...(Ls)>{
+            std::pair<std::string_view, V>{std::string_view(entries.first), entries.second}...});
+}
+
+}  // namespace container
@@ -0,0 +1,134 @@
+/**
+ * @file radix_heap.h
+ * @brief 单调基数堆：64 位整数优先级，弹出序列单调不减（定时器截止时间、事件时间戳）
+ * @version 1.0.0
+ *
+ * 定时器的截止时间（TscClock 周期数 / 纳秒）只会晚于已到期的时间，满足单调性，
+ * 可用基数堆替代比较堆：
+ * - 65 个桶：桶 0 存放等于 last() 的键，桶 i 存放与 last() 最高不同位为 i-1 的键
+ * - push 为 O(1)：一次异或 + lzcnt 定桶，追加到桶尾
+ * - 桶 0 为空时，用非空桶位图 tzcnt 找到最低非空桶，取其最小键为新的 last()，
+ *   把桶内元素重新分配到更低的桶；每个元素最多下移 64 次，摊还 O(log C)
+ *
+ * 小于 last() 的键视为等于 last()（已过期的定时器立即到期），保持单调性不被破坏。
+ * 相等键之间不保证先后顺序。
+ *
+ * 用法：
+ *   RadixHeap<TimerId> timers;
+ *   timers.push(clock.now() + timeout_ns, id);
+ *   while (!timers.empty() && timers.top().key_ <= clock.now()) { fire(timers.pop().value_); }
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace container {
+
+/// 无附带值
+struct RadixHeapNoValue {};
+
+template <typename Value = RadixHeapNoValue>
+class RadixHeap {
+public:
+    struct Entry {
+        uint64_t key_;
+        [[no_unique_address]] Value value_;
+    };
+
+    using value_type = Entry;
+    using size_type = std::size_t;
+
+    /// 桶数：桶 0 加上 64 个按最高不同位划分的桶
+    static constexpr std::size_t kBuckets = 65;
+
+    RadixHeap() = default;
+
+    // -------------------------------------------------------------------------
+    // 修改
+    // -------------------------------------------------------------------------
+
+    /// 插入；key 小于 last() 时按 last() 处理
+    [[gnu::hot]] void push(uint64_t key, Value value = Value()) {
+        key = key < last_ ? last_ : key;
+        const std::size_t bucket = bucket_of(key);
+        buckets_[bucket].push_back(Entry{key, std::move(value)});
+        occupied_ |= uint64_t{bucket != 0} << (bucket - (bucket != 0));
+        ++size_;
+    }
+
+    /// 弹出最小键（非空）
+    [[gnu::hot]] Entry pop() {
+        refill();
+        Entry entry = std::move(buckets_[0].back());
+        buckets_[0].pop_back();
+        --size_;
+        return entry;
+    }
+
+    /// 清空；last() 归零，桶容量保留
+    void clear() noexcept {
+        for (auto& bucket : buckets_) {
+            bucket.clear();
+        }
+        occupied_ = 0;
+        size_ = 0;
+        last_ = 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // 查询
+    // -------------------------------------------------------------------------
+
+    /// 最小键元素（非空）；可能触发一次桶重分配，故非 const
+    [[nodiscard]] const Entry& top() {
+        refill();
+        return buckets_[0].back();
+    }
+
+    /// 最近一次确定的最小键：之后弹出的键都不小于它
+    [[nodiscard]] inline uint64_t last() const noexcept { return last_; }
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+
+private:
+    [[nodiscard, gnu::always_inline]] inline std::size_t bucket_of(uint64_t key) const noexcept {
+        return key == last_ ? 0 : 64 - static_cast<std::size_t>(std::countl_zero(key ^ last_));
+    }
+
+    /// 桶 0 为空时，以最低非空桶的最小键为新 last()，并把该桶分配到更低的桶
+    [[gnu::always_inline]] inline void refill() {
+        if (!buckets_[0].empty()) [[likely]] {
+            return;
+        }
+        const std::size_t index = static_cast<std::size_t>(std::countr_zero(occupied_)) + 1;
+        auto& bucket = buckets_[index];
+        uint64_t min = std::numeric_limits<uint64_t>::max();
+        for (const Entry& entry : bucket) {
+            min = entry.key_ < min ? entry.key_ : min;
+        }
+        last_ = min;
+        for (Entry& entry : bucket) {
+            // 与新 last() 的最高不同位必低于 index - 1
+            const std::size_t to = bucket_of(entry.key_);
+            buckets_[to].push_back(std::move(entry));
+            occupied_ |= uint64_t{to != 0} << (to - (to != 0));
+        }
+        bucket.clear();
+        occupied_ &= ~(uint64_t{1} << (index - 1));
+    }
+
+    std::array<std::vector<Entry>, kBuckets> buckets_;
+    uint64_t occupied_{0};  // 第 i 位：桶 i+1 非空
+    uint64_t last_{0};
+    std::size_t size_{0};
+};
+
+}  // namespace container
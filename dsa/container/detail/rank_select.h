@@ -0,0 +1,144 @@
+/**
+ * @file rank_select.h
+ * @brief 位图的只读秩/选择索引：rank O(1)（一次索引访问 + 一次 popcount），select 采样 + 二分
+ * @version 1.0.0
+ *
+ * 把稀疏编号（合约 id、订阅位）映射为稠密下标：rank1(id) 即 id 在集合中的序号，select1(k) 为其逆。
+ * 布局为 rank9（Vigna）：
+ * - 每 512 位（8 个字，一条缓存行）一个块，16 字节：块前的累计置位数，
+ *   以及块内第 1~7 个字之前的相对置位数（各 9 位，共 63 位）
+ * - rank1(pos)：块累计 + 块内相对计数 + 当前字掩码后的 popcount，只访问一个块与一个字
+ * - select1(k)：每 512 个置位记录一次所在块作为采样，先在相邻采样之间二分找到块，
+ *   再用块内相对计数定位字，字内用 pdep + tzcnt（BMI2）取第 k 个置位
+ *
+ * 索引只引用位数据（不复制）：位图修改或重新分配后须重建。超出 size() 的位须为 0（FixedBitset /
+ * DynamicBitset 保证）。
+ *
+ * 用法：
+ *   RankSelect index(active);
+ *   std::size_t slot = index.rank1(instrument_id);    // active 中小于 instrument_id 的个数
+ *   std::size_t id = index.select1(slot);             // 第 slot 个活跃合约
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "bitset.h"
+
+namespace container {
+
+class RankSelect {
+public:
+    /// 每块字数（512 位，一条缓存行）
+    static constexpr std::size_t kBlockWords = 8;
+    static constexpr std::size_t kBlockBits = kBlockWords * detail::kWordBits;
+    /// select 采样间隔（置位数）
+    static constexpr std::size_t kSelectSample = 512;
+
+    RankSelect() = default;
+
+    RankSelect(std::span<const uint64_t> words, std::size_t bits) : words_(words.data()), size_(bits) {
+        const std::size_t word_count = detail::words_for(bits);
+        const std::size_t block_count = (word_count + kBlockWords - 1) / kBlockWords;
+        blocks_.clear();
+        blocks_.reserve(block_count + 1);
+
+        std::size_t ones = 0;
+        for (std::size_t b = 0; b < block_count; ++b) {
+            Block block{ones, 0};
+            uint64_t in_block = 0;
+            for (std::size_t j = 0; j < kBlockWords; ++j) {
+                if (j > 0) {
+                    block.relative_ |= in_block << (9 * (j - 1));
+                }
+                const std::size_t w = b * kBlockWords + j;
+                if (w < word_count) {
+                    const auto n = static_cast<std::size_t>(std::popcount(words_[w]));
+                    for (std::size_t k = kSelectSample - 1 - (ones + in_block) % kSelectSample; k < n;
+                         k += kSelectSample) {
+                        samples_.push_back(static_cast<uint32_t>(b));
+                    }
+                    in_block += n;
+                }
+            }
+            ones += in_block;
+            blocks_.push_back(block);
+        }
+        blocks_.push_back(Block{ones, 0});
+        ones_ = ones;
+    }
+
+    /// 从 FixedBitset / DynamicBitset 建立索引
+    template <typename Bitset>
+    explicit RankSelect(const Bitset& bitset) : RankSelect(bitset.words(), bitset.size()) {}
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline std::size_t ones() const noexcept { return ones_; }
+
+    /// [0, pos) 内的置位数；pos <= size()
+    [[nodiscard, gnu::hot]] inline std::size_t rank1(std::size_t pos) const noexcept {
+        const std::size_t word = pos / detail::kWordBits;
+        const Block& block = blocks_[pos / kBlockBits];
+        std::size_t rank = block.rank_ + block.relative(word % kBlockWords);
+        if (pos % detail::kWordBits != 0) {
+            rank += static_cast<std::size_t>(
+                std::popcount(words_[word] & ((uint64_t{1} << (pos % detail::kWordBits)) - 1)));
+        }
+        return rank;
+    }
+
+    /// [0, pos) 内的 0 位数
+    [[nodiscard]] inline std::size_t rank0(std::size_t pos) const noexcept { return pos - rank1(pos); }
+
+    /// 第 k 个（从 0 起）置位的下标；k >= ones() 时返回 size()
+    [[nodiscard, gnu::hot]] std::size_t select1(std::size_t k) const noexcept {
+        if (k >= ones_) [[unlikely]] {
+            return size_;
+        }
+        // 第 k 个置位所在块位于 [第 k/S 个采样所在块, 下一个采样所在块] 之间
+        const std::size_t s = k / kSelectSample;
+        std::size_t lo = s == 0 ? 0 : samples_[s - 1];
+        std::size_t hi = s < samples_.size() ? samples_[s] : blocks_.size() - 2;
+        while (lo < hi) {  // 最后一个 rank_ <= k 的块
+            const std::size_t mid = (lo + hi + 1) / 2;
+            if (blocks_[mid].rank_ <= k) {
+                lo = mid;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        const Block& block = blocks_[lo];
+        const std::size_t remaining = k - block.rank_;
+        std::size_t j = 0;
+        while (j + 1 < kBlockWords && block.relative(j + 1) <= remaining) {
+            ++j;
+        }
+        const std::size_t word = lo * kBlockWords + j;
+        return word * detail::kWordBits +
+               detail::select_in_word(words_[word], static_cast<unsigned>(remaining - block.relative(j)));
+    }
+
+private:
+    struct Block {
+        uint64_t rank_;      // 块之前的置位数
+        uint64_t relative_;  // 第 j 个字（1~7）之前、块内的置位数，9 位一组
+
+        /// 块内第 j 个字之前的置位数
+        [[nodiscard, gnu::always_inline]] inline std::size_t relative(std::size_t j) const noexcept {
+            return j == 0 ? 0 : static_cast<std::size_t>((relative_ >> (9 * (j - 1))) & 0x1ff);
+        }
+    };
+
+    const uint64_t* words_{nullptr};
+    std::size_t size_{0};
+    std::size_t ones_{0};
+    std::vector<Block> blocks_{Block{0, 0}};
+    std::vector<uint32_t> samples_;  // 第 (i + 1) * kSelectSample - 1 个置位所在的块
+};
+
+}  // namespace container
@@ -0,0 +1,122 @@
+/**
+ * @file relocate.h
+ * @brief 平凡重定位（trivially relocatable）判定与连续存储的搬移工具
+ * @version 1.0.0
+ *
+ * 重定位 = 在新地址移动构造 + 销毁旧对象。平凡可复制类型以及"按字节搬走即可"的类型
+ * （如 std::unique_ptr：移动构造只是拷贝指针、再把源置空，而源随即被销毁）可以整块按字节复制完成，
+ * 扩容与中间插入/删除不必逐个调用移动构造与析构。
+ *
+ * is_trivially_relocatable 默认等于 can_memcpy（平凡可复制），自定义类型可特化为 true：
+ *   template <> struct container::is_trivially_relocatable<Order> : std::true_type {};
+ * 不能特化的典型反例：libstdc++ 的 std::string（短字符串时指向自身内部缓冲区）、
+ * 含自引用指针或在别处登记了自身地址的类型。
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../../common/fast_copy.h"
+
+namespace container {
+
+using namespace common;
+
+template <typename T>
+struct is_trivially_relocatable : std::bool_constant<can_memcpy_v<T>> {};
+
+template <typename T>
+struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+namespace detail {
+
+/// 按字节复制 count 个对象（不重叠）
+template <typename T>
+[[gnu::always_inline]]
+inline void copy_bytes(T* dst, const T* src, std::size_t count) noexcept {
+    fast_copy(reinterpret_cast<unsigned char*>(dst), reinterpret_cast<const unsigned char*>(src),
+              count * sizeof(T));
+}
+
+/// 把 [src, src + count) 重定位到未初始化的 dst（不重叠），之后 src 处不再有对象。
+/// 移动构造可能抛异常且可复制时改为复制，失败时 src 保持原样
+template <typename T>
+inline void relocate(T* dst, T* src, std::size_t count) {
+    if constexpr (is_trivially_relocatable_v<T>) {
+        copy_bytes(dst, src, count);
+    } else if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+        for (std::size_t i = 0; i < count; ++i) {
+            ::new (static_cast<void*>(dst + i)) T(std::move(src[i]));
+            src[i].~T();
+        }
+    } else {
+        std::uninitialized_copy_n(src, count, dst);
+        std::destroy_n(src, count);
+    }
+}
+
+/// 复制构造到未初始化的 dst
+template <typename T>
+inline void copy_construct(T* dst, const T* src, std::size_t count) {
+    if constexpr (can_memcpy_v<T>) {
+        fast_copy(dst, src, count);
+    } else {
+        std::uninitialized_copy_n(src, count, dst);
+    }
+}
+
+/// 在 pos 处插入 value：[pos, end) 后移一位，end 处须有未初始化空间。
+/// value 不得引用 [pos, end) 内的元素（调用方先构造临时对象）
+template <typename T>
+void insert_shift(T* pos, T* end, T&& value) {
+    if (pos == end) {
+        ::new (static_cast<void*>(end)) T(std::move(value));
+        return;
+    }
+    if constexpr (is_trivially_relocatable_v<T>) {
+        std::memmove(static_cast<void*>(pos + 1), static_cast<const void*>(pos),
+                     static_cast<std::size_t>(end - pos) * sizeof(T));
+        try {
+            ::new (static_cast<void*>(pos)) T(std::move(value));
+        } catch (...) {
+            std::memmove(static_cast<void*>(pos), static_cast<const void*>(pos + 1),
+                         static_cast<std::size_t>(end - pos) * sizeof(T));
+            throw;
+        }
+    } else {
+        ::new (static_cast<void*>(end)) T(std::move(end[-1]));
+        std::move_backward(pos, end - 1, end);
+        *pos = std::move(value);
+    }
+}
+
+/// 删除 [first, last) 并把 [last, end) 前移，返回新的尾指针
+template <typename T>
+T* erase_shift(T* first, T* last, T* end) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if (first == last) {
+        return end;
+    }
+    if constexpr (is_trivially_relocatable_v<T>) {
+        std::destroy(first, last);
+        std::memmove(static_cast<void*>(first), static_cast<const void*>(last),
+                     static_cast<std::size_t>(end - last) * sizeof(T));
+        return end - (last - first);
+    } else {
+        T* new_end = std::move(last, end, first);
+        std::destroy(new_end, end);
+        return new_end;
+    }
+}
+
+}  // namespace detail
+
+}  // namespace container
@@ -0,0 +1,86 @@
+/**
+ * @file simd_search.h
+ * @brief 有序键数组的无分支计数搜索：count_less（AVX2 整数比较 + popcount，其余标量）
+ * @version 1.0.0
+ *
+ * "小于 key 的元素个数"即升序数组上的 lower_bound 下标；FlatMap 与 BPlusTree 的节点内搜索共用。
+ * 长度固定的 count_less<K, Count> 可配合"空位填最大键"使用，整段比较无需知道有效元素数。
+ */
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace container::detail {
+
+/// 可走 AVX2 比较计数的键类型
+template <typename K>
+concept SimdSearchKey = std::integral<K> && !std::same_as<K, bool> && (sizeof(K) == 4 || sizeof(K) == 8);
+
+/// [first, first + n) 中小于 key 的元素个数（无分支，编译器可向量化）
+template <typename K>
+[[nodiscard, gnu::always_inline]] inline std::size_t count_less_scalar(const K* first, std::size_t n,
+                                                                      const K& key) noexcept {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        count += static_cast<std::size_t>(first[i] < key);
+    }
+    return count;
+}
+
+#ifdef __AVX2__
+/// [first, first + Count) 中小于 key 的元素个数；Count 为每向量元素数的整数倍
+template <SimdSearchKey K, std::size_t Count>
+[[nodiscard, gnu::always_inline]] inline std::size_t count_less_simd(const K* first, K key) noexcept {
+    constexpr std::size_t kLanes = 32 / sizeof(K);
+    static_assert(Count % kLanes == 0);
+
+    // AVX2 只有有符号比较：无符号键两侧同时翻转符号位
+    constexpr bool kFlip = std::is_unsigned_v<K>;
+    std::size_t count = 0;
+    if constexpr (sizeof(K) == 8) {
+        const __m256i bias = _mm256_set1_epi64x(kFlip ? INT64_MIN : 0);
+        const __m256i k = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<int64_t>(key)), bias);
+        for (std::size_t i = 0; i < Count; i += kLanes) {
+            const __m256i v =
+                _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i)), bias);
+            const int mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(k, v)));
+            count += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(mask)));
+        }
+    } else {
+        const __m256i bias = _mm256_set1_epi32(kFlip ? INT32_MIN : 0);
+        const __m256i k = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int32_t>(key)), bias);
+        for (std::size_t i = 0; i < Count; i += kLanes) {
+            const __m256i v =
+                _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i)), bias);
+            const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(k, v)));
+            count += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(mask)));
+        }
+    }
+    return count;
+}
+#endif
+
+/// [first, first + Count) 中小于 key 的元素个数：整向量部分走 SIMD，余数与非整数键走标量
+template <typename K, std::size_t Count>
+[[nodiscard, gnu::always_inline]] inline std::size_t count_less(const K* first, const K& key) noexcept {
+#ifdef __AVX2__
+    if constexpr (SimdSearchKey<K>) {
+        constexpr std::size_t kVector = Count / (32 / sizeof(K)) * (32 / sizeof(K));
+        std::size_t count = 0;
+        if constexpr (kVector > 0) {
+            count = count_less_simd<K, kVector>(first, key);
+        }
+        return count + count_less_scalar(first + kVector, Count - kVector, key);
+    }
+#endif
+    return count_less_scalar(first, Count, key);
+}
+
+}  // namespace container::detail
@@ -0,0 +1,385 @@
+/**
+ * @file small_vector.h
+ * @brief 小对象优化向量：前 N 个元素存于对象内部，超出后转到堆上
+ * @version 1.0.0
+ *
+ * 每消息的小集合大多不超过十几个元素，std::vector 即使只放一个元素也要一次堆分配：
+ * - 布局：数据指针 + uint32 大小/容量 + N 个内联槽位；数据指针指向内联槽位或堆缓冲区
+ * - 扩容按 2 倍增长；平凡重定位类型（is_trivially_relocatable，含平凡可复制类型）
+ *   经 common::fast_copy 整块搬移，否则逐个移动构造（移动可能抛异常时复制）再析构
+ * - 移动构造/赋值：源在堆上时直接接管缓冲区；源在内联槽位时重定位其元素，源变为空
+ * - 缩小（clear / pop_back / erase）不释放堆缓冲区，shrink_to_fit() 在元素数不超过 N 时回到内联槽位
+ *
+ * 元素数上限 2^32 - 1；分配失败抛 std::bad_alloc（std::allocator 约定）。
+ * 扩容、插入以及移动一个内联存储的 SmallVector 都会使迭代器失效。
+ *
+ * 用法：
+ *   SmallVector<Leg, 8> legs;
+ *   legs.push_back(leg);  // 前 8 个不分配
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "relocate.h"
+
+namespace container {
+
+template <typename T, std::size_t N>
+class SmallVector {
+    static_assert(N > 0, "SmallVector inline capacity must be positive; use std::vector otherwise");
+    static_assert(N <= std::numeric_limits<uint32_t>::max());
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr std::size_t kInlineCapacity = N;
+
+    SmallVector() noexcept : data_(inline_data()) {}
+
+    explicit SmallVector(std::size_t count) : SmallVector() { resize(count); }
+
+    SmallVector(std::size_t count, const T& value) : SmallVector() { resize(count, value); }
+
+    template <std::input_iterator It>
+    SmallVector(It first, It last) : SmallVector() {
+        if constexpr (std::forward_iterator<It>) {
+            reserve(static_cast<std::size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    SmallVector(std::initializer_list<T> init) : SmallVector(init.begin(), init.end()) {}
+
+    SmallVector(const SmallVector& other) : SmallVector() { copy_from(other); }
+
+    SmallVector(SmallVector&& other) noexcept(kNothrowRelocate) : SmallVector() { move_from(other); }
+
+    ~SmallVector() {
+        std::destroy_n(data_, size_);
+        release();
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(kNothrowRelocate) {
+        if (this != &other) {
+            clear();
+            if (!other.is_inline()) {
+                release();
+                data_ = inline_data();
+                capacity_ = N;
+            }
+            move_from(other);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> init) {
+        clear();
+        reserve(init.size());
+        for (const T& value : init) {
+            unchecked_emplace_back(value);
+        }
+        return *this;
+    }
+
+    // -------------------------------------------------------------------------
+    // 访问
+    // -------------------------------------------------------------------------
+
+    [[nodiscard, gnu::always_inline]] inline T* data() noexcept { return data_; }
+    [[nodiscard, gnu::always_inline]] inline const T* data() const noexcept { return data_; }
+
+    [[nodiscard]] inline T& operator[](std::size_t i) noexcept { return data_[i]; }
+    [[nodiscard]] inline const T& operator[](std::size_t i) const noexcept { return data_[i]; }
+    [[nodiscard]] inline T& front() noexcept { return data_[0]; }
+    [[nodiscard]] inline const T& front() const noexcept { return data_[0]; }
+    [[nodiscard]] inline T& back() noexcept { return data_[size_ - 1]; }
+    [[nodiscard]] inline const T& back() const noexcept { return data_[size_ - 1]; }
+
+    [[nodiscard]] inline iterator begin() noexcept { return data_; }
+    [[nodiscard]] inline iterator end() noexcept { return data_ + size_; }
+    [[nodiscard]] inline const_iterator begin() const noexcept { return data_; }
+    [[nodiscard]] inline const_iterator end() const noexcept { return data_ + size_; }
+    [[nodiscard]] inline const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] inline const_iterator cend() const noexcept { return end(); }
+    [[nodiscard]] inline reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    [[nodiscard]] inline reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    [[nodiscard]] inline const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    [[nodiscard]] inline const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    // -------------------------------------------------------------------------
+    // 容量
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] inline std::size_t capacity() const noexcept { return capacity_; }
+    [[nodiscard]] static constexpr std::size_t max_size() noexcept {
+        return std::numeric_limits<uint32_t>::max();
+    }
+
+    /// 元素是否仍在内联槽位中（未分配堆内存）
+    [[nodiscard]] inline bool is_inline() const noexcept { return data_ == inline_data(); }
+
+    inline void reserve(std::size_t count) {
+        if (count > capacity_) {
+            grow_to(count);
+        }
+    }
+
+    /// 元素数不超过 N 时搬回内联槽位并释放堆缓冲区；否则缩到恰好容纳
+    void shrink_to_fit() {
+        if (is_inline() || size_ == capacity_) {
+            return;
+        }
+        if (size_ <= N) {
+            detail::relocate(inline_data(), data_, size_);
+            release();
+            data_ = inline_data();
+            capacity_ = N;
+        } else {
+            reallocate(size_);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // 尾部插入 / 删除
+    // -------------------------------------------------------------------------
+
+    template <typename... Args>
+    [[gnu::hot]]
+    inline T& emplace_back(Args&&... args) {
+        if (size_ == capacity_) [[unlikely]] {
+            if constexpr (kSmallTrivial) {
+                // 先在寄存器中构造：扩容函数不取其地址，快路径不必把参数落到栈上再读回
+                const T value(std::forward<Args>(args)...);
+                grow_by_one();
+                return unchecked_emplace_back(value);
+            } else {
+                return grow_and_emplace_back(std::forward<Args>(args)...);
+            }
+        }
+        return unchecked_emplace_back(std::forward<Args>(args)...);
+    }
+
+    inline T& push_back(const T& value) { return emplace_back(value); }
+    inline T& push_back(T&& value) { return emplace_back(std::move(value)); }
+
+    inline void pop_back() noexcept {
+        --size_;
+        std::destroy_at(data_ + size_);
+    }
+
+    inline void clear() noexcept {
+        std::destroy_n(data_, size_);
+        size_ = 0;
+    }
+
+    void resize(std::size_t count) { resize_with(count, [](T* p) { ::new (static_cast<void*>(p)) T(); }); }
+
+    void resize(std::size_t count, const T& value) {
+        if (count > capacity_ && value_inside(value)) {
+            const T copy(value);
+            resize(count, copy);
+            return;
+        }
+        resize_with(count, [&](T* p) { ::new (static_cast<void*>(p)) T(value); });
+    }
+
+    // -------------------------------------------------------------------------
+    // 中间插入 / 删除
+    // -------------------------------------------------------------------------
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        const auto index = static_cast<std::size_t>(pos - begin());
+        T value(std::forward<Args>(args)...);  // 先构造：参数可能引用本容器内的元素
+        if (size_ == capacity_) {
+            grow_to(std::size_t{size_} + 1);
+        }
+        detail::insert_shift(data_ + index, end(), std::move(value));
+        ++size_;
+        return data_ + index;
+    }
+
+    inline iterator insert(const_iterator pos, const T& value) { return emplace(pos, value); }
+    inline iterator insert(const_iterator pos, T&& value) { return emplace(pos, std::move(value)); }
+
+    inline iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        T* from = data_ + (first - begin());
+        T* to = data_ + (last - begin());
+        size_ = static_cast<uint32_t>(detail::erase_shift(from, to, end()) - data_);
+        return from;
+    }
+
+    [[nodiscard]] friend bool operator==(const SmallVector& a, const SmallVector& b) {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+private:
+    static constexpr bool kNothrowRelocate =
+        is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>;
+
+    /// 小的平凡可复制类型：push_back 快路径按值构造，扩容路径不接收参数
+    static constexpr bool kSmallTrivial = std::is_trivially_copyable_v<T> && sizeof(T) <= 64;
+
+    [[nodiscard, gnu::always_inline]] inline T* inline_data() noexcept {
+        return std::launder(reinterpret_cast<T*>(inline_));
+    }
+    [[nodiscard, gnu::always_inline]] inline const T* inline_data() const noexcept {
+        return std::launder(reinterpret_cast<const T*>(inline_));
+    }
+
+    [[nodiscard]] inline bool value_inside(const T& value) const noexcept {
+        return std::less_equal<const T*>()(begin(), &value) && std::less<const T*>()(&value, end());
+    }
+
+    [[nodiscard]] inline std::size_t next_capacity(std::size_t required) const {
+        if (required > max_size()) [[unlikely]] {
+            throw std::bad_alloc();
+        }
+        return std::clamp<std::size_t>(std::size_t{capacity_} * 2, required, max_size());
+    }
+
+    /// 扩容路径单独成函数，保持 emplace_back 内联部分短小。
+    /// 新元素先构造在新缓冲区中再搬移旧元素，参数引用旧元素时仍然有效
+    template <typename... Args>
+    [[gnu::noinline]] T& grow_and_emplace_back(Args&&... args) {
+        const std::size_t capacity = next_capacity(std::size_t{size_} + 1);
+        T* buffer = allocate(capacity);
+        T* slot = buffer + size_;
+        try {
+            ::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(buffer, capacity);
+            throw;
+        }
+        try {
+            detail::relocate(buffer, data_, size_);
+        } catch (...) {
+            slot->~T();
+            deallocate(buffer, capacity);
+            throw;
+        }
+        adopt(buffer, capacity);
+        ++size_;
+        return *slot;
+    }
+
+    [[gnu::noinline]] void grow_by_one() { grow_to(std::size_t{size_} + 1); }
+
+    inline void grow_to(std::size_t required) { reallocate(next_capacity(required)); }
+
+    void reallocate(std::size_t capacity) {
+        T* buffer = allocate(capacity);
+        try {
+            detail::relocate(buffer, data_, size_);
+        } catch (...) {
+            deallocate(buffer, capacity);
+            throw;
+        }
+        adopt(buffer, capacity);
+    }
+
+    /// 旧元素已搬走：释放旧堆缓冲区（若有）并接管新缓冲区
+    inline void adopt(T* buffer, std::size_t capacity) noexcept {
+        release();
+        data_ = buffer;
+        capacity_ = static_cast<uint32_t>(capacity);
+    }
+
+    template <typename... Args>
+    [[gnu::always_inline]] inline T& unchecked_emplace_back(Args&&... args) {
+        T* slot = ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    template <typename Construct>
+    void resize_with(std::size_t count, Construct&& construct) {
+        if (count < size_) {
+            std::destroy(data_ + count, end());
+            size_ = static_cast<uint32_t>(count);
+            return;
+        }
+        reserve(count);
+        while (size_ < count) {
+            construct(data_ + size_);
+            ++size_;
+        }
+    }
+
+    /// 调用前 this 为空
+    void copy_from(const SmallVector& other) {
+        reserve(other.size_);
+        detail::copy_construct(data_, other.data_, other.size_);
+        size_ = other.size_;
+    }
+
+    /// 调用前 this 为空；other 在堆上时 this 须使用内联槽位
+    void move_from(SmallVector& other) noexcept(kNothrowRelocate) {
+        if (!other.is_inline()) {
+            data_ = std::exchange(other.data_, other.inline_data());
+            size_ = std::exchange(other.size_, 0);
+            capacity_ = std::exchange(other.capacity_, static_cast<uint32_t>(N));
+            return;
+        }
+        detail::relocate(data_, other.data_, other.size_);
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    [[nodiscard]] static T* allocate(std::size_t capacity) { return std::allocator<T>().allocate(capacity); }
+
+    static void deallocate(T* buffer, std::size_t capacity) noexcept {
+        std::allocator<T>().deallocate(buffer, capacity);
+    }
+
+    inline void release() noexcept {
+        if (!is_inline()) {
+            deallocate(data_, capacity_);
+        }
+    }
+
+    T* data_;
+    uint32_t size_{0};
+    uint32_t capacity_{static_cast<uint32_t>(N)};
+    alignas(T) std::byte inline_[N * sizeof(T)];
+};
+
+}  // namespace container
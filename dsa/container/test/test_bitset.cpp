@@ -0,0 +1,192 @@
+/**
+ * @file test_bitset.cpp
+ * @brief FixedBitset / DynamicBitset 单元测试
+ * @version 1.0.0
+ */
+
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/bitset.h"
+
+using namespace container;
+
+namespace {
+
+/// 随机位，density 为置位概率的百分比
+template <typename Bitset>
+void fill_random(Bitset& bits, std::vector<bool>& reference, std::mt19937_64& rng, unsigned density) {
+    for (std::size_t i = 0; i < bits.size(); ++i) {
+        const bool value = rng() % 100 < density;
+        bits.set(i, value);
+        reference[i] = value;
+    }
+}
+
+template <typename Bitset>
+bool matches(const Bitset& bits, const std::vector<bool>& reference) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < reference.size(); ++i) {
+        if (bits.test(i) != reference[i]) {
+            return false;
+        }
+        count += reference[i];
+    }
+    std::vector<std::size_t> visited;
+    bits.for_each([&](std::size_t i) { visited.push_back(i); });
+    std::size_t next = bits.find_first();
+    for (std::size_t i : visited) {
+        if (!reference[i] || next != i) {
+            return false;
+        }
+        next = bits.find_next(i + 1);
+    }
+    return next == bits.size() && visited.size() == count && bits.count() == count;
+}
+
+}  // namespace
+
+TEST(FixedBitset, TailBitsStayClear) {
+    FixedBitset<100> bits;
+    EXPECT_TRUE(bits.none());
+    EXPECT_EQ(bits.find_first(), 100u);
+    bits.set_all();
+    EXPECT_EQ(bits.count(), 100u);
+    EXPECT_TRUE(bits.all());
+    EXPECT_EQ(bits.words()[1], (uint64_t{1} << 36) - 1);
+    bits.flip_all();
+    EXPECT_TRUE(bits.none());
+    bits.flip(99);
+    bits.set(0);
+    EXPECT_EQ(bits.find_next(1), 99u);
+    EXPECT_EQ(bits.rank(99), 1u);
+    EXPECT_EQ(bits.rank(100), 2u);
+    EXPECT_EQ(bits.select(1), 99u);
+    EXPECT_EQ(bits.select(2), 100u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(bits.words().data()) % 64, 0u);
+    return true;
+}
+
+TEST(FixedBitset, OperationsMatchStdBitset) {
+    constexpr std::size_t kBits = 1000;  // 不是 512 的整数倍：SIMD 主循环加标量余数
+    std::mt19937_64 rng(1);
+    for (unsigned density : {0u, 3u, 50u, 97u, 100u}) {
+        FixedBitset<kBits> a;
+        FixedBitset<kBits> b;
+        std::vector<bool> ra(kBits);
+        std::vector<bool> rb(kBits);
+        fill_random(a, ra, rng, density);
+        fill_random(b, rb, rng, 50);
+        std::bitset<kBits> sa;
+        std::bitset<kBits> sb;
+        for (std::size_t i = 0; i < kBits; ++i) {
+            sa[i] = ra[i];
+            sb[i] = rb[i];
+        }
+
+        const auto check = [&](const FixedBitset<kBits>& got, const std::bitset<kBits>& expected) {
+            std::vector<bool> r(kBits);
+            for (std::size_t i = 0; i < kBits; ++i) {
+                r[i] = expected[i];
+            }
+            return matches(got, r);
+        };
+        EXPECT_TRUE(check(a, sa));
+        EXPECT_TRUE(check(a & b, sa & sb));
+        EXPECT_TRUE(check(a | b, sa | sb));
+        EXPECT_TRUE(check(a ^ b, sa ^ sb));
+        FixedBitset<kBits> c = a;
+        c.and_not(b);
+        EXPECT_TRUE(check(c, sa & ~sb));
+        EXPECT_EQ(a.count_and(b), (sa & sb).count());
+        EXPECT_EQ(a.intersects(b), (sa & sb).any());
+        EXPECT_EQ(a.all(), sa.all());
+        EXPECT_TRUE(a == a);
+        EXPECT_EQ(a == b, sa == sb);
+    }
+    return true;
+}
+
+TEST(DynamicBitset, ResizeKeepsBitsAndFillsNewOnes) {
+    DynamicBitset bits(70);
+    bits.set(3);
+    bits.set(69);
+    bits.resize(130, true);
+    EXPECT_EQ(bits.count(), 2u + 60u);
+    EXPECT_TRUE(bits.test(69) && bits.test(70) && bits.test(129));
+    EXPECT_FALSE(bits.test(68));
+    bits.resize(65);  // 位 69 及新填充的位被截掉，尾部保持为 0
+    EXPECT_EQ(bits.count(), 1u);
+    EXPECT_EQ(bits.words()[1], 0u);
+    bits.resize(200);
+    EXPECT_EQ(bits.count(), 1u);
+    EXPECT_EQ(bits.find_next(4), 200u);
+    return true;
+}
+
+TEST(DynamicBitset, OperationsMatchVectorBool) {
+    std::mt19937_64 rng(2);
+    for (std::size_t size : {1u, 63u, 64u, 511u, 512u, 4099u}) {
+        DynamicBitset a(size);
+        std::vector<bool> ra(size);
+        fill_random(a, ra, rng, 30);
+        EXPECT_TRUE(matches(a, ra));
+
+        // 长度不同：较短一方缺少的字视为 0
+        const std::size_t other_size = size / 2 + 1 + rng() % (size + 64);
+        DynamicBitset b(other_size);
+        std::vector<bool> rb(other_size);
+        fill_random(b, rb, rng, 60);
+        const auto other = [&](std::size_t i) {
+            return i < other_size && rb[i];
+        };
+
+        std::vector<bool> expected(size);
+        DynamicBitset c = a;
+        c &= b;
+        for (std::size_t i = 0; i < size; ++i) {
+            expected[i] = ra[i] && other(i);
+        }
+        EXPECT_TRUE(matches(c, expected));
+        EXPECT_EQ(a.count_and(b), c.count());
+        EXPECT_EQ(a.intersects(b), c.any());
+
+        c = a;
+        c |= b;
+        for (std::size_t i = 0; i < size; ++i) {
+            expected[i] = ra[i] || other(i);
+        }
+        EXPECT_TRUE(matches(c, expected));
+
+        c = a;
+        c ^= b;
+        for (std::size_t i = 0; i < size; ++i) {
+            expected[i] = ra[i] != other(i);
+        }
+        EXPECT_TRUE(matches(c, expected));
+
+        c = a;
+        c.and_not(b);
+        for (std::size_t i = 0; i < size; ++i) {
+            expected[i] = ra[i] && !other(i);
+        }
+        EXPECT_TRUE(matches(c, expected));
+
+        std::size_t ones = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(a.rank(i), ones);
+            if (ra[i]) {
+                EXPECT_EQ(a.select(ones), i);
+                ++ones;
+            }
+        }
+        EXPECT_EQ(a.rank(size), ones);
+        EXPECT_EQ(a.select(ones), size);
+    }
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
@@ -0,0 +1,106 @@
+/**
+ * @file test_bloom_filter.cpp
+ * @brief BlockedBloomFilter 单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/bloom_filter.h"
+
+using namespace container;
+
+namespace {
+
+/// n 个互不相同的随机键：前一半插入，后一半只用于测误判
+std::vector<uint64_t> random_keys(std::size_t n, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<uint64_t> keys(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        keys[i] = (rng() << 1) | (i & 1);  // 奇偶分开，插入集与查询集不相交
+    }
+    return keys;
+}
+
+}  // namespace
+
+TEST(BlockedBloomFilter, SizingFollowsTargetFpr) {
+    const auto loose = BlockedBloomFilter<uint64_t>::blocks_for(100'000, 0.05);
+    const auto tight = BlockedBloomFilter<uint64_t>::blocks_for(100'000, 0.001);
+    EXPECT_GT(tight, loose);
+    // 最少块数：再少一块就超过目标
+    EXPECT_TRUE(BlockedBloomFilter<uint64_t>::estimate_fpr(100'000, tight) <= 0.001);
+    EXPECT_TRUE(BlockedBloomFilter<uint64_t>::estimate_fpr(100'000, tight - 1) > 0.001);
+
+    const BlockedBloomFilter<uint64_t> empty(0);
+    EXPECT_EQ(empty.blocks(), 1u);
+    EXPECT_FALSE(empty.contains(uint64_t{42}));
+
+    bool thrown = false;
+    try {
+        BlockedBloomFilter<uint64_t> invalid(10, 1.0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+    return true;
+}
+
+TEST(BlockedBloomFilter, NoFalseNegativesAndMeasuredFpr) {
+    constexpr std::size_t kKeys = 200'000;
+    for (double target : {0.05, 0.01, 0.001}) {
+        BlockedBloomFilter<uint64_t> filter(kKeys, target);
+        const auto keys = random_keys(2 * kKeys, 1);
+        for (std::size_t i = 0; i < keys.size(); i += 2) {
+            filter.insert(keys[i]);
+        }
+        std::size_t false_positives = 0;
+        for (std::size_t i = 0; i < keys.size(); i += 2) {
+            EXPECT_TRUE(filter.contains(keys[i]));
+            false_positives += filter.contains(keys[i + 1]);
+        }
+        // 实测误判率与估计一致（宽松上下界，随机波动远小于此）
+        const double measured = static_cast<double>(false_positives) / kKeys;
+        EXPECT_TRUE(measured < target * 1.3);
+        EXPECT_TRUE(measured > filter.fpr() * 0.7);
+        EXPECT_EQ(filter.inserted(), kKeys);
+    }
+    return true;
+}
+
+TEST(BlockedBloomFilter, BatchMatchesSingleQueries) {
+    BlockedBloomFilter<std::string> filter(1000, 0.01);
+    std::vector<std::string> keys;
+    for (int i = 0; i < 2000; ++i) {
+        keys.push_back("SYM" + std::to_string(i));
+    }
+    for (int i = 0; i < 2000; i += 2) {
+        filter.insert(keys[i]);
+    }
+    // 长于与短于预取距离两种情况，长度都不是其整数倍
+    for (std::size_t length : {1999u, 5u}) {
+        const std::span<const std::string> queries(keys.data(), length);
+        std::vector<char> hits(queries.size());
+        const std::size_t count = filter.contains_batch(queries, reinterpret_cast<bool*>(hits.data()));
+        std::size_t expected = 0;
+        for (std::size_t i = 0; i < queries.size(); ++i) {
+            EXPECT_EQ(hits[i] != 0, filter.contains(queries[i]));
+            expected += filter.contains(queries[i]);
+            if (i % 2 == 0) {
+                EXPECT_TRUE(hits[i] != 0);
+            }
+        }
+        EXPECT_EQ(count, expected);
+    }
+
+    filter.clear();
+    EXPECT_FALSE(filter.contains(keys[0]));
+    EXPECT_EQ(filter.inserted(), 0u);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
@@ -0,0 +1,192 @@
+/**
+ * @file test_btree.cpp
+ * @brief BPlusTree 单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/btree.h"
+
+using namespace container;
+
+namespace {
+
+/// 按键序遍历与 std::map 完全一致，且逐键 find / lower_bound 一致
+template <typename Tree, typename K, typename V>
+bool matches_reference(const Tree& tree, const std::map<K, V>& reference) {
+    if (tree.size() != reference.size()) {
+        return false;
+    }
+    auto expected = reference.begin();
+    for (auto [key, value] : tree) {
+        if (expected == reference.end() || key != expected->first || value != expected->second) {
+            return false;
+        }
+        ++expected;
+    }
+    if (expected != reference.end()) {
+        return false;
+    }
+    for (const auto& [key, value] : reference) {
+        const V* found = tree.find(key);
+        if (found == nullptr || *found != value) {
+            return false;
+        }
+        auto it = tree.lower_bound(static_cast<K>(key - 1));
+        auto ref = reference.lower_bound(static_cast<K>(key - 1));
+        if ((it == tree.end()) != (ref == reference.end()) ||
+            (ref != reference.end() && it.key() != ref->first)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// 随机插入/删除（小节点使树有多层），每轮与 std::map 对照
+template <typename K, std::size_t NodeLines>
+bool random_operations(uint64_t seed) {
+    BPlusTree<K, uint64_t, NodeLines> tree;
+    std::map<K, uint64_t> reference;
+    std::mt19937_64 rng(seed);
+    for (int round = 0; round < 4; ++round) {
+        for (uint64_t i = 0; i < 20000; ++i) {
+            const K key = static_cast<K>(rng() % 30000);
+            const bool erase = rng() % 100 < (round % 2 == 0 ? 30u : 70u);
+            if (erase) {
+                if (tree.erase(key) != reference.erase(key)) {
+                    return false;
+                }
+            } else if (tree.try_emplace(key, i).second != reference.try_emplace(key, i).second) {
+                return false;
+            }
+        }
+        if (!matches_reference(tree, reference)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST(BPlusTree, NodeLayout) {
+    using Tree = BPlusTree<uint64_t, uint64_t>;
+    EXPECT_EQ(Tree::kNodeBytes % memory_constants::kCacheLineSize, 0u);
+    EXPECT_EQ(Tree::kLeafSlots, 14u);
+    EXPECT_EQ(Tree::kInnerSlots, 15u);
+    EXPECT_EQ((BPlusTree<uint32_t, uint32_t, 1>::kLeafSlots), 5u);
+    return true;
+}
+
+TEST(BPlusTree, RandomInsertEraseMatchesStdMap) {
+    EXPECT_TRUE((random_operations<uint64_t, 2>(1)));
+    EXPECT_TRUE((random_operations<int64_t, 4>(2)));
+    EXPECT_TRUE((random_operations<int32_t, 2>(3)));
+    EXPECT_TRUE((random_operations<uint32_t, 2>(4)));
+    EXPECT_TRUE((random_operations<double, 2>(5)));
+    return true;
+}
+
+TEST(BPlusTree, BulkLoad) {
+    for (std::size_t n : {0u, 1u, 6u, 7u, 13u, 100u, 5000u, 100000u}) {
+        std::vector<std::pair<uint64_t, uint64_t>> sorted;
+        std::map<uint64_t, uint64_t> reference;
+        for (uint64_t i = 0; i < n; ++i) {
+            sorted.emplace_back(i * 3, i);
+            if (i % 7 == 0) {
+                sorted.emplace_back(i * 3, i + 1);  // 重复键：保留第一个
+            }
+            reference.emplace(i * 3, i);
+        }
+        BPlusTree<uint64_t, uint64_t, 2> tree(sorted.begin(), sorted.end());
+        EXPECT_TRUE(matches_reference(tree, reference));
+
+        // 批量构造后仍可插入/删除
+        EXPECT_TRUE(tree.try_emplace(1, 1).second);
+        EXPECT_EQ(tree.erase(0), n > 0 ? 1u : 0u);
+        reference.emplace(1, 1);
+        reference.erase(0);
+        EXPECT_TRUE(matches_reference(tree, reference));
+    }
+    return true;
+}
+
+TEST(BPlusTree, AppendKeepsNodesFull) {
+    // 递增追加与批量构造得到同样的树高（追加时左节点保持全满）
+    constexpr uint64_t kCount = 200000;
+    BPlusTree<uint64_t, uint64_t, 2> appended;
+    std::vector<std::pair<uint64_t, uint64_t>> sorted;
+    for (uint64_t i = 0; i < kCount; ++i) {
+        appended.try_emplace(i, i);
+        sorted.emplace_back(i, i);
+    }
+    BPlusTree<uint64_t, uint64_t, 2> loaded(sorted.begin(), sorted.end());
+    EXPECT_EQ(appended.size(), kCount);
+    EXPECT_EQ(appended.height(), loaded.height());
+
+    uint64_t expected = 0;
+    for (auto [key, value] : appended) {
+        EXPECT_EQ(key, expected);
+        ++expected;
+    }
+    EXPECT_EQ(expected, kCount);
+    return true;
+}
+
+TEST(BPlusTree, RangeScan) {
+    BPlusTree<int64_t, int64_t> tree;
+    std::map<int64_t, int64_t> reference;
+    std::mt19937_64 rng(7);
+    for (int i = 0; i < 50000; ++i) {
+        const auto key = static_cast<int64_t>(rng() % 1000000) - 500000;
+        tree.try_emplace(key, -key);
+        reference.try_emplace(key, -key);
+    }
+    for (int i = 0; i < 200; ++i) {
+        const auto from = static_cast<int64_t>(rng() % 1100000) - 550000;
+        const int64_t to = from + static_cast<int64_t>(rng() % 20000);
+        auto expected = reference.lower_bound(from);
+        bool ordered = true;
+        const std::size_t visited = std::as_const(tree).scan(from, to, [&](int64_t key, int64_t value) {
+            ordered = ordered && key == expected->first && value == -key;
+            ++expected;
+        });
+        EXPECT_TRUE(ordered);
+        EXPECT_EQ(visited, static_cast<std::size_t>(std::distance(reference.lower_bound(from),
+                                                                  reference.lower_bound(to))));
+    }
+
+    // 非 const 扫描可修改值
+    tree.scan(0, 1000, [](int64_t, int64_t& value) { value = 42; });
+    EXPECT_TRUE(tree.lower_bound(0) == tree.end() || tree.lower_bound(0).key() >= 1000 ||
+                tree.lower_bound(0).value() == 42);
+    return true;
+}
+
+TEST(BPlusTree, EraseAllAndReuse) {
+    BPlusTree<uint32_t, uint32_t, 1> tree;
+    for (uint32_t i = 0; i < 10000; ++i) {
+        tree[i * 7 % 10007] = i;
+    }
+    EXPECT_GT(tree.height(), 2u);
+    for (uint32_t i = 0; i < 10000; ++i) {
+        EXPECT_EQ(tree.erase(i * 7 % 10007), 1u);
+    }
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.height(), 0u);
+    EXPECT_TRUE(tree.begin() == tree.end());
+
+    tree.insert_or_assign(5, 1);
+    tree.insert_or_assign(5, 2);
+    EXPECT_EQ(*tree.find(5), 2u);
+    tree.clear();
+    EXPECT_TRUE(tree.find(5) == nullptr);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
@@ -0,0 +1,265 @@
+/**
+ * @file test_cache.cpp
+ * @brief LruCache / ClockCache / ShardedCache 单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/cache.h"
+
+using namespace container;
+
+namespace {
+
+/// 参考实现：std::list + std::unordered_map
+class ReferenceLru {
+public:
+    explicit ReferenceLru(std::size_t capacity) : capacity_(capacity) {}
+
+    const std::string* find(const std::string& key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return nullptr;
+        }
+        order_.splice(order_.begin(), order_, it->second);
+        return &it->second->second;
+    }
+
+    void insert_or_assign(const std::string& key, const std::string& value) {
+        if (auto it = index_.find(key); it != index_.end()) {
+            it->second->second = value;
+            order_.splice(order_.begin(), order_, it->second);
+            return;
+        }
+        if (order_.size() == capacity_) {
+            index_.erase(order_.back().first);
+            order_.pop_back();
+        }
+        order_.emplace_front(key, value);
+        index_[key] = order_.begin();
+    }
+
+    std::size_t erase(const std::string& key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return 0;
+        }
+        order_.erase(it->second);
+        index_.erase(it);
+        return 1;
+    }
+
+    const std::list<std::pair<std::string, std::string>>& order() const { return order_; }
+
+private:
+    std::size_t capacity_;
+    std::list<std::pair<std::string, std::string>> order_;
+    std::unordered_map<std::string, std::list<std::pair<std::string, std::string>>::iterator> index_;
+};
+
+template <typename Cache>
+bool throws_on_capacity(std::size_t capacity) {
+    try {
+        Cache cache(capacity);
+    } catch (const std::length_error&) {
+        return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+TEST(LruCache, EvictsLeastRecentlyUsed) {
+    LruCache<int, int> cache(3);
+    cache.insert_or_assign(1, 10);
+    cache.insert_or_assign(2, 20);
+    cache.insert_or_assign(3, 30);
+    EXPECT_EQ(*cache.find(1), 10);  // 1 成为最近使用，2 为最久
+    EXPECT_TRUE(cache.find(4) == nullptr);
+    cache.insert_or_assign(4, 40);
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_EQ(*cache.peek(3), 30);  // peek 不改变顺序：3 仍最久
+    cache.insert_or_assign(5, 50);
+    EXPECT_FALSE(cache.contains(3));
+
+    std::vector<int> order;
+    cache.for_each([&](int key, int) { order.push_back(key); });
+    EXPECT_TRUE((order == std::vector<int>{5, 4, 1}));
+
+    const CacheStats stats = cache.stats();
+    EXPECT_EQ(stats.hits_, 1u);
+    EXPECT_EQ(stats.misses_, 1u);
+    EXPECT_EQ(stats.insertions_, 5u);
+    EXPECT_EQ(stats.evictions_, 2u);
+
+    EXPECT_EQ(cache.erase(4), 1u);
+    EXPECT_EQ(cache.erase(4), 0u);
+    cache.insert_or_assign(6, 60);  // 复用已删除的槽位，不淘汰
+    EXPECT_EQ(cache.size(), 3u);
+    EXPECT_EQ(cache.stats().evictions_, 2u);
+
+    cache.clear();
+    EXPECT_TRUE(cache.empty());
+    EXPECT_TRUE(cache.find(1) == nullptr);
+    EXPECT_TRUE((throws_on_capacity<LruCache<int, int>>(0)));
+    return true;
+}
+
+TEST(LruCache, RandomOperationsMatchReference) {
+    // 容量小于键空间，淘汰与索引后移删除频繁发生
+    for (std::size_t capacity : {1u, 7u, 64u, 1000u}) {
+        LruCache<std::string, std::string> cache(capacity);
+        ReferenceLru reference(capacity);
+        std::mt19937_64 rng(capacity);
+        const uint64_t keys = capacity * 3 + 5;
+        for (int i = 0; i < 100000; ++i) {
+            const std::string key = "key" + std::to_string(rng() % keys);
+            const auto op = rng() % 100;
+            if (op < 50) {
+                const std::string* expected = reference.find(key);
+                const std::string* actual = cache.find(std::string_view(key));
+                EXPECT_EQ(actual == nullptr, expected == nullptr);
+                if (actual != nullptr && expected != nullptr) {
+                    EXPECT_EQ(*actual, *expected);
+                }
+            } else if (op < 90) {
+                const std::string value = std::to_string(rng());
+                cache.insert_or_assign(key, value);
+                reference.insert_or_assign(key, value);
+            } else {
+                EXPECT_EQ(cache.erase(key), reference.erase(key));
+            }
+            EXPECT_EQ(cache.size(), reference.order().size());
+        }
+        auto it = reference.order().begin();
+        bool same_order = true;
+        cache.for_each([&](const std::string& key, const std::string& value) {
+            if (it == reference.order().end() || it->first != key || it->second != value) {
+                same_order = false;
+                return;
+            }
+            ++it;
+        });
+        EXPECT_TRUE(same_order);
+    }
+    return true;
+}
+
+TEST(ClockCache, FrequencyGivesSecondChance) {
+    ClockCache<int, int> cache(3);
+    cache.insert_or_assign(1, 10);
+    cache.insert_or_assign(2, 20);
+    cache.insert_or_assign(3, 30);
+    EXPECT_EQ(*cache.find(1), 10);
+    EXPECT_EQ(*cache.find(1), 10);
+    cache.insert_or_assign(4, 40);  // 指针经过 1（频率 2 → 1），淘汰 2
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_FALSE(cache.contains(2));
+    cache.insert_or_assign(5, 50);  // 淘汰 3
+    EXPECT_FALSE(cache.contains(3));
+    cache.insert_or_assign(6, 60);  // 1 频率 1 → 0，淘汰 4
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_FALSE(cache.contains(4));
+
+    const CacheStats stats = cache.stats();
+    EXPECT_EQ(stats.hits_, 2u);
+    EXPECT_EQ(stats.insertions_, 6u);
+    EXPECT_EQ(stats.evictions_, 3u);
+    EXPECT_TRUE((throws_on_capacity<ClockCache<int, int>>(memory_constants::kMaxCapacity + 1)));
+    return true;
+}
+
+TEST(ClockCache, RandomOperationsStayConsistent) {
+    // 缓存中的每个键都必须对应最近一次写入的值；统计与大小守恒
+    ClockCache<uint64_t, std::string> cache(500);
+    std::unordered_map<uint64_t, std::string> latest;
+    std::mt19937_64 rng(11);
+    uint64_t erased = 0;
+    for (int i = 0; i < 200000; ++i) {
+        const uint64_t key = rng() % 2000;
+        const auto op = rng() % 100;
+        if (op < 60) {
+            if (const std::string* value = cache.find(key)) {
+                EXPECT_EQ(*value, latest[key]);
+            }
+        } else if (op < 95) {
+            latest[key] = std::to_string(rng());
+            cache.insert_or_assign(key, latest[key]);
+        } else {
+            erased += cache.erase(key);
+        }
+    }
+    std::size_t count = 0;
+    bool values_match = true;
+    cache.for_each([&](uint64_t key, const std::string& value) {
+        values_match = values_match && latest[key] == value;
+        ++count;
+    });
+    EXPECT_TRUE(values_match);
+    EXPECT_EQ(count, cache.size());
+    const CacheStats stats = cache.stats();
+    EXPECT_EQ(stats.insertions_ - stats.evictions_ - erased, cache.size());
+    EXPECT_GT(stats.hits_, 0u);
+    EXPECT_GT(stats.evictions_, 0u);
+    return true;
+}
+
+TEST(ShardedCache, ConcurrentReadersAndWriters) {
+    // 值恒为键的函数，任何线程读到的值都可校验
+    const auto check = [](auto& cache) {
+        constexpr int kThreads = 4;
+        constexpr int kOps = 50000;
+        std::vector<std::thread> threads;
+        std::vector<int> bad(kThreads, 0);
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&, t] {
+                std::mt19937_64 rng(t);
+                for (int i = 0; i < kOps; ++i) {
+                    const uint64_t key = rng() % 4096;
+                    if (auto value = cache.get(key)) {
+                        bad[t] += *value != key * 3;
+                    } else {
+                        cache.insert_or_assign(key, key * 3);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        const CacheStats stats = cache.stats();
+        return bad == std::vector<int>(kThreads, 0) && stats.hits_ + stats.misses_ == kThreads * kOps &&
+               cache.size() <= cache.capacity() && stats.evictions_ > 0;
+    };
+
+    ShardedCache<ClockCache<uint64_t, uint64_t, std::hash<uint64_t>, std::equal_to<>, true>> clock(1000, 8);
+    EXPECT_TRUE(clock.kSharedReads);
+    EXPECT_EQ(clock.shard_count(), 8u);
+    EXPECT_EQ(clock.capacity(), 1000u);
+    EXPECT_TRUE(check(clock));
+
+    ShardedCache<LruCache<uint64_t, uint64_t>> lru(1000, 64);  // 截断到 kMaxPartitions
+    EXPECT_FALSE(lru.kSharedReads);
+    EXPECT_EQ(lru.shard_count(), memory_constants::kMaxPartitions);
+    EXPECT_TRUE(check(lru));
+
+    lru.insert_or_assign(uint64_t{7}, uint64_t{21});
+    EXPECT_TRUE(lru.contains(uint64_t{7}));
+    EXPECT_EQ(lru.erase(uint64_t{7}), 1u);
+    lru.clear();
+    EXPECT_EQ(lru.size(), 0u);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
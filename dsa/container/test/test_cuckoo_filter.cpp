@@ -0,0 +1,132 @@
+/**
+ * @file test_cuckoo_filter.cpp
+ * @brief CuckooFilter 单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/cuckoo_filter.h"
+
+using namespace container;
+
+namespace {
+
+std::vector<uint64_t> random_keys(std::size_t n, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<uint64_t> keys(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        keys[i] = (rng() << 1) | (i & 1);  // 奇偶分开，插入集与查询集不相交
+    }
+    return keys;
+}
+
+/// 按容量插满偶数下标的键，返回奇数下标键的实测误判率
+template <typename Filter>
+double fill_and_measure(Filter& filter, const std::vector<uint64_t>& keys) {
+    for (std::size_t i = 0; i < keys.size(); i += 2) {
+        if (!filter.insert(keys[i])) {
+            return 1.0;
+        }
+    }
+    std::size_t false_positives = 0;
+    for (std::size_t i = 0; i < keys.size(); i += 2) {
+        if (!filter.contains(keys[i])) {
+            return 1.0;
+        }
+        false_positives += filter.contains(keys[i + 1]);
+    }
+    return static_cast<double>(false_positives) / static_cast<double>(keys.size() / 2);
+}
+
+}  // namespace
+
+TEST(CuckooFilter, FingerprintWidthFromTargetFpr) {
+    EXPECT_TRUE((std::is_same_v<CuckooFilterFor<uint64_t, 0.05>, CuckooFilter<uint64_t, uint8_t>>));
+    EXPECT_TRUE((std::is_same_v<CuckooFilterFor<uint64_t, 0.01>, CuckooFilter<uint64_t, uint16_t>>));
+
+    constexpr std::size_t kKeys = 100'000;
+    const auto keys = random_keys(2 * kKeys, 1);
+    CuckooFilter<uint64_t, uint8_t> narrow(kKeys);
+    CuckooFilter<uint64_t, uint16_t> wide(kKeys);
+    EXPECT_EQ(narrow.buckets(), wide.buckets());
+    EXPECT_EQ(narrow.bytes() * 2, wide.bytes());
+    // 实测误判率不超过满载理论值（装载率不足 100% 时更低）
+    const double narrow_fpr = fill_and_measure(narrow, keys);
+    const double wide_fpr = fill_and_measure(wide, keys);
+    EXPECT_TRUE(narrow_fpr < narrow.kFpr && narrow_fpr > narrow.kFpr / 4);
+    EXPECT_TRUE(wide_fpr < wide.kFpr);
+    EXPECT_EQ(wide.size(), kKeys);
+    return true;
+}
+
+TEST(CuckooFilter, EraseRemovesOnlyOneCopy) {
+    CuckooFilter<uint64_t> filter(1000);
+    const auto keys = random_keys(2000, 2);
+    for (std::size_t i = 0; i < keys.size(); i += 2) {
+        EXPECT_TRUE(filter.insert(keys[i]));
+    }
+    EXPECT_TRUE(filter.insert(keys[0]));  // 重复插入占两个槽
+    EXPECT_EQ(filter.size(), 1001u);
+
+    EXPECT_TRUE(filter.erase(keys[0]));
+    EXPECT_TRUE(filter.contains(keys[0]));
+    EXPECT_TRUE(filter.erase(keys[0]));
+    EXPECT_FALSE(filter.erase(keys[0]));
+    for (std::size_t i = 2; i < keys.size(); i += 4) {
+        EXPECT_TRUE(filter.erase(keys[i]));
+    }
+    for (std::size_t i = 4; i < keys.size(); i += 4) {
+        EXPECT_TRUE(filter.contains(keys[i]));
+    }
+    EXPECT_EQ(filter.size(), 499u);
+
+    filter.clear();
+    EXPECT_TRUE(filter.empty());
+    EXPECT_FALSE(filter.contains(keys[4]));
+    return true;
+}
+
+TEST(CuckooFilter, OverfillKeepsVictimUntilErase) {
+    CuckooFilter<uint64_t, uint8_t> filter(100);
+    const auto keys = random_keys(4 * filter.capacity(), 3);
+    std::size_t inserted = 0;
+    while (inserted < keys.size() && filter.insert(keys[inserted])) {
+        ++inserted;
+    }
+    // 装满后再插入被拒绝；已插入的键（含暂存的 victim）全部可查到
+    EXPECT_TRUE(filter.full());
+    EXPECT_TRUE(filter.load_factor() > 0.9);
+    EXPECT_FALSE(filter.insert(keys[inserted]));
+    for (std::size_t i = 0; i < inserted; ++i) {
+        EXPECT_TRUE(filter.contains(keys[i]));
+    }
+
+    // 删除若干键后 victim 回到桶中，可以继续插入
+    for (std::size_t i = 0; i < 8; ++i) {
+        EXPECT_TRUE(filter.erase(keys[i]));
+    }
+    EXPECT_FALSE(filter.full());
+    EXPECT_TRUE(filter.insert(keys[inserted]));
+    for (std::size_t i = 8; i <= inserted; ++i) {
+        EXPECT_TRUE(filter.contains(keys[i]));
+    }
+    EXPECT_EQ(filter.size(), inserted - 7);
+
+    const std::span<const uint64_t> queries(keys.data(), inserted + 1);
+    std::vector<char> hits(queries.size());
+    const std::size_t count = filter.contains_batch(queries, reinterpret_cast<bool*>(hits.data()));
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        EXPECT_EQ(hits[i] != 0, filter.contains(queries[i]));
+        expected += hits[i] != 0;
+    }
+    EXPECT_EQ(count, expected);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
@@ -0,0 +1,181 @@
+/**
+ * @file test_dary_heap.cpp
+ * @brief DaryHeap / IndexedDaryHeap 单元测试
+ * @version 1.0.0
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/dary_heap.h"
+
+using namespace container;
+
+namespace {
+
+/// 随机 push / pop / replace_top，与 std::priority_queue 对照
+template <typename T, std::size_t Arity, typename Make>
+bool matches_priority_queue(uint64_t seed, Make&& make) {
+    DaryHeap<T, Arity> heap;
+    std::priority_queue<T, std::vector<T>, std::greater<T>> reference;
+    std::mt19937_64 rng(seed);
+    for (int round = 0; round < 4; ++round) {
+        for (int i = 0; i < 20000; ++i) {
+            const auto op = rng() % 100;
+            if (op < (round % 2 == 0 ? 60u : 30u) || reference.empty()) {
+                const T value = make(rng);
+                heap.push(value);
+                reference.push(value);
+            } else if (op < 90) {
+                heap.pop();
+                reference.pop();
+            } else {
+                const T value = make(rng);
+                heap.replace_top(value);
+                reference.pop();
+                reference.push(value);
+            }
+            if (heap.size() != reference.size() || (!reference.empty() && heap.top() != reference.top())) {
+                return false;
+            }
+        }
+    }
+    while (!reference.empty()) {
+        if (heap.top() != reference.top()) {
+            return false;
+        }
+        heap.pop();
+        reference.pop();
+    }
+    return heap.empty();
+}
+
+}  // namespace
+
+TEST(DaryHeap, ChildGroupsAreCacheLineAligned) {
+    using Index = detail::DaryIndex<8>;
+    EXPECT_EQ(Index::kRoot, 7u);
+    EXPECT_EQ(Index::first_child(Index::kRoot), 8u);
+    for (std::size_t i = Index::kRoot; i < 1000; ++i) {
+        EXPECT_EQ(Index::first_child(i) % 8, 0u);
+        EXPECT_EQ(Index::parent(Index::first_child(i)), i);
+        EXPECT_EQ(Index::parent(Index::first_child(i) + 7), i);
+    }
+
+    DaryHeap<uint64_t, 8> heap;
+    for (uint64_t i = 0; i < 100; ++i) {
+        heap.push(i);
+    }
+    const auto address = reinterpret_cast<uintptr_t>(&*heap.begin());
+    EXPECT_EQ((address + sizeof(uint64_t)) % 64, 0u);  // 根之后的第一组子节点按缓存行对齐
+    return true;
+}
+
+TEST(DaryHeap, RandomOperationsMatchPriorityQueue) {
+    const auto small = [](std::mt19937_64& rng) { return rng() % 1000; };
+    const auto wide = [](std::mt19937_64& rng) { return rng(); };
+    EXPECT_TRUE((matches_priority_queue<uint64_t, 2>(1, small)));
+    EXPECT_TRUE((matches_priority_queue<uint64_t, 4>(2, small)));
+    EXPECT_TRUE((matches_priority_queue<uint64_t, 8>(3, wide)));
+    EXPECT_TRUE((matches_priority_queue<int32_t, 16>(4, [](std::mt19937_64& rng) {
+        return static_cast<int32_t>(rng() % 5000) - 2500;
+    })));
+    EXPECT_TRUE((matches_priority_queue<std::string, 4>(5, [](std::mt19937_64& rng) {
+        return std::to_string(rng() % 100000);
+    })));
+    return true;
+}
+
+TEST(DaryHeap, BuildFromRangeAndCompare) {
+    std::vector<int> values;
+    std::mt19937 rng(6);
+    for (int i = 0; i < 5000; ++i) {
+        values.push_back(static_cast<int>(rng() % 10000));
+    }
+    for (std::size_t n : {0u, 1u, 2u, 9u, 5000u}) {
+        DaryHeap<int, 4, std::greater<int>> heap(values.begin(), values.begin() + n);  // 大顶堆
+        std::vector<int> expected(values.begin(), values.begin() + n);
+        std::sort(expected.begin(), expected.end(), std::greater<int>());
+        EXPECT_EQ(heap.size(), n);
+        for (int value : expected) {
+            EXPECT_EQ(heap.top(), value);
+            heap.pop();
+        }
+        EXPECT_TRUE(heap.empty());
+    }
+    return true;
+}
+
+TEST(IndexedDaryHeap, UpdateAndEraseMatchSet) {
+    IndexedDaryHeap<uint64_t, 4> heap;
+    std::set<std::pair<uint64_t, uint32_t>> reference;  // (值, 句柄)
+    std::vector<uint32_t> live;
+    std::mt19937_64 rng(7);
+    for (int i = 0; i < 100000; ++i) {
+        const auto op = rng() % 100;
+        if (op < 40 || live.empty()) {
+            const uint64_t value = rng() % 100000;
+            const uint32_t handle = heap.push(value);
+            EXPECT_FALSE(reference.count({value, handle}) > 0);
+            reference.emplace(value, handle);
+            live.push_back(handle);
+        } else if (op < 70) {
+            const std::size_t k = rng() % live.size();
+            const uint32_t handle = live[k];
+            const uint64_t value = rng() % 100000;  // 增减皆有
+            reference.erase({heap.value(handle), handle});
+            heap.update(handle, value);
+            reference.emplace(value, handle);
+        } else if (op < 85) {
+            const std::size_t k = rng() % live.size();
+            const uint32_t handle = live[k];
+            reference.erase({heap.value(handle), handle});
+            heap.erase(handle);
+            EXPECT_FALSE(heap.contains(handle));
+            live[k] = live.back();
+            live.pop_back();
+        } else {
+            EXPECT_EQ(heap.top(), reference.begin()->first);
+            const uint32_t handle = heap.pop();
+            reference.erase({reference.begin()->first, handle});
+            std::erase(live, handle);
+        }
+        EXPECT_EQ(heap.size(), reference.size());
+        if (!reference.empty()) {
+            EXPECT_EQ(heap.top(), reference.begin()->first);
+            EXPECT_EQ(heap.value(heap.top_handle()), heap.top());
+        }
+    }
+    for (uint32_t handle : live) {
+        EXPECT_TRUE(heap.contains(handle));
+    }
+    return true;
+}
+
+TEST(IndexedDaryHeap, HandleReuse) {
+    IndexedDaryHeap<int, 2> heap;
+    const auto a = heap.push(5);
+    const auto b = heap.push(3);
+    EXPECT_EQ(heap.top_handle(), b);
+    heap.update(a, 1);  // decrease-key
+    EXPECT_EQ(heap.top_handle(), a);
+    EXPECT_EQ(heap.pop(), a);
+    EXPECT_FALSE(heap.contains(a));
+    const auto c = heap.push(7);
+    EXPECT_EQ(c, a);  // 释放的句柄被复用
+    EXPECT_EQ(heap.value(c), 7);
+    heap.clear();
+    EXPECT_TRUE(heap.empty());
+    EXPECT_FALSE(heap.contains(b));
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
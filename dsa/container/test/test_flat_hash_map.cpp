@@ -0,0 +1,259 @@
+/**
+ * @file test_flat_hash_map.cpp
+ * @brief FlatHashMap 单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "../../test/test.h"
+#include "../detail/flat_hash_map.h"
+
+using namespace container;
+
+namespace {
+
+/// 所有键落在同一组：强制组内匹配与跨组探测
+struct CollidingHash {
+    std::size_t operator()(uint64_t) const noexcept { return 42; }
+};
+
+/// 统计析构次数，检查删除/清空/析构时值被正确销毁
+struct Tracked {
+    static inline int live_ = 0;
+    int value_;
+    explicit Tracked(int v) : value_(v) { ++live_; }
+    Tracked(Tracked&& other) noexcept : value_(other.value_) { ++live_; }
+    ~Tracked() { --live_; }
+};
+
+/// 值为负时构造抛异常，检查插入失败后表保持不变
+struct ThrowingValue {
+    static inline int live_ = 0;
+    int value_;
+    explicit ThrowingValue(int v) : value_(v) {
+        if (v < 0) {
+            throw std::runtime_error("ThrowingValue");
+        }
+        ++live_;
+    }
+    ThrowingValue(ThrowingValue&& other) noexcept : value_(other.value_) { ++live_; }
+    ~ThrowingValue() { --live_; }
+};
+
+template <typename Map>
+bool throws_on_emplace(Map& map, const typename Map::key_type& key, int value) {
+    try {
+        map.try_emplace(key, value);
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+TEST(FlatHashMap, InsertFindErase) {
+    FlatHashMap<uint64_t, int> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.find(1) == map.end());
+
+    EXPECT_TRUE(map.try_emplace(1, 10).second);
+    EXPECT_TRUE(map.try_emplace(2, 20).second);
+    EXPECT_TRUE(!map.try_emplace(1, 99).second);
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.find(1)->second, 10);
+    EXPECT_EQ(*map.get(2), 20);
+    EXPECT_TRUE(map.get(3) == nullptr);
+
+    map[3] = 30;
+    map.insert_or_assign(1, 11);
+    EXPECT_EQ(map[1], 11);
+    EXPECT_EQ(map[3], 30);
+
+    EXPECT_EQ(map.erase(2), 1u);
+    EXPECT_EQ(map.erase(2), 0u);
+    EXPECT_TRUE(!map.contains(2));
+    EXPECT_EQ(map.size(), 2u);
+
+    map.erase(map.find(1));
+    EXPECT_TRUE(!map.contains(1));
+    EXPECT_EQ(map.size(), 1u);
+    return true;
+}
+
+TEST(FlatHashMap, GrowthMatchesReference) {
+    FlatHashMap<uint64_t, uint64_t> map;
+    std::unordered_map<uint64_t, uint64_t> reference;
+    constexpr uint64_t kCount = 100000;
+
+    for (uint64_t i = 0; i < kCount; ++i) {
+        map[i * 7919] = i;
+        reference[i * 7919] = i;
+    }
+    EXPECT_EQ(map.size(), reference.size());
+    EXPECT_TRUE(map.load_factor() <= 7.0 / 8.0);
+    constexpr std::size_t kGroupWidth = FlatHashMap<uint64_t, uint64_t>::kGroupWidth;
+    EXPECT_EQ(map.capacity() % kGroupWidth, 0u);
+
+    // 删除一半，其余仍可查到
+    for (uint64_t i = 0; i < kCount; i += 2) {
+        EXPECT_EQ(map.erase(i * 7919), 1u);
+        reference.erase(i * 7919);
+    }
+    std::size_t visited = 0;
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(reference.at(key), value);
+        ++visited;
+    }
+    EXPECT_EQ(visited, reference.size());
+    for (uint64_t i = 0; i < kCount; ++i) {
+        EXPECT_EQ(map.contains(i * 7919), (i & 1) == 1);
+    }
+    return true;
+}
+
+TEST(FlatHashMap, CollisionsAndTombstones) {
+    // 全部键冲突：填满首组后溢出到后续组，删除首组元素产生墓碑
+    FlatHashMap<uint64_t, uint64_t, CollidingHash> map;
+    constexpr uint64_t kCount = 200;
+    for (uint64_t i = 0; i < kCount; ++i) {
+        EXPECT_TRUE(map.try_emplace(i, i).second);
+    }
+    for (uint64_t i = 0; i < kCount; i += 3) {
+        EXPECT_EQ(map.erase(i), 1u);
+    }
+    for (uint64_t i = 0; i < kCount; ++i) {
+        EXPECT_EQ(map.contains(i), i % 3 != 0);
+    }
+
+    // 反复插删不会无限增长：墓碑被复用或同容量重哈希清除
+    const std::size_t capacity = map.capacity();
+    for (uint64_t round = 0; round < 50; ++round) {
+        for (uint64_t i = 0; i < kCount; i += 3) {
+            EXPECT_TRUE(map.try_emplace(i, round).second);
+        }
+        for (uint64_t i = 0; i < kCount; i += 3) {
+            EXPECT_EQ(map.erase(i), 1u);
+        }
+    }
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_EQ(map.size(), static_cast<std::size_t>(kCount - (kCount + 2) / 3));
+    return true;
+}
+
+TEST(FlatHashMap, HeterogeneousStringLookup) {
+    FlatHashMap<std::string, int> map;
+    map.try_emplace("AAPL", 1);
+    map.try_emplace(std::string("MSFT"), 2);
+    map.try_emplace(std::string_view("GOOG"), 3);
+
+    const std::string_view msft = "MSFT";
+    EXPECT_EQ(map.find(msft)->second, 2);
+    EXPECT_EQ(*map.get("GOOG"), 3);
+    EXPECT_TRUE(!map.contains(std::string_view("TSLA")));
+
+    // 编译期字符串：哈希在编译期算好，运行期只剩探测与比较
+    constexpr auto kAapl = utils::CompileTimeString<4>("AAPL");
+    constexpr std::size_t kAaplHash = kAapl.hash();
+    CHECK_COMPILE_TIME(kAaplHash == fnv1a("AAPL"));
+    EXPECT_EQ(map.find(kAapl)->second, 1);
+    EXPECT_EQ(map.find(kAapl, kAaplHash)->second, 1);
+    EXPECT_EQ(map.find(std::string_view("AAPL"), StringHash{}("AAPL"))->second, 1);
+
+    EXPECT_EQ(map.erase(std::string_view("AAPL")), 1u);
+    EXPECT_TRUE(map.find(kAapl) == map.end());
+    return true;
+}
+
+TEST(FlatHashMap, FixedCapacityNeverRehashes) {
+    FixedFlatHashMap<uint64_t, uint64_t> map(100);
+    const std::size_t capacity = map.capacity();
+    const std::size_t limit = map.growth_left();
+    EXPECT_GT(limit, 99u);
+
+    for (uint64_t i = 0; i < limit; ++i) {
+        EXPECT_TRUE(map.try_emplace(i, i).second);
+    }
+    EXPECT_EQ(map.growth_left(), 0u);
+
+    // 已满：插入新键失败，已有键仍可查到
+    auto [it, inserted] = map.try_emplace(limit, 0);
+    EXPECT_TRUE(!inserted);
+    EXPECT_TRUE(it == map.end());
+    EXPECT_TRUE(map.contains(0));
+
+    // 删除后腾出的位置（墓碑或空位）可复用
+    for (uint64_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(map.erase(i), 1u);
+    }
+    for (uint64_t i = 0; i < 10; ++i) {
+        EXPECT_TRUE(map.try_emplace(limit + i, i).second);
+    }
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_EQ(map.size(), limit);
+    return true;
+}
+
+TEST(FlatHashMap, DestroysValues) {
+    Tracked::live_ = 0;
+    {
+        FlatHashMap<uint64_t, Tracked> map;
+        for (uint64_t i = 0; i < 1000; ++i) {
+            map.try_emplace(i, static_cast<int>(i));
+        }
+        EXPECT_EQ(Tracked::live_, 1000);
+        map.erase(5);
+        EXPECT_EQ(Tracked::live_, 999);
+
+        FlatHashMap<uint64_t, Tracked> moved(std::move(map));
+        EXPECT_EQ(moved.find(7)->second.value_, 7);
+        EXPECT_TRUE(map.empty());
+
+        moved.clear();
+        EXPECT_EQ(Tracked::live_, 0);
+        moved.try_emplace(1, 1);
+    }
+    EXPECT_EQ(Tracked::live_, 0);
+    return true;
+}
+
+TEST(FlatHashMap, ThrowingConstructorLeavesTableIntact) {
+    ThrowingValue::live_ = 0;
+    {
+        FlatHashMap<std::string, ThrowingValue> map;
+        // 逐个插入直到扩容边界，每一步都让一次插入抛异常
+        for (int i = 0; i < 200; ++i) {
+            EXPECT_TRUE(throws_on_emplace(map, "bad" + std::to_string(i), -1));
+            EXPECT_EQ(map.size(), static_cast<std::size_t>(i));
+            EXPECT_TRUE(map.find("bad" + std::to_string(i)) == map.end());
+            EXPECT_TRUE(map.try_emplace("key" + std::to_string(i), i).second);
+        }
+        EXPECT_EQ(ThrowingValue::live_, 200);
+
+        std::size_t visited = 0;
+        for (const auto& [key, value] : map) {
+            EXPECT_EQ(key, "key" + std::to_string(value.value_));
+            ++visited;
+        }
+        EXPECT_EQ(visited, std::size_t{200});
+
+        // 抛异常的键随后可以正常插入
+        EXPECT_TRUE(map.try_emplace(std::string("bad0"), 0).second);
+        EXPECT_EQ(map.erase(std::string_view("bad0")), 1u);
+        EXPECT_EQ(map.size(), std::size_t{200});
+    }
+    EXPECT_EQ(ThrowingValue::live_, 0);
+
+    FixedFlatHashMap<uint64_t, ThrowingValue> fixed(64);
+    EXPECT_TRUE(throws_on_emplace(fixed, 1, -1));
+    EXPECT_TRUE(fixed.empty());
+    EXPECT_EQ(fixed.growth_left(), fixed.capacity() - fixed.capacity() / 8);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
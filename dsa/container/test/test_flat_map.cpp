@@ -0,0 +1,227 @@
+/**
+ * @file test_flat_map.cpp
+ * @brief FlatMap（Sorted / Eytzinger 布局）单元测试
+ * @version 1.0.0
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/flat_map.h"
+
+using namespace container;
+
+namespace {
+
+/// 随机无序输入（含重复键）与对照 std::map（重复键保留先出现者）
+template <typename K>
+std::vector<std::pair<K, uint64_t>> random_entries(std::size_t n, std::map<K, uint64_t>& reference) {
+    std::mt19937_64 rng(n);
+    std::vector<std::pair<K, uint64_t>> entries;
+    for (std::size_t i = 0; i < n; ++i) {
+        const K key = static_cast<K>(rng() % (n * 4));
+        entries.emplace_back(key, i);
+        reference.try_emplace(key, i);
+    }
+    return entries;
+}
+
+/// lower_bound 与 find 在全部键及其相邻值上与 std::map 一致
+template <typename Map, typename K>
+bool matches_reference(const Map& map, const std::map<K, uint64_t>& reference) {
+    if (map.size() != reference.size()) {
+        return false;
+    }
+    auto expected = reference.begin();
+    for (auto [key, value] : map) {
+        if (expected == reference.end() || key != expected->first || value != expected->second) {
+            return false;
+        }
+        ++expected;
+    }
+    for (const auto& [key, value] : reference) {
+        for (K probe : {static_cast<K>(key - 1), key, static_cast<K>(key + 1)}) {
+            auto it = map.lower_bound(probe);
+            auto ref = reference.lower_bound(probe);
+            if ((it == map.end()) != (ref == reference.end())) {
+                return false;
+            }
+            if (ref != reference.end() && it.key() != ref->first) {
+                return false;
+            }
+            const uint64_t* found = map.find(probe);
+            if ((found != nullptr) != reference.contains(probe) ||
+                (found != nullptr && *found != reference.at(probe))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename K, FlatMapLayout Layout>
+bool check_sizes() {
+    for (std::size_t n : {0u, 1u, 2u, 7u, 15u, 16u, 17u, 33u, 100u, 1000u, 20000u}) {
+        std::map<K, uint64_t> reference;
+        FlatMap<K, uint64_t, Layout> map(random_entries<K>(n, reference));
+        if (!matches_reference(map, reference)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// 值为负时构造抛异常；throw_on_assign_ 置位时移动赋值抛异常（erase 移动后续元素时触发）
+struct ThrowingValue {
+    static inline bool throw_on_assign_ = false;
+    int value_{0};
+    ThrowingValue() = default;
+    explicit ThrowingValue(int v) : value_(v) {
+        if (v < 0) {
+            throw std::runtime_error("ThrowingValue");
+        }
+    }
+    ThrowingValue(ThrowingValue&&) = default;
+    ThrowingValue& operator=(ThrowingValue&& other) {
+        if (throw_on_assign_) {
+            throw std::runtime_error("ThrowingValue");
+        }
+        value_ = other.value_;
+        return *this;
+    }
+};
+
+/// 每个键 k 对应值 k * 10
+template <typename Map>
+bool keys_match_values(const Map& map, std::size_t expected_size) {
+    if (map.size() != expected_size) {
+        return false;
+    }
+    for (auto [key, value] : map) {
+        if (value.value_ != key * 10 || map.find(key)->value_ != key * 10) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST(FlatMap, SortedMatchesStdMap) {
+    EXPECT_TRUE((check_sizes<int64_t, FlatMapLayout::Sorted>()));
+    EXPECT_TRUE((check_sizes<uint64_t, FlatMapLayout::Sorted>()));
+    EXPECT_TRUE((check_sizes<int32_t, FlatMapLayout::Sorted>()));
+    EXPECT_TRUE((check_sizes<uint32_t, FlatMapLayout::Sorted>()));
+    EXPECT_TRUE((check_sizes<int16_t, FlatMapLayout::Sorted>()));
+    return true;
+}
+
+TEST(FlatMap, EytzingerMatchesStdMap) {
+    EXPECT_TRUE((check_sizes<int64_t, FlatMapLayout::Eytzinger>()));
+    EXPECT_TRUE((check_sizes<uint32_t, FlatMapLayout::Eytzinger>()));
+
+    using Map = FlatMap<uint64_t, uint64_t, FlatMapLayout::Eytzinger>;
+    Map map(std::vector<std::pair<uint64_t, uint64_t>>{{3, 3}, {1, 1}, {2, 2}});
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(map.key_data()) % memory_constants::kCacheLineSize, 0u);
+    return true;
+}
+
+TEST(FlatMap, UnsignedExtremes) {
+    // 无符号键跨越符号位：SIMD 比较需翻转符号位
+    constexpr uint64_t kMax = std::numeric_limits<uint64_t>::max();
+    std::vector<std::pair<uint64_t, int>> entries;
+    for (int i = 0; i < 64; ++i) {
+        entries.emplace_back(kMax - static_cast<uint64_t>(i) * 3, i);
+        entries.emplace_back(static_cast<uint64_t>(i) * 3, -i);
+    }
+    FlatMap<uint64_t, int> map(entries);
+    EXPECT_EQ(*map.find(kMax), 0);
+    EXPECT_EQ(*map.find(kMax - 63 * 3), 63);
+    EXPECT_EQ(map.lower_bound(uint64_t{1} << 63).key(), kMax - 63 * 3);
+    EXPECT_TRUE(map.find(kMax - 1) == nullptr);
+    EXPECT_TRUE(map.lower_bound(kMax - 1).key() == kMax);
+    return true;
+}
+
+TEST(FlatMap, BulkBuildKeepsFirstDuplicate) {
+    FlatMap<int, std::string> map(std::vector<std::pair<int, std::string>>{
+        {5, "a"}, {1, "b"}, {5, "c"}, {3, "d"}, {1, "e"}});
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(*map.find(5), std::string("a"));
+    EXPECT_EQ(*map.find(1), std::string("b"));
+    return true;
+}
+
+TEST(FlatMap, InsertErase) {
+    FlatMap<int64_t, int> map;
+    std::map<int64_t, int> reference;
+    std::mt19937_64 rng(1);
+    for (int i = 0; i < 5000; ++i) {
+        const int64_t key = static_cast<int64_t>(rng() % 2000) - 1000;
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(map.erase(key), reference.erase(key));
+        } else {
+            EXPECT_EQ(map.try_emplace(key, i).second, reference.try_emplace(key, i).second);
+        }
+    }
+    EXPECT_EQ(map.size(), reference.size());
+    auto it = reference.begin();
+    for (auto [key, value] : map) {
+        EXPECT_EQ(key, it->first);
+        EXPECT_EQ(value, it->second);
+        ++it;
+    }
+
+    map[7] = 70;
+    map.insert_or_assign(7, 71);
+    EXPECT_EQ(*map.find(7), 71);
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.begin() == map.end());
+    return true;
+}
+
+TEST(FlatMap, ThrowingValueKeepsArraysAligned) {
+    FlatMap<int, ThrowingValue> map;
+    for (int key = 0; key < 100; key += 2) {
+        map.try_emplace(key, key * 10);
+    }
+
+    // 插入中间位置时值构造抛异常：键不应留在键数组中
+    for (int key = 1; key < 100; key += 10) {
+        bool thrown = false;
+        try {
+            map.try_emplace(key, -1);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        EXPECT_TRUE(thrown);
+        EXPECT_TRUE(!map.contains(key));
+    }
+    EXPECT_TRUE(keys_match_values(map, 50));
+
+    // 删除时移动后续值抛异常：两个数组都不变
+    ThrowingValue::throw_on_assign_ = true;
+    bool thrown = false;
+    try {
+        map.erase(40);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    ThrowingValue::throw_on_assign_ = false;
+    EXPECT_TRUE(thrown);
+    EXPECT_TRUE(keys_match_values(map, 50));
+
+    EXPECT_EQ(map.erase(40), 1u);
+    EXPECT_TRUE(keys_match_values(map, 49));
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
@@ -0,0 +1,133 @@
+/**
+ * @file test_inplace_vector.cpp
+ * @brief InplaceVector 单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/inplace_vector.h"
+
+using namespace container;
+
+namespace {
+
+template <typename T, std::size_t N, typename Make>
+bool matches_std_vector(uint64_t seed, Make&& make) {
+    InplaceVector<T, N> inplace;
+    std::vector<T> reference;
+    std::mt19937_64 rng(seed);
+    for (int i = 0; i < 20000; ++i) {
+        const auto op = rng() % 100;
+        const int x = static_cast<int>(rng() % 1000);
+        if (op < 35 || reference.empty()) {
+            if (inplace.try_push_back(make(x)) != nullptr) {
+                reference.push_back(make(x));
+            } else if (reference.size() != N) {
+                return false;
+            }
+        } else if (op < 50) {
+            if (!inplace.full()) {
+                const std::size_t at = rng() % (reference.size() + 1);
+                inplace.insert(inplace.begin() + at, make(x));
+                reference.insert(reference.begin() + at, make(x));
+            }
+        } else if (op < 65) {
+            inplace.pop_back();
+            reference.pop_back();
+        } else if (op < 75) {
+            const std::size_t first = rng() % reference.size();
+            const std::size_t last = first + rng() % (reference.size() - first + 1);
+            inplace.erase(inplace.begin() + first, inplace.begin() + last);
+            reference.erase(reference.begin() + first, reference.begin() + last);
+        } else if (op < 80) {
+            const std::size_t count = rng() % (N + 1);
+            inplace.resize(count, make(x));
+            reference.resize(count, make(x));
+        } else if (op < 90) {
+            InplaceVector<T, N> copy(inplace);
+            InplaceVector<T, N> moved(std::move(copy));
+            inplace = moved;
+        } else if (op < 92) {
+            inplace.clear();
+            reference.clear();
+        }
+        if (!std::equal(inplace.begin(), inplace.end(), reference.begin(), reference.end())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+struct Point {
+    int32_t x_;
+    int32_t y_;
+    bool operator==(const Point&) const = default;
+};
+
+}  // namespace
+
+TEST(InplaceVector, LayoutAndTriviality) {
+    static_assert(std::is_trivially_copyable_v<InplaceVector<Point, 8>>);
+    static_assert(std::is_trivially_destructible_v<InplaceVector<uint64_t, 8>>);
+    static_assert(!std::is_trivially_copyable_v<InplaceVector<std::string, 8>>);
+    EXPECT_EQ((sizeof(InplaceVector<uint8_t, 14>)), 16u);          // uint16_t 大小字段
+    EXPECT_EQ((sizeof(InplaceVector<uint32_t, 70000>)), 280004u);  // uint32_t 大小字段
+    EXPECT_EQ((sizeof(InplaceVector<uint64_t, 4>)), 40u);
+    EXPECT_EQ((InplaceVector<Point, 8>::capacity()), 8u);
+
+    InplaceVector<Point, 8> points{{1, 2}, {3, 4}};
+    InplaceVector<Point, 8> copy;
+    std::memcpy(static_cast<void*>(&copy), &points, sizeof(points));  // 平凡可复制：整体按字节复制
+    EXPECT_TRUE(copy == points);
+    EXPECT_EQ(copy.back().y_, 4);
+    return true;
+}
+
+TEST(InplaceVector, FullCapacityBehaviour) {
+    InplaceVector<std::string, 3> v;
+    v.push_back("a");
+    v.emplace_back(2, 'b');
+    EXPECT_TRUE(v.try_emplace_back("c") != nullptr);
+    EXPECT_TRUE(v.full());
+    EXPECT_TRUE(v.try_push_back("d") == nullptr);
+
+    bool threw = false;
+    try {
+        v.push_back("d");
+    } catch (const std::bad_alloc&) {
+        threw = true;
+    }
+    EXPECT_TRUE(threw);
+    threw = false;
+    try {
+        v.resize(4);
+    } catch (const std::bad_alloc&) {
+        threw = true;
+    }
+    EXPECT_TRUE(threw);
+    EXPECT_EQ(v.size(), 3u);
+    EXPECT_EQ(v[1], std::string("bb"));
+
+    v.erase(v.begin());
+    v.unchecked_push_back("e");
+    EXPECT_TRUE((v == InplaceVector<std::string, 3>{"bb", "c", "e"}));
+    return true;
+}
+
+TEST(InplaceVector, RandomOperationsMatchStdVector) {
+    EXPECT_TRUE((matches_std_vector<uint32_t, 16>(1, [](int x) { return uint32_t(x); })));
+    const auto make_string = [](int x) { return std::string(30, static_cast<char>('a' + x % 26)); };
+    EXPECT_TRUE((matches_std_vector<std::string, 7>(2, make_string)));
+    EXPECT_TRUE((matches_std_vector<std::vector<int>, 5>(3, [](int x) { return std::vector<int>(3, x); })));
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
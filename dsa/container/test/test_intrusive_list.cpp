@@ -0,0 +1,214 @@
+/**
+ * @file test_intrusive_list.cpp
+ * @brief IntrusiveList / IntrusiveStack / IntrusiveQueue 单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/intrusive_list.h"
+
+using namespace container;
+
+namespace {
+
+struct Order {
+    uint64_t id_{0};
+    ListHook<true> hook_;  // 测试中开启 safe-link
+    SListHook<true> next_;
+};
+
+using OrderList = IntrusiveList<&Order::hook_>;
+using OrderStack = IntrusiveStack<&Order::next_>;
+using OrderQueue = IntrusiveQueue<&Order::next_>;
+
+template <typename Container>
+std::vector<uint64_t> ids(const Container& container) {
+    std::vector<uint64_t> result;
+    for (const Order& order : container) {
+        result.push_back(order.id_);
+    }
+    return result;
+}
+
+std::vector<Order> make_orders(std::size_t n) {
+    std::vector<Order> orders(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        orders[i].id_ = i;
+    }
+    return orders;
+}
+
+}  // namespace
+
+TEST(IntrusiveList, PushPopAndLinkedState) {
+    auto orders = make_orders(4);
+    OrderList list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_TRUE(list.front() == nullptr);
+    EXPECT_TRUE(list.pop_front() == nullptr);
+
+    list.push_back(orders[1]);
+    list.push_back(orders[2]);
+    list.push_front(orders[0]);
+    list.insert(list.iterator_to(orders[2]), orders[3]);
+    EXPECT_EQ(list.size(), 4u);
+    EXPECT_TRUE((ids(list) == std::vector<uint64_t>{0, 1, 3, 2}));
+    EXPECT_TRUE(orders[3].hook_.linked());
+
+    list.erase(orders[3]);
+    EXPECT_FALSE(orders[3].hook_.linked());
+    EXPECT_EQ(list.front()->id_, 0u);
+    EXPECT_EQ(list.back()->id_, 2u);
+    EXPECT_EQ(list.pop_back()->id_, 2u);
+    EXPECT_EQ(list.pop_front()->id_, 0u);
+    EXPECT_FALSE(orders[0].hook_.linked());
+    EXPECT_EQ(list.size(), 1u);
+
+    // 复制宿主对象不复制链接状态
+    Order copy = orders[1];
+    EXPECT_FALSE(copy.hook_.linked());
+    list.clear();
+    EXPECT_FALSE(orders[1].hook_.linked());
+    EXPECT_TRUE(list.begin() == list.end());
+    return true;
+}
+
+TEST(IntrusiveList, RandomOperationsMatchStdList) {
+    constexpr std::size_t kCount = 256;
+    auto orders = make_orders(kCount);
+    OrderList list;
+    std::list<uint64_t> reference;
+    std::mt19937_64 rng(1);
+    for (int i = 0; i < 100000; ++i) {
+        Order& order = orders[rng() % kCount];
+        const auto op = rng() % 4;
+        if (!order.hook_.linked()) {
+            if (op % 2 == 0) {
+                list.push_back(order);
+                reference.push_back(order.id_);
+            } else {
+                list.push_front(order);
+                reference.push_front(order.id_);
+            }
+        } else if (op == 0) {
+            list.erase(order);
+            reference.remove(order.id_);
+        } else if (op == 1) {
+            list.move_to_front(order);
+            reference.remove(order.id_);
+            reference.push_front(order.id_);
+        } else if (op == 2) {
+            list.move_to_back(order);
+            reference.remove(order.id_);
+            reference.push_back(order.id_);
+        } else {
+            auto next = list.erase(list.iterator_to(order));
+            list.insert(next, order);
+        }
+    }
+    EXPECT_EQ(list.size(), reference.size());
+    EXPECT_TRUE((ids(list) == std::vector<uint64_t>(reference.begin(), reference.end())));
+
+    // 反向遍历
+    std::vector<uint64_t> reversed;
+    for (auto it = list.end(); it != list.begin();) {
+        reversed.push_back((--it)->id_);
+    }
+    EXPECT_TRUE((reversed == std::vector<uint64_t>(reference.rbegin(), reference.rend())));
+    return true;
+}
+
+TEST(IntrusiveList, SpliceAndMove) {
+    auto orders = make_orders(6);
+    OrderList a;
+    OrderList b;
+    for (std::size_t i = 0; i < 3; ++i) {
+        a.push_back(orders[i]);
+        b.push_back(orders[i + 3]);
+    }
+    a.splice(std::next(a.begin()), b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(a.size(), 6u);
+    EXPECT_TRUE((ids(a) == std::vector<uint64_t>{0, 3, 4, 5, 1, 2}));
+
+    OrderList moved(std::move(a));
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(moved.size(), 6u);
+    b = std::move(moved);
+    EXPECT_TRUE((ids(b) == std::vector<uint64_t>{0, 3, 4, 5, 1, 2}));
+
+    // 析构摘除全部节点
+    {
+        OrderList scoped(std::move(b));
+    }
+    for (const Order& order : orders) {
+        EXPECT_FALSE(order.hook_.linked());
+    }
+    return true;
+}
+
+TEST(IntrusiveStack, LifoOrder) {
+    auto orders = make_orders(5);
+    OrderStack stack;
+    EXPECT_TRUE(stack.pop() == nullptr);
+    for (Order& order : orders) {
+        stack.push(order);
+    }
+    EXPECT_EQ(stack.size(), 5u);
+    EXPECT_EQ(stack.top()->id_, 4u);
+    EXPECT_TRUE((ids(stack) == std::vector<uint64_t>{4, 3, 2, 1, 0}));
+    EXPECT_TRUE(orders[0].next_.linked());  // 栈底节点同样为已链接
+
+    EXPECT_EQ(stack.pop()->id_, 4u);
+    EXPECT_FALSE(orders[4].next_.linked());
+    OrderStack other(std::move(stack));
+    EXPECT_TRUE(stack.empty());
+    EXPECT_EQ(other.size(), 4u);
+    other.clear();
+    for (const Order& order : orders) {
+        EXPECT_FALSE(order.next_.linked());
+    }
+    return true;
+}
+
+TEST(IntrusiveQueue, FifoOrderAndAppend) {
+    auto orders = make_orders(6);
+    OrderQueue queue;
+    EXPECT_TRUE(queue.pop_front() == nullptr);
+    queue.push_back(orders[1]);
+    queue.push_back(orders[2]);
+    queue.push_front(orders[0]);
+    EXPECT_EQ(queue.front()->id_, 0u);
+    EXPECT_EQ(queue.back()->id_, 2u);
+
+    OrderQueue other;
+    other.push_back(orders[3]);
+    other.push_back(orders[4]);
+    queue.append(other);
+    EXPECT_TRUE(other.empty());
+    queue.push_back(orders[5]);
+    EXPECT_EQ(queue.size(), 6u);
+    EXPECT_TRUE((ids(queue) == std::vector<uint64_t>{0, 1, 2, 3, 4, 5}));
+
+    for (uint64_t expected = 0; expected < 6; ++expected) {
+        Order* order = queue.pop_front();
+        EXPECT_EQ(order->id_, expected);
+        EXPECT_FALSE(order->next_.linked());
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_TRUE(queue.back() == nullptr);
+
+    // 弹空后可再次使用
+    queue.push_back(orders[2]);
+    EXPECT_EQ(queue.front(), queue.back());
+    queue.clear();
+    EXPECT_FALSE(orders[2].next_.linked());
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
@@ -0,0 +1,168 @@
+/**
+ * @file test_intrusive_rbtree.cpp
+ * @brief IntrusiveRbTree 单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/intrusive_rbtree.h"
+
+using namespace container;
+
+namespace {
+
+struct Timer {
+    RbHook<true> hook_;
+    uint64_t deadline_{0};
+    uint64_t id_{0};
+};
+
+/// 按截止时间比较；支持与 uint64_t 的异构比较
+struct ByDeadline {
+    bool operator()(const Timer& a, const Timer& b) const noexcept { return a.deadline_ < b.deadline_; }
+    bool operator()(const Timer& a, uint64_t b) const noexcept { return a.deadline_ < b; }
+    bool operator()(uint64_t a, const Timer& b) const noexcept { return a < b.deadline_; }
+};
+
+using TimerTree = IntrusiveRbTree<&Timer::hook_, ByDeadline>;
+using Reference = std::multiset<std::pair<uint64_t, uint64_t>>;
+
+/// 中序与 std::multiset<(deadline, id)> 一致（相等截止时间按插入顺序，id 随插入递增）
+bool matches_reference(const TimerTree& tree, const Reference& reference) {
+    if (tree.size() != reference.size() || tree.verify() < 0) {
+        return false;
+    }
+    auto expected = reference.begin();
+    for (const Timer& timer : tree) {
+        if (expected == reference.end() || timer.deadline_ != expected->first ||
+            timer.id_ != expected->second) {
+            return false;
+        }
+        ++expected;
+    }
+    return expected == reference.end();
+}
+
+}  // namespace
+
+TEST(IntrusiveRbTree, HookLayout) {
+    EXPECT_EQ(sizeof(RbHook<>), 3 * sizeof(void*));
+    Timer timer;
+    EXPECT_FALSE(timer.hook_.linked());
+    TimerTree tree;
+    EXPECT_TRUE(tree.front() == nullptr);
+    EXPECT_TRUE(tree.pop_front() == nullptr);
+    EXPECT_EQ(tree.verify(), 1);
+
+    tree.insert(timer);
+    EXPECT_TRUE(timer.hook_.linked());  // 单节点为黑色根
+    EXPECT_EQ(tree.front(), &timer);
+    tree.erase(timer);
+    EXPECT_FALSE(timer.hook_.linked());
+    return true;
+}
+
+TEST(IntrusiveRbTree, RandomInsertEraseMatchesMultiset) {
+    constexpr std::size_t kCount = 2000;
+    std::vector<Timer> timers(kCount);
+    TimerTree tree;
+    Reference reference;
+    std::mt19937_64 rng(3);
+    uint64_t next_id = 0;
+    for (int round = 0; round < 6; ++round) {
+        for (int i = 0; i < 20000; ++i) {
+            Timer& timer = timers[rng() % kCount];
+            const bool erase = rng() % 100 < (round % 2 == 0 ? 30u : 70u);
+            if (timer.hook_.linked()) {
+                if (erase) {
+                    reference.erase(reference.find({timer.deadline_, timer.id_}));
+                    tree.erase(timer);
+                }
+            } else if (!erase) {
+                timer.deadline_ = rng() % 500;  // 大量相等键
+                timer.id_ = next_id++;
+                tree.insert(timer);
+                reference.emplace(timer.deadline_, timer.id_);
+            }
+        }
+        EXPECT_TRUE(matches_reference(tree, reference));
+        if (!reference.empty()) {
+            EXPECT_EQ(tree.front()->id_, reference.begin()->second);
+            EXPECT_EQ(tree.back()->id_, std::prev(reference.end())->second);
+        }
+    }
+
+    // 按序弹出
+    while (Timer* timer = tree.pop_front()) {
+        EXPECT_EQ(timer->id_, reference.begin()->second);
+        EXPECT_FALSE(timer->hook_.linked());
+        reference.erase(reference.begin());
+    }
+    EXPECT_TRUE(reference.empty());
+    EXPECT_EQ(tree.verify(), 1);
+    return true;
+}
+
+TEST(IntrusiveRbTree, LowerBoundAndFind) {
+    std::vector<Timer> timers(100);
+    TimerTree tree;
+    for (uint64_t i = 0; i < timers.size(); ++i) {
+        timers[i].deadline_ = (i / 2) * 10;  // 每个截止时间两个
+        timers[i].id_ = i;
+        tree.insert(timers[i]);
+    }
+    EXPECT_EQ(tree.lower_bound(uint64_t{25})->deadline_, 30u);
+    EXPECT_EQ(tree.lower_bound(uint64_t{30})->id_, 6u);
+    EXPECT_TRUE(tree.lower_bound(uint64_t{10000}) == tree.end());
+    EXPECT_EQ(tree.find(uint64_t{40})->id_, 8u);
+    EXPECT_TRUE(tree.find(uint64_t{41}) == nullptr);
+
+    // 迭代器摘除返回后继，反向遍历
+    auto it = tree.erase(tree.iterator_to(timers[6]));
+    EXPECT_EQ(it->id_, 7u);
+    EXPECT_EQ(tree.size(), 99u);
+    uint64_t count = 0;
+    uint64_t last = ~uint64_t{0};
+    for (auto rit = tree.end(); rit != tree.begin();) {
+        --rit;
+        EXPECT_TRUE(rit->deadline_ <= last);
+        last = rit->deadline_;
+        ++count;
+    }
+    EXPECT_EQ(count, 99u);
+    return true;
+}
+
+TEST(IntrusiveRbTree, ClearAndMove) {
+    std::vector<Timer> timers(1000);
+    TimerTree tree;
+    for (uint64_t i = 0; i < timers.size(); ++i) {
+        timers[i].deadline_ = i * 7919 % 1000;
+        tree.insert(timers[i]);
+    }
+    TimerTree moved(std::move(tree));
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(moved.size(), 1000u);
+    EXPECT_TRUE(moved.verify() > 0);
+    EXPECT_EQ(moved.front()->deadline_, 0u);
+
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    for (const Timer& timer : timers) {
+        EXPECT_FALSE(timer.hook_.linked());
+    }
+    tree = std::move(moved);
+    tree.insert(timers[0]);
+    EXPECT_EQ(tree.size(), 1u);
+    tree.clear();
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
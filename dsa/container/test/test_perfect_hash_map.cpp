@@ -0,0 +1,140 @@
+/**
+ * @file test_perfect_hash_map.cpp
+ * @brief PerfectHashMap 与 hash_bytes 单元测试
+ * @version 1.0.0
+ */
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "../../test/test.h"
+#include "../detail/perfect_hash_map.h"
+
+using namespace container;
+using utils::operator""_cs;
+
+namespace {
+
+enum class Route : uint8_t { None, Session, Order, MarketData };
+
+constexpr auto kRoutes = make_perfect_hash_map(
+    std::pair{"Logon"_cs, Route::Session}, std::pair{"Logout"_cs, Route::Session},
+    std::pair{"Heartbeat"_cs, Route::Session}, std::pair{"NewOrderSingle"_cs, Route::Order},
+    std::pair{"OrderCancelRequest"_cs, Route::Order}, std::pair{"OrderStatusRequest"_cs, Route::Order},
+    std::pair{"MarketDataSnapshotFullRefresh"_cs, Route::MarketData},
+    std::pair{"MarketDataIncrementalRefresh"_cs, Route::MarketData});
+
+/// 200 个形如 "K<i>" 的键：检验较大键集也能在编译期找到种子
+constexpr std::size_t kManyKeys = 200;
+using ManyKey = utils::CompileTimeString<8>;
+
+consteval auto many_entries() {
+    std::array<std::pair<ManyKey, uint32_t>, kManyKeys> entries{};
+    for (std::size_t i = 0; i < kManyKeys; ++i) {
+        std::array<char, 8> buf{'K'};
+        std::size_t len = 1;
+        char digits[4]{};
+        std::size_t n = 0;
+        for (std::size_t v = i; n == 0 || v > 0; v /= 10) {
+            digits[n++] = static_cast<char>('0' + v % 10);
+        }
+        while (n > 0) {
+            buf[len++] = digits[--n];
+        }
+        entries[i] = {ManyKey(std::string_view(buf.data(), len)), static_cast<uint32_t>(i)};
+    }
+    return entries;
+}
+
+constexpr auto kMany = make_perfect_hash_map(many_entries());
+
+}  // namespace
+
+TEST(HashBytes, ConstantAndRuntimeAgree) {
+    // 覆盖 0 / 1~3 / 4~7 / 8~16 / 多块各分支
+    static constexpr std::string_view kText = "the quick brown fox jumps over the lazy dog";
+    constexpr auto kExpected = [] {
+        std::array<uint64_t, kText.size() + 1> hashes{};
+        for (std::size_t n = 0; n <= kText.size(); ++n) {
+            hashes[n] = hash_bytes(kText.substr(0, n), 42);
+        }
+        return hashes;
+    }();
+
+    const std::string text(kText);
+    for (std::size_t n = 0; n <= text.size(); ++n) {
+        EXPECT_EQ(hash_bytes(std::string_view(text).substr(0, n), 42), kExpected[n]);
+    }
+    EXPECT_TRUE(hash_bytes("abc", 1) != hash_bytes("abc", 2));
+    EXPECT_TRUE(hash_bytes("abc", 1) != hash_bytes("abd", 1));
+    return true;
+}
+
+TEST(PerfectHashMap, CompileTimeLookup) {
+    CHECK_COMPILE_TIME(kRoutes.size() == 8);
+    CHECK_COMPILE_TIME(*kRoutes.find("Logon") == Route::Session);
+    CHECK_COMPILE_TIME(*kRoutes.find("NewOrderSingle") == Route::Order);
+    CHECK_COMPILE_TIME(*kRoutes.find("MarketDataIncrementalRefresh") == Route::MarketData);
+    CHECK_COMPILE_TIME(kRoutes.find("Unknown") == nullptr);
+    CHECK_COMPILE_TIME(kRoutes.value_or("Log", Route::None) == Route::None);
+    return true;
+}
+
+TEST(PerfectHashMap, RuntimeLookup) {
+    // 运行期字符串（不在常量中）
+    const std::string logout = std::string("Log") + "out";
+    const std::string status = "OrderStatusRequest";
+    EXPECT_TRUE(kRoutes.find(logout) != nullptr);
+    EXPECT_TRUE(*kRoutes.find(logout) == Route::Session);
+    EXPECT_TRUE(kRoutes.value_or(status, Route::None) == Route::Order);
+
+    // 前缀、同长度不同内容、空串都未命中
+    EXPECT_TRUE(!kRoutes.contains(std::string("Logo")));
+    EXPECT_TRUE(!kRoutes.contains(std::string("OrderStatusRequesT")));
+    EXPECT_TRUE(!kRoutes.contains(std::string()));
+
+    std::size_t used = 0;
+    for (const auto& slot : kRoutes.slots()) {
+        if (slot.length_ != decltype(kRoutes)::kEmptySlot) {
+            EXPECT_TRUE(kRoutes.find(std::string_view(slot.key_.data(), slot.length_)) == &slot.value_);
+            ++used;
+        }
+    }
+    EXPECT_EQ(used, kRoutes.size());
+    return true;
+}
+
+TEST(PerfectHashMap, ManyKeys) {
+    CHECK_COMPILE_TIME(decltype(kMany)::kSlots >= kManyKeys);
+    for (uint32_t i = 0; i < kManyKeys; ++i) {
+        const std::string key = "K" + std::to_string(i);
+        const uint32_t* value = kMany.find(key);
+        EXPECT_TRUE(value != nullptr);
+        EXPECT_EQ(*value, i);
+    }
+    for (uint32_t i = kManyKeys; i < 2 * kManyKeys; ++i) {
+        EXPECT_TRUE(!kMany.contains("K" + std::to_string(i)));
+    }
+    return true;
+}
+
+TEST(PerfectHashMap, EdgeKeys) {
+    // 空串键与互为前缀的键
+    constexpr auto kEdge = make_perfect_hash_map(std::pair{utils::CompileTimeString<1>(""), 0},
+                                                 std::pair{"A"_cs, 1}, std::pair{"AB"_cs, 2},
+                                                 std::pair{"ABC"_cs, 3});
+    CHECK_COMPILE_TIME(*kEdge.find("") == 0);
+    CHECK_COMPILE_TIME(*kEdge.find("AB") == 2);
+    EXPECT_EQ(kEdge.value_or(std::string("ABC"), -1), 3);
+    EXPECT_EQ(kEdge.value_or(std::string("ABCD"), -1), -1);
+
+    constexpr auto kSingle = make_perfect_hash_map(std::pair{"only"_cs, 7});
+    CHECK_COMPILE_TIME(kSingle.capacity() == 1);
+    EXPECT_EQ(kSingle.value_or(std::string("only"), 0), 7);
+    EXPECT_EQ(kSingle.value_or(std::string("other"), 0), 0);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
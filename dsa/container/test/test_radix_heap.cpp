@@ -0,0 +1,101 @@
+/**
+ * @file test_radix_heap.cpp
+ * @brief RadixHeap 单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/radix_heap.h"
+
+using namespace container;
+
+TEST(RadixHeap, EntryWithoutValueIsKeySized) {
+    EXPECT_EQ(sizeof(RadixHeap<>::Entry), sizeof(uint64_t));
+    RadixHeap<> heap;
+    EXPECT_TRUE(heap.empty());
+    heap.push(3);
+    heap.push(1);
+    heap.push(2);
+    EXPECT_EQ(heap.top().key_, 1u);
+    EXPECT_EQ(heap.pop().key_, 1u);
+    EXPECT_EQ(heap.pop().key_, 2u);
+    EXPECT_EQ(heap.last(), 2u);
+    EXPECT_EQ(heap.pop().key_, 3u);
+    EXPECT_TRUE(heap.empty());
+    return true;
+}
+
+TEST(RadixHeap, MonotoneOperationsMatchPriorityQueue) {
+    // 定时器模型：新键 = 当前最小键 + 随机延迟；延迟跨多个数量级
+    RadixHeap<uint32_t> heap;
+    std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> reference;
+    std::mt19937_64 rng(1);
+    uint64_t now = uint64_t{1} << 40;
+    uint32_t id = 0;
+    for (int i = 0; i < 200000; ++i) {
+        const auto op = rng() % 100;
+        if (op < 55 || reference.empty()) {
+            const uint64_t delay = rng() >> (20 + rng() % 44);
+            const uint64_t key = now + delay;
+            heap.push(key, id++);
+            reference.push(key);
+        } else {
+            const auto entry = heap.pop();
+            EXPECT_EQ(entry.key_, reference.top());
+            EXPECT_TRUE(entry.key_ >= now);
+            now = entry.key_;
+            reference.pop();
+        }
+        EXPECT_EQ(heap.size(), reference.size());
+    }
+    while (!reference.empty()) {
+        EXPECT_EQ(heap.pop().key_, reference.top());
+        reference.pop();
+    }
+    EXPECT_TRUE(heap.empty());
+    return true;
+}
+
+TEST(RadixHeap, ExtremeKeysAndValues) {
+    RadixHeap<uint64_t> heap;
+    constexpr uint64_t kMax = std::numeric_limits<uint64_t>::max();
+    heap.push(kMax, 1);
+    heap.push(0, 2);
+    heap.push(kMax, 3);
+    heap.push(uint64_t{1} << 63, 4);
+    EXPECT_EQ(heap.pop().value_, 2u);
+    EXPECT_EQ(heap.pop().value_, 4u);
+    const auto a = heap.pop();
+    const auto b = heap.pop();
+    EXPECT_EQ(a.key_, kMax);
+    EXPECT_EQ(a.value_ + b.value_, 4u);  // 相等键顺序不定
+    EXPECT_TRUE(heap.empty());
+    return true;
+}
+
+TEST(RadixHeap, LateKeysAreClampedToLast) {
+    RadixHeap<int> heap;
+    heap.push(100, 1);
+    heap.push(200, 2);
+    EXPECT_EQ(heap.pop().value_, 1);
+    heap.push(50, 3);  // 已过期：视为 last() == 100
+    const auto late = heap.pop();
+    EXPECT_EQ(late.value_, 3);
+    EXPECT_EQ(late.key_, 100u);
+    EXPECT_EQ(heap.pop().value_, 2);
+
+    heap.clear();
+    EXPECT_EQ(heap.last(), 0u);
+    heap.push(7, 4);
+    EXPECT_EQ(heap.top().value_, 4);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
@@ -0,0 +1,87 @@
+/**
+ * @file test_rank_select.cpp
+ * @brief RankSelect 单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/rank_select.h"
+
+using namespace container;
+
+namespace {
+
+/// 与逐位前缀计数对照全部 rank1 / rank0 / select1
+bool matches_naive(const DynamicBitset& bits) {
+    const RankSelect index(bits);
+    std::size_t ones = 0;
+    for (std::size_t i = 0; i < bits.size(); ++i) {
+        if (index.rank1(i) != ones || index.rank0(i) != i - ones) {
+            return false;
+        }
+        if (bits.test(i)) {
+            if (index.select1(ones) != i) {
+                return false;
+            }
+            ++ones;
+        }
+    }
+    return index.rank1(bits.size()) == ones && index.ones() == ones && index.select1(ones) == bits.size();
+}
+
+}  // namespace
+
+TEST(RankSelect, EmptyAndFullBitmaps) {
+    const RankSelect none;
+    EXPECT_EQ(none.ones(), 0u);
+    EXPECT_EQ(none.rank1(0), 0u);
+    EXPECT_EQ(none.select1(0), 0u);
+
+    for (std::size_t size : {1u, 64u, 512u, 513u, 5000u}) {
+        DynamicBitset zeros(size);
+        EXPECT_TRUE(matches_naive(zeros));
+        DynamicBitset ones(size, true);
+        EXPECT_TRUE(matches_naive(ones));
+    }
+    return true;
+}
+
+TEST(RankSelect, RandomDensitiesMatchNaive) {
+    std::mt19937_64 rng(1);
+    // 稀疏时相邻采样跨越多个块，二分范围大；稠密时一个块内有多个采样
+    for (unsigned density : {1u, 10u, 50u, 90u, 99u}) {
+        for (std::size_t size : {100u, 4096u, 70001u}) {
+            DynamicBitset bits(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                bits.set(i, rng() % 100 < density);
+            }
+            EXPECT_TRUE(matches_naive(bits));
+        }
+    }
+    return true;
+}
+
+TEST(RankSelect, ClusteredBitsWithLongGaps) {
+    // 成簇的置位之间隔着整块全 0：select 须跳过空块与块内空字
+    DynamicBitset bits(1 << 16);
+    for (std::size_t start : {3u, 700u, 20000u, 65000u}) {
+        for (std::size_t i = start; i < start + 300; i += 1 + i % 3) {
+            bits.set(i);
+        }
+    }
+    EXPECT_TRUE(matches_naive(bits));
+
+    FixedBitset<1024> fixed;
+    fixed.set(1023);
+    const RankSelect index(fixed);
+    EXPECT_EQ(index.select1(0), 1023u);
+    EXPECT_EQ(index.rank1(1023), 0u);
+    EXPECT_EQ(index.rank1(1024), 1u);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
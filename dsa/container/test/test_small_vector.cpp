@@ -0,0 +1,207 @@
+/**
+ * @file test_small_vector.cpp
+ * @brief SmallVector 单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/small_vector.h"
+
+using namespace container;
+
+namespace {
+
+/// 统计存活对象数与移动次数
+struct Tracked {
+    static inline int live = 0;
+    static inline int moves = 0;
+
+    explicit Tracked(int v = 0) : value_(v) { ++live; }
+    Tracked(const Tracked& other) : value_(other.value_) { ++live; }
+    Tracked(Tracked&& other) noexcept : value_(other.value_) {
+        ++live;
+        ++moves;
+    }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&& other) noexcept {
+        value_ = other.value_;
+        ++moves;
+        return *this;
+    }
+    ~Tracked() { --live; }
+
+    bool operator==(const Tracked& other) const { return value_ == other.value_; }
+
+    int value_;
+};
+
+/// 同样的计数，但声明为可平凡重定位：扩容按字节搬移，不调用移动构造与析构
+struct Relocatable : Tracked {
+    using Tracked::Tracked;
+};
+
+}  // namespace
+
+template <>
+struct container::is_trivially_relocatable<Relocatable> : std::true_type {};
+
+namespace {
+
+/// 随机操作与 std::vector 对照；make(int) 构造元素，same(a, b) 比较元素
+template <typename T, std::size_t N, typename Make, typename Same>
+bool matches_std_vector(uint64_t seed, Make&& make, Same&& same) {
+    SmallVector<T, N> small;
+    std::vector<T> reference;
+    std::mt19937_64 rng(seed);
+    for (int i = 0; i < 20000; ++i) {
+        const auto op = rng() % 100;
+        const int x = static_cast<int>(rng() % 1000);
+        if (op < 35 || reference.empty()) {
+            small.push_back(make(x));
+            reference.push_back(make(x));
+        } else if (op < 50) {
+            const std::size_t at = rng() % (reference.size() + 1);
+            small.insert(small.begin() + at, make(x));
+            reference.insert(reference.begin() + at, make(x));
+        } else if (op < 60) {
+            small.pop_back();
+            reference.pop_back();
+        } else if (op < 70) {
+            const std::size_t first = rng() % reference.size();
+            const std::size_t last = first + rng() % (reference.size() - first + 1);
+            small.erase(small.begin() + first, small.begin() + last);
+            reference.erase(reference.begin() + first, reference.begin() + last);
+        } else if (op < 75) {
+            const std::size_t count = rng() % (2 * N + 4);
+            small.resize(count);
+            reference.resize(count);
+        } else if (op < 80) {
+            if constexpr (std::is_copy_constructible_v<T>) {
+                const std::size_t k = rng() % reference.size();
+                small.push_back(small[k]);  // 参数引用自身元素，可能触发扩容
+                reference.push_back(reference[k]);
+                SmallVector<T, N> copy(small);
+                small = copy;
+            }
+        } else if (op < 90) {
+            SmallVector<T, N> moved(std::move(small));
+            small = SmallVector<T, N>();
+            small = std::move(moved);
+        } else if (op < 95) {
+            small.shrink_to_fit();
+        } else if (op < 97) {
+            small.clear();
+            reference.clear();
+        }
+        if (small.size() != reference.size() || small.capacity() < small.size()) {
+            return false;
+        }
+        for (std::size_t k = 0; k < reference.size(); ++k) {
+            if (!same(small[k], reference[k])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST(SmallVector, InlineUntilCapacityThenHeap) {
+    SmallVector<uint64_t, 4> v;
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 4u);
+    for (uint64_t i = 0; i < 4; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_TRUE(v.is_inline());
+    v.push_back(4);
+    EXPECT_FALSE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 8u);
+    for (uint64_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(v[i], i);
+    }
+
+    v.erase(v.begin() + 1, v.begin() + 3);
+    EXPECT_TRUE((v == SmallVector<uint64_t, 4>{0, 3, 4}));
+    v.shrink_to_fit();  // 元素数不超过 4：回到内联槽位
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_TRUE((v == SmallVector<uint64_t, 4>{0, 3, 4}));
+    v.insert(v.begin(), 9);
+    v.push_back(v[0]);  // 引用自身元素且触发扩容
+    EXPECT_TRUE((v == SmallVector<uint64_t, 4>{9, 0, 3, 4, 9}));
+    return true;
+}
+
+TEST(SmallVector, RandomOperationsMatchStdVector) {
+    const auto same = [](const auto& a, const auto& b) { return a == b; };
+    EXPECT_TRUE((matches_std_vector<uint64_t, 4>(1, [](int x) { return uint64_t(x); }, same)));
+    const auto make_string = [](int x) { return std::string(40, static_cast<char>('a' + x % 26)); };
+    EXPECT_TRUE((matches_std_vector<std::string, 3>(2, make_string, same)));
+    EXPECT_TRUE((matches_std_vector<Tracked, 8>(3, [](int x) { return Tracked(x); }, same)));
+    EXPECT_TRUE((matches_std_vector<Relocatable, 2>(4, [](int x) { return Relocatable(x); }, same)));
+    EXPECT_TRUE((matches_std_vector<std::unique_ptr<int>, 4>(
+        5, [](int x) { return std::make_unique<int>(x); },
+        [](const auto& a, const auto& b) { return (a == nullptr) == (b == nullptr) && (!a || *a == *b); })));
+    EXPECT_EQ(Tracked::live, 0);
+    return true;
+}
+
+TEST(SmallVector, RelocatableGrowthSkipsMoves) {
+    {
+        SmallVector<Tracked, 2> tracked;
+        SmallVector<Relocatable, 2> relocatable;
+        for (int i = 0; i < 100; ++i) {
+            tracked.emplace_back(i);
+            relocatable.emplace_back(i);
+        }
+        Tracked::moves = 0;
+        tracked.reserve(1000);
+        EXPECT_EQ(Tracked::moves, 100);  // 逐个移动构造
+        Tracked::moves = 0;
+        relocatable.reserve(1000);
+        EXPECT_EQ(Tracked::moves, 0);  // 按字节搬移
+        EXPECT_EQ(Tracked::live, 200);
+        for (int i = 0; i < 100; ++i) {
+            EXPECT_EQ(relocatable[i].value_, i);
+        }
+    }
+    EXPECT_EQ(Tracked::live, 0);
+    return true;
+}
+
+TEST(SmallVector, MoveStealsHeapBufferOrRelocatesInline) {
+    SmallVector<std::unique_ptr<int>, 2> heap;
+    for (int i = 0; i < 5; ++i) {
+        heap.push_back(std::make_unique<int>(i));
+    }
+    const int* first = heap[0].get();
+    const auto* buffer = heap.data();
+    SmallVector<std::unique_ptr<int>, 2> stolen(std::move(heap));
+    EXPECT_TRUE(stolen.data() == buffer);  // 接管堆缓冲区
+    EXPECT_TRUE(heap.empty() && heap.is_inline());
+    EXPECT_TRUE(stolen[0].get() == first);
+
+    SmallVector<std::unique_ptr<int>, 2> small;
+    small.push_back(std::make_unique<int>(7));
+    SmallVector<std::unique_ptr<int>, 2> moved(std::move(small));
+    EXPECT_TRUE(moved.is_inline());
+    EXPECT_EQ(*moved[0], 7);
+    EXPECT_TRUE(small.empty());
+
+    stolen = std::move(moved);  // 源在内联槽位：元素重定位到目标已有的堆缓冲区
+    EXPECT_TRUE(stolen.data() == buffer);
+    EXPECT_EQ(stolen.size(), 1u);
+    EXPECT_EQ(*stolen[0], 7);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
@@ -4,6 +4,7 @@
 #include <array>
 #include <concepts>
 #include <cstdint>
+#include <format>
 #include <iostream>
 #include <iterator>
 #include <ranges>
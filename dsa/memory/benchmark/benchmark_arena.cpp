@@ -0,0 +1,145 @@
+/**
+ * @file benchmark_arena.cpp
+ * @brief MonotonicArena vs malloc / std::pmr for per-message scratch allocations
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <memory_resource>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/arena.h"
+
+using memory::MonotonicArena;
+
+namespace {
+
+/// 模拟一条消息解码：若干个大小不一的临时缓冲区
+constexpr std::size_t kScratchPerMessage = 16;
+constexpr std::size_t kScratchSizes[kScratchPerMessage] = {24,  64, 200, 32,  48,  512, 16,  96,
+                                                           128, 40, 256, 24, 1024, 80,  64, 160};
+
+MonotonicArena& thread_arena() {
+    static thread_local MonotonicArena arena(4 * 1024 * 1024);
+    return arena;
+}
+
+}  // namespace
+
+// =============================================================================
+// 每条消息的临时分配
+// =============================================================================
+
+BENCHMARK(scratch_malloc_free) {
+    void* ptrs[kScratchPerMessage];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t k = 0; k < kScratchPerMessage; ++k) {
+            ptrs[k] = std::malloc(kScratchSizes[k]);
+            std::memset(ptrs[k], 0, 8);
+        }
+        DONT_OPTIMIZE(ptrs);
+        for (std::size_t k = 0; k < kScratchPerMessage; ++k) {
+            std::free(ptrs[k]);
+        }
+    }
+}
+
+BENCHMARK(scratch_pmr_monotonic_buffer) {
+    alignas(64) static char buffer[16 * 1024];
+    void* ptrs[kScratchPerMessage];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer));
+        for (std::size_t k = 0; k < kScratchPerMessage; ++k) {
+            ptrs[k] = resource.allocate(kScratchSizes[k]);
+            std::memset(ptrs[k], 0, 8);
+        }
+        DONT_OPTIMIZE(ptrs);
+    }
+}
+
+BENCHMARK(scratch_arena_scope) {
+    auto& arena = thread_arena();
+    void* ptrs[kScratchPerMessage];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        memory::ArenaScope scope(arena);
+        for (std::size_t k = 0; k < kScratchPerMessage; ++k) {
+            ptrs[k] = arena.allocate(kScratchSizes[k]);
+            std::memset(ptrs[k], 0, 8);
+        }
+        DONT_OPTIMIZE(ptrs);
+    }
+}
+
+// =============================================================================
+// pmr 容器：默认堆 vs ArenaResource
+// =============================================================================
+
+BENCHMARK(pmr_vector_new_delete) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::pmr::vector<uint64_t> v(std::pmr::new_delete_resource());
+        for (uint64_t k = 0; k < 64; ++k) {
+            v.push_back(k);
+        }
+        DONT_OPTIMIZE(v.data());
+    }
+}
+
+BENCHMARK(pmr_vector_arena) {
+    auto& arena = thread_arena();
+    memory::ArenaResource resource(arena);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        memory::ArenaScope scope(arena);
+        std::pmr::vector<uint64_t> v(&resource);
+        for (uint64_t k = 0; k < 64; ++k) {
+            v.push_back(k);
+        }
+        DONT_OPTIMIZE(v.data());
+    }
+}
+
+// =============================================================================
+// 首次触及：普通页 vs 透明大页（缺页次数差异）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(first_touch_64mb_regular, benchmark::Config::quick().repetitions(5)) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        MonotonicArena arena(64 * 1024 * 1024, memory::HugePagePolicy::None);
+        auto* p = static_cast<char*>(arena.allocate(arena.capacity(), 1));
+        for (std::size_t off = 0; off < arena.capacity(); off += common::memory_constants::kPageSize) {
+            p[off] = 1;
+        }
+        DONT_OPTIMIZE(p);
+    }
+}
+
+BENCHMARK_WITH_CONFIG(first_touch_64mb_hugepage, benchmark::Config::quick().repetitions(5)) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        MonotonicArena arena(64 * 1024 * 1024, memory::HugePagePolicy::Explicit);
+        auto* p = static_cast<char*>(arena.allocate(arena.capacity(), 1));
+        for (std::size_t off = 0; off < arena.capacity(); off += common::memory_constants::kPageSize) {
+            p[off] = 1;
+        }
+        DONT_OPTIMIZE(p);
+    }
+}
+
+// =============================================================================
+// 主函数
+// =============================================================================
+
+int main() {
+    std::cout << "Arena Benchmark v" << benchmark::version() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("arena_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("arena_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file benchmark_pool.cpp
+ * @brief FixedPool / Pool<T> vs new/delete vs std::pmr pool resources
+ */
+
+#include <atomic>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/pool.h"
+
+namespace {
+
+/// 64 字节订单节点
+struct Order {
+    uint64_t id_;
+    uint64_t price_;
+    uint64_t qty_;
+    uint64_t ts_;
+    uint64_t pad_[4];
+
+    explicit Order(uint64_t id) noexcept : id_(id), price_(0), qty_(0), ts_(0), pad_{} {}
+};
+
+constexpr std::size_t kBatch = 64;
+
+/// 生产者 → 消费者的单生产者单消费者环形队列（只用于驱动基准）
+class HandoffRing {
+public:
+    static constexpr std::size_t kCapacity = 4096;
+
+    void push(Order* p) noexcept {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        while (tail - head_.load(std::memory_order_acquire) == kCapacity) {
+            std::this_thread::yield();
+        }
+        slots_[tail & (kCapacity - 1)] = p;
+        tail_.store(tail + 1, std::memory_order_release);
+    }
+
+    Order* pop() noexcept {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        while (tail_.load(std::memory_order_acquire) == head) {
+            std::this_thread::yield();
+        }
+        Order* p = slots_[head & (kCapacity - 1)];
+        head_.store(head + 1, std::memory_order_release);
+        return p;
+    }
+
+private:
+    alignas(common::memory_constants::kCacheLineSize) std::atomic<std::size_t> head_{0};
+    alignas(common::memory_constants::kCacheLineSize) std::atomic<std::size_t> tail_{0};
+    alignas(common::memory_constants::kCacheLineSize) Order* slots_[kCapacity]{};
+};
+
+/// 生产者线程分配、消费者线程释放
+template <typename Make, typename Destroy>
+void producer_consumer(std::size_t count, Make&& make, Destroy&& destroy) {
+    auto ring = std::make_unique<HandoffRing>();
+    std::thread consumer([&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            destroy(ring->pop());
+        }
+    });
+    for (std::size_t i = 0; i < count; ++i) {
+        ring->push(make(i));
+    }
+    consumer.join();
+}
+
+memory::Pool<Order>& order_pool() {
+    static memory::Pool<Order> pool;
+    return pool;
+}
+
+}  // namespace
+
+// =============================================================================
+// 单线程：批量分配后批量释放
+// =============================================================================
+
+BENCHMARK(single_new_delete) {
+    Order* batch[kBatch];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            batch[k] = new Order(k);
+        }
+        DONT_OPTIMIZE(batch);
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            delete batch[k];
+        }
+    }
+}
+
+BENCHMARK(single_pmr_unsynchronized_pool) {
+    static std::pmr::unsynchronized_pool_resource resource;
+    std::pmr::polymorphic_allocator<Order> alloc(&resource);
+    Order* batch[kBatch];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            batch[k] = alloc.new_object<Order>(k);
+        }
+        DONT_OPTIMIZE(batch);
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            alloc.delete_object(batch[k]);
+        }
+    }
+}
+
+BENCHMARK(single_pool_make_destroy) {
+    auto& pool = order_pool();
+    Order* batch[kBatch];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            batch[k] = pool.make(k);
+        }
+        DONT_OPTIMIZE(batch);
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            pool.destroy(batch[k]);
+        }
+    }
+}
+
+BENCHMARK(single_fixed_pool_raw) {
+    static memory::FixedPool pool(sizeof(Order), alignof(Order));
+    void* batch[kBatch];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            batch[k] = pool.allocate();
+        }
+        DONT_OPTIMIZE(batch);
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            pool.deallocate(batch[k]);
+        }
+    }
+}
+
+// =============================================================================
+// 生产者/消费者：跨线程释放
+// =============================================================================
+
+const auto kHandoffConfig = benchmark::Config::quick().repetitions(10);
+
+BENCHMARK_WITH_CONFIG(handoff_new_delete, kHandoffConfig) {
+    producer_consumer(
+        iterations * kBatch, [](std::size_t i) { return new Order(i); }, [](Order* p) { delete p; });
+}
+
+BENCHMARK_WITH_CONFIG(handoff_pmr_synchronized_pool, kHandoffConfig) {
+    // unsynchronized_pool_resource 不允许跨线程释放，此处使用 synchronized 版本
+    static std::pmr::synchronized_pool_resource resource;
+    std::pmr::polymorphic_allocator<Order> alloc(&resource);
+    producer_consumer(
+        iterations * kBatch, [&](std::size_t i) { return alloc.new_object<Order>(i); },
+        [&](Order* p) { alloc.delete_object(p); });
+}
+
+BENCHMARK_WITH_CONFIG(handoff_pool_remote_free, kHandoffConfig) {
+    auto& pool = order_pool();
+    producer_consumer(
+        iterations * kBatch, [&](std::size_t i) { return pool.make(i); }, [&](Order* p) { pool.destroy(p); });
+}
+
+// =============================================================================
+// 主函数
+// =============================================================================
+
+int main() {
+    std::cout << "Pool Benchmark v" << benchmark::version() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("pool_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("pool_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
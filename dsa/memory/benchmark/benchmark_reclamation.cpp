@@ -0,0 +1,132 @@
+/**
+ * @file benchmark_reclamation.cpp
+ * @brief EBR / 风险指针的读者开销与退休吞吐，对比裸原子读取与 std::atomic<std::shared_ptr>
+ */
+
+#include <atomic>
+#include <memory>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/reclamation.h"
+
+using memory::EpochDomain;
+using memory::HazardDomain;
+
+namespace {
+
+/// 参考数据（如合约表）
+struct Instrument {
+    uint64_t id_{0};
+    double tick_size_{0.01};
+    double multiplier_{1.0};
+};
+
+constexpr std::size_t kReadsPerSection = 64;
+
+Instrument g_instrument{42, 0.01, 10.0};
+std::atomic<Instrument*> g_current{&g_instrument};
+std::atomic<std::shared_ptr<Instrument>> g_shared{std::make_shared<Instrument>(g_instrument)};
+
+}  // namespace
+
+// =============================================================================
+// 单次读取的读者开销
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(read_raw_atomic, benchmark::Config::quick()) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const Instrument* p = g_current.load(std::memory_order_acquire);
+        DONT_OPTIMIZE(p->tick_size_);
+    }
+}
+
+BENCHMARK_WITH_CONFIG(read_epoch_guard, benchmark::Config::quick()) {
+    auto& domain = EpochDomain::global();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto guard = domain.pin();
+        const Instrument* p = g_current.load(std::memory_order_acquire);
+        DONT_OPTIMIZE(p->tick_size_);
+    }
+}
+
+BENCHMARK_WITH_CONFIG(read_hazard_pointer, benchmark::Config::quick()) {
+    auto hp = HazardDomain::global().make_hazard();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const Instrument* p = hp.protect(g_current);
+        DONT_OPTIMIZE(p->tick_size_);
+        hp.reset();
+    }
+}
+
+BENCHMARK_WITH_CONFIG(read_atomic_shared_ptr, benchmark::Config::quick()) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto p = g_shared.load(std::memory_order_acquire);
+        DONT_OPTIMIZE(p->tick_size_);
+    }
+}
+
+// =============================================================================
+// 一次临界区内多次读取（EBR 的屏障被摊销）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(read_epoch_guard_x64, benchmark::Config::quick()) {
+    auto& domain = EpochDomain::global();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto guard = domain.pin();
+        for (std::size_t k = 0; k < kReadsPerSection; ++k) {
+            const Instrument* p = g_current.load(std::memory_order_acquire);
+            DONT_OPTIMIZE(p->tick_size_);
+        }
+    }
+}
+
+BENCHMARK_WITH_CONFIG(read_hazard_pointer_x64, benchmark::Config::quick()) {
+    auto hp = HazardDomain::global().make_hazard();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t k = 0; k < kReadsPerSection; ++k) {
+            const Instrument* p = hp.protect(g_current);
+            DONT_OPTIMIZE(p->tick_size_);
+        }
+        hp.reset();
+    }
+}
+
+// =============================================================================
+// 写者：替换并退休（含摊销扫描）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(retire_epoch, benchmark::Config::quick()) {
+    auto& domain = EpochDomain::global();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        domain.retire(new Instrument{i, 0.01, 1.0});
+    }
+}
+
+BENCHMARK_WITH_CONFIG(retire_hazard, benchmark::Config::quick()) {
+    auto& domain = HazardDomain::global();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        domain.retire(new Instrument{i, 0.01, 1.0});
+    }
+}
+
+BENCHMARK_WITH_CONFIG(retire_shared_ptr_store, benchmark::Config::quick()) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        g_shared.store(std::make_shared<Instrument>(Instrument{i, 0.01, 1.0}), std::memory_order_release);
+    }
+}
+
+int main() {
+    std::cout << "Reclamation Benchmark v" << benchmark::version() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("reclamation_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("reclamation_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
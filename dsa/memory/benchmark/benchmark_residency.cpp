@@ -0,0 +1,136 @@
+/**
+ * @file benchmark_residency.cpp
+ * @brief 首次触及缺页 vs 预缺页 / mlock 后的写入开销
+ */
+
+#include <sys/mman.h>
+
+#include <cstring>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/arena.h"
+#include "../detail/residency.h"
+
+using memory::MonotonicArena;
+using memory::Residency;
+
+namespace {
+
+constexpr std::size_t kRegionBytes = 4 * 1024 * 1024;
+constexpr std::size_t kPage = common::memory_constants::kPageSize;
+
+char* map_region() {
+    void* p = ::mmap(nullptr, kRegionBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return p == MAP_FAILED ? nullptr : static_cast<char*>(p);
+}
+
+/// 每页写一个缓存行，模拟热路径首次使用缓冲区
+void touch_pages(char* p) {
+    for (std::size_t off = 0; off < kRegionBytes; off += kPage) {
+        std::memset(p + off, 1, common::memory_constants::kCacheLineSize);
+    }
+    DONT_OPTIMIZE(p);
+}
+
+/// 每次重复只写一遍，否则后续迭代均已常驻
+const auto kOnePassConfig = benchmark::Config::quick().repetitions(50).max_iterations(1);
+
+/// 每次重复丢弃区域的物理页，按参数选择是否预缺页
+struct Benchmark_FreshRegion {
+    char* data_{nullptr};
+
+    void init(bool populate) {
+        if (data_ == nullptr) {
+            data_ = map_region();
+        } else {
+            ::madvise(data_, kRegionBytes, MADV_DONTNEED);
+        }
+        if (populate) {
+            (void)Residency::populate(data_, kRegionBytes);
+        }
+    }
+
+    void reset() {}
+};
+
+}  // namespace
+
+// =============================================================================
+// 首次触及 vs 预缺页（计时区间只包含写入）
+// =============================================================================
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(write_first_touch, Benchmark_FreshRegion, kOnePassConfig, false) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        touch_pages(data_);
+    }
+}
+
+BENCHMARK_F_WITH_CONFIG_AND_ARGS(write_after_populate, Benchmark_FreshRegion, kOnePassConfig, true) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        touch_pages(data_);
+    }
+}
+
+// =============================================================================
+// 预缺页本身的开销：内核批量填充 vs 逐页触及
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(populate_madvise, benchmark::Config::quick().repetitions(50)) {
+    static char* region = map_region();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        ::madvise(region, kRegionBytes, MADV_DONTNEED);
+        (void)Residency::populate(region, kRegionBytes);
+    }
+}
+
+BENCHMARK_WITH_CONFIG(populate_touch_loop, benchmark::Config::quick().repetitions(50)) {
+    static char* region = map_region();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        ::madvise(region, kRegionBytes, MADV_DONTNEED);
+        Residency::prefault_write(region, kRegionBytes);
+    }
+}
+
+// =============================================================================
+// Config::resident()：mlockall 后运行，报告计时区间缺页数
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(arena_scratch_resident, benchmark::Config::resident().repetitions(100)) {
+    static MonotonicArena arena(kRegionBytes);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        arena.reset();
+        auto* p = static_cast<char*>(arena.allocate(kRegionBytes / 4, 64));
+        for (std::size_t off = 0; off < kRegionBytes / 4; off += kPage) {
+            p[off] = static_cast<char>(i);
+        }
+        DONT_OPTIMIZE(p);
+    }
+}
+
+/// 多线程：工作线程的创建与栈预触及不计入计时区间，稳态应为零缺页
+BENCHMARK_WITH_CONFIG(stack_scratch_resident_threads,
+                      benchmark::Config::resident().threads(4).repetitions(20)) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        char scratch[16 * 1024];
+        for (std::size_t off = 0; off < sizeof(scratch); off += 64) {
+            scratch[off] = static_cast<char>(i);
+        }
+        DONT_OPTIMIZE(scratch[i % sizeof(scratch)]);
+    }
+}
+
+int main() {
+    std::cout << "Residency Benchmark v" << benchmark::version() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("residency_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("residency_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
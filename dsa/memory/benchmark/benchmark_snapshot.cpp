@@ -0,0 +1,112 @@
+/**
+ * @file benchmark_snapshot.cpp
+ * @brief SnapshotPublisher vs std::atomic<std::shared_ptr> 读取开销（1 / 16 读者线程）
+ */
+
+#include <atomic>
+#include <memory>
+
+#include "../../benchmark/benchmark.h"
+#include "../detail/snapshot.h"
+
+using memory::SnapshotPublisher;
+
+namespace {
+
+/// 参考数据：合约定义
+struct InstrumentTable {
+    uint64_t version_{0};
+    double tick_size_[64]{};
+};
+
+constexpr std::size_t kReaderThreads = 16;
+const auto kConcurrentConfig =
+    benchmark::Config::concurrent(kReaderThreads).max_iterations(1'000'000).repetitions(10);
+
+SnapshotPublisher<InstrumentTable> g_snapshot(std::make_unique<InstrumentTable>());
+std::atomic<std::shared_ptr<InstrumentTable>> g_shared{std::make_shared<InstrumentTable>()};
+std::shared_ptr<InstrumentTable> g_plain_shared = std::make_shared<InstrumentTable>();
+
+/// 每条消息读取一次参考数据，之后声明静止
+void read_snapshot(benchmark::IterationCount iterations) {
+    auto reader = g_snapshot.register_reader();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const InstrumentTable* t = reader.get();
+        DONT_OPTIMIZE(t->tick_size_[i & 63]);
+        reader.quiescent();
+    }
+}
+
+void read_atomic_shared_ptr(benchmark::IterationCount iterations) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto t = g_shared.load(std::memory_order_acquire);
+        DONT_OPTIMIZE(t->tick_size_[i & 63]);
+    }
+}
+
+void read_std_atomic_load(benchmark::IterationCount iterations) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto t = std::atomic_load_explicit(&g_plain_shared, std::memory_order_acquire);
+        DONT_OPTIMIZE(t->tick_size_[i & 63]);
+    }
+}
+
+}  // namespace
+
+// =============================================================================
+// 单读者
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(snapshot_read_1_thread, benchmark::Config::quick()) { read_snapshot(iterations); }
+
+BENCHMARK_WITH_CONFIG(atomic_shared_ptr_read_1_thread, benchmark::Config::quick()) {
+    read_atomic_shared_ptr(iterations);
+}
+
+BENCHMARK_WITH_CONFIG(std_atomic_load_shared_ptr_1_thread, benchmark::Config::quick()) {
+    read_std_atomic_load(iterations);
+}
+
+// =============================================================================
+// 16 读者：shared_ptr 的引用计数缓存行在读者之间来回迁移
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(snapshot_read_16_threads, kConcurrentConfig) {
+    read_snapshot(iterations);
+}
+
+BENCHMARK_WITH_CONFIG(atomic_shared_ptr_read_16_threads, kConcurrentConfig) {
+    read_atomic_shared_ptr(iterations);
+}
+
+BENCHMARK_WITH_CONFIG(std_atomic_load_shared_ptr_16_threads, kConcurrentConfig) {
+    read_std_atomic_load(iterations);
+}
+
+// =============================================================================
+// 写者：发布新版本（无读者在线时宽限期立即结束）
+// =============================================================================
+
+BENCHMARK_WITH_CONFIG(snapshot_publish, benchmark::Config::quick()) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto next = std::make_unique<InstrumentTable>();
+        next->version_ = i;
+        g_snapshot.publish(std::move(next));
+    }
+}
+
+int main() {
+    std::cout << "Snapshot Benchmark v" << benchmark::version() << "\n\n";
+
+    auto results = benchmark::run_all_benchmarks();
+
+    if (!results.empty()) {
+        std::cout << "\n[Exporting results...]\n";
+        benchmark::Reporter::save_to_file("snapshot_results.json", benchmark::Reporter::to_json(results));
+        benchmark::Reporter::save_to_file("snapshot_results.csv", benchmark::Reporter::to_csv(results));
+        std::cout << "\nTable:\n";
+        benchmark::Reporter::print_table(results);
+    }
+
+    return 0;
+}
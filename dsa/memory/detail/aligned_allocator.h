@@ -0,0 +1,49 @@
+/**
+ * @file aligned_allocator.h
+ * @brief 按缓存行（或指定边界）对齐的 STL 分配器
+ * @version 1.0.0
+ *
+ * 供需要对齐首地址的连续容器使用（SIMD 对齐加载、按缓存行分块的搜索布局与过滤器）：
+ *   std::vector<uint64_t, AlignedAllocator<uint64_t>> words;
+ * 分配失败抛 std::bad_alloc（Allocator 约定）。
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+#include "../../common/constants.h"
+
+namespace memory {
+
+template <typename T, std::size_t Alignment = common::memory_constants::kCacheLineSize>
+struct AlignedAllocator {
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+                  "Alignment must be a power of two no smaller than alignof(T)");
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    constexpr AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    constexpr AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    [[nodiscard]] T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept { ::operator delete(p, std::align_val_t{Alignment}); }
+
+    template <typename U>
+    constexpr bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return true;
+    }
+};
+
+}  // namespace memory
@@ -0,0 +1,341 @@
+/**
+ * @file arena.h
+ * @brief 大页支持的单调（bump-pointer）内存池
+ * @version 1.0.0
+ *
+ * 提供热路径上零系统调用的临时内存分配：
+ * - MonotonicArena: 预留整段虚拟地址空间，指针递增分配，支持 mark/rewind 与整体 reset
+ * - ArenaScope: RAII 作用域，析构时回卷到进入时的位置（如每条消息的解码临时内存）
+ * - ArenaResource: std::pmr::memory_resource 适配器，供 pmr 容器使用
+ *
+ * 大页策略：
+ * - Explicit: 优先 MAP_HUGETLB（需预留 hugetlbfs 页），失败时退化为 Transparent
+ * - Transparent: 2MB 对齐预留 + madvise(MADV_HUGEPAGE)，由内核透明大页合并
+ * - None: 普通 4KB 页
+ */
+
+#pragma once
+
+#include <sys/mman.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../../common/constants.h"
+#include "../../common/macros.h"
+#include "residency.h"
+
+namespace memory {
+
+using namespace common;
+
+// =============================================================================
+// 大页策略
+// =============================================================================
+
+enum class HugePagePolicy : uint8_t {
+    None = 0,     // 普通页
+    Transparent,  // madvise(MADV_HUGEPAGE)
+    Explicit,     // MAP_HUGETLB，失败退化为 Transparent
+};
+
+/// 实际生效的页面后端
+enum class PageBacking : uint8_t {
+    None = 0,     // 未映射（预留失败）
+    Regular,      // 普通 4KB 页
+    Transparent,  // 透明大页（建议）
+    HugeTlb,      // 显式大页
+};
+
+// =============================================================================
+// 地址空间映射
+// =============================================================================
+
+namespace detail {
+
+/// 向上对齐到任意 2 的幂边界
+[[nodiscard, gnu::always_inline]]
+inline constexpr std::size_t align_up(std::size_t size, std::size_t alignment) noexcept {
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/// 一段匿名映射
+struct Mapping {
+    void* base_{nullptr};
+    std::size_t size_{0};
+    PageBacking backing_{PageBacking::None};
+};
+
+/// 预留 bytes 字节地址空间，按策略申请大页
+/// 大页策略下尺寸向上取整到大页、基址 2MB 对齐；alignment 可要求更大的基址对齐（如 slab 按自身大小对齐）
+[[nodiscard]] inline Mapping map_region(std::size_t bytes, HugePagePolicy policy,
+                                        std::size_t alignment = 0) noexcept {
+    constexpr std::size_t kHuge = memory_constants::kHugePageSize;
+    constexpr int kProt = PROT_READ | PROT_WRITE;
+    constexpr int kFlags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+
+    if (bytes == 0) {
+        return {};
+    }
+
+    const bool huge = policy != HugePagePolicy::None;
+    const std::size_t granule = huge ? kHuge : memory_constants::kPageSize;
+    const std::size_t size = align_up(bytes, granule);
+    alignment = alignment < granule ? granule : alignment;
+
+#ifdef MAP_HUGETLB
+    if (policy == HugePagePolicy::Explicit && alignment <= kHuge) {
+        // 不带 MAP_NORESERVE：大页池不足时 mmap 直接失败，而不是在首次触及时 SIGBUS
+        void* p = ::mmap(nullptr, size, kProt, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) {
+            return {p, size, PageBacking::HugeTlb};
+        }
+    }
+#endif
+
+    if (alignment <= memory_constants::kPageSize) {
+        void* p = ::mmap(nullptr, size, kProt, kFlags, -1, 0);
+        if (p == MAP_FAILED) {
+            return {};
+        }
+        return {p, size, PageBacking::Regular};
+    }
+
+    // 多预留 alignment 字节，裁掉首尾使基址对齐（透明大页需要 2MB 对齐才能整页合并）
+    void* raw = ::mmap(nullptr, size + alignment, kProt, kFlags, -1, 0);
+    if (raw == MAP_FAILED) {
+        return {};
+    }
+
+    const auto raw_addr = reinterpret_cast<std::uintptr_t>(raw);
+    const std::uintptr_t aligned = align_up(raw_addr, alignment);
+    const std::size_t head = aligned - raw_addr;
+    const std::size_t tail = alignment - head;
+    if (head > 0) {
+        ::munmap(raw, head);
+    }
+    if (tail > 0) {
+        ::munmap(reinterpret_cast<void*>(aligned + size), tail);
+    }
+
+    void* p = reinterpret_cast<void*>(aligned);
+    PageBacking backing = PageBacking::Regular;
+#ifdef MADV_HUGEPAGE
+    if (huge && ::madvise(p, size, MADV_HUGEPAGE) == 0) {
+        backing = PageBacking::Transparent;
+    }
+#endif
+    return {p, size, backing};
+}
+
+inline void unmap_region(const Mapping& m) noexcept {
+    if (m.base_ != nullptr) {
+        ::munmap(m.base_, m.size_);
+    }
+}
+
+}  // namespace detail
+
+// =============================================================================
+// 单调内存池
+// =============================================================================
+
+/// 单调内存池：只分配不单独释放，通过 rewind/reset 批量回收
+/// 非线程安全，每个线程（或每条处理流水线）持有一个
+class MonotonicArena {
+public:
+    /// 回卷位置
+    struct Marker {
+        std::size_t offset_{0};
+    };
+
+    static constexpr std::size_t kDefaultAlignment = alignof(std::max_align_t);
+
+    /// 预留 capacity 字节地址空间；失败时 valid() 为 false，allocate 始终返回 nullptr
+    explicit MonotonicArena(std::size_t capacity,
+                            HugePagePolicy policy = HugePagePolicy::Transparent) noexcept
+        : mapping_(detail::map_region(capacity, policy)) {
+        base_ = reinterpret_cast<std::uintptr_t>(mapping_.base_);
+        capacity_ = mapping_.size_;
+    }
+
+    ~MonotonicArena() { detail::unmap_region(mapping_); }
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    MonotonicArena(MonotonicArena&& other) noexcept
+        : mapping_(std::exchange(other.mapping_, {})),
+          base_(std::exchange(other.base_, 0)),
+          offset_(std::exchange(other.offset_, 0)),
+          capacity_(std::exchange(other.capacity_, 0)),
+          high_water_(std::exchange(other.high_water_, 0)) {}
+
+    MonotonicArena& operator=(MonotonicArena&& other) noexcept {
+        if (this != &other) {
+            detail::unmap_region(mapping_);
+            mapping_ = std::exchange(other.mapping_, {});
+            base_ = std::exchange(other.base_, 0);
+            offset_ = std::exchange(other.offset_, 0);
+            capacity_ = std::exchange(other.capacity_, 0);
+            high_water_ = std::exchange(other.high_water_, 0);
+        }
+        return *this;
+    }
+
+    // -------------------------------------------------------------------------
+    // 分配
+    // -------------------------------------------------------------------------
+
+    /// 分配 bytes 字节（alignment 必须为 2 的幂），空间不足返回 nullptr
+    [[nodiscard, gnu::hot, gnu::always_inline]]
+    inline void* allocate(std::size_t bytes, std::size_t alignment = kDefaultAlignment) noexcept {
+        const std::uintptr_t current = base_ + offset_;
+        const std::uintptr_t aligned = detail::align_up(current, alignment);
+        const std::size_t start = aligned - base_;
+        if (start > capacity_ || bytes > capacity_ - start) [[unlikely]] {
+            return nullptr;
+        }
+
+        offset_ = start + bytes;
+        if (offset_ > high_water_) {
+            high_water_ = offset_;
+        }
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    /// 分配未初始化的 T 数组
+    template <typename T>
+    [[nodiscard, gnu::hot, gnu::always_inline]]
+    inline T* allocate_array(std::size_t count) noexcept {
+        if (count > capacity_ / sizeof(T)) [[unlikely]] {
+            return nullptr;
+        }
+        return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /// 构造对象；内存池不调用析构函数，因此只接受平凡析构类型
+    template <typename T, typename... Args>
+    [[nodiscard, gnu::hot]]
+    inline T* make(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+        static_assert(std::is_trivially_destructible_v<T>, "arena never runs destructors");
+        void* p = allocate(sizeof(T), alignof(T));
+        if (p == nullptr) [[unlikely]] {
+            return nullptr;
+        }
+        return ::new (p) T(std::forward<Args>(args)...);
+    }
+
+    // -------------------------------------------------------------------------
+    // 回收
+    // -------------------------------------------------------------------------
+
+    [[nodiscard, gnu::always_inline]] inline Marker mark() const noexcept { return Marker{offset_}; }
+
+    /// 回卷到 marker，之后分配的内存全部失效
+    [[gnu::always_inline]] inline void rewind(Marker marker) noexcept {
+        if (marker.offset_ <= offset_) {
+            offset_ = marker.offset_;
+        }
+    }
+
+    /// 整体回收（物理页保留，下次分配无缺页）
+    [[gnu::always_inline]] inline void reset() noexcept { offset_ = 0; }
+
+    /// 预先填充前 bytes 字节（默认整个预留区）的物理页，之后的分配不再缺页
+    void prefault(std::size_t bytes = static_cast<std::size_t>(-1)) noexcept {
+        if (mapping_.base_ != nullptr) {
+            (void)Residency::populate(mapping_.base_, bytes < capacity_ ? bytes : capacity_);
+        }
+    }
+
+    /// 整体回收并把物理页归还内核（下次触及时重新缺页）
+    void release() noexcept {
+        offset_ = 0;
+        high_water_ = 0;
+        if (mapping_.base_ != nullptr) {
+            ::madvise(mapping_.base_, mapping_.size_, MADV_DONTNEED);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // 查询
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline bool valid() const noexcept { return mapping_.base_ != nullptr; }
+    [[nodiscard]] inline explicit operator bool() const noexcept { return valid(); }
+
+    [[nodiscard]] inline std::size_t used() const noexcept { return offset_; }
+    [[nodiscard]] inline std::size_t capacity() const noexcept { return capacity_; }
+    [[nodiscard]] inline std::size_t remaining() const noexcept { return capacity_ - offset_; }
+    [[nodiscard]] inline std::size_t high_water_mark() const noexcept { return high_water_; }
+    [[nodiscard]] inline PageBacking backing() const noexcept { return mapping_.backing_; }
+    [[nodiscard]] inline void* data() const noexcept { return mapping_.base_; }
+
+    [[nodiscard]] inline bool owns(const void* p) const noexcept {
+        const auto addr = reinterpret_cast<std::uintptr_t>(p);
+        return addr >= base_ && addr < base_ + capacity_;
+    }
+
+private:
+    detail::Mapping mapping_{};
+    std::uintptr_t base_{0};
+    std::size_t offset_{0};
+    std::size_t capacity_{0};
+    std::size_t high_water_{0};
+};
+
+// =============================================================================
+// 作用域回卷
+// =============================================================================
+
+/// 进入时记录位置，析构时回卷
+class ArenaScope {
+public:
+    explicit ArenaScope(MonotonicArena& arena) noexcept : arena_(arena), marker_(arena.mark()) {}
+    ~ArenaScope() { arena_.rewind(marker_); }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    MonotonicArena& arena_;
+    MonotonicArena::Marker marker_;
+};
+
+// =============================================================================
+// std::pmr 适配器
+// =============================================================================
+
+/// 将 MonotonicArena 暴露为 std::pmr::memory_resource
+/// deallocate 为空操作；空间耗尽时抛 std::bad_alloc（memory_resource 约定）
+class ArenaResource : public std::pmr::memory_resource {
+public:
+    explicit ArenaResource(MonotonicArena& arena) noexcept : arena_(&arena) {}
+
+    [[nodiscard]] inline MonotonicArena& arena() const noexcept { return *arena_; }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        void* p = arena_->allocate(bytes, alignment);
+        if (p == nullptr) [[unlikely]] {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        const auto* rhs = dynamic_cast<const ArenaResource*>(&other);
+        return rhs != nullptr && rhs->arena_ == arena_;
+    }
+
+    MonotonicArena* arena_;
+};
+
+}  // namespace memory
@@ -0,0 +1,344 @@
+/**
+ * @file numa.h
+ * @brief NUMA 感知的内存放置
+ * @version 1.0.0
+ *
+ * 直接通过系统调用（mbind/set_mempolicy/get_mempolicy/getcpu）控制内存放置，不依赖 libnuma：
+ * - Numa: 节点查询、线程绑定节点、地址区间绑定/交织、首次触及预缺页
+ * - NumaRegion: 绑定到指定节点（或交织到所有节点）的匿名映射
+ *
+ * 跨插槽访问约增加 100ns 延迟；热数据应放在使用它的线程所在节点，
+ * 多节点共享的只读表使用交织分配以平摊带宽。
+ */
+
+#pragma once
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../../common/constants.h"
+#include "../../utility/detail/coreAffinity.h"
+#include "../../utility/detail/coreDetector.h"
+#include "arena.h"
+
+namespace memory {
+
+// =============================================================================
+// 内存策略（与内核 MPOL_* 取值一致）
+// =============================================================================
+
+enum class NumaPolicy : int {
+    Default = 0,     // MPOL_DEFAULT
+    Preferred = 1,   // MPOL_PREFERRED
+    Bind = 2,        // MPOL_BIND
+    Interleave = 3,  // MPOL_INTERLEAVE
+    Local = 4,       // MPOL_LOCAL
+};
+
+/// 节点位图，覆盖 numa_constants::kMaxNumaNodes 个节点
+class NodeMask {
+public:
+    static constexpr std::size_t kBits = 64;
+    static_assert(numa_constants::kMaxNumaNodes <= kBits, "NodeMask holds a single word");
+
+    constexpr NodeMask() noexcept = default;
+    constexpr explicit NodeMask(uint64_t bits) noexcept : bits_(bits) {}
+
+    [[nodiscard]] static constexpr NodeMask single(int node) noexcept {
+        return NodeMask(node >= 0 && static_cast<std::size_t>(node) < kBits ? uint64_t{1} << node : 0);
+    }
+
+    /// 所有已检测到的节点
+    [[nodiscard]] static NodeMask all() noexcept {
+        const uint32_t n = utils::CoreDetector::instance().get_num_of_numa_nodes();
+        const uint32_t nodes = n == 0 ? 1 : (n < kBits ? n : kBits);
+        return NodeMask(nodes == kBits ? ~uint64_t{0} : (uint64_t{1} << nodes) - 1);
+    }
+
+    constexpr void add(int node) noexcept { bits_ |= single(node).bits_; }
+    [[nodiscard]] constexpr bool contains(int node) const noexcept {
+        return (bits_ & single(node).bits_) != 0;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return bits_ == 0; }
+    [[nodiscard]] constexpr int count() const noexcept { return __builtin_popcountll(bits_); }
+
+    [[nodiscard]] const unsigned long* native_handle() const noexcept {
+        return reinterpret_cast<const unsigned long*>(&bits_);
+    }
+
+    /// 内核 maxnode 参数：位数 + 1（内核会先减一）
+    [[nodiscard]] static constexpr unsigned long max_node() noexcept { return kBits + 1; }
+
+private:
+    uint64_t bits_{0};
+};
+
+// =============================================================================
+// 系统调用封装
+// =============================================================================
+
+namespace detail {
+
+inline constexpr unsigned kMpolMfStrict = 1U << 0;  // MPOL_MF_STRICT
+inline constexpr unsigned kMpolMfMove = 1U << 1;    // MPOL_MF_MOVE
+inline constexpr unsigned long kMpolFNode = 1UL << 0;  // MPOL_F_NODE
+inline constexpr unsigned long kMpolFAddr = 1UL << 1;  // MPOL_F_ADDR
+
+[[nodiscard]] inline long sys_mbind(void* addr, std::size_t len, int mode, const unsigned long* nodemask,
+                                    unsigned long maxnode, unsigned flags) noexcept {
+    return ::syscall(SYS_mbind, addr, len, mode, nodemask, maxnode, flags);
+}
+
+[[nodiscard]] inline long sys_set_mempolicy(int mode, const unsigned long* nodemask,
+                                            unsigned long maxnode) noexcept {
+    return ::syscall(SYS_set_mempolicy, mode, nodemask, maxnode);
+}
+
+[[nodiscard]] inline long sys_get_mempolicy(int* mode, unsigned long* nodemask, unsigned long maxnode,
+                                            const void* addr, unsigned long flags) noexcept {
+    return ::syscall(SYS_get_mempolicy, mode, nodemask, maxnode, addr, flags);
+}
+
+/// 按页对齐区间：[向下对齐起点, 向上对齐终点)
+[[nodiscard]] inline std::pair<void*, std::size_t> page_span(void* addr, std::size_t len) noexcept {
+    constexpr std::size_t kPage = memory_constants::kPageSize;
+    const auto begin = reinterpret_cast<std::uintptr_t>(addr) & ~(kPage - 1);
+    const auto end = align_up(reinterpret_cast<std::uintptr_t>(addr) + len, kPage);
+    return {reinterpret_cast<void*>(begin), end - begin};
+}
+
+}  // namespace detail
+
+// =============================================================================
+// NUMA 工具
+// =============================================================================
+
+struct Numa {
+    /// 节点数（至少为 1）
+    [[nodiscard]] static uint32_t num_nodes() noexcept {
+        const uint32_t n = utils::CoreDetector::instance().get_num_of_numa_nodes();
+        return n == 0 ? 1 : n;
+    }
+
+    /// 调用线程当前所在的 CPU 与节点（getcpu 系统调用，vDSO 不可用时亦可）
+    [[nodiscard]] static int current_node() noexcept {
+        unsigned cpu = 0;
+        unsigned node = 0;
+        if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+            return node_of_cpu(::sched_getcpu());
+        }
+        return static_cast<int>(node);
+    }
+
+    [[nodiscard]] static int current_cpu() noexcept { return ::sched_getcpu(); }
+
+    /// 由 CoreDetector 的每节点 cpulist 查找 CPU 所属节点，未知时返回 0
+    [[nodiscard]] static int node_of_cpu(int cpu) noexcept {
+        const auto& cpulists = utils::CoreDetector::instance().get_cpulists();
+        return static_cast<int>(utils::CoreDetector::node_of_cpu(cpulists, cpu));
+    }
+
+    /// 解析节点参数：kLocalNode 表示调用线程所在节点
+    [[nodiscard]] static int resolve(int node) noexcept {
+        return node == numa_constants::kLocalNode ? current_node() : node;
+    }
+
+    /// 页面当前所在节点（页面未分配时返回 -1）
+    [[nodiscard]] static int node_of_address(const void* addr) noexcept {
+        int node = -1;
+        const unsigned long flags = detail::kMpolFNode | detail::kMpolFAddr;
+        if (detail::sys_get_mempolicy(&node, nullptr, 0, addr, flags) != 0) {
+            return -1;
+        }
+        return node;
+    }
+
+    // -------------------------------------------------------------------------
+    // 放置策略
+    // -------------------------------------------------------------------------
+
+    /// 将 [addr, addr + len) 绑定到 node；move 为 true 时迁移已存在的页面
+    [[nodiscard]] static bool bind(void* addr, std::size_t len, int node = numa_constants::kLocalNode,
+                                   bool move = false) noexcept {
+        const NodeMask mask = NodeMask::single(resolve(node));
+        if (mask.empty()) {
+            return false;
+        }
+        return apply(addr, len, NumaPolicy::Bind, mask, move);
+    }
+
+    /// 将 [addr, addr + len) 按页交织到 nodes
+    [[nodiscard]] static bool interleave(void* addr, std::size_t len, NodeMask nodes = NodeMask::all(),
+                                         bool move = false) noexcept {
+        if (nodes.empty()) {
+            return false;
+        }
+        return apply(addr, len, NumaPolicy::Interleave, nodes, move);
+    }
+
+    [[nodiscard]] static bool apply(void* addr, std::size_t len, NumaPolicy policy, NodeMask nodes,
+                                    bool move = false) noexcept {
+        if (addr == nullptr || len == 0) {
+            return false;
+        }
+        auto [begin, bytes] = detail::page_span(addr, len);
+        const unsigned flags = move ? (detail::kMpolMfMove | detail::kMpolMfStrict) : 0;
+        const bool with_mask = policy != NumaPolicy::Default && policy != NumaPolicy::Local;
+        const unsigned long* mask = with_mask ? nodes.native_handle() : nullptr;
+        const unsigned long max_node = with_mask ? NodeMask::max_node() : 0;
+        return detail::sys_mbind(begin, bytes, static_cast<int>(policy), mask, max_node, flags) == 0;
+    }
+
+    /// 设置调用线程的默认内存策略（影响之后所有新分配的页面）
+    [[nodiscard]] static bool set_thread_policy(NumaPolicy policy, NodeMask nodes = {}) noexcept {
+        const bool with_mask = policy != NumaPolicy::Default && policy != NumaPolicy::Local;
+        const unsigned long* mask = with_mask ? nodes.native_handle() : nullptr;
+        const unsigned long max_node = with_mask ? NodeMask::max_node() : 0;
+        return detail::sys_set_mempolicy(static_cast<int>(policy), mask, max_node) == 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // 线程放置
+    // -------------------------------------------------------------------------
+
+    /// 将调用线程绑定到 node 的所有 CPU
+    [[nodiscard]] static bool pin_to_node(int node) noexcept {
+        const auto& detector = utils::CoreDetector::instance();
+        if (node < 0 || static_cast<uint32_t>(node) >= detector.get_num_of_numa_nodes()) {
+            return false;
+        }
+
+        utils::CpuSet cpuset;
+        for (int32_t cpu : detector.get_cpulist(static_cast<uint32_t>(node))) {
+            cpuset.add_cpu(static_cast<std::size_t>(cpu));
+        }
+        return utils::CpuAffinity::set_thread_affinity(cpuset);
+    }
+
+    // -------------------------------------------------------------------------
+    // 首次触及
+    // -------------------------------------------------------------------------
+
+    /// 每页写一个字节，强制分配物理页（只用于新映射、内容尚未使用的内存）
+    static void touch_pages(void* addr, std::size_t len) noexcept {
+        auto* p = static_cast<volatile char*>(addr);
+        for (std::size_t off = 0; off < len; off += memory_constants::kPageSize) {
+            p[off] = 0;
+        }
+        if (len > 0) {
+            p[len - 1] = 0;
+        }
+    }
+
+    /// 从绑定到 node 的临时线程首次触及，使页面落在该节点（默认 first-touch 策略下生效）
+    /// 单节点机器或绑定失败时在调用线程内触及
+    static void prefault_on_node(void* addr, std::size_t len, int node = numa_constants::kLocalNode) {
+        node = resolve(node);
+        if (num_nodes() <= 1 || node == current_node()) {
+            touch_pages(addr, len);
+            return;
+        }
+
+        std::thread toucher([addr, len, node] {
+            (void)pin_to_node(node);
+            touch_pages(addr, len);
+        });
+        toucher.join();
+    }
+};
+
+// =============================================================================
+// 节点内存区域
+// =============================================================================
+
+/// 绑定到单个节点或交织到多个节点的匿名映射
+class NumaRegion {
+public:
+    NumaRegion() = default;
+
+    /// 在 node 上分配 bytes 字节；prefault 为 true 时立即分配物理页
+    [[nodiscard]] static NumaRegion on_node(std::size_t bytes, int node = numa_constants::kLocalNode,
+                                            bool prefault = true,
+                                            HugePagePolicy huge = HugePagePolicy::Transparent) {
+        NumaRegion region(detail::map_region(bytes, huge));
+        if (!region.valid()) {
+            return region;
+        }
+
+        region.node_ = Numa::resolve(node);
+        region.bound_ = Numa::bind(region.data(), region.size(), region.node_);
+        if (prefault) {
+            Numa::prefault_on_node(region.data(), region.size(), region.node_);
+        }
+        return region;
+    }
+
+    /// 按页交织到 nodes（共享只读表）
+    [[nodiscard]] static NumaRegion interleaved(std::size_t bytes, NodeMask nodes = NodeMask::all(),
+                                                bool prefault = true,
+                                                HugePagePolicy huge = HugePagePolicy::Transparent) {
+        NumaRegion region(detail::map_region(bytes, huge));
+        if (!region.valid()) {
+            return region;
+        }
+
+        region.bound_ = Numa::interleave(region.data(), region.size(), nodes);
+        if (prefault) {
+            Numa::touch_pages(region.data(), region.size());
+        }
+        return region;
+    }
+
+    ~NumaRegion() { detail::unmap_region(mapping_); }
+
+    NumaRegion(const NumaRegion&) = delete;
+    NumaRegion& operator=(const NumaRegion&) = delete;
+
+    NumaRegion(NumaRegion&& other) noexcept
+        : mapping_(std::exchange(other.mapping_, {})),
+          node_(std::exchange(other.node_, numa_constants::kLocalNode)),
+          bound_(std::exchange(other.bound_, false)) {}
+
+    NumaRegion& operator=(NumaRegion&& other) noexcept {
+        if (this != &other) {
+            detail::unmap_region(mapping_);
+            mapping_ = std::exchange(other.mapping_, {});
+            node_ = std::exchange(other.node_, numa_constants::kLocalNode);
+            bound_ = std::exchange(other.bound_, false);
+        }
+        return *this;
+    }
+
+    [[nodiscard]] inline bool valid() const noexcept { return mapping_.base_ != nullptr; }
+    [[nodiscard]] inline explicit operator bool() const noexcept { return valid(); }
+    [[nodiscard]] inline void* data() const noexcept { return mapping_.base_; }
+    [[nodiscard]] inline std::size_t size() const noexcept { return mapping_.size_; }
+    [[nodiscard]] inline PageBacking backing() const noexcept { return mapping_.backing_; }
+
+    /// 目标节点（交织区域为 kLocalNode）
+    [[nodiscard]] inline int node() const noexcept { return node_; }
+
+    /// mbind 是否成功（内核不支持 NUMA 策略时为 false，内存仍可用）
+    [[nodiscard]] inline bool bound() const noexcept { return bound_; }
+
+    template <typename T>
+    [[nodiscard]] inline T* as() const noexcept {
+        return static_cast<T*>(mapping_.base_);
+    }
+
+private:
+    explicit NumaRegion(detail::Mapping mapping) noexcept : mapping_(mapping) {}
+
+    detail::Mapping mapping_{};
+    int node_{numa_constants::kLocalNode};
+    bool bound_{false};
+};
+
+}  // namespace memory
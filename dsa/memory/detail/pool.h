@@ -0,0 +1,410 @@
+/**
+ * @file pool.h
+ * @brief 无锁定长对象池（每线程缓存 + 跨线程远程释放）
+ * @version 1.0.0
+ *
+ * 面向每秒百万次同尺寸节点分配/释放（订单、定时器项、消息）：
+ * - FixedPool: 原始接口，allocate()/deallocate(p)
+ * - Pool<T>: 类型化接口，make(args...)/destroy(p)
+ *
+ * 结构：
+ * - slab: 2MB、按自身大小对齐（块地址掩码即得 slab 头），可选大页
+ * - 每线程缓存: 本线程拥有的空闲链表 + 当前切分中的 slab，快路径无原子操作
+ * - 远程释放: 其他线程释放的块压入所有者的 MPSC 链表（CAS 入栈），
+ *   所有者在本地链表耗尽时一次 exchange 整体取走，无 ABA 问题
+ * - 线程退出: 缓存被标记为遗弃，由之后的新线程接管，已缓存的块不丢失
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../../common/constants.h"
+#include "../../common/singleton.h"
+#include "arena.h"
+
+namespace memory {
+
+class FixedPool;
+
+namespace detail {
+
+/// 空闲块（复用块自身存储）
+struct FreeBlock {
+    FreeBlock* next_;
+};
+
+struct PoolThreadCache;
+
+/// slab 头部，位于 slab 起始处
+struct alignas(memory_constants::kCacheLineSize) SlabHeader {
+    PoolThreadCache* owner_{nullptr};
+    SlabHeader* next_{nullptr};
+    Mapping mapping_{};
+};
+
+/// 每线程缓存：所有者字段与远程释放链表分处不同缓存行
+struct alignas(memory_constants::kCacheLineSize) PoolThreadCache {
+    // 所有者线程独占
+    FreeBlock* free_{nullptr};
+    std::byte* bump_{nullptr};
+    std::byte* bump_end_{nullptr};
+    PoolThreadCache* next_abandoned_{nullptr};
+
+    // 其他线程写入（多生产者单消费者）
+    alignas(memory_constants::kCacheLineSize) std::atomic<FreeBlock*> remote_{nullptr};
+};
+
+/// 存活池登记表：线程退出时据此判断池是否仍存在
+class PoolRegistry : public common::singleton<PoolRegistry> {
+    friend class common::singleton<PoolRegistry>;
+
+public:
+    uint64_t add(FixedPool* pool) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const uint64_t id = ++next_id_;
+        pools_.emplace(id, pool);
+        return id;
+    }
+
+    void remove(uint64_t id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pools_.erase(id);
+    }
+
+    /// 线程退出时归还缓存（池已销毁则忽略）
+    inline void abandon(uint64_t id, PoolThreadCache* cache);
+
+private:
+    PoolRegistry() = default;
+
+    std::mutex mutex_;
+    uint64_t next_id_{0};
+    std::unordered_map<uint64_t, FixedPool*> pools_;
+};
+
+/// 最近使用的池缓存（平凡类型，thread_local 访问无初始化检查）
+struct ThreadCacheHint {
+    uint64_t last_id_;
+    PoolThreadCache* last_;
+};
+
+inline thread_local ThreadCacheHint tls_pool_hint{0, nullptr};
+
+/// 当前线程持有的各池缓存，线程退出时归还
+struct ThreadCacheSlots {
+    std::vector<std::pair<uint64_t, PoolThreadCache*>> caches_;
+
+    ~ThreadCacheSlots() {
+        for (auto [id, cache] : caches_) {
+            PoolRegistry::instance().abandon(id, cache);
+        }
+    }
+};
+
+inline thread_local ThreadCacheSlots tls_pool_caches;
+
+}  // namespace detail
+
+// =============================================================================
+// 定长对象池（原始接口）
+// =============================================================================
+
+class FixedPool {
+    friend class detail::PoolRegistry;
+
+public:
+    /// slab 大小（一个大页）
+    static constexpr std::size_t kSlabBytes = memory_constants::kHugePageSize;
+
+    /// 单块上限：保证每个 slab 至少切出若干块
+    static constexpr std::size_t kMaxBlockSize = kSlabBytes / 8;
+
+    /// block_size/alignment 会被向上调整到至少容纳一个指针；alignment 必须为 2 的幂
+    explicit FixedPool(std::size_t block_size, std::size_t alignment = alignof(std::max_align_t),
+                       HugePagePolicy policy = HugePagePolicy::None)
+        : alignment_(alignment < alignof(detail::FreeBlock) ? alignof(detail::FreeBlock) : alignment),
+          block_size_(detail::align_up(block_size < sizeof(detail::FreeBlock) ? sizeof(detail::FreeBlock)
+                                                                             : block_size,
+                                       alignment_)),
+          header_size_(detail::align_up(sizeof(detail::SlabHeader), alignment_)),
+          policy_(policy),
+          id_(detail::PoolRegistry::instance().add(this)) {}
+
+    ~FixedPool() {
+        detail::PoolRegistry::instance().remove(id_);
+
+        detail::SlabHeader* slab = slabs_;
+        while (slab != nullptr) {
+            detail::SlabHeader* next = slab->next_;
+            detail::unmap_region(slab->mapping_);
+            slab = next;
+        }
+    }
+
+    FixedPool(const FixedPool&) = delete;
+    FixedPool& operator=(const FixedPool&) = delete;
+    FixedPool(FixedPool&&) = delete;
+    FixedPool& operator=(FixedPool&&) = delete;
+
+    // -------------------------------------------------------------------------
+    // 分配 / 释放
+    // -------------------------------------------------------------------------
+
+    /// 分配一块，内存耗尽（或块过大）时返回 nullptr
+    [[nodiscard, gnu::hot]]
+    inline void* allocate() noexcept {
+        detail::PoolThreadCache* cache = local_cache();
+        if (detail::FreeBlock* block = cache->free_) [[likely]] {
+            cache->free_ = block->next_;
+            return block;
+        }
+        return allocate_slow(cache);
+    }
+
+    /// 释放任意线程分配的块
+    [[gnu::hot]]
+    inline void deallocate(void* p) noexcept {
+        if (p == nullptr) [[unlikely]] {
+            return;
+        }
+
+        auto* block = static_cast<detail::FreeBlock*>(p);
+        detail::PoolThreadCache* owner = slab_of(p)->owner_;
+        if (owner == find_cache()) [[likely]] {
+            block->next_ = owner->free_;
+            owner->free_ = block;
+            return;
+        }
+
+        // 远程释放：压入所有者的 MPSC 链表
+        detail::FreeBlock* head = owner->remote_.load(std::memory_order_relaxed);
+        do {
+            block->next_ = head;
+        } while (!owner->remote_.compare_exchange_weak(head, block, std::memory_order_release,
+                                                       std::memory_order_relaxed));
+    }
+
+    // -------------------------------------------------------------------------
+    // 查询
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline std::size_t block_size() const noexcept { return block_size_; }
+    [[nodiscard]] inline std::size_t alignment() const noexcept { return alignment_; }
+    [[nodiscard]] inline std::size_t blocks_per_slab() const noexcept {
+        return block_size_ > kMaxBlockSize ? 0 : (kSlabBytes - header_size_) / block_size_;
+    }
+    [[nodiscard]] inline HugePagePolicy policy() const noexcept { return policy_; }
+
+    [[nodiscard]] std::size_t slab_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return slab_count_;
+    }
+
+    [[nodiscard]] bool owns(const void* p) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const detail::SlabHeader* target = slab_of(p);
+        for (const detail::SlabHeader* slab = slabs_; slab != nullptr; slab = slab->next_) {
+            if (slab == target) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    [[nodiscard, gnu::always_inline]]
+    static inline detail::SlabHeader* slab_of(const void* p) noexcept {
+        const auto addr = reinterpret_cast<std::uintptr_t>(p);
+        return reinterpret_cast<detail::SlabHeader*>(addr & ~(kSlabBytes - 1));
+    }
+
+    /// 查找当前线程的缓存，不存在返回 nullptr
+    [[nodiscard, gnu::always_inline]]
+    inline detail::PoolThreadCache* find_cache() const noexcept {
+        auto& hint = detail::tls_pool_hint;
+        if (hint.last_id_ == id_) [[likely]] {
+            return hint.last_;
+        }
+        return find_cache_slow();
+    }
+
+    [[gnu::noinline]] detail::PoolThreadCache* find_cache_slow() const noexcept {
+        for (auto [id, cache] : detail::tls_pool_caches.caches_) {
+            if (id == id_) {
+                detail::tls_pool_hint = {id, cache};
+                return cache;
+            }
+        }
+        return nullptr;
+    }
+
+    /// 查找或创建当前线程的缓存
+    [[nodiscard, gnu::always_inline]]
+    inline detail::PoolThreadCache* local_cache() noexcept {
+        if (detail::PoolThreadCache* cache = find_cache()) [[likely]] {
+            return cache;
+        }
+        return attach_cache();
+    }
+
+    [[gnu::noinline]] detail::PoolThreadCache* attach_cache() noexcept {
+        detail::PoolThreadCache* cache = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (abandoned_ != nullptr) {
+                cache = abandoned_;
+                abandoned_ = cache->next_abandoned_;
+                cache->next_abandoned_ = nullptr;
+            } else {
+                caches_.push_back(std::make_unique<detail::PoolThreadCache>());
+                cache = caches_.back().get();
+            }
+        }
+
+        detail::tls_pool_caches.caches_.emplace_back(id_, cache);
+        detail::tls_pool_hint = {id_, cache};
+        return cache;
+    }
+
+    /// 线程退出：缓存（含空闲块与切分中的 slab）留给下一个线程
+    void abandon(detail::PoolThreadCache* cache) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache->next_abandoned_ = abandoned_;
+        abandoned_ = cache;
+    }
+
+    [[gnu::noinline]] void* allocate_slow(detail::PoolThreadCache* cache) noexcept {
+        // 1. 取回其他线程归还的块
+        if (detail::FreeBlock* remote = cache->remote_.exchange(nullptr, std::memory_order_acquire)) {
+            cache->free_ = remote->next_;
+            return remote;
+        }
+
+        // 2. 从当前 slab 切分
+        if (cache->bump_ + block_size_ > cache->bump_end_) {
+            if (!refill_slab(cache)) [[unlikely]] {
+                return nullptr;
+            }
+        }
+
+        void* p = cache->bump_;
+        cache->bump_ += block_size_;
+        return p;
+    }
+
+    bool refill_slab(detail::PoolThreadCache* cache) noexcept {
+        if (block_size_ > kMaxBlockSize) {
+            return false;
+        }
+
+        detail::Mapping mapping = detail::map_region(kSlabBytes, policy_, kSlabBytes);
+        if (mapping.base_ == nullptr) {
+            return false;
+        }
+
+        auto* slab = ::new (mapping.base_) detail::SlabHeader{};
+        slab->owner_ = cache;
+        slab->mapping_ = mapping;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            slab->next_ = slabs_;
+            slabs_ = slab;
+            ++slab_count_;
+        }
+
+        auto* base = static_cast<std::byte*>(mapping.base_);
+        cache->bump_ = base + header_size_;
+        cache->bump_end_ = base + kSlabBytes;
+        return true;
+    }
+
+    const std::size_t alignment_;
+    const std::size_t block_size_;
+    const std::size_t header_size_;
+    const HugePagePolicy policy_;
+    const uint64_t id_;
+
+    mutable std::mutex mutex_;
+    detail::SlabHeader* slabs_{nullptr};
+    std::size_t slab_count_{0};
+    detail::PoolThreadCache* abandoned_{nullptr};
+    std::vector<std::unique_ptr<detail::PoolThreadCache>> caches_;
+};
+
+inline void detail::PoolRegistry::abandon(uint64_t id, PoolThreadCache* cache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = pools_.find(id);
+    if (it != pools_.end()) {
+        it->second->abandon(cache);
+    }
+}
+
+// =============================================================================
+// 类型化对象池
+// =============================================================================
+
+template <typename T>
+class Pool {
+public:
+    struct Deleter {
+        Pool* pool_;
+        void operator()(T* p) const noexcept { pool_->destroy(p); }
+    };
+
+    using UniquePtr = std::unique_ptr<T, Deleter>;
+
+    explicit Pool(HugePagePolicy policy = HugePagePolicy::None) : pool_(sizeof(T), alignof(T), policy) {}
+
+    /// 构造对象，内存耗尽返回 nullptr；构造函数抛出时归还内存并继续传播
+    template <typename... Args>
+    [[nodiscard, gnu::hot]]
+    inline T* make(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+        void* p = pool_.allocate();
+        if (p == nullptr) [[unlikely]] {
+            return nullptr;
+        }
+
+        if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+            return ::new (p) T(std::forward<Args>(args)...);
+        } else {
+            try {
+                return ::new (p) T(std::forward<Args>(args)...);
+            } catch (...) {
+                pool_.deallocate(p);
+                throw;
+            }
+        }
+    }
+
+    template <typename... Args>
+    [[nodiscard]] inline UniquePtr make_unique(Args&&... args) {
+        return UniquePtr(make(std::forward<Args>(args)...), Deleter{this});
+    }
+
+    /// 析构并归还，可在任意线程调用
+    [[gnu::hot]]
+    inline void destroy(T* p) noexcept {
+        if (p != nullptr) [[likely]] {
+            p->~T();
+            pool_.deallocate(p);
+        }
+    }
+
+    [[nodiscard]] inline FixedPool& raw() noexcept { return pool_; }
+    [[nodiscard]] inline const FixedPool& raw() const noexcept { return pool_; }
+
+private:
+    FixedPool pool_;
+};
+
+}  // namespace memory
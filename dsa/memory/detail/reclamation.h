@@ -0,0 +1,685 @@
+/**
+ * @file reclamation.h
+ * @brief 无锁结构的安全内存回收：基于纪元（EBR）与风险指针（HP）
+ * @version 1.0.0
+ *
+ * 无锁容器摘除节点后，其他线程可能仍持有该节点指针，不能立即释放：
+ * - EpochDomain: 读者进入临界区时发布全局纪元，退休对象在全局纪元前进两次后释放。
+ *   读者开销为一次发布 + 一次轻量全屏障，可覆盖任意多次读取；垃圾量受最慢读者影响而无上界
+ * - HazardDomain: 读者对每个要访问的指针单独登记风险指针，扫描时跳过被登记的对象。
+ *   每次保护都需屏障，但未释放对象数有上界（退休阈值 + 线程数 × 每线程风险指针数）
+ *
+ * 两者共用每线程记录管理：记录首次使用时创建并挂入域的链表，线程退出后留待复用，
+ * 未释放的退休对象转交域统一回收。
+ *
+ * 用法：
+ *   auto guard = domain.pin();                    // EBR 读者
+ *   const Table* t = table_.load(std::memory_order_acquire);
+ *   ...
+ *   domain.retire(table_.exchange(next));         // 写者摘除后退休
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../../common/constants.h"
+#include "../../common/intrinsics.h"
+#include "../../common/singleton.h"
+
+namespace memory {
+
+using namespace common;
+
+namespace detail {
+
+// =============================================================================
+// 公共部分：退休对象与每线程记录管理
+// =============================================================================
+
+/// 退休对象：指针、删除函数与退休时的纪元（HP 不使用纪元）
+struct Retired {
+    void* ptr_;
+    void (*deleter_)(void*);
+    uint64_t epoch_;
+
+    inline void reclaim() const noexcept { deleter_(ptr_); }
+};
+
+template <typename T>
+void delete_retired(void* p) noexcept {
+    delete static_cast<T*>(p);
+}
+
+template <typename Record>
+class RecordManager;
+
+/// 存活域登记表：线程退出时据此判断域是否仍存在
+template <typename Record>
+class RecordRegistry : public common::singleton<RecordRegistry<Record>> {
+    friend class common::singleton<RecordRegistry<Record>>;
+
+public:
+    uint64_t add(RecordManager<Record>* manager) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const uint64_t id = ++next_id_;
+        managers_.emplace(id, manager);
+        return id;
+    }
+
+    void remove(uint64_t id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        managers_.erase(id);
+    }
+
+    /// 线程退出时归还记录（域已销毁则忽略）
+    inline void detach(uint64_t id, Record* record);
+
+private:
+    RecordRegistry() = default;
+
+    std::mutex mutex_;
+    uint64_t next_id_{0};
+    std::unordered_map<uint64_t, RecordManager<Record>*> managers_;
+};
+
+/// 最近使用的记录（平凡类型，thread_local 访问无初始化检查）
+template <typename Record>
+struct RecordHint {
+    uint64_t last_id_;
+    Record* last_;
+};
+
+template <typename Record>
+struct ThreadRecords;
+
+/// 当前线程持有的各域记录，线程退出时归还
+template <typename Record>
+struct RecordSlots {
+    std::vector<std::pair<uint64_t, Record*>> records_;
+
+    ~RecordSlots() {
+        for (auto [id, record] : records_) {
+            RecordRegistry<Record>::instance().detach(id, record);
+        }
+        ThreadRecords<Record>::hint_ = {0, nullptr};
+    }
+};
+
+/// 每线程状态（类模板静态成员：GCC 不会为 thread_local 变量模板注册析构）
+template <typename Record>
+struct ThreadRecords {
+    static inline thread_local RecordHint<Record> hint_{0, nullptr};
+    static inline thread_local RecordSlots<Record> slots_;
+};
+
+/**
+ * @brief 每线程记录管理
+ *
+ * 记录只增不删（域析构时统一释放），扫描者可无锁遍历链表；
+ * Record 需提供 next_、in_use_ 与 retired_ 成员
+ */
+template <typename Record>
+class RecordManager {
+public:
+    RecordManager() : id_(RecordRegistry<Record>::instance().add(this)) {}
+
+    ~RecordManager() {
+        RecordRegistry<Record>::instance().remove(id_);
+
+        Record* record = head_.load(std::memory_order_acquire);
+        while (record != nullptr) {
+            Record* next = record->next_;
+            for (const auto& r : record->retired_) {
+                r.reclaim();
+            }
+            delete record;
+            record = next;
+        }
+        for (const auto& r : orphans_) {
+            r.reclaim();
+        }
+    }
+
+    RecordManager(const RecordManager&) = delete;
+    RecordManager& operator=(const RecordManager&) = delete;
+
+    /// 查找或创建当前线程的记录
+    [[nodiscard, gnu::hot, gnu::always_inline]]
+    inline Record* local() noexcept {
+        auto& hint = ThreadRecords<Record>::hint_;
+        if (hint.last_id_ == id_) [[likely]] {
+            return hint.last_;
+        }
+        return local_slow();
+    }
+
+    /// 遍历所有在用记录（无锁，可与 local() 并发）
+    template <typename Fn>
+    inline void for_each(Fn&& fn) const noexcept {
+        for (Record* r = head_.load(std::memory_order_acquire); r != nullptr; r = r->next_) {
+            if (r->in_use_.load(std::memory_order_acquire)) {
+                fn(*r);
+            }
+        }
+    }
+
+    /// 记录总数（含空闲待复用的）
+    [[nodiscard]] inline std::size_t size() const noexcept {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    /// 线程退出：退休对象转为孤儿，记录留待复用
+    void detach(Record* record) noexcept {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            orphans_.insert(orphans_.end(), record->retired_.begin(), record->retired_.end());
+            orphan_count_.store(orphans_.size(), std::memory_order_relaxed);
+        }
+        record->retired_.clear();
+        record->in_use_.store(false, std::memory_order_release);
+    }
+
+    /// 释放满足 pred 的孤儿对象，返回释放数
+    template <typename Pred>
+    std::size_t reclaim_orphans(Pred&& pred) noexcept {
+        if (orphan_count_.load(std::memory_order_relaxed) == 0) {
+            return 0;
+        }
+
+        std::vector<Retired> ready;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = std::stable_partition(orphans_.begin(), orphans_.end(),
+                                            [&](const Retired& r) { return !pred(r); });
+            ready.assign(it, orphans_.end());
+            orphans_.erase(it, orphans_.end());
+            orphan_count_.store(orphans_.size(), std::memory_order_relaxed);
+        }
+        for (const auto& r : ready) {
+            r.reclaim();
+        }
+        return ready.size();
+    }
+
+    [[nodiscard]] inline std::size_t orphan_count() const noexcept {
+        return orphan_count_.load(std::memory_order_relaxed);
+    }
+
+private:
+    [[gnu::noinline]] Record* local_slow() noexcept {
+        for (auto [id, record] : ThreadRecords<Record>::slots_.records_) {
+            if (id == id_) {
+                ThreadRecords<Record>::hint_ = {id, record};
+                return record;
+            }
+        }
+        return attach();
+    }
+
+    [[gnu::noinline]] Record* attach() noexcept {
+        // 1. 复用已退出线程的记录
+        Record* record = nullptr;
+        for (Record* r = head_.load(std::memory_order_acquire); r != nullptr; r = r->next_) {
+            bool expected = false;
+            if (!r->in_use_.load(std::memory_order_relaxed) &&
+                r->in_use_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                record = r;
+                break;
+            }
+        }
+
+        // 2. 新建并挂入链表头
+        if (record == nullptr) {
+            record = new Record();
+            Record* head = head_.load(std::memory_order_relaxed);
+            do {
+                record->next_ = head;
+            } while (!head_.compare_exchange_weak(head, record, std::memory_order_release,
+                                                  std::memory_order_relaxed));
+            count_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        ThreadRecords<Record>::slots_.records_.emplace_back(id_, record);
+        ThreadRecords<Record>::hint_ = {id_, record};
+        return record;
+    }
+
+    const uint64_t id_;
+    std::atomic<Record*> head_{nullptr};
+    std::atomic<std::size_t> count_{0};
+
+    std::mutex mutex_;
+    std::vector<Retired> orphans_;
+    std::atomic<std::size_t> orphan_count_{0};
+};
+
+template <typename Record>
+inline void RecordRegistry<Record>::detach(uint64_t id, Record* record) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = managers_.find(id);
+    if (it != managers_.end()) {
+        it->second->detach(record);
+    }
+}
+
+// =============================================================================
+// EBR 每线程记录
+// =============================================================================
+
+/// 纪元记录：发布的纪元、扫描者读取的链表字段、所有者私有字段分处不同缓存行
+struct alignas(memory_constants::kCacheLineSize) EpochRecord {
+    /// 未处于临界区
+    static constexpr uint64_t kQuiescent = 0;
+
+    // 所有者发布，回收者扫描
+    std::atomic<uint64_t> epoch_{kQuiescent};
+
+    // 扫描者读取
+    alignas(memory_constants::kCacheLineSize) EpochRecord* next_{nullptr};
+    std::atomic<bool> in_use_{true};
+
+    // 所有者线程独占
+    alignas(memory_constants::kCacheLineSize) uint32_t depth_{0};
+    std::size_t next_scan_{0};
+    std::vector<Retired> retired_;
+};
+
+// =============================================================================
+// HP 每线程记录
+// =============================================================================
+
+/// 每线程风险指针数
+inline constexpr std::size_t kHazardsPerThread = 4;
+
+struct alignas(memory_constants::kCacheLineSize) HazardRecord {
+    // 所有者发布，回收者扫描
+    std::array<std::atomic<const void*>, kHazardsPerThread> slots_{};
+
+    // 扫描者读取
+    alignas(memory_constants::kCacheLineSize) HazardRecord* next_{nullptr};
+    std::atomic<bool> in_use_{true};
+
+    // 所有者线程独占
+    alignas(memory_constants::kCacheLineSize) uint32_t used_{0};
+    std::size_t next_scan_{0};
+    std::vector<Retired> retired_;
+    std::vector<const void*> scratch_;
+};
+
+}  // namespace detail
+
+// =============================================================================
+// 基于纪元的回收
+// =============================================================================
+
+class EpochDomain {
+public:
+    /// 每累计这么多退休对象尝试一次推进与回收（摊销扫描开销）
+    static constexpr std::size_t kRetireBatch = 64;
+
+    /// 读者临界区（可嵌套）；必须在创建它的线程上析构
+    class Guard {
+    public:
+        explicit Guard(EpochDomain& domain) noexcept : domain_(&domain), record_(domain.enter()) {}
+
+        ~Guard() {
+            if (record_ != nullptr) {
+                domain_->leave(record_);
+            }
+        }
+
+        Guard(Guard&& other) noexcept
+            : domain_(other.domain_), record_(std::exchange(other.record_, nullptr)) {}
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+
+    private:
+        EpochDomain* domain_;
+        detail::EpochRecord* record_;
+    };
+
+    EpochDomain() = default;
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    /// 进程级默认域
+    [[nodiscard]] static EpochDomain& global() noexcept {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    /// 进入读者临界区
+    [[nodiscard, gnu::hot, gnu::always_inline]]
+    inline Guard pin() noexcept {
+        return Guard(*this);
+    }
+
+    /// 退休对象（须已从共享结构摘除），由 delete 释放
+    template <typename T>
+    [[gnu::hot]]
+    inline void retire(T* p) noexcept {
+        retire(p, &detail::delete_retired<T>);
+    }
+
+    /// 退休对象，由 deleter 释放
+    [[gnu::hot]]
+    inline void retire(void* p, void (*deleter)(void*)) noexcept {
+        if (p == nullptr) [[unlikely]] {
+            return;
+        }
+
+        detail::EpochRecord* record = records_.local();
+        record->retired_.push_back({p, deleter, global_epoch_.load(std::memory_order_relaxed)});
+        retired_total_.fetch_add(1, std::memory_order_relaxed);
+        if (record->retired_.size() >= record->next_scan_) [[unlikely]] {
+            collect_batch(record);
+        }
+    }
+
+    /// 所有在临界区内的读者都已观察到当前纪元时，推进全局纪元
+    bool try_advance() noexcept {
+        uint64_t epoch = global_epoch_.load(std::memory_order_relaxed);
+
+        // 与读者发布纪元后的屏障配对：之后读取的发布值不会早于读者开始读取共享数据
+        mfence_light();
+
+        bool all_current = true;
+        records_.for_each([&](const detail::EpochRecord& r) {
+            const uint64_t e = r.epoch_.load(std::memory_order_acquire);
+            if (e != detail::EpochRecord::kQuiescent && e != epoch) {
+                all_current = false;
+            }
+        });
+
+        return all_current &&
+               global_epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel,
+                                                     std::memory_order_relaxed);
+    }
+
+    /// 释放当前线程与孤儿列表中已安全的对象，返回释放数
+    std::size_t reclaim() noexcept { return reclaim_record(records_.local()) + reclaim_orphans(); }
+
+    /// 尽力回收：多次推进纪元并回收；没有读者停留在临界区时可释放当前线程的全部退休对象
+    std::size_t synchronize() noexcept {
+        std::size_t freed = 0;
+        for (int i = 0; i < 3; ++i) {
+            (void)try_advance();
+            freed += reclaim();
+        }
+        return freed;
+    }
+
+    // -------------------------------------------------------------------------
+    // 查询
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline uint64_t epoch() const noexcept {
+        return global_epoch_.load(std::memory_order_relaxed);
+    }
+
+    /// 已退休尚未释放的对象数（近似值）
+    [[nodiscard]] inline std::size_t pending() const noexcept {
+        return retired_total_.load(std::memory_order_relaxed) -
+               reclaimed_total_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] inline std::size_t thread_records() const noexcept { return records_.size(); }
+
+private:
+    [[gnu::hot, gnu::always_inline]]
+    inline detail::EpochRecord* enter() noexcept {
+        detail::EpochRecord* record = records_.local();
+        if (record->depth_++ == 0) {
+            record->epoch_.store(global_epoch_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            // StoreLoad：发布纪元先于后续对共享数据的读取
+            mfence_light();
+        }
+        return record;
+    }
+
+    [[gnu::hot, gnu::always_inline]]
+    inline void leave(detail::EpochRecord* record) noexcept {
+        if (--record->depth_ == 0) {
+            record->epoch_.store(detail::EpochRecord::kQuiescent, std::memory_order_release);
+        }
+    }
+
+    [[gnu::noinline]] void collect_batch(detail::EpochRecord* record) noexcept {
+        (void)try_advance();
+        (void)reclaim_record(record);
+        (void)reclaim_orphans();
+        record->next_scan_ = record->retired_.size() + kRetireBatch;
+    }
+
+    /// 退休纪元比当前纪元早两个及以上的对象不再被任何读者引用
+    [[nodiscard]] inline bool safe(const detail::Retired& r, uint64_t epoch) const noexcept {
+        return r.epoch_ + 2 <= epoch;
+    }
+
+    std::size_t reclaim_record(detail::EpochRecord* record) noexcept {
+        const uint64_t epoch = global_epoch_.load(std::memory_order_acquire);
+        auto& retired = record->retired_;
+
+        // 退休纪元单调不减，可安全释放的对象构成前缀
+        auto it = std::find_if(retired.begin(), retired.end(),
+                               [&](const detail::Retired& r) { return !safe(r, epoch); });
+        for (auto p = retired.begin(); p != it; ++p) {
+            p->reclaim();
+        }
+        const auto freed = static_cast<std::size_t>(it - retired.begin());
+        retired.erase(retired.begin(), it);
+        reclaimed_total_.fetch_add(freed, std::memory_order_relaxed);
+        return freed;
+    }
+
+    std::size_t reclaim_orphans() noexcept {
+        const uint64_t epoch = global_epoch_.load(std::memory_order_acquire);
+        const std::size_t freed =
+            records_.reclaim_orphans([&](const detail::Retired& r) { return safe(r, epoch); });
+        reclaimed_total_.fetch_add(freed, std::memory_order_relaxed);
+        return freed;
+    }
+
+    // 全局纪元独占缓存行：读者只读，推进时才写
+    alignas(memory_constants::kCacheLineSize) std::atomic<uint64_t> global_epoch_{1};
+
+    alignas(memory_constants::kCacheLineSize) detail::RecordManager<detail::EpochRecord> records_;
+    std::atomic<std::size_t> retired_total_{0};
+    std::atomic<std::size_t> reclaimed_total_{0};
+};
+
+// =============================================================================
+// 风险指针
+// =============================================================================
+
+class HazardDomain {
+public:
+    static constexpr std::size_t kHazardsPerThread = detail::kHazardsPerThread;
+
+    /// 退休阈值下限；实际阈值随线程数增长（2 × 全部风险指针数），保证每次扫描至少释放一半
+    static constexpr std::size_t kRetireThreshold = 64;
+
+    /// 单个风险指针；必须在创建它的线程上使用与析构
+    class HazardPointer {
+    public:
+        HazardPointer() noexcept = default;
+
+        HazardPointer(detail::HazardRecord* record, uint32_t index) noexcept
+            : record_(record), index_(index) {}
+
+        ~HazardPointer() { release(); }
+
+        HazardPointer(HazardPointer&& other) noexcept
+            : record_(std::exchange(other.record_, nullptr)), index_(other.index_) {}
+
+        HazardPointer& operator=(HazardPointer&& other) noexcept {
+            if (this != &other) {
+                release();
+                record_ = std::exchange(other.record_, nullptr);
+                index_ = other.index_;
+            }
+            return *this;
+        }
+
+        HazardPointer(const HazardPointer&) = delete;
+        HazardPointer& operator=(const HazardPointer&) = delete;
+
+        /// 是否持有槽位（每线程槽位耗尽时为 false）
+        [[nodiscard]] inline bool valid() const noexcept { return record_ != nullptr; }
+
+        /// 读取并保护 src 当前指向的对象；返回后对象在 reset() 前不会被释放
+        template <typename T>
+        [[nodiscard, gnu::hot]]
+        inline T* protect(const std::atomic<T*>& src) noexcept {
+            T* p = src.load(std::memory_order_relaxed);
+            while (true) {
+                slot().store(p, std::memory_order_relaxed);
+                // StoreLoad：登记先于复查
+                mfence_light();
+                T* again = src.load(std::memory_order_acquire);
+                if (again == p) [[likely]] {
+                    return p;
+                }
+                p = again;
+            }
+        }
+
+        /// 直接登记指针（调用方须自行复查其仍可达）
+        inline void set(const void* p) noexcept {
+            slot().store(p, std::memory_order_relaxed);
+            mfence_light();
+        }
+
+        inline void reset() noexcept { slot().store(nullptr, std::memory_order_release); }
+
+    private:
+        [[nodiscard, gnu::always_inline]]
+        inline std::atomic<const void*>& slot() const noexcept {
+            return record_->slots_[index_];
+        }
+
+        void release() noexcept {
+            if (record_ != nullptr) {
+                reset();
+                record_->used_ &= ~(1U << index_);
+                record_ = nullptr;
+            }
+        }
+
+        detail::HazardRecord* record_{nullptr};
+        uint32_t index_{0};
+    };
+
+    HazardDomain() = default;
+    HazardDomain(const HazardDomain&) = delete;
+    HazardDomain& operator=(const HazardDomain&) = delete;
+
+    /// 进程级默认域
+    [[nodiscard]] static HazardDomain& global() noexcept {
+        static HazardDomain domain;
+        return domain;
+    }
+
+    /// 获取当前线程的一个空闲风险指针；超过 kHazardsPerThread 时返回无效对象
+    [[nodiscard]] HazardPointer make_hazard() noexcept {
+        detail::HazardRecord* record = records_.local();
+        for (uint32_t i = 0; i < kHazardsPerThread; ++i) {
+            if ((record->used_ & (1U << i)) == 0) {
+                record->used_ |= 1U << i;
+                return HazardPointer(record, i);
+            }
+        }
+        return HazardPointer();
+    }
+
+    template <typename T>
+    [[gnu::hot]]
+    inline void retire(T* p) noexcept {
+        retire(p, &detail::delete_retired<T>);
+    }
+
+    [[gnu::hot]]
+    inline void retire(void* p, void (*deleter)(void*)) noexcept {
+        if (p == nullptr) [[unlikely]] {
+            return;
+        }
+
+        detail::HazardRecord* record = records_.local();
+        record->retired_.push_back({p, deleter, 0});
+        retired_total_.fetch_add(1, std::memory_order_relaxed);
+        if (record->retired_.size() >= record->next_scan_) [[unlikely]] {
+            (void)scan(record);
+            record->next_scan_ = record->retired_.size() + threshold();
+        }
+    }
+
+    /// 扫描所有风险指针，释放当前线程与孤儿列表中未被保护的对象，返回释放数
+    std::size_t scan() noexcept { return scan(records_.local()); }
+
+    // -------------------------------------------------------------------------
+    // 查询
+    // -------------------------------------------------------------------------
+
+    /// 当前退休阈值
+    [[nodiscard]] inline std::size_t threshold() const noexcept {
+        return std::max(kRetireThreshold, 2 * kHazardsPerThread * records_.size());
+    }
+
+    [[nodiscard]] inline std::size_t pending() const noexcept {
+        return retired_total_.load(std::memory_order_relaxed) -
+               reclaimed_total_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] inline std::size_t thread_records() const noexcept { return records_.size(); }
+
+private:
+    std::size_t scan(detail::HazardRecord* record) noexcept {
+        // 与读者登记后的屏障配对
+        mfence_light();
+
+        auto& hazards = record->scratch_;
+        hazards.clear();
+        records_.for_each([&](const detail::HazardRecord& r) {
+            for (const auto& s : r.slots_) {
+                if (const void* p = s.load(std::memory_order_acquire)) {
+                    hazards.push_back(p);
+                }
+            }
+        });
+        std::sort(hazards.begin(), hazards.end());
+
+        auto unprotected = [&](const detail::Retired& r) {
+            return !std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(r.ptr_));
+        };
+
+        auto& retired = record->retired_;
+        auto it = std::stable_partition(retired.begin(), retired.end(),
+                                        [&](const detail::Retired& r) { return !unprotected(r); });
+        for (auto p = it; p != retired.end(); ++p) {
+            p->reclaim();
+        }
+        std::size_t freed = static_cast<std::size_t>(retired.end() - it);
+        retired.erase(it, retired.end());
+
+        freed += records_.reclaim_orphans(unprotected);
+        reclaimed_total_.fetch_add(freed, std::memory_order_relaxed);
+        return freed;
+    }
+
+    alignas(memory_constants::kCacheLineSize) detail::RecordManager<detail::HazardRecord> records_;
+    std::atomic<std::size_t> retired_total_{0};
+    std::atomic<std::size_t> reclaimed_total_{0};
+};
+
+}  // namespace memory
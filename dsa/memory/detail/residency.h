@@ -0,0 +1,217 @@
+/**
+ * @file residency.h
+ * @brief 内存驻留工具：预缺页、mlock、缺页计数
+ * @version 1.0.0
+ *
+ * 启动后的尾延迟主要来自首次触及时的缺页。本模块在预热阶段把内存提前变为常驻：
+ * - Residency::prefault_*: 每 kPageSize 触及一个字节，或 MADV_POPULATE_READ/WRITE 由内核一次完成
+ * - Residency::lock_all/lock: mlockall/mlock，防止常驻页被换出
+ * - Residency::prefault_stack: 热线程预先触及栈空间
+ * - FaultCounts/FaultProbe: getrusage 缺页计数，稳态下可断言零缺页
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../../common/constants.h"
+#include "../../common/macros.h"
+
+namespace memory {
+
+using namespace common;
+
+// =============================================================================
+// 缺页计数
+// =============================================================================
+
+struct FaultCounts {
+    long minor_{0};  // 无需 I/O 的缺页（首次触及匿名页）
+    long major_{0};  // 需要 I/O 的缺页
+
+    [[nodiscard]] inline long total() const noexcept { return minor_ + major_; }
+
+    friend inline FaultCounts operator-(const FaultCounts& a, const FaultCounts& b) noexcept {
+        return {a.minor_ - b.minor_, a.major_ - b.major_};
+    }
+};
+
+// =============================================================================
+// 驻留工具
+// =============================================================================
+
+struct Residency {
+    /// 默认栈预缺页大小
+    static constexpr std::size_t kDefaultStackPrefault = 256 * 1024;
+
+    /// 栈预缺页时保留的余量（避免触及保护页）
+    static constexpr std::size_t kStackSafetyMargin = 64 * 1024;
+
+    // -------------------------------------------------------------------------
+    // 缺页计数
+    // -------------------------------------------------------------------------
+
+    /// 当前缺页计数；per_thread 为 true 时只统计调用线程（RUSAGE_THREAD）
+    [[nodiscard]] static FaultCounts fault_counts(bool per_thread = false) noexcept {
+        struct rusage usage{};
+        if (::getrusage(per_thread ? RUSAGE_THREAD : RUSAGE_SELF, &usage) != 0) {
+            return {};
+        }
+        return {usage.ru_minflt, usage.ru_majflt};
+    }
+
+    // -------------------------------------------------------------------------
+    // 预缺页
+    // -------------------------------------------------------------------------
+
+    /// 每页读一个字节（匿名内存只映射零页，写时仍会缺页；适合只读文件映射）
+    static void prefault_read(const void* addr, std::size_t len) noexcept {
+        const auto* p = static_cast<const volatile char*>(addr);
+        for (std::size_t off = 0; off < len; off += memory_constants::kPageSize) {
+            (void)p[off];
+        }
+        if (len > 0) {
+            (void)p[len - 1];
+        }
+    }
+
+    /// 每页读后原值写回，触发写缺页且不改变内容（不可与其他线程的写入并发）
+    static void prefault_write(void* addr, std::size_t len) noexcept {
+        auto* p = static_cast<volatile char*>(addr);
+        for (std::size_t off = 0; off < len; off += memory_constants::kPageSize) {
+            p[off] = p[off];
+        }
+        if (len > 0) {
+            p[len - 1] = p[len - 1];
+        }
+    }
+
+    /// 由内核一次填充页表（Linux 5.14+ MADV_POPULATE_WRITE/READ），不支持时退化为逐页触及
+    /// 返回 true 表示由内核完成
+    static bool populate(void* addr, std::size_t len, bool write = true) noexcept {
+        if (addr == nullptr || len == 0) {
+            return false;
+        }
+
+        const auto begin = reinterpret_cast<std::uintptr_t>(addr) & ~(memory_constants::kPageSize - 1);
+        const std::size_t span = reinterpret_cast<std::uintptr_t>(addr) + len - begin;
+        const int advice = write ? kMadvPopulateWrite : kMadvPopulateRead;
+        if (::madvise(reinterpret_cast<void*>(begin), span, advice) == 0) {
+            return true;
+        }
+
+        if (write) {
+            prefault_write(addr, len);
+        } else {
+            prefault_read(addr, len);
+        }
+        return false;
+    }
+
+    /// 预先触及调用线程的栈（自当前栈帧向下 bytes 字节），用于绑核的热线程
+    /// 返回实际触及的字节数（受栈大小限制）
+    [[gnu::noinline]]
+    static std::size_t prefault_stack(std::size_t bytes = kDefaultStackPrefault) noexcept {
+        const std::size_t limit = stack_size();
+        if (limit <= kStackSafetyMargin) {
+            return 0;
+        }
+        if (bytes > limit - kStackSafetyMargin) {
+            bytes = limit - kStackSafetyMargin;
+        }
+
+        // 栈向低地址增长：从靠近当前栈帧的一端开始逐页向下触及
+        auto* p = static_cast<volatile char*>(__builtin_alloca(bytes));
+        constexpr std::size_t kPage = memory_constants::kPageSize;
+        for (std::size_t off = bytes; off >= kPage; off -= kPage) {
+            p[off - 1] = 0;
+        }
+        p[0] = 0;
+        DONT_OPTIMIZE(p);
+        return bytes;
+    }
+
+    /// 调用线程的栈大小（主线程取 RLIMIT_STACK）
+    [[nodiscard]] static std::size_t stack_size() noexcept {
+        pthread_attr_t attr;
+        std::size_t size = 0;
+        if (::pthread_getattr_np(::pthread_self(), &attr) == 0) {
+            void* addr = nullptr;
+            (void)::pthread_attr_getstack(&attr, &addr, &size);
+            ::pthread_attr_destroy(&attr);
+        }
+
+        if (size == 0) {
+            struct rlimit rl{};
+            if (::getrlimit(RLIMIT_STACK, &rl) == 0 && rl.rlim_cur != RLIM_INFINITY) {
+                size = static_cast<std::size_t>(rl.rlim_cur);
+            }
+        }
+        return size;
+    }
+
+    // -------------------------------------------------------------------------
+    // 锁定
+    // -------------------------------------------------------------------------
+
+    /// RLIMIT_MEMLOCK 是否不受限（否则 MCL_FUTURE 可能使后续 mmap 失败）
+    [[nodiscard]] static bool memlock_unlimited() noexcept {
+        struct rlimit rl{};
+        return ::getrlimit(RLIMIT_MEMLOCK, &rl) == 0 && rl.rlim_cur == RLIM_INFINITY;
+    }
+
+    /// 锁定当前（及之后，future 为 true 时）全部映射，锁定时立即分配物理页
+    [[nodiscard]] static bool lock_all(bool future = true) noexcept {
+        return ::mlockall(MCL_CURRENT | (future ? MCL_FUTURE : 0)) == 0;
+    }
+
+    static bool unlock_all() noexcept { return ::munlockall() == 0; }
+
+    /// 锁定区间（同时完成预缺页）
+    [[nodiscard]] static bool lock(const void* addr, std::size_t len) noexcept {
+        return ::mlock(addr, len) == 0;
+    }
+
+    static bool unlock(const void* addr, std::size_t len) noexcept { return ::munlock(addr, len) == 0; }
+
+private:
+    // 旧版头文件可能缺少定义，取值来自 <linux/mman.h>
+#ifdef MADV_POPULATE_READ
+    static constexpr int kMadvPopulateRead = MADV_POPULATE_READ;
+#else
+    static constexpr int kMadvPopulateRead = 22;
+#endif
+#ifdef MADV_POPULATE_WRITE
+    static constexpr int kMadvPopulateWrite = MADV_POPULATE_WRITE;
+#else
+    static constexpr int kMadvPopulateWrite = 23;
+#endif
+};
+
+// =============================================================================
+// 缺页探针
+// =============================================================================
+
+/// 记录构造以来的缺页增量，用于断言稳态零缺页
+class FaultProbe {
+public:
+    explicit FaultProbe(bool per_thread = false) noexcept
+        : per_thread_(per_thread), start_(Residency::fault_counts(per_thread)) {}
+
+    [[nodiscard]] inline FaultCounts delta() const noexcept {
+        return Residency::fault_counts(per_thread_) - start_;
+    }
+
+    inline void restart() noexcept { start_ = Residency::fault_counts(per_thread_); }
+
+private:
+    bool per_thread_;
+    FaultCounts start_;
+};
+
+}  // namespace memory
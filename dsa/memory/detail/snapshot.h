@@ -0,0 +1,247 @@
+/**
+ * @file snapshot.h
+ * @brief RCU 风格的单写多读版本化快照发布器
+ * @version 1.0.0
+ *
+ * 面向每条消息都要读取、每天只更新几次的参考数据（合约定义、风控限额）：
+ * - 读者: 一次 acquire 加载得到稳定指针，无引用计数、无原子读-改-写
+ * - 写者: 发布新版本，旧版本在宽限期结束后释放
+ * - 宽限期: 基于静止状态（QSBR）。每个读者在自己的缓存行上维护静止计数器，
+ *   在两条消息之间调用 quiescent() 声明不再持有之前取得的指针；
+ *   旧版本发布时记录各读者计数器，所有在线读者的计数器都变化后即可释放
+ *
+ * 用法：
+ *   SnapshotPublisher<Limits> limits(std::make_unique<Limits>(...));
+ *   auto reader = limits.register_reader();       // 每个读者线程一次
+ *   for (msg : feed) { check(*reader.get(), msg); reader.quiescent(); }
+ *   limits.publish(std::make_unique<Limits>(...)); // 写者线程
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../../common/constants.h"
+#include "../../common/intrinsics.h"
+
+namespace memory {
+
+using namespace common;
+
+namespace detail {
+
+/// 读者槽位：静止计数器与在线标志独占缓存行，读者写、写者扫描
+struct alignas(memory_constants::kCacheLineSize) QuiescentSlot {
+    std::atomic<uint64_t> counter_{0};
+    std::atomic<bool> online_{false};
+    std::atomic<bool> claimed_{false};
+};
+
+}  // namespace detail
+
+template <typename T>
+class SnapshotPublisher {
+public:
+    /// 最大同时注册的读者数
+    static constexpr std::size_t kMaxReaders = 64;
+
+    /// 读者句柄（每个读者线程一个）；析构时注销
+    class Reader {
+    public:
+        Reader() noexcept = default;
+
+        Reader(SnapshotPublisher* publisher, detail::QuiescentSlot* slot) noexcept
+            : publisher_(publisher), slot_(slot) {}
+
+        ~Reader() { release(); }
+
+        Reader(Reader&& other) noexcept
+            : publisher_(other.publisher_), slot_(std::exchange(other.slot_, nullptr)) {}
+
+        Reader& operator=(Reader&& other) noexcept {
+            if (this != &other) {
+                release();
+                publisher_ = other.publisher_;
+                slot_ = std::exchange(other.slot_, nullptr);
+            }
+            return *this;
+        }
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        /// 注册成功（读者数未超过 kMaxReaders）
+        [[nodiscard]] inline bool valid() const noexcept { return slot_ != nullptr; }
+
+        /// 当前快照：一次 acquire 加载；下次 quiescent()/offline() 前指针保持有效
+        [[nodiscard, gnu::hot, gnu::always_inline]]
+        inline const T* get() const noexcept {
+            return publisher_->current_.load(std::memory_order_acquire);
+        }
+
+        /// 声明不再持有之前取得的快照指针（单写者计数器，普通 release 存储）
+        [[gnu::hot, gnu::always_inline]]
+        inline void quiescent() noexcept {
+            slot_->counter_.store(slot_->counter_.load(std::memory_order_relaxed) + 1,
+                                  std::memory_order_release);
+        }
+
+        /// 长时间不读取（如阻塞等待）前下线，避免拖住写者的宽限期
+        inline void offline() noexcept {
+            quiescent();
+            slot_->online_.store(false, std::memory_order_release);
+        }
+
+        /// 重新上线；之后才可调用 get()
+        inline void online() noexcept {
+            slot_->online_.store(true, std::memory_order_relaxed);
+            // StoreLoad：上线先于之后读取快照，写者不会漏掉该读者
+            mfence_light();
+        }
+
+    private:
+        void release() noexcept {
+            if (slot_ != nullptr) {
+                offline();
+                slot_->claimed_.store(false, std::memory_order_release);
+                slot_ = nullptr;
+            }
+        }
+
+        SnapshotPublisher* publisher_{nullptr};
+        detail::QuiescentSlot* slot_{nullptr};
+    };
+
+    explicit SnapshotPublisher(std::unique_ptr<T> initial) noexcept : current_(initial.release()) {}
+
+    /// 析构时须已无读者
+    ~SnapshotPublisher() {
+        delete current_.load(std::memory_order_relaxed);
+        for (auto& r : retired_) {
+            delete r.value_;
+        }
+    }
+
+    SnapshotPublisher(const SnapshotPublisher&) = delete;
+    SnapshotPublisher& operator=(const SnapshotPublisher&) = delete;
+
+    // -------------------------------------------------------------------------
+    // 读者
+    // -------------------------------------------------------------------------
+
+    /// 注册读者并上线；槽位耗尽时返回无效句柄
+    [[nodiscard]] Reader register_reader() noexcept {
+        for (auto& slot : slots_) {
+            bool expected = false;
+            if (!slot.claimed_.load(std::memory_order_relaxed) &&
+                slot.claimed_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                Reader reader(this, &slot);
+                reader.online();
+                return reader;
+            }
+        }
+        return Reader();
+    }
+
+    /// 写者线程读取当前版本（读者应使用 Reader::get()）
+    [[nodiscard]] inline const T* load() const noexcept { return current_.load(std::memory_order_acquire); }
+
+    // -------------------------------------------------------------------------
+    // 写者（单线程）
+    // -------------------------------------------------------------------------
+
+    /// 发布新版本，旧版本进入宽限期；顺带释放宽限期已结束的旧版本
+    void publish(std::unique_ptr<T> next) {
+        T* old = current_.exchange(next.release(), std::memory_order_acq_rel);
+        ++version_;
+
+        // exchange 为带 lock 前缀的全屏障：此后记录的计数器晚于新指针可见
+        Retired retired{old, {}};
+        for (std::size_t i = 0; i < kMaxReaders; ++i) {
+            retired.counters_[i] = slots_[i].counter_.load(std::memory_order_acquire);
+        }
+        retired_.push_back(std::move(retired));
+
+        (void)reclaim();
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        publish(std::make_unique<T>(std::forward<Args>(args)...));
+    }
+
+    /// 释放宽限期已结束的旧版本，返回释放数
+    std::size_t reclaim() noexcept {
+        std::size_t freed = 0;
+        auto it = retired_.begin();
+        // 宽限期按发布顺序结束，只需检查前缀
+        while (it != retired_.end() && grace_period_elapsed(*it)) {
+            delete it->value_;
+            ++it;
+            ++freed;
+        }
+        retired_.erase(retired_.begin(), it);
+        return freed;
+    }
+
+    /// 阻塞等待所有旧版本的宽限期结束
+    void synchronize() noexcept {
+        while (!retired_.empty()) {
+            if (reclaim() == 0) {
+                common::pause();
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // 查询
+    // -------------------------------------------------------------------------
+
+    /// 已发布的版本数（不含初始版本）
+    [[nodiscard]] inline uint64_t version() const noexcept { return version_; }
+
+    /// 等待释放的旧版本数
+    [[nodiscard]] inline std::size_t pending() const noexcept { return retired_.size(); }
+
+    [[nodiscard]] std::size_t readers() const noexcept {
+        std::size_t n = 0;
+        for (const auto& slot : slots_) {
+            n += slot.claimed_.load(std::memory_order_relaxed) ? 1 : 0;
+        }
+        return n;
+    }
+
+private:
+    struct Retired {
+        T* value_;
+        std::array<uint64_t, kMaxReaders> counters_;
+    };
+
+    [[nodiscard]] bool grace_period_elapsed(const Retired& r) const noexcept {
+        for (std::size_t i = 0; i < kMaxReaders; ++i) {
+            const auto& slot = slots_[i];
+            if (slot.online_.load(std::memory_order_acquire) &&
+                slot.counter_.load(std::memory_order_acquire) == r.counters_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 读者热点：独占缓存行，只在发布时写入
+    alignas(memory_constants::kCacheLineSize) std::atomic<T*> current_;
+
+    std::array<detail::QuiescentSlot, kMaxReaders> slots_{};
+
+    // 写者私有
+    alignas(memory_constants::kCacheLineSize) uint64_t version_{0};
+    std::vector<Retired> retired_;
+};
+
+}  // namespace memory
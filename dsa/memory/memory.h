@@ -0,0 +1,17 @@
+/**
+ * @file memory.h
+ * @brief 内存管理库主头文件
+ * @version 1.0.0
+ *
+ * 提供热路径内存分配器与内存布局工具
+ */
+
+#pragma once
+
+#include "detail/aligned_allocator.h"
+#include "detail/arena.h"
+#include "detail/numa.h"
+#include "detail/pool.h"
+#include "detail/reclamation.h"
+#include "detail/residency.h"
+#include "detail/snapshot.h"
@@ -0,0 +1,42 @@
+/**
+ * @file test_aligned_allocator.cpp
+ * @brief AlignedAllocator 单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/aligned_allocator.h"
+
+using namespace memory;
+
+TEST(AlignedAllocator, VectorStorageIsLineAligned) {
+    constexpr std::size_t kLine = common::memory_constants::kCacheLineSize;
+    for (std::size_t n = 1; n < 5000; n = n * 3 + 1) {
+        std::vector<uint32_t, AlignedAllocator<uint32_t>> v(n, 7);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(v.data()) % kLine, 0u);
+        v.resize(n * 2 + 1);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(v.data()) % kLine, 0u);
+        EXPECT_EQ(v[0], 7u);
+    }
+    return true;
+}
+
+TEST(AlignedAllocator, CustomAlignmentAndRebind) {
+    std::vector<char, AlignedAllocator<char, 4096>> page(10);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(page.data()) % 4096, 0u);
+
+    // 节点容器经 rebind 分配节点
+    std::map<int, int, std::less<>, AlignedAllocator<std::pair<const int, int>>> m;
+    for (int i = 0; i < 100; ++i) {
+        m.emplace(i, i * i);
+    }
+    EXPECT_EQ(m.at(9), 81);
+    EXPECT_TRUE(AlignedAllocator<int>() == AlignedAllocator<double>());
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
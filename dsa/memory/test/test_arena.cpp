@@ -0,0 +1,163 @@
+/**
+ * @file test_arena.cpp
+ * @brief MonotonicArena 单调内存池单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/arena.h"
+
+using namespace memory;
+
+namespace {
+
+struct Quote {
+    uint64_t id_;
+    double price_;
+    uint32_t qty_;
+};
+
+}  // namespace
+
+TEST(MonotonicArena, ReserveRoundsUpToHugePage) {
+    MonotonicArena arena(1000);
+    EXPECT_TRUE(arena.valid());
+    EXPECT_EQ(arena.capacity(), memory_constants::kHugePageSize);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(arena.data()) % memory_constants::kHugePageSize, 0u);
+    EXPECT_TRUE(arena.backing() != PageBacking::None);
+
+    MonotonicArena small(1000, HugePagePolicy::None);
+    EXPECT_EQ(small.capacity(), memory_constants::kPageSize);
+    EXPECT_TRUE(small.backing() == PageBacking::Regular);
+    return true;
+}
+
+TEST(MonotonicArena, ExplicitFallsBack) {
+    // 未配置 hugetlbfs 时退化为透明大页/普通页，仍然可用
+    MonotonicArena arena(4 * 1024 * 1024, HugePagePolicy::Explicit);
+    EXPECT_TRUE(arena.valid());
+    auto* p = static_cast<char*>(arena.allocate(4096));
+    EXPECT_TRUE(p != nullptr);
+    std::memset(p, 0xab, 4096);
+    return true;
+}
+
+TEST(MonotonicArena, AllocateAlignment) {
+    MonotonicArena arena(64 * 1024);
+    auto* a = arena.allocate(1, 1);
+    auto* b = arena.allocate(8, 64);
+    auto* c = arena.allocate(3, 4096);
+    EXPECT_TRUE(a != nullptr && b != nullptr && c != nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(c) % 4096, 0u);
+    EXPECT_TRUE(arena.owns(a) && arena.owns(b) && arena.owns(c));
+    EXPECT_EQ(arena.used(), 4096u + 3u);
+    return true;
+}
+
+TEST(MonotonicArena, Exhaustion) {
+    MonotonicArena arena(4096, HugePagePolicy::None);
+    EXPECT_TRUE(arena.allocate(4000) != nullptr);
+    EXPECT_TRUE(arena.allocate(200) == nullptr);
+    EXPECT_TRUE(arena.allocate(static_cast<std::size_t>(-1)) == nullptr);
+    EXPECT_TRUE(arena.allocate_array<uint64_t>(static_cast<std::size_t>(-1) / 4) == nullptr);
+    EXPECT_EQ(arena.used(), 4000u);
+    EXPECT_TRUE(arena.allocate(96, 1) != nullptr);
+    EXPECT_EQ(arena.remaining(), 0u);
+    return true;
+}
+
+TEST(MonotonicArena, MarkRewindReset) {
+    MonotonicArena arena(64 * 1024);
+    auto* q = arena.make<Quote>(Quote{1, 100.5, 10});
+    EXPECT_EQ(q->id_, 1u);
+
+    auto marker = arena.mark();
+    auto* scratch = arena.allocate_array<uint32_t>(1000);
+    EXPECT_TRUE(scratch != nullptr);
+    EXPECT_EQ(arena.used(), marker.offset_ + 4000);
+
+    arena.rewind(marker);
+    EXPECT_EQ(arena.used(), marker.offset_);
+    EXPECT_EQ(arena.allocate_array<uint32_t>(1000), scratch);  // 复用同一段内存
+    EXPECT_EQ(arena.high_water_mark(), marker.offset_ + 4000);
+
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0u);
+    EXPECT_EQ(static_cast<void*>(arena.make<Quote>()), static_cast<void*>(q));
+
+    arena.release();
+    EXPECT_EQ(arena.used(), 0u);
+    EXPECT_EQ(arena.high_water_mark(), 0u);
+    return true;
+}
+
+TEST(MonotonicArena, Scope) {
+    MonotonicArena arena(64 * 1024);
+    (void)arena.allocate(128);
+    {
+        ArenaScope scope(arena);
+        (void)arena.allocate(1024);
+        EXPECT_EQ(arena.used(), 1152u);
+    }
+    EXPECT_EQ(arena.used(), 128u);
+    return true;
+}
+
+TEST(MonotonicArena, Move) {
+    MonotonicArena a(64 * 1024);
+    (void)a.allocate(100);
+    MonotonicArena b(std::move(a));
+    EXPECT_TRUE(!a.valid());
+    EXPECT_TRUE(a.allocate(1) == nullptr);
+    EXPECT_TRUE(b.valid());
+    EXPECT_EQ(b.used(), 100u);
+
+    MonotonicArena c(4096, HugePagePolicy::None);
+    c = std::move(b);
+    EXPECT_EQ(c.used(), 100u);
+    EXPECT_EQ(c.capacity(), memory_constants::kHugePageSize);
+    return true;
+}
+
+TEST(ArenaResource, PmrContainers) {
+    MonotonicArena arena(1024 * 1024);
+    ArenaResource resource(arena);
+
+    std::pmr::vector<int> v(&resource);
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_EQ(v[999], 999);
+    EXPECT_TRUE(arena.owns(v.data()));
+
+    std::pmr::string s("a string longer than the small buffer", &resource);
+    EXPECT_TRUE(arena.owns(s.data()));
+
+    ArenaResource same(arena);
+    MonotonicArena other_arena(4096, HugePagePolicy::None);
+    ArenaResource other(other_arena);
+    EXPECT_TRUE(resource.is_equal(same));
+    EXPECT_TRUE(!resource.is_equal(other));
+    return true;
+}
+
+TEST(ArenaResource, ThrowsWhenExhausted) {
+    MonotonicArena arena(4096, HugePagePolicy::None);
+    ArenaResource resource(arena);
+    bool thrown = false;
+    try {
+        (void)resource.allocate(8192);
+    } catch (const std::bad_alloc&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
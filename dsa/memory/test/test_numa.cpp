@@ -0,0 +1,104 @@
+/**
+ * @file test_numa.cpp
+ * @brief NUMA 内存放置单元测试
+ * @version 1.0.0
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include "../../test/test.h"
+#include "../detail/arena.h"
+#include "../detail/numa.h"
+
+using namespace memory;
+
+TEST(NodeMask, Bits) {
+    constexpr NodeMask mask = NodeMask::single(3);
+    CHECK_COMPILE_TIME(mask.contains(3));
+    CHECK_COMPILE_TIME(!mask.contains(2));
+    CHECK_COMPILE_TIME(NodeMask::single(-1).empty());
+
+    NodeMask m;
+    m.add(0);
+    m.add(5);
+    EXPECT_EQ(m.count(), 2);
+    EXPECT_TRUE(m.contains(5));
+
+    auto all = NodeMask::all();
+    EXPECT_EQ(static_cast<uint32_t>(all.count()), Numa::num_nodes());
+    EXPECT_TRUE(all.contains(0));
+    return true;
+}
+
+TEST(Numa, CurrentNode) {
+    const int node = Numa::current_node();
+    EXPECT_TRUE(node >= 0);
+    EXPECT_TRUE(static_cast<uint32_t>(node) < Numa::num_nodes());
+    EXPECT_EQ(Numa::node_of_cpu(Numa::current_cpu()), node);
+    EXPECT_EQ(Numa::resolve(numa_constants::kLocalNode), node);
+    return true;
+}
+
+TEST(Numa, PinToNode) {
+    EXPECT_TRUE(Numa::pin_to_node(0));
+    EXPECT_EQ(Numa::current_node(), 0);
+    EXPECT_TRUE(!Numa::pin_to_node(-1));
+    EXPECT_TRUE(!Numa::pin_to_node(static_cast<int>(numa_constants::kMaxNumaNodes) + 1));
+    (void)utils::CpuAffinity::reset_affinity();
+    return true;
+}
+
+TEST(NumaRegion, OnNode) {
+    auto region = NumaRegion::on_node(4 * 1024 * 1024, 0);
+    EXPECT_TRUE(region.valid());
+    EXPECT_EQ(region.node(), 0);
+    EXPECT_TRUE(region.size() >= 4u * 1024 * 1024);
+
+    // 内核开启 NUMA 策略时，预缺页后页面应位于节点 0
+    if (region.bound()) {
+        EXPECT_EQ(Numa::node_of_address(region.data()), 0);
+        EXPECT_EQ(Numa::node_of_address(region.as<char>() + region.size() - 1), 0);
+    }
+
+    std::memset(region.data(), 0x5a, region.size());
+    EXPECT_EQ(region.as<unsigned char>()[12345], 0x5a);
+
+    NumaRegion moved = std::move(region);
+    EXPECT_TRUE(!region.valid());
+    EXPECT_TRUE(moved.valid());
+    return true;
+}
+
+TEST(NumaRegion, Interleaved) {
+    auto region = NumaRegion::interleaved(2 * 1024 * 1024);
+    EXPECT_TRUE(region.valid());
+    EXPECT_EQ(region.node(), numa_constants::kLocalNode);
+    if (region.bound()) {
+        const int node = Numa::node_of_address(region.data());
+        EXPECT_TRUE(NodeMask::all().contains(node));
+    }
+    return true;
+}
+
+TEST(Numa, BindArena) {
+    MonotonicArena arena(2 * 1024 * 1024);
+    const bool bound = Numa::bind(arena.data(), arena.capacity(), numa_constants::kLocalNode);
+    auto* p = static_cast<char*>(arena.allocate(4096));
+    Numa::prefault_on_node(p, 4096);
+    if (bound) {
+        EXPECT_EQ(Numa::node_of_address(p), Numa::current_node());
+    }
+
+    EXPECT_TRUE(!Numa::bind(nullptr, 4096));
+    EXPECT_TRUE(!Numa::interleave(p, 4096, NodeMask{}));
+    return true;
+}
+
+TEST(Numa, ThreadPolicy) {
+    EXPECT_TRUE(Numa::set_thread_policy(NumaPolicy::Preferred, NodeMask::single(0)));
+    EXPECT_TRUE(Numa::set_thread_policy(NumaPolicy::Default));
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
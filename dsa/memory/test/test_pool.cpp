@@ -0,0 +1,236 @@
+/**
+ * @file test_pool.cpp
+ * @brief FixedPool / Pool<T> 定长对象池单元测试
+ * @version 1.0.0
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/pool.h"
+
+using namespace memory;
+
+namespace {
+
+struct Order {
+    static inline int live_ = 0;
+
+    uint64_t id_;
+    double price_;
+
+    Order(uint64_t id, double price) : id_(id), price_(price) { ++live_; }
+    ~Order() { --live_; }
+};
+
+struct Throwing {
+    explicit Throwing(bool fail) {
+        if (fail) {
+            throw std::runtime_error("ctor");
+        }
+    }
+};
+
+}  // namespace
+
+TEST(FixedPool, BlockGeometry) {
+    FixedPool tiny(1);
+    EXPECT_EQ(tiny.block_size(), alignof(std::max_align_t));
+
+    FixedPool lines(40, memory_constants::kCacheLineSize);
+    EXPECT_EQ(lines.block_size(), memory_constants::kCacheLineSize);
+    EXPECT_EQ(lines.alignment(), memory_constants::kCacheLineSize);
+    EXPECT_TRUE(lines.blocks_per_slab() > 30000);
+
+    for (int i = 0; i < 100; ++i) {
+        auto addr = reinterpret_cast<std::uintptr_t>(lines.allocate());
+        EXPECT_EQ(addr % memory_constants::kCacheLineSize, 0u);
+    }
+    return true;
+}
+
+TEST(FixedPool, ReuseLifo) {
+    FixedPool pool(24);
+    void* a = pool.allocate();
+    void* b = pool.allocate();
+    EXPECT_TRUE(a != nullptr && b != nullptr && a != b);
+    EXPECT_TRUE(pool.owns(a) && pool.owns(b));
+
+    pool.deallocate(a);
+    EXPECT_EQ(pool.allocate(), a);
+    pool.deallocate(b);
+    pool.deallocate(a);
+    EXPECT_EQ(pool.allocate(), a);
+    EXPECT_EQ(pool.allocate(), b);
+    pool.deallocate(nullptr);
+    EXPECT_EQ(pool.slab_count(), 1u);
+    return true;
+}
+
+TEST(FixedPool, GrowsAcrossSlabs) {
+    FixedPool pool(4096);
+    const std::size_t n = pool.blocks_per_slab() * 2 + 1;
+    std::set<void*> seen;
+    std::vector<void*> blocks;
+    for (std::size_t i = 0; i < n; ++i) {
+        void* p = pool.allocate();
+        EXPECT_TRUE(p != nullptr);
+        seen.insert(p);
+        blocks.push_back(p);
+    }
+    EXPECT_EQ(seen.size(), n);
+    EXPECT_EQ(pool.slab_count(), 3u);
+
+    for (void* p : blocks) {
+        pool.deallocate(p);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_TRUE(seen.contains(pool.allocate()));
+    }
+    EXPECT_EQ(pool.slab_count(), 3u);
+    return true;
+}
+
+TEST(FixedPool, OversizedBlock) {
+    FixedPool pool(FixedPool::kMaxBlockSize + 1);
+    EXPECT_EQ(pool.blocks_per_slab(), 0u);
+    EXPECT_TRUE(pool.allocate() == nullptr);
+    return true;
+}
+
+TEST(FixedPool, RemoteFree) {
+    FixedPool pool(64);
+    constexpr std::size_t kCount = 10000;
+
+    std::vector<void*> blocks;
+    for (std::size_t i = 0; i < kCount; ++i) {
+        blocks.push_back(pool.allocate());
+    }
+    const std::set<void*> original(blocks.begin(), blocks.end());
+
+    // 其他线程释放 → 进入本线程的远程链表
+    std::thread consumer([&] {
+        for (void* p : blocks) {
+            pool.deallocate(p);
+        }
+    });
+    consumer.join();
+
+    // 本线程重新分配时取回远程链表，不新增 slab
+    for (std::size_t i = 0; i < kCount; ++i) {
+        EXPECT_TRUE(original.contains(pool.allocate()));
+    }
+    EXPECT_EQ(pool.slab_count(), 1u);
+    return true;
+}
+
+TEST(FixedPool, ProducerConsumer) {
+    FixedPool pool(32);
+    constexpr std::size_t kCount = 200000;
+    constexpr std::size_t kRing = 1024;
+
+    std::vector<std::atomic<void*>> ring(kRing);
+    std::atomic<bool> ok{true};
+
+    std::thread consumer([&] {
+        for (std::size_t i = 0; i < kCount; ++i) {
+            auto& slot = ring[i % kRing];
+            void* p;
+            while ((p = slot.exchange(nullptr, std::memory_order_acquire)) == nullptr) {
+                std::this_thread::yield();
+            }
+            if (*static_cast<uint64_t*>(p) != i) {
+                ok = false;
+            }
+            pool.deallocate(p);
+        }
+    });
+
+    for (std::size_t i = 0; i < kCount; ++i) {
+        auto* p = static_cast<uint64_t*>(pool.allocate());
+        *p = i;
+        auto& slot = ring[i % kRing];
+        while (slot.load(std::memory_order_acquire) != nullptr) {
+            std::this_thread::yield();
+        }
+        slot.store(p, std::memory_order_release);
+    }
+    consumer.join();
+
+    EXPECT_TRUE(ok.load());
+    // 远程释放持续回流，内存不随分配总数增长
+    EXPECT_EQ(pool.slab_count(), 1u);
+    return true;
+}
+
+TEST(FixedPool, ThreadExitCacheAdopted) {
+    FixedPool pool(128);
+    void* from_worker = nullptr;
+    std::thread worker([&] {
+        from_worker = pool.allocate();
+        pool.deallocate(from_worker);
+    });
+    worker.join();
+
+    // 新线程接管遗弃缓存，拿到同一块
+    void* adopted = nullptr;
+    std::thread next([&] { adopted = pool.allocate(); });
+    next.join();
+    EXPECT_EQ(adopted, from_worker);
+    EXPECT_EQ(pool.slab_count(), 1u);
+    return true;
+}
+
+TEST(FixedPool, HugePageSlabs) {
+    FixedPool pool(256, 64, HugePagePolicy::Transparent);
+    void* p = pool.allocate();
+    EXPECT_TRUE(p != nullptr);
+    std::memset(p, 0x11, 256);
+    pool.deallocate(p);
+    return true;
+}
+
+TEST(Pool, MakeDestroy) {
+    Pool<Order> pool;
+    Order* o = pool.make(42u, 99.5);
+    EXPECT_EQ(o->id_, 42u);
+    EXPECT_EQ(o->price_, 99.5);
+    EXPECT_EQ(Order::live_, 1);
+
+    pool.destroy(o);
+    EXPECT_EQ(Order::live_, 0);
+    EXPECT_EQ(static_cast<void*>(pool.make(1u, 1.0)), static_cast<void*>(o));
+
+    {
+        auto owned = pool.make_unique(7u, 7.0);
+        EXPECT_EQ(owned->id_, 7u);
+        EXPECT_EQ(Order::live_, 2);
+    }
+    EXPECT_EQ(Order::live_, 1);
+    return true;
+}
+
+TEST(Pool, ConstructorThrows) {
+    Pool<Throwing> pool;
+    Throwing* first = pool.make(false);
+    pool.destroy(first);
+
+    bool thrown = false;
+    try {
+        (void)pool.make(true);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+    // 失败的构造归还了内存
+    EXPECT_EQ(pool.make(false), first);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
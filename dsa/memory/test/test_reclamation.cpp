@@ -0,0 +1,253 @@
+/**
+ * @file test_reclamation.cpp
+ * @brief EpochDomain / HazardDomain 单元测试
+ * @version 1.0.0
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/reclamation.h"
+
+using namespace memory;
+
+namespace {
+
+std::atomic<int> g_live{0};
+
+struct Node {
+    static constexpr uint64_t kMagic = 0x5eed'cafe'f00d'beefULL;
+
+    uint64_t magic_{kMagic};
+    uint64_t value_{0};
+
+    explicit Node(uint64_t value = 0) : value_(value) { g_live.fetch_add(1, std::memory_order_relaxed); }
+    ~Node() {
+        magic_ = 0;
+        g_live.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+
+/// 写者不断替换共享节点并退休旧节点，读者校验节点未被释放
+template <typename ReadFn, typename RetireFn>
+bool stress(ReadFn read, RetireFn retire, std::atomic<Node*>& shared) {
+    constexpr int kReaders = 3;
+    constexpr uint64_t kUpdates = 20000;
+
+    std::atomic<bool> stop{false};
+    std::atomic<bool> corrupted{false};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < kReaders; ++i) {
+        readers.emplace_back([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (!read(shared)) {
+                    corrupted.store(true, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    for (uint64_t i = 1; i <= kUpdates; ++i) {
+        retire(shared.exchange(new Node(i), std::memory_order_acq_rel));
+    }
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& t : readers) {
+        t.join();
+    }
+    return !corrupted.load();
+}
+
+}  // namespace
+
+// =============================================================================
+// EpochDomain
+// =============================================================================
+
+TEST(EpochDomain, RetireWithoutReaders) {
+    g_live = 0;
+    EpochDomain domain;
+    domain.retire(new Node(1));
+    domain.retire(new Node(2));
+    EXPECT_EQ(domain.pending(), 2);
+
+    (void)domain.synchronize();
+    EXPECT_EQ(domain.pending(), 0);
+    EXPECT_EQ(g_live.load(), 0);
+    return true;
+}
+
+TEST(EpochDomain, PinnedReaderBlocksReclamation) {
+    g_live = 0;
+    EpochDomain domain;
+    {
+        auto guard = domain.pin();
+        domain.retire(new Node(1));
+        (void)domain.synchronize();
+        // 本线程仍在临界区：纪元最多前进一次，对象不可释放
+        EXPECT_EQ(g_live.load(), 1);
+    }
+    (void)domain.synchronize();
+    EXPECT_EQ(g_live.load(), 0);
+    return true;
+}
+
+TEST(EpochDomain, NestedGuards) {
+    g_live = 0;
+    EpochDomain domain;
+    {
+        auto outer = domain.pin();
+        {
+            auto inner = domain.pin();
+        }
+        domain.retire(new Node(1));
+        (void)domain.synchronize();
+        EXPECT_EQ(g_live.load(), 1);
+    }
+    (void)domain.synchronize();
+    EXPECT_EQ(g_live.load(), 0);
+    return true;
+}
+
+TEST(EpochDomain, BatchedReclamation) {
+    g_live = 0;
+    EpochDomain domain;
+    const std::size_t total = EpochDomain::kRetireBatch * 8;
+    for (std::size_t i = 0; i < total; ++i) {
+        domain.retire(new Node(i));
+    }
+    // 达到批量阈值时自动推进并回收
+    EXPECT_TRUE(domain.pending() < total);
+    EXPECT_TRUE(domain.epoch() > 1);
+    (void)domain.synchronize();
+    EXPECT_EQ(g_live.load(), 0);
+    return true;
+}
+
+TEST(EpochDomain, ThreadExitHandsOffRetired) {
+    g_live = 0;
+    EpochDomain domain;
+    std::thread worker([&] {
+        auto guard = domain.pin();
+        domain.retire(new Node(1));
+    });
+    worker.join();
+    EXPECT_EQ(domain.thread_records(), 1);
+
+    // 记录被新线程复用
+    std::thread again([&] { auto guard = domain.pin(); });
+    again.join();
+    EXPECT_EQ(domain.thread_records(), 1);
+
+    (void)domain.synchronize();
+    EXPECT_EQ(g_live.load(), 0);
+    return true;
+}
+
+TEST(EpochDomain, DestructorFreesPending) {
+    g_live = 0;
+    {
+        EpochDomain domain;
+        auto guard = domain.pin();
+        domain.retire(new Node(1));
+        EXPECT_EQ(g_live.load(), 1);
+    }
+    EXPECT_EQ(g_live.load(), 0);
+    return true;
+}
+
+TEST(EpochDomain, ConcurrentReaders) {
+    g_live = 0;
+    EpochDomain domain;
+    std::atomic<Node*> shared{new Node(0)};
+
+    const bool ok = stress(
+        [&](std::atomic<Node*>& src) {
+            auto guard = domain.pin();
+            const Node* n = src.load(std::memory_order_acquire);
+            return n->magic_ == Node::kMagic;
+        },
+        [&](Node* old) { domain.retire(old); }, shared);
+    EXPECT_TRUE(ok);
+
+    delete shared.load();
+    (void)domain.synchronize();
+    EXPECT_EQ(g_live.load(), 0);
+    return true;
+}
+
+// =============================================================================
+// HazardDomain
+// =============================================================================
+
+TEST(HazardDomain, ProtectedObjectSurvivesScan) {
+    g_live = 0;
+    HazardDomain domain;
+    std::atomic<Node*> shared{new Node(7)};
+
+    auto hp = domain.make_hazard();
+    EXPECT_TRUE(hp.valid());
+    Node* n = hp.protect(shared);
+    EXPECT_EQ(n->value_, 7);
+
+    domain.retire(shared.exchange(nullptr));
+    (void)domain.scan();
+    EXPECT_EQ(g_live.load(), 1);
+    EXPECT_EQ(n->magic_, Node::kMagic);
+
+    hp.reset();
+    EXPECT_EQ(domain.scan(), 1);
+    EXPECT_EQ(g_live.load(), 0);
+    return true;
+}
+
+TEST(HazardDomain, SlotExhaustion) {
+    HazardDomain domain;
+    std::vector<HazardDomain::HazardPointer> hps;
+    for (std::size_t i = 0; i < HazardDomain::kHazardsPerThread; ++i) {
+        hps.push_back(domain.make_hazard());
+        EXPECT_TRUE(hps.back().valid());
+    }
+    EXPECT_TRUE(!domain.make_hazard().valid());
+
+    // 释放后可再次获取
+    hps.pop_back();
+    EXPECT_TRUE(domain.make_hazard().valid());
+    return true;
+}
+
+TEST(HazardDomain, BoundedGarbage) {
+    g_live = 0;
+    HazardDomain domain;
+    const std::size_t total = domain.threshold() * 10;
+    for (std::size_t i = 0; i < total; ++i) {
+        domain.retire(new Node(i));
+        EXPECT_TRUE(domain.pending() <= domain.threshold());
+    }
+    (void)domain.scan();
+    EXPECT_EQ(g_live.load(), 0);
+    return true;
+}
+
+TEST(HazardDomain, ConcurrentReaders) {
+    g_live = 0;
+    HazardDomain domain;
+    std::atomic<Node*> shared{new Node(0)};
+
+    const bool ok = stress(
+        [&](std::atomic<Node*>& src) {
+            auto hp = domain.make_hazard();
+            const Node* n = hp.protect(src);
+            return n->magic_ == Node::kMagic;
+        },
+        [&](Node* old) { domain.retire(old); }, shared);
+    EXPECT_TRUE(ok);
+
+    delete shared.load();
+    (void)domain.scan();
+    EXPECT_EQ(g_live.load(), 0);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
@@ -0,0 +1,125 @@
+/**
+ * @file test_residency.cpp
+ * @brief 内存驻留工具单元测试
+ * @version 1.0.0
+ */
+
+#include <sys/mman.h>
+
+#include <thread>
+
+#include "../../test/test.h"
+#include "../detail/arena.h"
+#include "../detail/residency.h"
+
+using namespace memory;
+
+namespace {
+
+constexpr std::size_t kRegion = 8 * 1024 * 1024;
+
+char* map_fresh(std::size_t bytes) {
+    void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return p == MAP_FAILED ? nullptr : static_cast<char*>(p);
+}
+
+/// 每页写一次，返回期间本线程的缺页数
+long write_all_pages(char* p, std::size_t bytes) {
+    FaultProbe probe(true);
+    for (std::size_t off = 0; off < bytes; off += memory_constants::kPageSize) {
+        p[off] = 1;
+    }
+    return probe.delta().total();
+}
+
+}  // namespace
+
+TEST(Residency, FaultCountsMonotonic) {
+    auto a = Residency::fault_counts();
+    char* p = map_fresh(kRegion);
+    (void)write_all_pages(p, kRegion);
+    auto b = Residency::fault_counts();
+    EXPECT_TRUE(b.minor_ >= a.minor_);
+    EXPECT_TRUE((b - a).total() > 0);
+    ::munmap(p, kRegion);
+    return true;
+}
+
+TEST(Residency, FirstTouchFaults) {
+    char* p = map_fresh(kRegion);
+    EXPECT_TRUE(write_all_pages(p, kRegion) > 0);
+    // 第二次触及已常驻，无缺页
+    EXPECT_EQ(write_all_pages(p, kRegion), 0);
+    ::munmap(p, kRegion);
+    return true;
+}
+
+TEST(Residency, PopulateWrite) {
+    char* p = map_fresh(kRegion);
+    (void)Residency::populate(p, kRegion);
+    EXPECT_EQ(write_all_pages(p, kRegion), 0);
+    ::munmap(p, kRegion);
+    return true;
+}
+
+TEST(Residency, PrefaultWritePreservesContent) {
+    char* p = map_fresh(kRegion);
+    p[0] = 'a';
+    p[kRegion - 1] = 'z';
+    Residency::prefault_write(p, kRegion);
+    EXPECT_EQ(p[0], 'a');
+    EXPECT_EQ(p[kRegion - 1], 'z');
+    EXPECT_EQ(write_all_pages(p, kRegion), 0);
+    ::munmap(p, kRegion);
+    return true;
+}
+
+TEST(Residency, PopulateRejectsEmpty) {
+    EXPECT_TRUE(!Residency::populate(nullptr, 4096));
+    char* p = map_fresh(4096);
+    EXPECT_TRUE(!Residency::populate(p, 0));
+    ::munmap(p, 4096);
+    return true;
+}
+
+TEST(Residency, Lock) {
+    char* p = map_fresh(kRegion);
+    p[0] = 'x';
+    // 受 RLIMIT_MEMLOCK 限制可能失败；成功后内容不变且可解锁
+    if (Residency::lock(p, kRegion)) {
+        EXPECT_EQ(p[0], 'x');
+        EXPECT_TRUE(Residency::unlock(p, kRegion));
+    }
+    ::munmap(p, kRegion);
+    return true;
+}
+
+TEST(Residency, StackPrefault) {
+    EXPECT_TRUE(Residency::stack_size() > Residency::kStackSafetyMargin);
+    EXPECT_EQ(Residency::prefault_stack(), Residency::kDefaultStackPrefault);
+
+    std::size_t touched = 0;
+    std::thread worker([&] { touched = Residency::prefault_stack(1ULL << 40); });
+    worker.join();
+    // 受线程栈大小限制
+    EXPECT_TRUE(touched > 0);
+    EXPECT_TRUE(touched < (1ULL << 40));
+    return true;
+}
+
+TEST(MonotonicArena, PrefaultReducesFaults) {
+    MonotonicArena cold(kRegion, HugePagePolicy::None);
+    MonotonicArena warm(kRegion, HugePagePolicy::None);
+    warm.prefault();
+
+    auto* c = static_cast<char*>(cold.allocate(kRegion, 1));
+    auto* w = static_cast<char*>(warm.allocate(kRegion, 1));
+    EXPECT_TRUE(c != nullptr && w != nullptr);
+    // 插桩构建（ASan 影子内存）下预缺页区间仍可能计入少量缺页，只比较相对值
+    const long cold_faults = write_all_pages(c, kRegion);
+    const long warm_faults = write_all_pages(w, kRegion);
+    EXPECT_TRUE(warm_faults * 4 < cold_faults);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
@@ -0,0 +1,170 @@
+/**
+ * @file test_snapshot.cpp
+ * @brief SnapshotPublisher 单元测试
+ * @version 1.0.0
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../../test/test.h"
+#include "../detail/snapshot.h"
+
+using namespace memory;
+
+namespace {
+
+std::atomic<int> g_live{0};
+
+struct Limits {
+    static constexpr uint64_t kMagic = 0x11a1'75ca'fe00'0001ULL;
+
+    uint64_t magic_{kMagic};
+    uint64_t max_qty_{0};
+
+    explicit Limits(uint64_t max_qty = 0) : max_qty_(max_qty) {
+        g_live.fetch_add(1, std::memory_order_relaxed);
+    }
+    ~Limits() {
+        magic_ = 0;
+        g_live.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+
+}  // namespace
+
+TEST(SnapshotPublisher, PublishAndRead) {
+    g_live = 0;
+    SnapshotPublisher<Limits> limits(std::make_unique<Limits>(100));
+    auto reader = limits.register_reader();
+    EXPECT_TRUE(reader.valid());
+    EXPECT_EQ(reader.get()->max_qty_, 100);
+    EXPECT_EQ(limits.version(), 0);
+
+    limits.emplace(200);
+    EXPECT_EQ(reader.get()->max_qty_, 200);
+    EXPECT_EQ(limits.load()->max_qty_, 200);
+    EXPECT_EQ(limits.version(), 1);
+    return true;
+}
+
+TEST(SnapshotPublisher, GracePeriodWaitsForOnlineReader) {
+    g_live = 0;
+    SnapshotPublisher<Limits> limits(std::make_unique<Limits>(1));
+    auto reader = limits.register_reader();
+
+    const Limits* held = reader.get();
+    limits.emplace(2);
+    // 读者尚未声明静止：旧版本不可释放
+    EXPECT_EQ(limits.pending(), 1);
+    EXPECT_EQ(limits.reclaim(), 0);
+    EXPECT_EQ(held->magic_, Limits::kMagic);
+    EXPECT_EQ(g_live.load(), 2);
+
+    reader.quiescent();
+    EXPECT_EQ(limits.reclaim(), 1);
+    EXPECT_EQ(limits.pending(), 0);
+    EXPECT_EQ(g_live.load(), 1);
+    return true;
+}
+
+TEST(SnapshotPublisher, OfflineReaderDoesNotBlock) {
+    g_live = 0;
+    SnapshotPublisher<Limits> limits(std::make_unique<Limits>(1));
+    auto reader = limits.register_reader();
+    reader.offline();
+
+    limits.emplace(2);
+    EXPECT_EQ(limits.pending(), 0);
+
+    reader.online();
+    EXPECT_EQ(reader.get()->max_qty_, 2);
+    limits.emplace(3);
+    EXPECT_EQ(limits.pending(), 1);
+    reader.quiescent();
+    limits.synchronize();
+    EXPECT_EQ(g_live.load(), 1);
+    return true;
+}
+
+TEST(SnapshotPublisher, ReaderRegistration) {
+    SnapshotPublisher<Limits> limits(std::make_unique<Limits>());
+    {
+        std::vector<SnapshotPublisher<Limits>::Reader> readers;
+        for (std::size_t i = 0; i < SnapshotPublisher<Limits>::kMaxReaders; ++i) {
+            readers.push_back(limits.register_reader());
+            EXPECT_TRUE(readers.back().valid());
+        }
+        EXPECT_TRUE(!limits.register_reader().valid());
+        EXPECT_EQ(limits.readers(), SnapshotPublisher<Limits>::kMaxReaders);
+    }
+    // 析构后注销，不再阻塞宽限期
+    EXPECT_EQ(limits.readers(), 0);
+    limits.emplace(1);
+    EXPECT_EQ(limits.pending(), 0);
+    return true;
+}
+
+TEST(SnapshotPublisher, DestructorFreesAllVersions) {
+    g_live = 0;
+    {
+        SnapshotPublisher<Limits> limits(std::make_unique<Limits>(1));
+        auto reader = limits.register_reader();
+        (void)reader.get();
+        limits.emplace(2);
+        limits.emplace(3);
+        EXPECT_EQ(g_live.load(), 3);
+        reader.offline();
+    }
+    EXPECT_EQ(g_live.load(), 0);
+    return true;
+}
+
+TEST(SnapshotPublisher, ConcurrentReaders) {
+    g_live = 0;
+    constexpr int kReaders = 4;
+    constexpr uint64_t kUpdates = 5000;
+
+    SnapshotPublisher<Limits> limits(std::make_unique<Limits>(0));
+    std::atomic<bool> stop{false};
+    std::atomic<bool> corrupted{false};
+    std::atomic<int> ready{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < kReaders; ++i) {
+        readers.emplace_back([&] {
+            auto reader = limits.register_reader();
+            ready.fetch_add(1);
+            uint64_t last = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                const Limits* l = reader.get();
+                // 版本单调且对象有效
+                if (l->magic_ != Limits::kMagic || l->max_qty_ < last) {
+                    corrupted.store(true, std::memory_order_relaxed);
+                }
+                last = l->max_qty_;
+                reader.quiescent();
+            }
+        });
+    }
+    while (ready.load() < kReaders) {
+        std::this_thread::yield();
+    }
+
+    for (uint64_t i = 1; i <= kUpdates; ++i) {
+        limits.emplace(i);
+    }
+    stop.store(true);
+    for (auto& t : readers) {
+        t.join();
+    }
+    limits.synchronize();
+
+    EXPECT_TRUE(!corrupted.load());
+    EXPECT_EQ(limits.pending(), 0);
+    EXPECT_EQ(g_live.load(), 1);
+    return true;
+}
+
+int main() { return testing::run_all_tests(); }
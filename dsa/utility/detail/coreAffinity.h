@@ -15,6 +15,8 @@
 #include <sched.h>
 #include <unistd.h>
 
+#include <array>
+#include <bit>
 #include <cstdint>
 #include <cstring>
 #include <optional>
@@ -64,21 +66,19 @@ public:
 
     void clear() noexcept { CPU_ZERO(&cpuset_); }
 
-    [[nodiscard]] std::size_t count() const noexcept {
-        std::size_t cnt = 0;
-        for (std::size_t i = 0; i < CPU_SETSIZE; ++i) {
-            if (CPU_ISSET(i, &cpuset_)) {
-                ++cnt;
-            }
-        }
-        return cnt;
-    }
+    /// 按字 popcount（CPU_COUNT），不逐位检查 CPU_SETSIZE 个位
+    [[nodiscard]] std::size_t count() const noexcept { return static_cast<std::size_t>(CPU_COUNT(&cpuset_)); }
 
+    /// 按 64 位字取最低置位（tzcnt）枚举，跳过全零字
     [[nodiscard]] std::vector<std::size_t> get_cpus() const {
+        std::array<uint64_t, sizeof(cpu_set_t) / sizeof(uint64_t)> words;
+        std::memcpy(words.data(), &cpuset_, sizeof(words));
+
         std::vector<std::size_t> cpus;
-        for (std::size_t i = 0; i < CPU_SETSIZE; ++i) {
-            if (contains(i)) {
-                cpus.push_back(i);
+        cpus.reserve(count());
+        for (std::size_t w = 0; w < words.size(); ++w) {
+            for (uint64_t bits = words[w]; bits != 0; bits &= bits - 1) {
+                cpus.push_back(w * 64 + static_cast<std::size_t>(std::countr_zero(bits)));
             }
         }
         return cpus;
@@ -337,6 +337,20 @@ public:
     [[nodiscard]] inline const std::vector<std::set<int32_t>>& get_cpulists() const noexcept {
         return numa_cpus_;
     }
+    /// 物理核心列表：每项为共享同一物理核心的逻辑 CPU（超线程兄弟），按首个 CPU 排序
+    [[nodiscard]] inline const std::vector<std::set<int32_t>>& get_physical_cores() const noexcept {
+        return physical_cores_;
+    }
+    /// 逻辑 CPU 所属 NUMA 节点：在每节点 cpulist 中查找，未知时返回 0
+    [[nodiscard]] static inline size_t node_of_cpu(const std::vector<std::set<int32_t>>& cpulists,
+                                                   int32_t cpu) noexcept {
+        for (size_t node = 0; node < cpulists.size(); ++node) {
+            if (cpulists[node].contains(cpu)) {
+                return node;
+            }
+        }
+        return 0;
+    }
 
     [[nodiscard]] static inline bool is_virtualized_env() noexcept {
         return (common::cpuid(0x01).ecx & (1U << 31)) != 0;
@@ -420,6 +434,7 @@ private:
         }
 
         detect_hyper_thread();
+        detect_physical_cores();
     }
 
     void detect_cache() {
@@ -474,6 +489,17 @@ private:
         }
     }
 
+    void detect_physical_cores() {
+        std::set<std::set<int32_t>> cores;
+        for (int32_t cpu : online_cpus_) {
+            auto path = fs::path("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                                 "/topology/thread_siblings_list");
+            auto siblings = parse_cpu_list_file(path);
+            cores.insert(siblings ? std::move(*siblings) : std::set<int32_t>{cpu});
+        }
+        physical_cores_.assign(cores.begin(), cores.end());
+    }
+
     void analyze_vendor() {
         const auto id = common::cpuid(0);
         max_basic_leaf_ = id.eax;
@@ -560,7 +586,7 @@ private:
                 continue;
             }
 
-            if (auto range_opt = parse_cpu_range(range_view);) {
+            if (auto range_opt = parse_cpu_range(range_view)) {
                 auto [start, end] = *range_opt;
                 for (auto i = start; i <= end; ++i) {
                     result.insert(i);
@@ -622,6 +648,7 @@ private:
     std::set<int32_t> isolated_cpus_;
     std::set<int32_t> online_cpus_;
     std::vector<std::set<int32_t>> numa_cpus_;
+    std::vector<std::set<int32_t>> physical_cores_;
 
     const CacheInfo empty_cache_{CacheType::UNKNOWN, 0, 0, 0, 0};
     const std::set<int32_t> empty_set_{};
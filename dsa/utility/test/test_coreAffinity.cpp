@@ -5,6 +5,7 @@
  */
 
 #include <thread>
+#include <vector>
 
 #include "../../test/test.h"
 #include "../utility.h"
@@ -66,6 +67,20 @@ TEST(CpuSet, GetCpus) {
     return true;
 }
 
+TEST(CpuSet, CountAndGetCpusAcrossWords) {
+    CpuSet set;
+    const std::vector<std::size_t> expected{0, 63, 64, 129, CPU_SETSIZE - 1};
+    for (auto cpu : expected) {
+        set.add_cpu(cpu);
+    }
+    EXPECT_EQ(set.count(), expected.size());
+    EXPECT_TRUE(set.get_cpus() == expected);
+    set.remove_cpu(64);
+    EXPECT_EQ(set.count(), expected.size() - 1);
+    EXPECT_EQ(set.get_cpus()[2], static_cast<std::size_t>(129));
+    return true;
+}
+
 TEST(CpuSet, OutOfRange) {
     CpuSet set;
     EXPECT_FALSE(set.add_cpu(CPU_SETSIZE));
@@ -92,6 +92,20 @@ TEST(CoreDetector, OnlineCpus) {
     return true;
 }
 
+TEST(CoreDetector, PhysicalCores) {
+    auto& det = CoreDetector::instance();
+    const auto& cores = det.get_physical_cores();
+    EXPECT_GT(cores.size(), static_cast<size_t>(0));
+
+    // 每个在线 CPU 恰好属于一个物理核心
+    std::size_t total = 0;
+    for (const auto& core : cores) {
+        total += core.size();
+    }
+    EXPECT_EQ(total, det.get_online_cpus().size());
+    return true;
+}
+
 TEST(CoreDetector, VirtualizationDetection) {
     // 只要不崩溃就 OK
     bool is_virt = CoreDetector::is_virtualized_env();